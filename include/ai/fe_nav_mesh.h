@@ -9,6 +9,8 @@
 // Sabitler
 #define FE_NAV_MESH_MAX_VERTICES_PER_POLYGON 8 // Bir poligonun maksimum köşe sayısı (genellikle 3 veya 4)
 #define FE_NAV_MESH_EPSILON 0.01f              // Yüzen nokta karşılaştırmaları için tolerans
+#define FE_NAV_MESH_FILE_MAGIC   0x4D4E4546u     // "FENM"
+#define FE_NAV_MESH_FILE_VERSION 1u
 
 // --- NavMesh Veri Yapıları ---
 
@@ -99,6 +101,21 @@ uint32_t fe_nav_mesh_add_polygon(fe_nav_mesh_t* nav_mesh, const fe_nav_mesh_poly
  */
 bool fe_nav_mesh_build_connections(fe_nav_mesh_t* nav_mesh);
 
+/**
+ * @brief NavMesh'i ikili bir dosyadan yükler ve bağlantılarını kurar. Dosya belleğe eşlenir
+ * (fe_file_cache) ve doğrudan eşlenmiş bellekten ayrıştırılır; ara tampon kullanılmaz.
+ *
+ * Dosya düzeni (küçük uçlu):
+ *   u32 sihirli sayı (FE_NAV_MESH_FILE_MAGIC) | u32 sürüm | u32 köşe sayısı | u32 poli_gon sayısı
+ *   köşe sayısı x (f32 x, f32 y, f32 z)
+ *   poli_gon sayısı x (u32 köşe sayısı, köşe sayısı x u32 köşe indeksi)
+ *
+ * @param nav_mesh Başlatılmamış NavMesh yapısının işaretçisi (fe_nav_mesh_init bu fonksiyonda çağrılır).
+ * @param file_path NavMesh dosyasının yolu.
+ * @return bool Başarılı ise true, aksi takdirde false (nav_mesh başlatılmamış kalır).
+ */
+bool fe_nav_mesh_load_from_file(fe_nav_mesh_t* nav_mesh, const char* file_path);
+
 /**
  * @brief Belirli bir noktanın hangi NavMesh poli_gonunun içinde olduğunu bulur.
  * @param nav_mesh NavMesh yapısının işaretçisi.
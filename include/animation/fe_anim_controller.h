@@ -2,7 +2,8 @@
 #define FE_ANIM_CONTROLLER_H
 
 #include "core/utils/fe_types.h"
-#include "core/containers/fe_hash_map.h"
+#include "core/containers/fe_hash_map.g.h"
+#include "core/containers/fe_string_intern.h" // Klip ve kemik adı tanıtıcıları için
 #include "animation/fe_skeleton_animation.h" // fe_skeleton_t, fe_animation_clip_t, fe_animation_state_t için
 
 // --- Animasyon Kontrolcüsü Hata Kodları ---
@@ -42,6 +43,7 @@ typedef struct fe_anim_layer {
     float weight;                          // Bu katmanın karıştırma ağırlığı (0.0 - 1.0)
     fe_anim_blend_mode_t blend_mode;       // Karıştırma modu
     fe_string_t affected_bone_root;        // Eğer katman sadece bir kemik hiyerarşisini etkiliyorsa, kök kemik adı
+    fe_string_id_t affected_bone_root_id;  // affected_bone_root'un tanıtıcısı (maske kontrolü bununla yapılır)
     bool use_partial_mask;                 // Kısmi maske kullanılıp kullanılmayacağı
     // fe_hash_map_t bone_mask;             // (Gelecekte) Hangi kemiklerin bu katmandan etkileneceğini belirten maske (bone_name -> bool)
 } fe_anim_layer_t;
@@ -60,13 +62,16 @@ typedef struct fe_anim_transition_params {
 } fe_anim_transition_params_t;
 
 
+// Klip adı tanıtıcısı -> klip haritası.
+FE_HASH_MAP_DECLARE(fe_anim_clip_map, fe_string_id_t, fe_animation_clip_t*, fe_string_id_hash, fe_string_id_eq)
+
 /**
  * @brief Animasyon kontrolcüsü ana yapısı.
  * Her animasyonlu varlık için bir örnek oluşturulmalıdır.
  */
 typedef struct fe_anim_controller {
     fe_skeleton_t* skeleton;                          // Kontrolcünün bağlı olduğu iskelet
-    fe_hash_map_t registered_clips;                   // fe_string_t (clip_name) -> fe_animation_clip_t*
+    fe_anim_clip_map_t registered_clips;              // clip->name_id -> fe_animation_clip_t*
     fe_anim_layer_t layers[FE_ANIM_LAYER_COUNT];      // Her katman için animasyon durumu
     
     fe_anim_transition_params_t* current_transition;  // Şu an aktif olan geçişin işaretçisi (NULL ise geçiş yok)
@@ -127,6 +132,12 @@ fe_anim_controller_error_t fe_anim_controller_unregister_clip(fe_anim_controller
  */
 fe_anim_controller_error_t fe_anim_controller_play(fe_anim_controller_t* controller, const char* clip_name, fe_anim_layer_priority_t layer, fe_animation_loop_mode_t loop_mode, float playback_speed);
 
+/**
+ * @brief fe_anim_controller_play'in ad tanıtıcısı alan sürümü. Oyun kodu her karede aynı klipleri
+ * tetikliyorsa tanıtıcıyı bir kez alıp (fe_string_intern / FE_STRING_ID) bunu kullanmalıdır.
+ */
+fe_anim_controller_error_t fe_anim_controller_play_by_id(fe_anim_controller_t* controller, fe_string_id_t clip_id, fe_anim_layer_priority_t layer, fe_animation_loop_mode_t loop_mode, float playback_speed);
+
 /**
  * @brief Bir animasyondan diğerine yumuşak bir geçiş başlatır.
  *
@@ -140,6 +151,11 @@ fe_anim_controller_error_t fe_anim_controller_play(fe_anim_controller_t* control
  */
 fe_anim_controller_error_t fe_anim_controller_crossfade(fe_anim_controller_t* controller, const char* target_clip_name, float transition_duration, fe_anim_layer_priority_t layer, fe_animation_loop_mode_t loop_mode, float playback_speed);
 
+/**
+ * @brief fe_anim_controller_crossfade'in ad tanıtıcısı alan sürümü.
+ */
+fe_anim_controller_error_t fe_anim_controller_crossfade_by_id(fe_anim_controller_t* controller, fe_string_id_t target_clip_id, float transition_duration, fe_anim_layer_priority_t layer, fe_animation_loop_mode_t loop_mode, float playback_speed);
+
 /**
  * @brief Belirli bir katmandaki animasyonu duraklatır.
  *
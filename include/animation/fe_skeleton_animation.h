@@ -2,7 +2,8 @@
 #define FE_SKELETON_ANIMATION_H
 
 #include "core/utils/fe_types.h" // fe_vec3, fe_quat, fe_mat4, fe_string_t için
-#include "core/containers/fe_hash_map.h" // Kemik ID'lerini ve animasyonları saklamak için
+#include "core/containers/fe_hash_map.g.h" // Kemik/kanal indeks haritaları için
+#include "core/containers/fe_string_intern.h" // Kemik ve klip adı tanıtıcıları (fe_string_id_t) için
 #include "core/containers/fe_array.h" // Kemik ve anahtar kare dizileri için
 
 // --- Animasyon Hata Kodları ---
@@ -18,6 +19,10 @@ typedef enum fe_animation_error {
 
 // --- Temel Animasyon Yapıları ---
 
+// Kemik adı tanıtıcısı -> dizi indeksi haritası. Sıcak döngülerde (her kare, her kemik)
+// string hashleme/karşılaştırma yerine tamsayı tanıtıcılarla arama yapılır.
+FE_HASH_MAP_DECLARE(fe_anim_name_index_map, fe_string_id_t, int, fe_string_id_hash, fe_string_id_eq)
+
 /**
  * @brief Bir kemiğin yerel dönüşümünü (konum, rotasyon, ölçek) temsil eden anahtar kare verisi.
  */
@@ -33,6 +38,7 @@ typedef struct fe_animation_keyframe {
  */
 typedef struct fe_animation_bone_channel {
     fe_string_t bone_name; // Bu kanalın ait olduğu kemiğin adı
+    fe_string_id_t bone_name_id; // bone_name'in havuzdaki tanıtıcısı
     fe_array_t position_keyframes; // fe_animation_keyframe_t (sadece konum verisi önemli)
     fe_array_t rotation_keyframes; // fe_animation_keyframe_t (sadece rotasyon verisi önemli)
     fe_array_t scale_keyframes;    // fe_animation_keyframe_t (sadece ölçek verisi önemli)
@@ -44,12 +50,13 @@ typedef struct fe_animation_bone_channel {
  */
 typedef struct fe_animation_clip {
     fe_string_t name;       // Animasyon klibinin adı (örn. "walk", "idle")
+    fe_string_id_t name_id; // name'in havuzdaki tanıtıcısı
     float duration;         // Animasyon klibinin toplam süresi (saniye)
     float ticks_per_second; // Animasyonun orijinal hız çarpanı (FPS gibi)
     fe_array_t bone_channels; // fe_animation_bone_channel_t dizisi
     
     // Hızlı erişim için kemik adına göre kanal indeksini tutan bir hash map
-    fe_hash_map_t bone_channel_map; // fe_string_t -> int (index of bone_channels array)
+    fe_anim_name_index_map_t bone_channel_map; // bone_name_id -> int (index of bone_channels array)
 } fe_animation_clip_t;
 
 /**
@@ -63,6 +70,7 @@ typedef struct fe_animation_clip {
  */
 typedef struct fe_skeleton_bone {
     fe_string_t name;           // Kemiğin adı (örn. "Hip", "RightThigh")
+    fe_string_id_t name_id;     // name'in havuzdaki tanıtıcısı (kanal aramaları bununla yapılır)
     int parent_index;           // Ebeveyn kemiğin iskelet dizisindeki indeksi (-1 ise kök kemik)
     fe_mat4 local_transform;    // Kemiğin ebeveynine göre dönüşümü (bind pose'da)
     fe_mat4 inverse_bind_transform; // Bind pose'daki dünya dönüşümünün tersi
@@ -78,7 +86,7 @@ typedef struct fe_skeleton {
     fe_array_t bones;       // fe_skeleton_bone_t dizisi. Kök kemik genellikle 0. indekstedir.
     
     // Hızlı erişim için kemik adına göre kemik indeksini tutan bir hash map
-    fe_hash_map_t bone_map; // fe_string_t -> int (index of bones array)
+    fe_anim_name_index_map_t bone_map; // name_id -> int (index of bones array)
 } fe_skeleton_t;
 
 // --- Animasyon Durumu Yönetimi ---
@@ -123,6 +131,15 @@ fe_animation_clip_t* fe_animation_clip_create(const char* name, float duration,
  */
 fe_animation_bone_channel_t* fe_animation_clip_add_bone_channel(fe_animation_clip_t* clip, const char* bone_name);
 
+/**
+ * @brief Klipte, verilen kemik adı tanıtıcısına ait kanalı arar. String hashlemez.
+ *
+ * @param clip Klibin işaretçisi.
+ * @param bone_name_id Kemik adının tanıtıcısı (ör. fe_skeleton_bone_t::name_id).
+ * @return fe_animation_bone_channel_t* Kanal, klipte bu kemik için kanal yoksa NULL.
+ */
+fe_animation_bone_channel_t* fe_animation_clip_find_bone_channel(const fe_animation_clip_t* clip, fe_string_id_t bone_name_id);
+
 /**
  * @brief Bir kemik kanalına pozisyon anahtar karesi ekler.
  *
@@ -184,6 +201,15 @@ fe_skeleton_t* fe_skeleton_create(const char* name);
  */
 fe_skeleton_bone_t* fe_skeleton_add_bone(fe_skeleton_t* skeleton, const char* name, int parent_index, fe_mat4 local_transform, fe_mat4 inverse_bind_transform);
 
+/**
+ * @brief İskelette, verilen ad tanıtıcısına sahip kemiğin indeksini arar. String hashlemez.
+ *
+ * @param skeleton İskeletin işaretçisi.
+ * @param bone_name_id Kemik adının tanıtıcısı.
+ * @return int Kemiğin indeksi, bulunamazsa -1.
+ */
+int fe_skeleton_find_bone_index(const fe_skeleton_t* skeleton, fe_string_id_t bone_name_id);
+
 /**
  * @brief Bir iskeleti temizler ve bellekten serbest bırakır.
  *
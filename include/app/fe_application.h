@@ -4,6 +4,7 @@
 #include "core/utils/fe_types.h"       // Temel tipler (bool, float, uint64_t, size_t vb.)
 #include "core/events/fe_event.h"      // Olay işleme sistemi için
 #include "core/memory/fe_memory_manager.h" // Bellek yönetimi
+#include "core/utils/fe_timer.h"       // fe_frame_pacer_t için
 
 // --- İleri Bildirimler ---
 // Bu başlık dosyasının bağımlılıklarını azaltmak için kullanılır.
@@ -25,6 +26,10 @@ typedef struct fe_application_config {
     bool        fullscreen;         // Tam ekran modunda başlasın mı?
     bool        vsync_enabled;      // VSync etkinleştirilsin mi?
     float       target_frame_rate;  // Hedef kare hızı (0 ise sınırsız)
+    uint32_t    worker_thread_count; // İş sistemi işçi thread sayısı (0 ise mantıksal işlemci sayısı - 1)
+    uint32_t    critical_path_log_interval; // Her bu kadar karede bir kritik yol loglanır (0 ise loglanmaz)
+    char        derived_data_path[256]; // Türetilmiş veri önbelleği dizini (boşsa önbellek kapalı)
+    char        pak_path[256];      // Başlangıçta bağlanan pak arşivi (boşsa dosyalar yalnızca diskten okunur)
     // Diğer yapılandırma ayarları buraya eklenebilir (örn: log seviyesi, varsayılan sahne vb.)
 } fe_application_config_t;
 
@@ -52,6 +57,22 @@ typedef struct fe_application_module {
 
     // Modülün etkin olup olmadığını döndürür.
     bool (*is_active)(void);
+
+    // --- Paralel Güncelleme (isteğe bağlı) ---
+    // Bu modülün update'inden önce update'i bitmiş olması gereken modüllerin adları.
+    // NULL ile sonlanan dizi; NULL ise açık bağımlılık yoktur.
+    const char* const* update_after;
+
+    // update sırasında okunan/yazılan paylaşılan veri kümelerinin adları (ör. "transforms").
+    // NULL ile sonlanan diziler. Kayıt sırasına göre: bir kümeyi okuyan veya yazan modül, ondan önce
+    // kaydedilmiş son yazıcıyı; bir kümeyi yazan modül ayrıca o yazıcıdan sonraki okuyucuları bekler.
+    // Örn. fizik "transforms" yazar, ondan sonra kaydedilen ve "transforms" okuyan AI fiziği bekler.
+    const char* const* reads;
+    const char* const* writes;
+
+    // true ise update bir iş sistemi işçisinde, bağımlı olmadığı modüllerle eşzamanlı çalışabilir.
+    // false ise (varsayılan) update ana thread'de ve diğer ana thread modülleriyle kayıt sırasında çalışır.
+    bool update_in_parallel;
 } fe_application_module_t;
 
 // --- Uygulama Durumu Yapısı ---
@@ -72,6 +93,9 @@ typedef struct fe_application_state {
 #define FE_MAX_APPLICATION_MODULES 16
     fe_application_module_t* modules[FE_MAX_APPLICATION_MODULES];
     size_t                   module_count;
+    bool                     parallel_updates; // Modül güncellemeleri iş sistemi üzerinden zamanlanıyorsa true
+
+    fe_frame_pacer_t         frame_pacer;      // Hedef kare hızını uygular; kare süresi istatistiklerini toplar
 
     // Diğer global durum değişkenleri buraya eklenebilir
     // fe_event_dispatcher* event_dispatcher; // Eğer global bir dispatcher varsa
@@ -82,6 +106,21 @@ typedef struct fe_application_state {
 } fe_application_state_t;
 
 
+// --- Kare Grafiği İstatistikleri ---
+/**
+ * @brief Son karedeki modül güncellemelerinin zamanlaması ve kritik yolu.
+ * Kritik yol, en son biten modülden geriye doğru, her adımda o modülü serbest bırakan
+ * (en son biten) bağımlılık izlenerek bulunur; kare süresini belirleyen modül zinciridir.
+ */
+typedef struct fe_application_frame_graph_stats {
+    uint64_t frame;                 // İstatistiğin ait olduğu kare numarası
+    double   total_ms;              // Tüm modül güncellemelerinin duvar saati süresi
+    double   critical_path_ms;      // Kritik yoldaki modüllerin update sürelerinin toplamı
+    uint32_t critical_path_length;  // Kritik yoldaki modül sayısı
+    uint8_t  critical_path[FE_MAX_APPLICATION_MODULES]; // Kritik yol (ilk başlayandan son bitene modül indeksleri)
+    double   module_ms[FE_MAX_APPLICATION_MODULES];     // Her modülün bu karedeki update süresi
+} fe_application_frame_graph_stats_t;
+
 // --- Uygulama Fonksiyonları ---
 
 /**
@@ -112,6 +151,8 @@ void fe_application_shutdown(void);
 /**
  * @brief Uygulamaya yeni bir modül kaydeder.
  * Modüllerin fe_application_init'ten önce kaydedilmesi gereklidir.
+ * update_after ile verilen bağımlılıklar fe_application_init sırasında çözülür; böylece
+ * modüller herhangi bir sırayla kaydedilebilir.
  *
  * @param module Kaydedilecek modül arayüzü.
  * @return bool Başarılı ise true, aksi takdirde false.
@@ -125,6 +166,14 @@ bool fe_application_register_module(fe_application_module_t* module);
  */
 const fe_application_state_t* fe_application_get_state(void);
 
+/**
+ * @brief Son tamamlanan karenin modül zamanlamalarını ve kritik yolunu döndürür.
+ * Yalnızca ana thread'den, kareler arasında çağrılmalıdır.
+ *
+ * @return const fe_application_frame_graph_stats_t* İstatistik işaretçisi.
+ */
+const fe_application_frame_graph_stats_t* fe_application_get_frame_graph_stats(void);
+
 
 // --- Dahili Uygulama Olay Dinleyici Fonksiyonu ---
 // Pencere ve diğer sistemlerden gelen olayları merkezi olarak işlemek için kullanılır.
@@ -2,7 +2,7 @@
 #define FE_AUDIO_ENGINE_H
 
 #include "core/utils/fe_types.h" // fe_vec3 için
-#include "core/containers/fe_hash_map.h" // Sesleri kaydetmek için
+#include "core/containers/fe_string_intern.h" // Ses/müzik ID tanıtıcıları (fe_string_id_t) için
 #include "core/containers/fe_string.h" // Ses ID'leri ve dosya yolları için
 
 // SDL_mixer kütüphanesini dahil et (gerçek projede kütüphane kurulumu gereklidir)
@@ -28,6 +28,8 @@ typedef enum fe_audio_error {
 // Hash map'lerde ve fonksiyonlarda kullanılacak benzersiz kimlikler
 typedef fe_string_t fe_sound_id_t; // Ses efekti ID'si (örn: "shoot_sound")
 typedef fe_string_t fe_music_id_t; // Müzik parçası ID'si (örn: "background_music_level1")
+// Sık çalınan sesler için ID string'i bir kez fe_string_intern ile tanıtıcıya çevrilip
+// *_by_id fonksiyonlarıyla kullanılmalıdır; bu yollarda string hashlenmez veya karşılaştırılmaz.
 
 // --- Ses Dinleyicisi (Listener) Yapısı ---
 // Uzamsal ses için dinleyicinin konumu ve yönü
@@ -115,6 +117,14 @@ fe_audio_error_t fe_audio_engine_unload_music(fe_music_id_t music_id);
  */
 int fe_audio_engine_play_sound(fe_sound_id_t sound_id, int loops, int channel_hint, float volume, float pitch);
 
+/**
+ * @brief fe_audio_engine_play_sound'un ID tanıtıcısı alan sürümü.
+ *
+ * @param sound_name_id Ses ID'sinin tanıtıcısı (fe_string_intern(sound_id.data)).
+ * @return int Atanan kanal numarası, hata durumunda -1.
+ */
+int fe_audio_engine_play_sound_by_id(fe_string_id_t sound_name_id, int loops, int channel_hint, float volume, float pitch);
+
 /**
  * @brief Belirli bir kanalda çalınan bir sesi durdurur.
  *
@@ -131,6 +141,11 @@ void fe_audio_engine_stop_sound(int channel);
  */
 fe_audio_error_t fe_audio_engine_play_music(fe_music_id_t music_id, int loops);
 
+/**
+ * @brief fe_audio_engine_play_music'in ID tanıtıcısı alan sürümü.
+ */
+fe_audio_error_t fe_audio_engine_play_music_by_id(fe_string_id_t music_name_id, int loops);
+
 /**
  * @brief Çalmakta olan müziği duraklatır.
  * @return fe_audio_error_t Başarı durumunu döner.
@@ -196,4 +211,9 @@ fe_audio_error_t fe_audio_engine_set_listener(const fe_audio_listener_t* listene
  */
 int fe_audio_engine_play_spatial_sound(fe_sound_id_t sound_id, const fe_audio_emitter_t* emitter, int loops);
 
+/**
+ * @brief fe_audio_engine_play_spatial_sound'un ID tanıtıcısı alan sürümü.
+ */
+int fe_audio_engine_play_spatial_sound_by_id(fe_string_id_t sound_name_id, const fe_audio_emitter_t* emitter, int loops);
+
 #endif // FE_AUDIO_ENGINE_H
@@ -0,0 +1,243 @@
+#ifndef FE_CHUNK_LIST_H
+#define FE_CHUNK_LIST_H
+
+#include "core/utils/fe_types.h"        // Temel tipler (size_t, bool, uint8_t vb.)
+#include "core/memory/fe_memory_manager.h" // Bellek yönetimi (FE_MALLOC, FE_FREE)
+#include "core/ds/fe_ds_types.h"       // fe_data_free_func, fe_compare_func, fe_data_copy_func için
+
+// --- Parçalı (Unrolled) Liste ---
+// fe_list_t her eleman için iki tahsis yapar (düğüm + veri) ve her adımda bir işaretçi izler.
+// fe_chunk_list_t elemanları sabit boyutlu bloklarda (varsayılan 64 eleman) satır içi ve
+// bitişik tutar; bloklar çift yönlü bağlıdır. Bu sayede:
+// - Gezinme bitişik bellek üzerinde yapılır (blok başına tek işaretçi izleme).
+// - Sona ekleme/sondan silme O(1), başa ekleme/baştan silme en fazla bir blok kaydırmadır.
+// - İndeksle erişim/ekleme/silme O(n / blok boyutu) blok atlamasıyla konumu bulur.
+// - Tahsis yalnızca yeni blok gerektiğinde yapılır.
+//
+// API, fe_list_* ile aynı işlemleri aynı anlamlarla sunar. Farklar:
+// - Eleman boyutu init sırasında bir kez verilir; ekleme fonksiyonları data_size almaz.
+// - Elemanlar listenin içinde yaşar: data_free_cb elemanın sahip olduğu kaynakları bırakmalı,
+//   eleman belleğinin kendisini serbest bırakmamalıdır.
+// - Döndürülen eleman işaretçileri bir sonraki ekleme/silme işlemine kadar geçerlidir
+//   (elemanlar blok içinde kaydırılabilir).
+//
+// Kullanım:
+//   fe_chunk_list_t list;
+//   fe_chunk_list_init(&list, sizeof(fe_contact_t), NULL, NULL, NULL);
+//   fe_chunk_list_append(&list, &contact);
+//   fe_chunk_list_iter_t it = fe_chunk_list_begin(&list);
+//   for (fe_contact_t* c; (c = (fe_contact_t*)fe_chunk_list_iter_next(&it)) != NULL; ) { ... }
+
+// Bir bloktaki eleman sayısı.
+#ifndef FE_CHUNK_LIST_BLOCK_ELEMENTS
+#define FE_CHUNK_LIST_BLOCK_ELEMENTS 64
+#endif
+
+// --- Blok Yapısı ---
+/**
+ * @brief Parçalı listenin tek bir bloğu. Elemanlar başlığın hemen ardından
+ * FE_CHUNK_LIST_BLOCK_ELEMENTS * element_size bayt olarak gelir.
+ */
+typedef struct fe_chunk_list_block {
+    struct fe_chunk_list_block* prev;  // Önceki blok (ilk blokta NULL)
+    struct fe_chunk_list_block* next;  // Sonraki blok (son blokta NULL)
+    size_t                      count; // Bu bloktaki dolu eleman sayısı (1..FE_CHUNK_LIST_BLOCK_ELEMENTS)
+    size_t                      reserved; // Eleman verisinin 2 * sizeof(void*) hizalı başlaması için dolgu
+} fe_chunk_list_block_t;
+
+// --- Parçalı Liste Yapısı ---
+/**
+ * @brief Elemanları satır içi bloklarda tutan liste.
+ */
+typedef struct fe_chunk_list {
+    fe_chunk_list_block_t* head;         // İlk blok (liste boşsa NULL)
+    fe_chunk_list_block_t* tail;         // Son blok (liste boşsa NULL)
+    size_t                 size;         // Toplam eleman sayısı
+    size_t                 block_count;  // Blok sayısı
+    fe_chunk_list_block_t* spare;        // Son boşalan blok; sınırda gidip gelen ekle/sil için tekrar kullanılır
+    size_t                 element_size; // Tek bir elemanın bayt cinsinden boyutu
+    fe_data_free_func      data_free_cb;    // Eleman silinirken kaynaklarını bırakmak için (isteğe bağlı)
+    fe_compare_func        data_compare_cb; // Elemanları karşılaştırmak için (isteğe bağlı)
+    fe_data_copy_func      data_copy_cb;    // Elemanları kopyalamak için (isteğe bağlı, NULL ise memcpy)
+} fe_chunk_list_t;
+
+/**
+ * @brief Bir bloğun eleman verisinin başlangıcını döndürür.
+ */
+static inline uint8_t* fe_chunk_list_block_data(const fe_chunk_list_block_t* block) {
+    return (uint8_t*)(block + 1);
+}
+
+// --- Parçalı Liste Fonksiyonları ---
+
+/**
+ * @brief Yeni bir boş parçalı liste başlatır. Blok tahsisi ilk eklemede yapılır.
+ *
+ * @param list Başlatılacak liste işaretçisi.
+ * @param element_size Tek bir elemanın bayt cinsinden boyutu.
+ * @param data_free_callback İsteğe bağlı: Silinen her eleman için çağrılır (eleman belleğini değil,
+ * elemanın sahip olduğu kaynakları bırakmalıdır).
+ * @param data_compare_callback İsteğe bağlı: fe_chunk_list_remove / fe_chunk_list_contains için.
+ * @param data_copy_callback İsteğe bağlı: Elemanı listeye kopyalamak için. NULL ise memcpy kullanılır.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_chunk_list_init(fe_chunk_list_t* list,
+                        size_t element_size,
+                        fe_data_free_func data_free_callback,
+                        fe_compare_func data_compare_callback,
+                        fe_data_copy_func data_copy_callback);
+
+/**
+ * @brief Listeyi kapatır, tüm elemanları (data_free_cb ile) ve blokları serbest bırakır.
+ *
+ * @param list Kapatılacak liste işaretçisi.
+ */
+void fe_chunk_list_shutdown(fe_chunk_list_t* list);
+
+/**
+ * @brief Listenin başına bir eleman ekler. İlk blokta yer varsa en fazla bir blok kaydırılır.
+ *
+ * @param list Öğenin ekleneceği liste.
+ * @param data Kopyalanacak eleman (element_size bayt).
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_chunk_list_prepend(fe_chunk_list_t* list, const void* data);
+
+/**
+ * @brief Listenin sonuna bir eleman ekler. O(1).
+ *
+ * @param list Öğenin ekleneceği liste.
+ * @param data Kopyalanacak eleman (element_size bayt).
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_chunk_list_append(fe_chunk_list_t* list, const void* data);
+
+/**
+ * @brief Belirli bir indekse bir eleman ekler. Hedef blok doluysa ikiye bölünür.
+ *
+ * @param list Öğenin ekleneceği liste.
+ * @param index Öğenin ekleneceği konum (0 tabanlı, size'a eşit olabilir).
+ * @param data Kopyalanacak eleman (element_size bayt).
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_chunk_list_insert_at(fe_chunk_list_t* list, size_t index, const void* data);
+
+/**
+ * @brief Listenin başındaki elemanı kaldırır.
+ */
+bool fe_chunk_list_remove_head(fe_chunk_list_t* list);
+
+/**
+ * @brief Listenin sonundaki elemanı kaldırır. O(1).
+ */
+bool fe_chunk_list_remove_tail(fe_chunk_list_t* list);
+
+/**
+ * @brief Belirli bir indeksteki elemanı kaldırır. Boşalan bloklar serbest bırakılır,
+ * dörtte birinden az dolu bloklar sığıyorsa komşularıyla birleştirilir.
+ *
+ * @param list Öğenin kaldırılacağı liste.
+ * @param index Kaldırılacak öğenin konumu (0 tabanlı).
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_chunk_list_remove_at(fe_chunk_list_t* list, size_t index);
+
+/**
+ * @brief Listedeki ilk eşleşen elemanı (data_compare_cb ile) kaldırır.
+ *
+ * @param list Öğenin kaldırılacağı liste.
+ * @param data Karşılaştırılacak eleman.
+ * @return bool Eleman bulunup kaldırıldıysa true, aksi takdirde false.
+ */
+bool fe_chunk_list_remove(fe_chunk_list_t* list, const void* data);
+
+/**
+ * @brief Listenin başındaki elemana bir işaretçi döndürür (liste boşsa NULL).
+ */
+void* fe_chunk_list_peek_head(const fe_chunk_list_t* list);
+
+/**
+ * @brief Listenin sonundaki elemana bir işaretçi döndürür (liste boşsa NULL). O(1).
+ */
+void* fe_chunk_list_peek_tail(const fe_chunk_list_t* list);
+
+/**
+ * @brief Belirli bir indeksteki elemana bir işaretçi döndürür. Hangi uç daha yakınsa
+ * oradan blok atlanarak aranır.
+ *
+ * @param list İşlem yapılacak liste.
+ * @param index Getirilecek öğenin konumu (0 tabanlı).
+ * @return void* Elemanın işaretçisi, indeks geçersizse NULL.
+ */
+void* fe_chunk_list_get_at(const fe_chunk_list_t* list, size_t index);
+
+/**
+ * @brief Listede data_compare_cb'ye göre eşit bir elemanın olup olmadığını döndürür.
+ */
+bool fe_chunk_list_contains(const fe_chunk_list_t* list, const void* data);
+
+/**
+ * @brief Listenin boş olup olmadığını kontrol eder.
+ */
+bool fe_chunk_list_is_empty(const fe_chunk_list_t* list);
+
+/**
+ * @brief Listedeki eleman sayısını döndürür.
+ */
+size_t fe_chunk_list_size(const fe_chunk_list_t* list);
+
+/**
+ * @brief Listeyi boşaltır, tüm elemanları (data_free_cb ile) ve blokları serbest bırakır,
+ * ancak listeyi kullanıma hazır bırakır.
+ */
+void fe_chunk_list_clear(fe_chunk_list_t* list);
+
+/**
+ * @brief Listenin tüm elemanlarını sırayla verilen fonksiyona uygular.
+ *
+ * @param list İşlem yapılacak liste.
+ * @param callback Her eleman için çağrılacak fonksiyon (fe_list_for_each ile aynı imza).
+ */
+typedef void (*fe_chunk_list_iter_callback)(void* data);
+void fe_chunk_list_for_each(const fe_chunk_list_t* list, fe_chunk_list_iter_callback callback);
+
+// --- İteratör ---
+
+/**
+ * @brief Liste üzerinde sırayla gezinmek için hafif iteratör.
+ * İterasyon sırasında liste değiştirilmemelidir.
+ */
+typedef struct fe_chunk_list_iter {
+    fe_chunk_list_block_t* block;        // Geçerli blok
+    size_t                 index;        // Blok içindeki bir sonraki eleman indeksi
+    size_t                 element_size; // Listenin eleman boyutu
+} fe_chunk_list_iter_t;
+
+/**
+ * @brief Listenin başından başlayan bir iteratör döndürür.
+ */
+static inline fe_chunk_list_iter_t fe_chunk_list_begin(const fe_chunk_list_t* list) {
+    fe_chunk_list_iter_t it;
+    it.block = list ? list->head : NULL;
+    it.index = 0;
+    it.element_size = list ? list->element_size : 0;
+    return it;
+}
+
+/**
+ * @brief Bir sonraki elemanı döndürür ve iteratörü ilerletir.
+ *
+ * @param it İteratör.
+ * @return void* Elemanın işaretçisi, liste bittiyse NULL.
+ */
+static inline void* fe_chunk_list_iter_next(fe_chunk_list_iter_t* it) {
+    if (!it->block) return NULL;
+    if (it->index >= it->block->count) {
+        it->block = it->block->next;
+        it->index = 0;
+        if (!it->block) return NULL;
+    }
+    return fe_chunk_list_block_data(it->block) + (it->index++) * it->element_size;
+}
+
+#endif // FE_CHUNK_LIST_H
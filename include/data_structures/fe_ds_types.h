@@ -59,12 +59,150 @@ uint64_t fe_ds_hash_fnv1a(const void* data, size_t size);
 
 /**
  * @brief Bir string için hash değeri üreten yardımcı fonksiyon.
- * Aslında fe_ds_hash_fnv1a'yı strlen ile çağırır.
+ * Ayrı bir strlen geçişi yapmaz; string'i 8 baytlık kelimeler halinde tek geçişte okur.
+ * Sonuç fe_ds_hash_fast(str, strlen(str)) ile aynıdır.
  * @param str Hashlenecek string.
  * @return uint64_t Oluşturulan hash değeri.
  */
 uint64_t fe_ds_hash_string(const char* str);
 
+// --- Hızlı Kriptografik Olmayan Hash Ailesi (wyhash tarzı) ---
+// Veriyi 8 baytlık kelimeler halinde işler; her kelime için tek bir 64x64->128 bit
+// çarpma ile karıştırma yapar (FNV-1a'da bayt başına bir çarpma vardır).
+// fe_map'in varsayılan hash fonksiyonudur.
+
+#define FE_DS_HASH_DEFAULT_SEED ((uint64_t)0)
+
+#define FE_DS_HASH_SECRET0 ((uint64_t)0xa0761d6478bd642fULL)
+#define FE_DS_HASH_SECRET1 ((uint64_t)0xe7037ed1a0b428dbULL)
+#define FE_DS_HASH_SECRET2 ((uint64_t)0x8ebc6af09c88c6e3ULL)
+#define FE_DS_HASH_SECRET3 ((uint64_t)0x589965cc75374cc3ULL)
+
+/**
+ * @brief 64x64 bit çarpmanın 128 bitlik sonucunun alt ve üst yarısını XOR'lar.
+ */
+static inline uint64_t fe_ds_hash_mum(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+    uint64_t ha = a >> 32, la = (uint32_t)a, hb = b >> 32, lb = (uint32_t)b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t carry = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+    return lo ^ hi;
+#endif
+}
+
+/**
+ * @brief Hash algoritmasının çekirdeği; başlıkta tanımlıdır ki sabit uzunluklu
+ * girdilerde (ör. FE_DS_HASH_LITERAL) derleyici tamamen katlayabilsin.
+ * Kelimeler küçük-endian (little-endian) düzende okunur, böylece sonuç platformdan bağımsızdır.
+ */
+static inline uint64_t fe_ds_hash_bytes_inline(const void* data, size_t size, uint64_t seed) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t h = seed ^ FE_DS_HASH_SECRET0;
+    size_t remaining = size;
+
+    while (remaining >= 8) {
+        uint64_t w = (uint64_t)p[0]         | ((uint64_t)p[1] << 8)  | ((uint64_t)p[2] << 16) |
+                     ((uint64_t)p[3] << 24) | ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) |
+                     ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+        h = fe_ds_hash_mum(w ^ FE_DS_HASH_SECRET1, h ^ FE_DS_HASH_SECRET2);
+        p += 8;
+        remaining -= 8;
+    }
+
+    // Kalan 0-7 bayt sıfırla doldurulmuş tek bir kelime olarak karıştırılır.
+    uint64_t tail = 0;
+    for (size_t i = 0; i < remaining; ++i) {
+        tail |= (uint64_t)p[i] << (8 * i);
+    }
+    h = fe_ds_hash_mum(tail ^ FE_DS_HASH_SECRET1, h ^ FE_DS_HASH_SECRET3);
+
+    return fe_ds_hash_mum(h ^ FE_DS_HASH_SECRET0, (uint64_t)size ^ FE_DS_HASH_SECRET1);
+}
+
+/**
+ * @brief Ham bayt dizileri için hızlı hash (varsayılan tohum ile).
+ * fe_hash_func typedef'ine uyar.
+ * @param data Hashlenecek veri işaretçisi.
+ * @param size Hashlenecek verinin boyutu.
+ * @return uint64_t Oluşturulan hash değeri.
+ */
+uint64_t fe_ds_hash_fast(const void* data, size_t size);
+
+/**
+ * @brief Tohumlu (seed) hızlı hash. Ağdan gelen anahtarları tutan haritalarda
+ * hash taşkını (hash flooding) saldırılarına karşı süreç başına rastgele bir tohumla kullanılmalıdır.
+ * @param data Hashlenecek veri işaretçisi.
+ * @param size Hashlenecek verinin boyutu.
+ * @param seed Hash tohumu.
+ * @return uint64_t Oluşturulan hash değeri.
+ */
+uint64_t fe_ds_hash_fast_seeded(const void* data, size_t size, uint64_t seed);
+
+/**
+ * @brief fe_ds_hash_string'in tohumlu sürümü. Sonuç fe_ds_hash_fast_seeded(str, strlen(str), seed) ile aynıdır.
+ * @param str Hashlenecek string.
+ * @param seed Hash tohumu.
+ * @return uint64_t Oluşturulan hash değeri.
+ */
+uint64_t fe_ds_hash_string_seeded(const char* str, uint64_t seed);
+
+/**
+ * @brief Süreç başına tahmin edilmesi zor bir hash tohumu üretir (ilk çağrıda hesaplanır).
+ * Kriptografik olarak güvenli değildir; yalnızca hash taşkınına karşı koruma amaçlıdır.
+ * @return uint64_t Rastgele tohum.
+ */
+uint64_t fe_ds_hash_random_seed(void);
+
+// --- Derleme Zamanı String Hash Yardımcıları ---
+
+/**
+ * @brief Sabit bir string literal'in hash'ini üretir; uzunluk sizeof ile derleme zamanında bilinir
+ * ve optimizasyon açıkken sonuç tamamen sabite katlanır. fe_ds_hash_string ile aynı değeri verir.
+ * Örnek: static const uint64_t k_root_bone_hash = ...; if (h == FE_DS_HASH_LITERAL("root")) ...
+ */
+#define FE_DS_HASH_LITERAL(str_literal) \
+    fe_ds_hash_bytes_inline((str_literal), sizeof(str_literal) - 1, FE_DS_HASH_DEFAULT_SEED)
+
+#if defined(__cplusplus) && __cplusplus >= 201402L
+// C++ derleme birimlerinde (ör. editör) gerçek constexpr sürüm; switch/case etiketlerinde kullanılabilir.
+constexpr uint64_t fe_ds_hash_mum_ct(uint64_t a, uint64_t b) {
+    uint64_t ha = a >> 32, la = (uint32_t)a, hb = b >> 32, lb = (uint32_t)b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t carry = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+    return lo ^ hi;
+}
+
+constexpr uint64_t fe_ds_hash_ct(const char* str, size_t size, uint64_t seed = FE_DS_HASH_DEFAULT_SEED) {
+    uint64_t h = seed ^ FE_DS_HASH_SECRET0;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t w = 0;
+        for (size_t b = 0; b < 8; ++b) w |= (uint64_t)(unsigned char)str[i + b] << (8 * b);
+        h = fe_ds_hash_mum_ct(w ^ FE_DS_HASH_SECRET1, h ^ FE_DS_HASH_SECRET2);
+    }
+    uint64_t tail = 0;
+    for (size_t b = 0; i + b < size; ++b) tail |= (uint64_t)(unsigned char)str[i + b] << (8 * b);
+    h = fe_ds_hash_mum_ct(tail ^ FE_DS_HASH_SECRET1, h ^ FE_DS_HASH_SECRET3);
+    return fe_ds_hash_mum_ct(h ^ FE_DS_HASH_SECRET0, (uint64_t)size ^ FE_DS_HASH_SECRET1);
+}
+
+template <size_t N>
+constexpr uint64_t fe_ds_hash_ct(const char (&str)[N]) {
+    return fe_ds_hash_ct(str, N - 1);
+}
+#endif
+
 
 // --- Temel Karşılaştırma Fonksiyonları (genel kullanıma açık) ---
 // Bunlar fe_compare_func typedef'ine uyan fonksiyon implementasyonları olacaktır.
@@ -98,17 +236,17 @@ int fe_ds_compare_string(const void* a, const void* b);
 // Bu typedef'ler, genellikle diğer veri yapılarının kendilerine ait
 // .h dosyalarında tanımlanır ancak burada genel olarak bir fikir vermek için listelenmiştir.
 
-// Dinamik Dizi (Dynamic Array)
-// #define FE_DYNAMIC_ARRAY_DEFINE(type) struct { type* data; size_t size; size_t capacity; }
-// typedef struct fe_dynamic_array_meta { /* meta bilgiler */ } fe_dynamic_array_meta_t;
+// Dinamik Dizi (Dynamic Array): tip özelleştirilmiş, inline depolama -> fe_dynamic_array.h
+// FE_DYNAMIC_ARRAY(type) struct { type* data; size_t size; size_t capacity; }
 
 // Bağlantılı Liste (Linked List)
 // typedef struct fe_list_node { void* data; struct fe_list_node* next; } fe_list_node_t;
 // typedef struct fe_linked_list { fe_list_node_t* head; size_t size; } fe_linked_list_t;
 
-// Hash Haritası (Hash Map)
-// typedef struct fe_hash_map_entry { uint64_t key_hash; void* key_ptr; void* value_ptr; } fe_hash_map_entry_t;
-// typedef struct fe_hash_map { /* ... */ } fe_hash_map_t;
+// İçsel (Intrusive) Liste: düğüm nesnenin içine gömülür, tahsis yok -> fe_intrusive_list.h
+
+// Hash Haritası (Hash Map): makro ile üretilen, açık adreslemeli, inline depolama -> fe_hash_map.g.h
+// FE_HASH_MAP_DECLARE(name, K, V, HASH_FN, EQ_FN) -> name_t, name_get/insert/remove...
 
 // İkili Arama Ağacı (Binary Search Tree - BST)
 // typedef struct fe_bst_node { void* key; void* value; struct fe_bst_node* left; struct fe_bst_node* right; } fe_bst_node_t;
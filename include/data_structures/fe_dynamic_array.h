@@ -0,0 +1,153 @@
+#ifndef FE_DYNAMIC_ARRAY_H
+#define FE_DYNAMIC_ARRAY_H
+
+#include "core/utils/fe_types.h"            // Temel tipler (size_t, bool vb.)
+#include "core/memory/fe_memory_manager.h"  // Bellek yönetimi (FE_MALLOC, FE_FREE)
+
+#include <string.h> // memmove için
+
+// --- Tip Özelleştirilmiş Dinamik Dizi ---
+// fe_list_t'nin aksine elemanlar void* olarak değil, doğrudan kendi tipleriyle
+// tek bir bitişik bellek bloğunda (inline) saklanır. Eleman başına tahsis yapılmaz,
+// kopyalama/karşılaştırma geri arama fonksiyonları kullanılmaz.
+//
+// Kullanım:
+//   FE_DYNAMIC_ARRAY(fe_asset_t*) assets;
+//   FE_DYNAMIC_ARRAY_INIT(&assets, 16);
+//   FE_DYNAMIC_ARRAY_ADD(&assets, asset);
+//   fe_asset_t* first = FE_DYNAMIC_ARRAY_GET(&assets, 0);
+//   FE_DYNAMIC_ARRAY_SHUTDOWN(&assets);
+
+/**
+ * @brief Belirtilen eleman tipi için isimsiz bir dinamik dizi yapısı tanımlar.
+ * Yapı alanlarına (data, size, capacity) doğrudan erişilebilir.
+ */
+#define FE_DYNAMIC_ARRAY(type) \
+    struct { type* data; size_t size; size_t capacity; }
+
+/**
+ * @brief FE_DYNAMIC_ARRAY ile aynıdır; yerel değişken bildirimlerinde okunabilirlik için.
+ */
+#define FE_DYNAMIC_ARRAY_DEFINE(type) FE_DYNAMIC_ARRAY(type)
+
+/**
+ * @brief İsimlendirilmiş bir dinamik dizi tipi üretir (name_t).
+ * Fonksiyon parametresi olarak geçirilecek diziler için kullanılır.
+ */
+#define FE_DYNAMIC_ARRAY_DECLARE(name, type) \
+    typedef FE_DYNAMIC_ARRAY(type) name##_t
+
+// --- Dahili Yardımcı Fonksiyonlar (makrolar tarafından kullanılır) ---
+
+/**
+ * @brief Dinamik dizinin kapasitesini en az min_capacity olacak şekilde büyütür.
+ * Kapasite her büyümede en az iki katına çıkarılır (amortize O(1) ekleme).
+ *
+ * @param data Dizinin veri işaretçisinin adresi.
+ * @param capacity Dizinin mevcut kapasitesinin adresi.
+ * @param element_size Tek bir elemanın bayt cinsinden boyutu.
+ * @param min_capacity İstenen minimum kapasite.
+ * @return bool Başarılı ise true, bellek tahsisi başarısız olursa false (dizi değişmez).
+ */
+bool fe_dynamic_array_grow_raw(void** data, size_t* capacity, size_t element_size, size_t min_capacity);
+
+/**
+ * @brief Dinamik dizinin belleğini serbest bırakır ve alanlarını sıfırlar.
+ *
+ * @param data Dizinin veri işaretçisinin adresi.
+ * @param size Dizinin eleman sayısının adresi.
+ * @param capacity Dizinin kapasitesinin adresi.
+ */
+void fe_dynamic_array_free_raw(void** data, size_t* size, size_t* capacity);
+
+// --- Dinamik Dizi Makroları ---
+
+/**
+ * @brief Diziyi başlatır ve initial_capacity kadar yer ayırır.
+ * @return bool Başarılı ise true.
+ */
+#define FE_DYNAMIC_ARRAY_INIT(arr, initial_capacity) \
+    ((arr)->data = NULL, (arr)->size = 0, (arr)->capacity = 0, \
+     fe_dynamic_array_grow_raw((void**)&(arr)->data, &(arr)->capacity, sizeof(*(arr)->data), \
+                               (initial_capacity) > 0 ? (size_t)(initial_capacity) : 1))
+
+/**
+ * @brief Dizinin belleğini serbest bırakır. Elemanların işaret ettiği veriler serbest bırakılmaz.
+ */
+#define FE_DYNAMIC_ARRAY_SHUTDOWN(arr) \
+    fe_dynamic_array_free_raw((void**)&(arr)->data, &(arr)->size, &(arr)->capacity)
+
+/**
+ * @brief En az count elemanlık kapasite ayırır; sonraki eklemelerde yeniden tahsis olmaz.
+ * @return bool Başarılı ise true.
+ */
+#define FE_DYNAMIC_ARRAY_RESERVE(arr, count) \
+    ((size_t)(count) <= (arr)->capacity || \
+     fe_dynamic_array_grow_raw((void**)&(arr)->data, &(arr)->capacity, sizeof(*(arr)->data), (size_t)(count)))
+
+/**
+ * @brief Dizinin sonuna bir eleman ekler. Amortize O(1).
+ * @return bool Başarılı ise true.
+ */
+#define FE_DYNAMIC_ARRAY_ADD(arr, value) \
+    (FE_DYNAMIC_ARRAY_RESERVE((arr), (arr)->size + 1) ? ((arr)->data[(arr)->size++] = (value), true) : false)
+
+/**
+ * @brief Belirtilen indeksteki elemanı döndürür. Sınır kontrolü yapılmaz.
+ */
+#define FE_DYNAMIC_ARRAY_GET(arr, index) ((arr)->data[(index)])
+
+/**
+ * @brief Belirtilen indeksteki elemana işaretçi döndürür. Sınır kontrolü yapılmaz.
+ */
+#define FE_DYNAMIC_ARRAY_AT(arr, index) (&(arr)->data[(index)])
+
+/**
+ * @brief Son elemanı döndürür. Dizi boş olmamalıdır.
+ */
+#define FE_DYNAMIC_ARRAY_BACK(arr) ((arr)->data[(arr)->size - 1])
+
+/**
+ * @brief Son elemanı kaldırır (dizi boşsa bir şey yapmaz).
+ */
+#define FE_DYNAMIC_ARRAY_POP(arr) \
+    do { if ((arr)->size > 0) { (arr)->size--; } } while (0)
+
+/**
+ * @brief Belirtilen indeksteki elemanı kaldırır ve sonraki elemanları kaydırır. O(n), sırayı korur.
+ */
+#define FE_DYNAMIC_ARRAY_REMOVE_AT(arr, index) \
+    do { \
+        size_t fe_da_index_ = (size_t)(index); \
+        if (fe_da_index_ < (arr)->size) { \
+            memmove(&(arr)->data[fe_da_index_], &(arr)->data[fe_da_index_ + 1], \
+                    ((arr)->size - fe_da_index_ - 1) * sizeof(*(arr)->data)); \
+            (arr)->size--; \
+        } \
+    } while (0)
+
+/**
+ * @brief Belirtilen indeksteki elemanı son elemanla değiştirerek kaldırır. O(1), sırayı korumaz.
+ */
+#define FE_DYNAMIC_ARRAY_SWAP_REMOVE_AT(arr, index) \
+    do { \
+        size_t fe_da_index_ = (size_t)(index); \
+        if (fe_da_index_ < (arr)->size) { \
+            (arr)->data[fe_da_index_] = (arr)->data[(arr)->size - 1]; \
+            (arr)->size--; \
+        } \
+    } while (0)
+
+/**
+ * @brief Diziyi boşaltır ancak belleği korur.
+ */
+#define FE_DYNAMIC_ARRAY_CLEAR(arr) ((arr)->size = 0)
+
+/**
+ * @brief Dizinin elemanları üzerinde işaretçi ile iterasyon yapar.
+ * Örnek: FE_DYNAMIC_ARRAY_FOREACH(&arr, fe_asset_t*, it) { use(*it); }
+ */
+#define FE_DYNAMIC_ARRAY_FOREACH(arr, type, it) \
+    for (type* it = (arr)->data; it != NULL && it < (arr)->data + (arr)->size; ++it)
+
+#endif // FE_DYNAMIC_ARRAY_H
@@ -0,0 +1,269 @@
+#ifndef FE_HASH_MAP_G_H
+#define FE_HASH_MAP_G_H
+
+#include "core/utils/fe_types.h"            // Temel tipler (size_t, bool, uint64_t vb.)
+#include "core/memory/fe_memory_manager.h"  // Bellek yönetimi (FE_MALLOC, FE_FREE)
+#include "core/ds/fe_ds_types.h"            // fe_ds_hash_string için
+
+#include <string.h> // strcmp, memset için
+
+// --- Tip Özelleştirilmiş (Üretilmiş) Hash Haritası ---
+// fe_map_t'nin aksine anahtarlar ve değerler void* + size_t olarak değil, kendi tipleriyle
+// bitişik dizilerde (inline) saklanır. Çakışmalar açık adresleme (doğrusal yoklama) ile
+// çözülür; giriş başına bellek tahsisi yoktur. Hash ve eşitlik fonksiyonları makro
+// parametresi olarak verilir ve derleyici tarafından doğrudan satır içine alınır
+// (fonksiyon işaretçisi üzerinden dolaylı çağrı yapılmaz).
+//
+// Kullanım:
+//   FE_HASH_MAP_DECLARE(fe_id_to_node_map, uint64_t, fe_node_t*, fe_hash_map_hash_u64, fe_hash_map_eq_u64)
+//   fe_id_to_node_map_t map;
+//   fe_id_to_node_map_init(&map, 16);
+//   fe_id_to_node_map_insert(&map, 42, node);
+//   fe_node_t** found = fe_id_to_node_map_get(&map, 42);
+//   fe_id_to_node_map_shutdown(&map);
+//
+// Üretilen fonksiyonlar: name_init, name_shutdown, name_clear, name_reserve, name_get,
+// name_insert, name_remove, name_contains, name_size.
+
+// Kova hash değerleri için ayrılmış değerler. Gerçek hash değerleri bu aralığa düşerse kaydırılır.
+#define FE_HASH_MAP_SLOT_EMPTY     ((uint64_t)0)
+#define FE_HASH_MAP_SLOT_TOMBSTONE ((uint64_t)1)
+#define FE_HASH_MAP_MIN_CAPACITY   8
+
+// Dolu kova sayısı (silinmiş işaretleri dahil) kapasitenin bu oranını aşarsa tablo büyütülür.
+#define FE_HASH_MAP_MAX_LOAD_NUM 3
+#define FE_HASH_MAP_MAX_LOAD_DEN 4
+
+// --- Hazır Hash / Eşitlik Yardımcıları ---
+
+/**
+ * @brief 64-bit tamsayı anahtarlar için hash (MurmurHash3 fmix64 sonlandırıcısı).
+ * Sıralı ID'lerin tabloya eşit dağılmasını sağlar.
+ */
+static inline uint64_t fe_hash_map_hash_u64(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+static inline bool fe_hash_map_eq_u64(uint64_t a, uint64_t b) {
+    return a == b;
+}
+
+/**
+ * @brief İşaretçi anahtarlar için hash (adresin kendisi hashlenir, içeriği değil).
+ */
+static inline uint64_t fe_hash_map_hash_ptr(const void* key) {
+    return fe_hash_map_hash_u64((uint64_t)(uintptr_t)key);
+}
+
+static inline bool fe_hash_map_eq_ptr(const void* a, const void* b) {
+    return a == b;
+}
+
+/**
+ * @brief Null ile sonlanan string anahtarlar için hash (içerik hashlenir).
+ * Harita string'in kopyasını tutmaz; anahtarın ömrü girişin ömründen uzun olmalıdır.
+ */
+static inline uint64_t fe_hash_map_hash_cstr(const char* key) {
+    return fe_ds_hash_string(key);
+}
+
+static inline bool fe_hash_map_eq_cstr(const char* a, const char* b) {
+    return a == b || (a && b && strcmp(a, b) == 0);
+}
+
+/**
+ * @brief Bir hash değerini ayrılmış kova değerlerinden (boş/silinmiş) uzaklaştırır.
+ */
+static inline uint64_t fe_hash_map_fix_hash(uint64_t hash) {
+    return hash <= FE_HASH_MAP_SLOT_TOMBSTONE ? hash + 2 : hash;
+}
+
+/**
+ * @brief İstenen eleman sayısını yük faktörünü aşmadan tutabilecek 2'nin kuvveti kapasiteyi hesaplar.
+ */
+static inline size_t fe_hash_map_capacity_for(size_t count) {
+    size_t needed = (count * FE_HASH_MAP_MAX_LOAD_DEN) / FE_HASH_MAP_MAX_LOAD_NUM + 1;
+    size_t capacity = FE_HASH_MAP_MIN_CAPACITY;
+    while (capacity < needed) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+// --- Harita Üretici Makro ---
+
+/**
+ * @brief K -> V tipinde, name_t adında bir hash haritası tipi ve ona ait static inline
+ * fonksiyonları üretir.
+ *
+ * @param name Üretilecek tip ve fonksiyonların ön eki.
+ * @param K Anahtar tipi (değer olarak kopyalanır).
+ * @param V Değer tipi (değer olarak kopyalanır).
+ * @param HASH_FN uint64_t HASH_FN(K) imzalı fonksiyon veya makro.
+ * @param EQ_FN bool EQ_FN(K, K) imzalı fonksiyon veya makro.
+ */
+#define FE_HASH_MAP_DECLARE(name, K, V, HASH_FN, EQ_FN) \
+    typedef struct name { \
+        uint64_t* hashes;   /* Kova başına hash (0: boş, 1: silinmiş) */ \
+        K*        keys;     /* Kova başına anahtar */ \
+        V*        values;   /* Kova başına değer */ \
+        size_t    capacity; /* Kova sayısı (her zaman 2'nin kuvveti) */ \
+        size_t    size;     /* Canlı giriş sayısı */ \
+        size_t    tombstones; /* Silinmiş işaretli kova sayısı */ \
+    } name##_t; \
+    \
+    static inline bool name##_alloc_tables_(name##_t* map, size_t capacity) { \
+        map->hashes = (uint64_t*)FE_MALLOC(capacity * sizeof(uint64_t), FE_MEM_TYPE_CONTAINER); \
+        map->keys = (K*)FE_MALLOC(capacity * sizeof(K), FE_MEM_TYPE_CONTAINER); \
+        map->values = (V*)FE_MALLOC(capacity * sizeof(V), FE_MEM_TYPE_CONTAINER); \
+        if (!map->hashes || !map->keys || !map->values) { \
+            if (map->hashes) FE_FREE(map->hashes, FE_MEM_TYPE_CONTAINER); \
+            if (map->keys) FE_FREE(map->keys, FE_MEM_TYPE_CONTAINER); \
+            if (map->values) FE_FREE(map->values, FE_MEM_TYPE_CONTAINER); \
+            map->hashes = NULL; map->keys = NULL; map->values = NULL; \
+            return false; \
+        } \
+        memset(map->hashes, 0, capacity * sizeof(uint64_t)); \
+        map->capacity = capacity; \
+        map->size = 0; \
+        map->tombstones = 0; \
+        return true; \
+    } \
+    \
+    static inline bool name##_init(name##_t* map, size_t initial_capacity) { \
+        if (!map) return false; \
+        memset(map, 0, sizeof(*map)); \
+        return name##_alloc_tables_(map, fe_hash_map_capacity_for(initial_capacity)); \
+    } \
+    \
+    static inline void name##_shutdown(name##_t* map) { \
+        if (!map) return; \
+        if (map->hashes) FE_FREE(map->hashes, FE_MEM_TYPE_CONTAINER); \
+        if (map->keys) FE_FREE(map->keys, FE_MEM_TYPE_CONTAINER); \
+        if (map->values) FE_FREE(map->values, FE_MEM_TYPE_CONTAINER); \
+        memset(map, 0, sizeof(*map)); \
+    } \
+    \
+    static inline void name##_clear(name##_t* map) { \
+        if (!map || !map->hashes) return; \
+        memset(map->hashes, 0, map->capacity * sizeof(uint64_t)); \
+        map->size = 0; \
+        map->tombstones = 0; \
+    } \
+    \
+    /* Anahtarın bulunduğu kova indeksini döndürür; yoksa map->capacity döner. */ \
+    static inline size_t name##_find_(const name##_t* map, K key, uint64_t hash) { \
+        size_t mask = map->capacity - 1; \
+        size_t index = (size_t)hash & mask; \
+        for (size_t probe = 0; probe < map->capacity; ++probe) { \
+            uint64_t slot_hash = map->hashes[index]; \
+            if (slot_hash == FE_HASH_MAP_SLOT_EMPTY) break; \
+            if (slot_hash == hash && EQ_FN(map->keys[index], key)) return index; \
+            index = (index + 1) & mask; \
+        } \
+        return map->capacity; \
+    } \
+    \
+    /* Tabloyu yeni kapasiteye taşır; silinmiş işaretleri de temizler. */ \
+    static inline bool name##_rehash_(name##_t* map, size_t new_capacity) { \
+        name##_t old_map = *map; \
+        if (!name##_alloc_tables_(map, new_capacity)) { \
+            *map = old_map; \
+            return false; \
+        } \
+        size_t mask = new_capacity - 1; \
+        for (size_t i = 0; i < old_map.capacity; ++i) { \
+            uint64_t slot_hash = old_map.hashes[i]; \
+            if (slot_hash <= FE_HASH_MAP_SLOT_TOMBSTONE) continue; \
+            size_t index = (size_t)slot_hash & mask; \
+            while (map->hashes[index] != FE_HASH_MAP_SLOT_EMPTY) index = (index + 1) & mask; \
+            map->hashes[index] = slot_hash; \
+            map->keys[index] = old_map.keys[i]; \
+            map->values[index] = old_map.values[i]; \
+            map->size++; \
+        } \
+        FE_FREE(old_map.hashes, FE_MEM_TYPE_CONTAINER); \
+        FE_FREE(old_map.keys, FE_MEM_TYPE_CONTAINER); \
+        FE_FREE(old_map.values, FE_MEM_TYPE_CONTAINER); \
+        return true; \
+    } \
+    \
+    /* En az count giriş için yer ayırır; sonraki eklemeler yeniden boyutlandırma yapmaz. */ \
+    static inline bool name##_reserve(name##_t* map, size_t count) { \
+        if (!map || !map->hashes) return false; \
+        size_t capacity = fe_hash_map_capacity_for(count); \
+        if (capacity <= map->capacity) return true; \
+        return name##_rehash_(map, capacity); \
+    } \
+    \
+    static inline V* name##_get(const name##_t* map, K key) { \
+        if (!map || map->size == 0) return NULL; \
+        size_t index = name##_find_(map, key, fe_hash_map_fix_hash(HASH_FN(key))); \
+        return index < map->capacity ? &map->values[index] : NULL; \
+    } \
+    \
+    static inline bool name##_contains(const name##_t* map, K key) { \
+        return name##_get(map, key) != NULL; \
+    } \
+    \
+    /* Yeni bir giriş ekler veya mevcut anahtarın değerini günceller. */ \
+    static inline bool name##_insert(name##_t* map, K key, V value) { \
+        if (!map || !map->hashes) return false; \
+        uint64_t hash = fe_hash_map_fix_hash(HASH_FN(key)); \
+        size_t existing = name##_find_(map, key, hash); \
+        if (existing < map->capacity) { \
+            map->values[existing] = value; \
+            return true; \
+        } \
+        if ((map->size + map->tombstones + 1) * FE_HASH_MAP_MAX_LOAD_DEN > map->capacity * FE_HASH_MAP_MAX_LOAD_NUM) { \
+            /* Silinmiş işaretler çoğunluktaysa aynı kapasitede temizle, değilse büyüt. */ \
+            size_t new_capacity = (map->tombstones > map->size) ? map->capacity : map->capacity * 2; \
+            if (!name##_rehash_(map, new_capacity)) return false; \
+        } \
+        size_t mask = map->capacity - 1; \
+        size_t index = (size_t)hash & mask; \
+        while (map->hashes[index] > FE_HASH_MAP_SLOT_TOMBSTONE) index = (index + 1) & mask; \
+        if (map->hashes[index] == FE_HASH_MAP_SLOT_TOMBSTONE) map->tombstones--; \
+        map->hashes[index] = hash; \
+        map->keys[index] = key; \
+        map->values[index] = value; \
+        map->size++; \
+        return true; \
+    } \
+    \
+    static inline bool name##_remove(name##_t* map, K key) { \
+        if (!map || map->size == 0) return false; \
+        size_t index = name##_find_(map, key, fe_hash_map_fix_hash(HASH_FN(key))); \
+        if (index >= map->capacity) return false; \
+        map->hashes[index] = FE_HASH_MAP_SLOT_TOMBSTONE; \
+        map->size--; \
+        map->tombstones++; \
+        return true; \
+    } \
+    \
+    static inline size_t name##_size(const name##_t* map) { \
+        return map ? map->size : 0; \
+    }
+
+/**
+ * @brief FE_HASH_MAP_DECLARE ile üretilmiş bir haritanın canlı girişleri üzerinde iterasyon yapar.
+ * İterasyon sırası garanti edilmez. Gövde içinde `break` ve `continue` tek bir döngüdeki gibi
+ * çalışır. İterasyon sırasında haritaya ekleme yapılmamalıdır (silme güvenlidir).
+ *
+ * Örnek: FE_HASH_MAP_FOREACH(&map, const char*, path, fe_asset_t*, asset) { ... }
+ */
+// Anahtar ve değer değişkenlerini bildirmek için iç içe döngüler kullanılır. fe_hm_state_ gövdenin
+// nasıl bittiğini dış döngüye taşır: 0 = sıradaki giriş, 1 = gövde `break` ile çıktı, 2 = gövde tamamlandı.
+#define FE_HASH_MAP_FOREACH(map, key_type, key_name, value_type, value_name) \
+    for (size_t fe_hm_i_ = 0, fe_hm_state_ = 0; \
+         fe_hm_state_ != 1 && (fe_hm_state_ = 0, fe_hm_i_ < (map)->capacity); ++fe_hm_i_) \
+        if ((map)->hashes[fe_hm_i_] <= FE_HASH_MAP_SLOT_TOMBSTONE) {} else \
+        for (key_type key_name = (key_type)(map)->keys[fe_hm_i_]; fe_hm_state_ == 0;) \
+        for (value_type value_name = (map)->values[fe_hm_i_]; fe_hm_state_ == 0 ? (fe_hm_state_ = 1) : 0; fe_hm_state_ = 2)
+
+#endif // FE_HASH_MAP_G_H
@@ -0,0 +1,147 @@
+#ifndef FE_INTRUSIVE_LIST_H
+#define FE_INTRUSIVE_LIST_H
+
+#include "core/utils/fe_types.h" // Temel tipler (size_t, bool vb.)
+
+#include <stddef.h> // offsetof için
+
+// --- İçsel (Intrusive) Çift Yönlü Bağlantılı Liste ---
+// fe_list_t'nin aksine liste düğümü, saklanan nesnenin kendi içine gömülür.
+// Ekleme/çıkarma O(1)'dir ve hiçbir bellek tahsisi yapmaz; nesnenin ömrünü
+// liste değil, nesnenin sahibi yönetir. Bir nesne, birden fazla fe_ilist_node_t
+// alanı taşıyarak aynı anda birden fazla listede bulunabilir.
+//
+// Kullanım:
+//   typedef struct fe_asset { ...; fe_ilist_node_t lru_node; } fe_asset_t;
+//   fe_ilist_t lru; fe_ilist_init(&lru);
+//   fe_ilist_push_back(&lru, &asset->lru_node);
+//   fe_asset_t* oldest = FE_ILIST_CONTAINER_OF(fe_ilist_front(&lru), fe_asset_t, lru_node);
+
+/**
+ * @brief Nesnelerin içine gömülen liste düğümü.
+ */
+typedef struct fe_ilist_node {
+    struct fe_ilist_node* prev; // Önceki düğüm (listede değilse NULL)
+    struct fe_ilist_node* next; // Sonraki düğüm (listede değilse NULL)
+} fe_ilist_node_t;
+
+/**
+ * @brief Dairesel, sentinel (bekçi) düğümlü liste başlığı.
+ * Boş listede sentinel kendini işaret eder; bu sayede kenar durumları için dallanma gerekmez.
+ */
+typedef struct fe_ilist {
+    fe_ilist_node_t sentinel; // Baş/son için bekçi düğüm
+    size_t          size;     // Listedeki düğüm sayısı
+} fe_ilist_t;
+
+/**
+ * @brief Gömülü düğüm işaretçisinden onu içeren nesnenin işaretçisini hesaplar.
+ */
+#define FE_ILIST_CONTAINER_OF(node_ptr, type, member) \
+    ((type*)((char*)(node_ptr) - offsetof(type, member)))
+
+/**
+ * @brief Listedeki düğümler üzerinde baştan sona iterasyon yapar.
+ * İterasyon sırasında geçerli düğümü silmek için FE_ILIST_FOREACH_SAFE kullanılmalıdır.
+ */
+#define FE_ILIST_FOREACH(list, it) \
+    for (fe_ilist_node_t* it = (list)->sentinel.next; it != &(list)->sentinel; it = it->next)
+
+/**
+ * @brief Geçerli düğümün silinmesine izin veren iterasyon.
+ */
+#define FE_ILIST_FOREACH_SAFE(list, it, tmp) \
+    for (fe_ilist_node_t* it = (list)->sentinel.next, *tmp = it->next; \
+         it != &(list)->sentinel; it = tmp, tmp = it->next)
+
+static inline void fe_ilist_init(fe_ilist_t* list) {
+    list->sentinel.prev = &list->sentinel;
+    list->sentinel.next = &list->sentinel;
+    list->size = 0;
+}
+
+static inline void fe_ilist_node_init(fe_ilist_node_t* node) {
+    node->prev = NULL;
+    node->next = NULL;
+}
+
+static inline bool fe_ilist_is_empty(const fe_ilist_t* list) {
+    return list->sentinel.next == &list->sentinel;
+}
+
+static inline size_t fe_ilist_size(const fe_ilist_t* list) {
+    return list->size;
+}
+
+/**
+ * @brief Düğümün herhangi bir listeye bağlı olup olmadığını kontrol eder.
+ * Yalnızca fe_ilist_node_init ile başlatılmış ve fe_ilist_remove ile çıkarılmış düğümler için geçerlidir.
+ */
+static inline bool fe_ilist_node_is_linked(const fe_ilist_node_t* node) {
+    return node->next != NULL;
+}
+
+static inline void fe_ilist_insert_after_(fe_ilist_node_t* pos, fe_ilist_node_t* node) {
+    node->prev = pos;
+    node->next = pos->next;
+    pos->next->prev = node;
+    pos->next = node;
+}
+
+static inline void fe_ilist_push_front(fe_ilist_t* list, fe_ilist_node_t* node) {
+    fe_ilist_insert_after_(&list->sentinel, node);
+    list->size++;
+}
+
+static inline void fe_ilist_push_back(fe_ilist_t* list, fe_ilist_node_t* node) {
+    fe_ilist_insert_after_(list->sentinel.prev, node);
+    list->size++;
+}
+
+/**
+ * @brief Düğümü bulunduğu listeden çıkarır. O(1).
+ */
+static inline void fe_ilist_remove(fe_ilist_t* list, fe_ilist_node_t* node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->prev = NULL;
+    node->next = NULL;
+    list->size--;
+}
+
+/**
+ * @brief Listenin ilk düğümünü döndürür, liste boşsa NULL.
+ */
+static inline fe_ilist_node_t* fe_ilist_front(const fe_ilist_t* list) {
+    return fe_ilist_is_empty(list) ? NULL : list->sentinel.next;
+}
+
+/**
+ * @brief Listenin son düğümünü döndürür, liste boşsa NULL.
+ */
+static inline fe_ilist_node_t* fe_ilist_back(const fe_ilist_t* list) {
+    return fe_ilist_is_empty(list) ? NULL : list->sentinel.prev;
+}
+
+static inline fe_ilist_node_t* fe_ilist_pop_front(fe_ilist_t* list) {
+    fe_ilist_node_t* node = fe_ilist_front(list);
+    if (node) fe_ilist_remove(list, node);
+    return node;
+}
+
+static inline fe_ilist_node_t* fe_ilist_pop_back(fe_ilist_t* list) {
+    fe_ilist_node_t* node = fe_ilist_back(list);
+    if (node) fe_ilist_remove(list, node);
+    return node;
+}
+
+/**
+ * @brief Listedeki bir düğümü listenin sonuna taşır (ör. LRU'da "son kullanılan" işaretlemek için).
+ */
+static inline void fe_ilist_move_to_back(fe_ilist_t* list, fe_ilist_node_t* node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    fe_ilist_insert_after_(list->sentinel.prev, node);
+}
+
+#endif // FE_INTRUSIVE_LIST_H
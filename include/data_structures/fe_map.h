@@ -18,18 +18,33 @@ typedef struct fe_map_entry {
     uint64_t      key_hash;    // Anahtarın önceden hesaplanmış hash değeri
 } fe_map_entry_t;
 
+// Artımlı yeniden boyutlandırma sırasında her değiştirici işlemde (set/remove) eski tablodan
+// yeni tabloya taşınan en fazla dolu kova sayısı.
+#ifndef FE_MAP_REHASH_BUCKETS_PER_OP
+#define FE_MAP_REHASH_BUCKETS_PER_OP 4
+#endif
+
 // --- Hash Haritası Yapısı ---
 /**
  * @brief Fiction Engine için jenerik bir hash haritası (hash map) veri yapısı.
  * Çakışmaları zincirleme (chaining) ile yönetir.
+ * Artımlı yeniden boyutlandırma etkinse büyüme sırasında iki tablo yan yana yaşar:
+ * yeni girişler `buckets`'a eklenir, eski girişler `old_buckets`'tan kademeli olarak taşınır
+ * ve aramalar her iki tabloya da bakar.
  */
 typedef struct fe_map {
     fe_list_t* buckets;            // Kovaları temsil eden bağlantılı listeler dizisi
     size_t                  capacity;           // Toplam kova sayısı (hash tablosunun boyutu)
     size_t                  size;               // Haritadaki eleman sayısı (anahtar-değer çiftleri)
     float                   load_factor_threshold; // Yeniden boyutlandırma için yük faktörü eşiği
+
+    fe_list_t*              old_buckets;        // Artımlı yeniden boyutlandırmada taşınmakta olan eski tablo (yoksa NULL)
+    size_t                  old_capacity;       // Eski tablonun kova sayısı
+    size_t                  rehash_index;       // Eski tabloda taşınacak bir sonraki kova indeksi
+    bool                    incremental_resize; // true ise büyüme tek seferde değil, işlemlere yayılarak yapılır
     
-    fe_hash_func        hash_key_cb;        // Anahtarları hashlemek için geri arama fonksiyonu
+    fe_hash_func        hash_key_cb;        // Anahtarları hashlemek için geri arama fonksiyonu (NULL ise fe_ds_hash_fast_seeded)
+    uint64_t            hash_seed;          // Varsayılan hash fonksiyonunun tohumu (bkz. fe_map_set_hash_seed)
     fe_compare_func     compare_key_cb;     // Anahtarları karşılaştırmak için geri arama fonksiyonu
     fe_data_free_func   free_key_cb;        // Anahtar verisini serbest bırakmak için geri arama (isteğe bağlı)
     fe_data_free_func   free_value_cb;      // Değer verisini serbest bırakmak için geri arama (isteğe bağlı)
@@ -44,7 +59,8 @@ typedef struct fe_map {
  *
  * @param map Başlatılacak hash haritası işaretçisi.
  * @param initial_capacity Başlangıç kova sayısı. İdeal olarak bir asal sayı.
- * @param hash_key_callback Anahtarları hashlemek için kullanılacak geri arama fonksiyonu. ZORUNLU.
+ * @param hash_key_callback İsteğe bağlı: Anahtarları hashlemek için kullanılacak geri arama fonksiyonu.
+ * NULL ise hızlı varsayılan hash (fe_ds_hash_fast_seeded, map->hash_seed ile) doğrudan çağrılır.
  * @param compare_key_callback Anahtarları karşılaştırmak için kullanılacak geri arama fonksiyonu. ZORUNLU.
  * @param free_key_callback İsteğe bağlı: Her anahtar için bir serbest bırakma geri arama fonksiyonu.
  * NULL ise anahtar serbest bırakılmaz (sadece fe_map_entry_t.key serbest bırakılır).
@@ -63,6 +79,59 @@ bool fe_map_init(fe_map_t* map,
                  fe_data_copy_func copy_key_callback,
                  fe_data_copy_func copy_value_callback);
 
+/**
+ * @brief Varsayılan hash fonksiyonunun tohumunu ayarlar. Ağdan gelen anahtarları tutan
+ * haritalarda hash taşkını saldırılarına karşı fe_ds_hash_random_seed() ile kullanılmalıdır.
+ * Yalnızca harita boşken çağrılabilir; özel hash_key_callback verilmişse etkisizdir.
+ *
+ * @param map İşlem yapılacak hash haritası.
+ * @param seed Yeni hash tohumu.
+ * @return bool Başarılı ise true, harita boş değilse false.
+ */
+bool fe_map_set_hash_seed(fe_map_t* map, uint64_t seed);
+
+/**
+ * @brief Artımlı (amortize) yeniden boyutlandırmayı açar veya kapatır.
+ * Açıkken yük faktörü aşıldığında yeni tablo tahsis edilir, ancak girişler her set/remove
+ * çağrısında en fazla FE_MAP_REHASH_BUCKETS_PER_OP dolu kova olacak şekilde taşınır; böylece
+ * büyük tabloların kare ortasında büyümesi tek bir uzun duraklamaya neden olmaz.
+ * Kapatıldığında devam eden taşıma hemen tamamlanır.
+ *
+ * @param map İşlem yapılacak hash haritası.
+ * @param enabled true ise artımlı mod etkinleşir.
+ */
+void fe_map_set_incremental_resize(fe_map_t* map, bool enabled);
+
+/**
+ * @brief Haritayı, expected_count girişi yük faktörünü aşmadan tutabilecek şekilde önceden boyutlandırır.
+ * Yükleyiciler, tabloyu baştan doğru boyutta açarak oyun sırasındaki büyümelerden kaçınmak için kullanmalıdır.
+ * Bu işlem her zaman anında (artımlı olmayan) yeniden boyutlandırma yapar.
+ *
+ * @param map İşlem yapılacak hash haritası.
+ * @param expected_count Beklenen toplam giriş sayısı.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_map_reserve(fe_map_t* map, size_t expected_count);
+
+/**
+ * @brief Devam eden artımlı yeniden boyutlandırmayı en fazla max_buckets dolu kova ilerletir.
+ * fe_map_get const olduğu için taşıma yapmaz; yalnızca okunan haritalarda taşımayı
+ * boşta kalan zamanda bitirmek için kullanılabilir.
+ *
+ * @param map İşlem yapılacak hash haritası.
+ * @param max_buckets Bu çağrıda taşınacak en fazla dolu kova sayısı.
+ * @return size_t Eski tabloda taşınmayı bekleyen kova sayısı (0 ise taşıma bitmiştir).
+ */
+size_t fe_map_rehash_step(fe_map_t* map, size_t max_buckets);
+
+/**
+ * @brief Haritanın artımlı yeniden boyutlandırma ortasında olup olmadığını döndürür.
+ *
+ * @param map İşlem yapılacak hash haritası.
+ * @return bool İki tablo yan yana yaşıyorsa true.
+ */
+bool fe_map_is_rehashing(const fe_map_t* map);
+
 /**
  * @brief Bir hash haritasını kapatır ve tüm elemanlarını ve varsa verilerini serbest bırakır.
  *
@@ -0,0 +1,243 @@
+#ifndef FE_RING_QUEUE_H
+#define FE_RING_QUEUE_H
+
+#include "core/utils/fe_types.h"   // Temel tipler (size_t, bool, uint8_t vb.)
+#include "core/utils/fe_atomic.h"  // fe_atomic_*, FE_CACHE_LINE_SIZE için
+
+#include <string.h> // memcpy için
+
+// --- Sınırlı Kilitsiz Halka Kuyruklar ---
+// Thread'ler arası iş aktarımı için sabit kapasiteli, eleman başına tahsis yapmayan iki kuyruk:
+//
+// - fe_spsc_queue_t: Tek üretici / tek tüketici. Render komutu gönderimi, ses parametre
+//   güncellemeleri gibi iki sabit thread arasındaki akışlar için. Push/pop birer atomik
+//   yükleme ve saklamadan ibarettir; karşı tarafın indeksi önbelleğe alınarak paylaşılan
+//   satıra yalnızca kuyruk dolu/boş göründüğünde dokunulur.
+//
+// - fe_mpmc_queue_t: Çok üretici / çok tüketici (Vyukov sınırlı kuyruğu). Ağ alım thread'lerinden
+//   oyun thread'ine paket aktarımı gibi birden fazla tarafın yazdığı/okuduğu akışlar için.
+//   Her hücre kendi sıra numarasını taşır; üreticiler ve tüketiciler yalnızca kendi
+//   indekslerinde CAS yapar.
+//
+// Ortak özellikler:
+// - Kapasite 2'nin kuvvetine yuvarlanır; elemanlar (element_size bayt) halka içinde satır içi
+//   tutulur ve push/pop sırasında memcpy ile kopyalanır.
+// - Üretici ve tüketici indeksleri ayrı önbellek satırlarındadır (yanlış paylaşım olmaz).
+// - Kuyruk doluysa push, boşsa pop hemen false döner; bekleme/uyutma çağıranın işidir.
+//
+// Kullanım:
+//   fe_spsc_queue_t q; fe_spsc_queue_init(&q, 1024, sizeof(fe_render_cmd_t));
+//   // üretici: if (!fe_spsc_queue_push(&q, &cmd)) { /* dolu */ }
+//   // tüketici: while (fe_spsc_queue_pop(&q, &cmd)) execute(&cmd);
+
+// --- Tek Üretici / Tek Tüketici Kuyruğu ---
+
+/**
+ * @brief Tek üretici / tek tüketici sınırlı halka kuyruk.
+ * head ve tail monoton artan sayaçlardır; halka indeksi (sayaç & mask) ile bulunur.
+ */
+typedef struct fe_spsc_queue {
+    // Tüketici tarafı
+    size_t  head;              // Bir sonraki okunacak sayaç (yalnızca tüketici yazar)
+    size_t  cached_tail;       // Tüketicinin son gördüğü tail değeri
+    uint8_t pad0[FE_CACHE_LINE_SIZE - 2 * sizeof(size_t)];
+
+    // Üretici tarafı
+    size_t  tail;              // Bir sonraki yazılacak sayaç (yalnızca üretici yazar)
+    size_t  cached_head;       // Üreticinin son gördüğü head değeri
+    uint8_t pad1[FE_CACHE_LINE_SIZE - 2 * sizeof(size_t)];
+
+    // Salt okunur (init sonrası)
+    uint8_t* buffer;           // capacity * element_size baytlık halka
+    size_t   capacity;         // Eleman kapasitesi (2'nin kuvveti)
+    size_t   mask;             // capacity - 1
+    size_t   element_size;     // Tek bir elemanın bayt cinsinden boyutu
+} fe_spsc_queue_t;
+
+/**
+ * @brief Bir SPSC kuyruğu başlatır ve halka belleğini tahsis eder.
+ *
+ * @param queue Başlatılacak kuyruk.
+ * @param capacity İstenen eleman kapasitesi (2'nin kuvvetine yukarı yuvarlanır, en az 2).
+ * @param element_size Tek bir elemanın bayt cinsinden boyutu.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_spsc_queue_init(fe_spsc_queue_t* queue, size_t capacity, size_t element_size);
+
+/**
+ * @brief Kuyruğun belleğini serbest bırakır. Hiçbir thread kuyruğu kullanmıyorken çağrılmalıdır.
+ *
+ * @param queue Kapatılacak kuyruk.
+ */
+void fe_spsc_queue_shutdown(fe_spsc_queue_t* queue);
+
+/**
+ * @brief Kuyruğun sonuna bir eleman ekler. Yalnızca üretici thread'den çağrılmalıdır.
+ *
+ * @param queue İşlem yapılacak kuyruk.
+ * @param element Kopyalanacak eleman (element_size bayt).
+ * @return bool Eklendiyse true, kuyruk doluysa false.
+ */
+static inline bool fe_spsc_queue_push(fe_spsc_queue_t* queue, const void* element) {
+    size_t tail = queue->tail; // Yalnızca üretici yazdığı için düz okuma yeterlidir
+    if (tail - queue->cached_head >= queue->capacity) {
+        queue->cached_head = fe_atomic_load_size(&queue->head, FE_ATOMIC_ACQUIRE);
+        if (tail - queue->cached_head >= queue->capacity) {
+            return false;
+        }
+    }
+    memcpy(queue->buffer + (tail & queue->mask) * queue->element_size, element, queue->element_size);
+    fe_atomic_store_size(&queue->tail, tail + 1, FE_ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Kuyruğun başındaki elemanı çıkarır. Yalnızca tüketici thread'den çağrılmalıdır.
+ *
+ * @param queue İşlem yapılacak kuyruk.
+ * @param out_element Elemanın kopyalanacağı adres (element_size bayt).
+ * @return bool Eleman çıkarıldıysa true, kuyruk boşsa false.
+ */
+static inline bool fe_spsc_queue_pop(fe_spsc_queue_t* queue, void* out_element) {
+    size_t head = queue->head; // Yalnızca tüketici yazdığı için düz okuma yeterlidir
+    if (head == queue->cached_tail) {
+        queue->cached_tail = fe_atomic_load_size(&queue->tail, FE_ATOMIC_ACQUIRE);
+        if (head == queue->cached_tail) {
+            return false;
+        }
+    }
+    memcpy(out_element, queue->buffer + (head & queue->mask) * queue->element_size, queue->element_size);
+    fe_atomic_store_size(&queue->head, head + 1, FE_ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Kuyruğun başındaki elemana, çıkarmadan bir işaretçi döndürür. Yalnızca tüketici
+ * thread'den çağrılmalıdır; işaretçi bir sonraki fe_spsc_queue_pop'a kadar geçerlidir.
+ *
+ * @param queue İşlem yapılacak kuyruk.
+ * @return void* Baştaki elemanın halka içindeki adresi, kuyruk boşsa NULL.
+ */
+static inline void* fe_spsc_queue_peek(fe_spsc_queue_t* queue) {
+    size_t head = queue->head;
+    if (head == queue->cached_tail) {
+        queue->cached_tail = fe_atomic_load_size(&queue->tail, FE_ATOMIC_ACQUIRE);
+        if (head == queue->cached_tail) {
+            return NULL;
+        }
+    }
+    return queue->buffer + (head & queue->mask) * queue->element_size;
+}
+
+/**
+ * @brief Kuyruktaki yaklaşık eleman sayısını döndürür. Diğer thread'ler çalışırken değer
+ * çağrı döndüğünde eskimiş olabilir; yalnızca istatistik/ayıklama amaçlıdır.
+ */
+size_t fe_spsc_queue_size_approx(const fe_spsc_queue_t* queue);
+
+// --- Çok Üretici / Çok Tüketici Kuyruğu ---
+
+/**
+ * @brief Çok üretici / çok tüketici sınırlı kuyruk (Dmitry Vyukov'un algoritması).
+ * Her hücrenin başında bir sıra numarası vardır:
+ * - sequence == pos           -> hücre boş, pos konumundaki üretici yazabilir
+ * - sequence == pos + 1       -> hücre dolu, pos konumundaki tüketici okuyabilir
+ * - sequence == pos + capacity -> hücre boşaltıldı, bir sonraki tura hazır
+ */
+typedef struct fe_mpmc_queue {
+    size_t  enqueue_pos;       // Üreticilerin paylaştığı yazma sayacı
+    uint8_t pad0[FE_CACHE_LINE_SIZE - sizeof(size_t)];
+
+    size_t  dequeue_pos;       // Tüketicilerin paylaştığı okuma sayacı
+    uint8_t pad1[FE_CACHE_LINE_SIZE - sizeof(size_t)];
+
+    // Salt okunur (init sonrası)
+    uint8_t* cells;            // capacity * cell_stride baytlık hücre dizisi
+    size_t   capacity;         // Hücre sayısı (2'nin kuvveti)
+    size_t   mask;             // capacity - 1
+    size_t   element_size;     // Tek bir elemanın bayt cinsinden boyutu
+    size_t   cell_stride;      // Sıra numarası + eleman, sizeof(size_t) hizalı
+} fe_mpmc_queue_t;
+
+/**
+ * @brief Bir MPMC kuyruğu başlatır ve hücre belleğini tahsis eder.
+ *
+ * @param queue Başlatılacak kuyruk.
+ * @param capacity İstenen eleman kapasitesi (2'nin kuvvetine yukarı yuvarlanır, en az 2).
+ * @param element_size Tek bir elemanın bayt cinsinden boyutu.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_mpmc_queue_init(fe_mpmc_queue_t* queue, size_t capacity, size_t element_size);
+
+/**
+ * @brief Kuyruğun belleğini serbest bırakır. Hiçbir thread kuyruğu kullanmıyorken çağrılmalıdır.
+ *
+ * @param queue Kapatılacak kuyruk.
+ */
+void fe_mpmc_queue_shutdown(fe_mpmc_queue_t* queue);
+
+/**
+ * @brief Kuyruğa bir eleman ekler. Herhangi bir thread'den çağrılabilir.
+ *
+ * @param queue İşlem yapılacak kuyruk.
+ * @param element Kopyalanacak eleman (element_size bayt).
+ * @return bool Eklendiyse true, kuyruk doluysa false.
+ */
+static inline bool fe_mpmc_queue_push(fe_mpmc_queue_t* queue, const void* element) {
+    size_t pos = fe_atomic_load_size(&queue->enqueue_pos, FE_ATOMIC_RELAXED);
+    uint8_t* cell;
+    for (;;) {
+        cell = queue->cells + (pos & queue->mask) * queue->cell_stride;
+        size_t seq = fe_atomic_load_size((size_t*)cell, FE_ATOMIC_ACQUIRE);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (fe_atomic_compare_exchange_size(&queue->enqueue_pos, &pos, pos + 1, FE_ATOMIC_RELAXED)) {
+                break;
+            }
+            // CAS başarısız: pos güncel değerle dolduruldu, tekrar dene
+        } else if (diff < 0) {
+            return false; // Hücre bir önceki turdan hâlâ dolu: kuyruk dolu
+        } else {
+            pos = fe_atomic_load_size(&queue->enqueue_pos, FE_ATOMIC_RELAXED);
+        }
+    }
+    memcpy(cell + sizeof(size_t), element, queue->element_size);
+    fe_atomic_store_size((size_t*)cell, pos + 1, FE_ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Kuyruktan bir eleman çıkarır. Herhangi bir thread'den çağrılabilir.
+ *
+ * @param queue İşlem yapılacak kuyruk.
+ * @param out_element Elemanın kopyalanacağı adres (element_size bayt).
+ * @return bool Eleman çıkarıldıysa true, kuyruk boşsa false.
+ */
+static inline bool fe_mpmc_queue_pop(fe_mpmc_queue_t* queue, void* out_element) {
+    size_t pos = fe_atomic_load_size(&queue->dequeue_pos, FE_ATOMIC_RELAXED);
+    uint8_t* cell;
+    for (;;) {
+        cell = queue->cells + (pos & queue->mask) * queue->cell_stride;
+        size_t seq = fe_atomic_load_size((size_t*)cell, FE_ATOMIC_ACQUIRE);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (fe_atomic_compare_exchange_size(&queue->dequeue_pos, &pos, pos + 1, FE_ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false; // Hücre henüz yazılmadı: kuyruk boş
+        } else {
+            pos = fe_atomic_load_size(&queue->dequeue_pos, FE_ATOMIC_RELAXED);
+        }
+    }
+    memcpy(out_element, cell + sizeof(size_t), queue->element_size);
+    fe_atomic_store_size((size_t*)cell, pos + queue->mask + 1, FE_ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Kuyruktaki yaklaşık eleman sayısını döndürür. Yalnızca istatistik/ayıklama amaçlıdır.
+ */
+size_t fe_mpmc_queue_size_approx(const fe_mpmc_queue_t* queue);
+
+#endif // FE_RING_QUEUE_H
@@ -0,0 +1,135 @@
+#ifndef FE_SORT_H
+#define FE_SORT_H
+
+#include "core/utils/fe_types.h" // Temel tipler (size_t, bool, uint32_t vb.)
+#include "core/ds/fe_ds_types.h" // fe_compare_func için
+
+#include <string.h> // memcpy için
+
+// --- Sıralama Primitifleri ---
+// Her kare sıralanan bitişik diziler (çizim anahtarları, broadphase uç noktaları, ağ öncelik
+// kuyrukları) için iki yol sunulur:
+//
+// - fe_sort_radix_u32 / fe_sort_radix_u64: LSD radix sort. Karşılaştırma yapmaz; O(n) ve
+//   kararlıdır (eşit anahtarlar giriş sırasını korur). Her anahtara isteğe bağlı bir uint32_t
+//   yük (genellikle orijinal dizi indeksi) eşlik eder ve anahtarla birlikte taşınır.
+//   Tüm basamak histogramları tek geçişte çıkarılır; tüm anahtarlarda aynı olan basamaklar
+//   (ör. yalnızca alt bitleri kullanılan anahtarların üst baytları) atlanır.
+//
+// - fe_sort_merge / fe_sort_parallel_merge: Karşılaştırıcı alan kararlı birleştirmeli sıralama.
+//   Paralel sürüm diziyi thread'ler arasında parçalar, parçaları eşzamanlı sıralar ve
+//   ardından çiftler halinde paralel olarak birleştirir.
+//
+// İşaretli tamsayı ve float anahtarlar, sıralamayı koruyan fe_sort_key_* dönüşümleriyle
+// radix sort'a verilebilir.
+//
+// Kullanım:
+//   for (i...) { keys[i] = fe_sort_key_from_float(depth[i]); indices[i] = i; }
+//   fe_sort_radix_u32(keys, indices, count, NULL);
+
+// Bu eleman sayısının altında radix/merge yerine eklemeli sıralama kullanılır.
+#define FE_SORT_SMALL_THRESHOLD 48
+
+// fe_sort_parallel_merge, görev başına bu kadar elemandan azı düşüyorsa diziyi bölmez.
+#define FE_SORT_PARALLEL_MIN_PER_THREAD 16384
+
+// fe_sort_parallel_merge'in diziyi bölebileceği en fazla görev sayısı.
+#define FE_SORT_MAX_THREADS 32
+
+// --- Anahtar Dönüşümleri ---
+
+/**
+ * @brief İşaretli 32-bit tamsayıyı, işaretsiz sıralaması işaretli sıralamayla aynı olan anahtara çevirir.
+ */
+static inline uint32_t fe_sort_key_from_i32(int32_t value) {
+    return (uint32_t)value ^ 0x80000000u;
+}
+
+static inline uint64_t fe_sort_key_from_i64(int64_t value) {
+    return (uint64_t)value ^ 0x8000000000000000ull;
+}
+
+/**
+ * @brief float'ı, işaretsiz sıralaması float sıralamasıyla aynı olan anahtara çevirir.
+ * Negatif sayılarda tüm bitler, pozitiflerde yalnızca işaret biti çevrilir. NaN'lar sona düşer.
+ */
+static inline uint32_t fe_sort_key_from_float(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t mask = (uint32_t)(-(int32_t)(bits >> 31)) | 0x80000000u;
+    return bits ^ mask;
+}
+
+static inline float fe_sort_key_to_float(uint32_t key) {
+    uint32_t mask = ((key >> 31) - 1u) | 0x80000000u;
+    uint32_t bits = key ^ mask;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// --- Radix Sort ---
+
+/**
+ * @brief fe_sort_radix_u32 için gereken geçici bellek boyutunu döndürür.
+ * Her kare sıralama yapan sistemler bu boyutta bir tamponu bir kez ayırıp tekrar kullanabilir.
+ *
+ * @param count Eleman sayısı.
+ * @param with_payloads Yük dizisi kullanılacaksa true.
+ * @return size_t Bayt cinsinden boyut.
+ */
+size_t fe_sort_radix_u32_scratch_size(size_t count, bool with_payloads);
+
+/**
+ * @brief fe_sort_radix_u64 için gereken geçici bellek boyutunu döndürür.
+ */
+size_t fe_sort_radix_u64_scratch_size(size_t count, bool with_payloads);
+
+/**
+ * @brief 32-bit anahtarları (ve varsa yüklerini) artan sırada, kararlı olarak sıralar.
+ *
+ * @param keys Sıralanacak anahtar dizisi (yerinde sıralanır).
+ * @param payloads İsteğe bağlı: anahtarlarla birlikte taşınacak yük dizisi (NULL olabilir).
+ * @param count Eleman sayısı.
+ * @param scratch İsteğe bağlı: en az fe_sort_radix_u32_scratch_size bayt, 8 bayt hizalı geçici bellek.
+ * NULL ise FE_MEM_TYPE_TEMP ile tahsis edilip serbest bırakılır.
+ * @return bool Başarılı ise true, geçici bellek tahsis edilemezse false (dizi değişmez).
+ */
+bool fe_sort_radix_u32(uint32_t* keys, uint32_t* payloads, size_t count, void* scratch);
+
+/**
+ * @brief 64-bit anahtarları (ve varsa yüklerini) artan sırada, kararlı olarak sıralar.
+ * Parametreler fe_sort_radix_u32 ile aynıdır; scratch boyutu fe_sort_radix_u64_scratch_size'dır.
+ */
+bool fe_sort_radix_u64(uint64_t* keys, uint32_t* payloads, size_t count, void* scratch);
+
+// --- Karşılaştırmalı (Birleştirmeli) Sıralama ---
+
+/**
+ * @brief Bitişik bir diziyi karşılaştırıcıyla, tek thread'de kararlı olarak sıralar.
+ *
+ * @param base Dizinin başlangıcı.
+ * @param count Eleman sayısı.
+ * @param element_size Tek bir elemanın bayt cinsinden boyutu.
+ * @param compare Karşılaştırma fonksiyonu (ör. fe_ds_compare_int).
+ * @return bool Başarılı ise true, geçici bellek tahsis edilemezse false (dizi değişmez).
+ */
+bool fe_sort_merge(void* base, size_t count, size_t element_size, fe_compare_func compare);
+
+/**
+ * @brief Bitişik bir diziyi karşılaştırıcıyla, iş sistemi (core/jobs/fe_job_system.h) üzerinde
+ * kararlı olarak sıralar. Karşılaştırıcı thread-safe olmalıdır (yalnızca iki elemanı okuyan saf
+ * fonksiyonlar uygundur). Küçük dizilerde veya iş sistemi başlatılmamışsa çağıran thread'de
+ * çalışır; sonuç her durumda aynıdır. Bir işin içinden de çağrılabilir.
+ *
+ * @param base Dizinin başlangıcı.
+ * @param count Eleman sayısı.
+ * @param element_size Tek bir elemanın bayt cinsinden boyutu.
+ * @param compare Karşılaştırma fonksiyonu.
+ * @param thread_count Dizinin bölüneceği görev sayısı. 0 ise iş sistemindeki thread sayısı
+ * (işçiler + ana thread) kullanılır.
+ * @return bool Başarılı ise true, geçici bellek tahsis edilemezse false (dizi değişmez).
+ */
+bool fe_sort_parallel_merge(void* base, size_t count, size_t element_size, fe_compare_func compare, uint32_t thread_count);
+
+#endif // FE_SORT_H
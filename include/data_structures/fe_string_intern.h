@@ -0,0 +1,125 @@
+#ifndef FE_STRING_INTERN_H
+#define FE_STRING_INTERN_H
+
+#include "core/utils/fe_types.h"            // Temel tipler (size_t, bool, uint32_t vb.)
+#include "core/ds/fe_ds_types.h"            // fe_ds_hash_fast, FE_DS_HASH_LITERAL için
+#include "core/containers/fe_hash_map.g.h"  // fe_hash_map_hash_u64 için
+
+// --- Global String Havuzu (String Interning) ---
+// Kemik adları, klip adları, ses ID'leri ve varlık yolları gibi tekrar tekrar aranan
+// string'ler bir kez havuza eklenir ve yerine 32-bit bir tanıtıcı (handle) kullanılır.
+// Aynı içerik her zaman aynı tanıtıcıyı döndürür; bu sayede sıcak döngülerde string
+// hashleme ve karşılaştırma yerine tek bir tamsayı karşılaştırması yapılır.
+//
+// - Tanıtıcılar ve döndürülen const char* işaretçileri fe_string_intern_shutdown'a kadar geçerlidir.
+// - Her girişin içerik hash'i (fe_ds_hash_fast) ekleme sırasında bir kez hesaplanır ve saklanır.
+// - Ekleme/arama thread-safe'tir (okuyucu/yazıcı kilidi). Tanıtıcıdan string/hash okuma
+//   kilitsizdir; girişler sabit sayfalarda tutulur ve tablo büyüse de yer değiştirmez.
+// - Tanıtıcılar yalnızca süreç ömrü boyunca kararlıdır; diske yazılacaksa içerik hash'i kullanılmalıdır.
+//
+// Kullanım:
+//   fe_string_id_t hip = fe_string_intern("Hip");
+//   if (bone->name_id == hip) { ... }
+//   printf("%s", fe_string_intern_c_str(hip));
+
+/**
+ * @brief Havuza eklenmiş bir string'in tanıtıcısı.
+ */
+typedef uint32_t fe_string_id_t;
+
+// Geçersiz/boş tanıtıcı. fe_string_intern_c_str bu değer için "" döndürür.
+#define FE_STRING_ID_INVALID ((fe_string_id_t)0)
+
+// Havuzun tutabileceği en fazla string sayısı (sayfa başına giriş x sayfa sayısı).
+#define FE_STRING_INTERN_PAGE_BITS 10
+#define FE_STRING_INTERN_MAX_PAGES 4096
+
+/**
+ * @brief Bir string'i havuza ekler (zaten varsa mevcut tanıtıcıyı döndürür).
+ *
+ * @param str Null ile sonlanan string.
+ * @return fe_string_id_t String'in tanıtıcısı, str NULL ise veya bellek yetersizse FE_STRING_ID_INVALID.
+ */
+fe_string_id_t fe_string_intern(const char* str);
+
+/**
+ * @brief Uzunluğu bilinen (null ile sonlanması gerekmeyen) bir string'i havuza ekler.
+ *
+ * @param str String verisi.
+ * @param length Bayt cinsinden uzunluk.
+ * @return fe_string_id_t String'in tanıtıcısı, hata durumunda FE_STRING_ID_INVALID.
+ */
+fe_string_id_t fe_string_intern_n(const char* str, size_t length);
+
+/**
+ * @brief İçerik hash'i önceden bilinen bir string'i havuza ekler; hash yeniden hesaplanmaz.
+ * hash, fe_ds_hash_fast(str, length) ile aynı olmalıdır (bkz. FE_STRING_ID).
+ *
+ * @param str String verisi.
+ * @param length Bayt cinsinden uzunluk.
+ * @param hash String'in fe_ds_hash_fast değeri.
+ * @return fe_string_id_t String'in tanıtıcısı, hata durumunda FE_STRING_ID_INVALID.
+ */
+fe_string_id_t fe_string_intern_with_hash(const char* str, size_t length, uint64_t hash);
+
+/**
+ * @brief Bir string'in tanıtıcısını ekleme yapmadan arar.
+ * Yalnızca okuma yapan yollarda (ör. "bu isimde bir klip var mı?") havuzun gereksiz
+ * büyümesini önlemek için kullanılır.
+ *
+ * @param str Null ile sonlanan string.
+ * @return fe_string_id_t String havuzdaysa tanıtıcısı, değilse FE_STRING_ID_INVALID.
+ */
+fe_string_id_t fe_string_intern_find(const char* str);
+
+/**
+ * @brief Tanıtıcıya ait string'i döndürür. Kilitsizdir.
+ *
+ * @param id String tanıtıcısı.
+ * @return const char* Null ile sonlanan string; geçersiz tanıtıcı için "".
+ */
+const char* fe_string_intern_c_str(fe_string_id_t id);
+
+/**
+ * @brief Tanıtıcıya ait string'in bayt cinsinden uzunluğunu döndürür. Kilitsizdir.
+ */
+size_t fe_string_intern_length(fe_string_id_t id);
+
+/**
+ * @brief Tanıtıcıya ait önceden hesaplanmış içerik hash'ini (fe_ds_hash_fast) döndürür. Kilitsizdir.
+ * Tanıtıcıların aksine bu değer süreçler arasında kararlıdır.
+ */
+uint64_t fe_string_intern_hash(fe_string_id_t id);
+
+/**
+ * @brief Havuzdaki string sayısını döndürür.
+ */
+size_t fe_string_intern_count(void);
+
+/**
+ * @brief Havuzu ve tüm string belleğini serbest bırakır. Daha önce döndürülen tüm tanıtıcılar
+ * ve işaretçiler geçersiz olur. Başka thread'ler havuzu kullanırken çağrılmamalıdır.
+ * Havuz ilk kullanımda kendiliğinden başlatılır; ayrı bir init fonksiyonu yoktur.
+ */
+void fe_string_intern_shutdown(void);
+
+/**
+ * @brief Bir string sabitini, hash'ini derleme zamanında katlanabilir şekilde hesaplayarak havuza ekler.
+ * Örnek: static fe_string_id_t s_hip; if (!s_hip) s_hip = FE_STRING_ID("Hip");
+ */
+#define FE_STRING_ID(str_literal) \
+    fe_string_intern_with_hash((str_literal), sizeof(str_literal) - 1, FE_DS_HASH_LITERAL(str_literal))
+
+// --- Tip Özelleştirilmiş Hash Haritası Yardımcıları ---
+// Tanıtıcılar yoğun sıralı tamsayılar olduğundan karıştırılarak hashlenir; string'e hiç dokunulmaz.
+//   FE_HASH_MAP_DECLARE(fe_bone_index_map, fe_string_id_t, int, fe_string_id_hash, fe_string_id_eq)
+
+static inline uint64_t fe_string_id_hash(fe_string_id_t id) {
+    return fe_hash_map_hash_u64((uint64_t)id);
+}
+
+static inline bool fe_string_id_eq(fe_string_id_t a, fe_string_id_t b) {
+    return a == b;
+}
+
+#endif // FE_STRING_INTERN_H
@@ -3,6 +3,8 @@
 
 #include "core/utils/fe_types.h"       // Temel tipler (uint32_t, bool vb.)
 #include "core/containers/fe_hash_map.g.h" // Varlıkları saklamak için bir hash haritası
+#include "core/containers/fe_string_intern.h" // Varlık yolu tanıtıcıları (fe_string_id_t) için
+#include "core/containers/fe_intrusive_list.h" // Kullanılmayan varlıkların LRU listesi için
 #include "core/memory/fe_memory_manager.h" // Bellek yönetimi için
 
 // İleri bildirimler (gerçek varlık tipleri burada tanımlanmaz)
@@ -23,24 +25,149 @@ typedef enum fe_asset_type {
     FE_ASSET_TYPE_COUNT // Toplam varlık tipi sayısını tutar
 } fe_asset_type_t;
 
+/**
+ * @brief Bir varlığın bağımlılığı (ör. modelin materyali, materyalin dokusu ve shader'ı).
+ */
+typedef struct fe_asset_dependency {
+    fe_string_id_t  path_id;  // Bağımlılığın yolu
+    fe_asset_type_t type;
+    uint64_t        asset_id; // Yüklü varlıkta tutulan bağımlılığın kimliği (bildirimlerde 0)
+} fe_asset_dependency_t;
+
 // --- Temel Varlık Yapısı ---
 // Tüm varlık tipleri bu yapıyı içermelidir (veya ilk üyesi olmalıdır)
 // böylece genel bir fe_asset_t* olarak ele alınabilirler.
 typedef struct fe_asset {
     uint64_t id;                 // Benzersiz varlık kimliği (path hash'i olabilir)
     char     path[256];          // Varlığın dosya yolu (mutlak veya göreceli)
+    fe_string_id_t path_id;      // Yolun havuzdaki tanıtıcısı (önbellek anahtarı)
     fe_asset_type_t type;        // Varlık tipi
     uint32_t ref_count;          // Referans sayacı: Kaç bileşenin bu varlığı kullandığını gösterir
     size_t   data_size;          // Varlık verisinin bellekteki boyutu (isteğe bağlı, izleme için)
     void* data_ptr;           // Varlık verisine işaretçi (örneğin, fe_texture_t*, fe_model_t*)
+    fe_ilist_node_t lru_node;    // ref_count sıfırken tipin LRU listesindeki düğümü (ayrılmışsa ayrılmışlar listesinde)
+    bool     detached;           // Tip uyumsuzluğuyla önbellekten çıkarıldı; son referansla boşaltılır
+    fe_asset_dependency_t* dependencies; // Bu varlığın referans tuttuğu bağımlılıklar
+    uint32_t dependency_count;
     // Ek meta veriler buraya eklenebilir (örneğin, yükleme bayrakları, son erişim zamanı)
 } fe_asset_t;
 
+// Varlık yolu tanıtıcısı -> Varlık pointer'ı haritası. Önbellek aramaları yol string'ini
+// hashlemez veya karşılaştırmaz; yol yalnızca havuza eklenirken bir kez hashlenir.
+FE_HASH_MAP_DECLARE(fe_asset_cache_map, fe_string_id_t, fe_asset_t*, fe_string_id_hash, fe_string_id_eq)
+
+// --- Bağımlılıklar ---
+// Bir varlığın bağımlılıkları fe_asset_manager_add_dependency ile yoluna göre bildirilir. Varlık
+// yüklenirken önce bağımlılıkları yüklenir; yüklü varlık her bağımlılığında bir referans tutar ve
+// boşaltılınca bırakır. Bildirimler yönlü döngüsüz bir çizge (DAG) oluşturur; döngü oluşturacak
+// bildirim reddedilir. Bildirimler sonraki yüklemelere uygulanır; yüklü varlıklar etkilenmez.
+// Asenkron yüklemede bağımlılıklar aynı öncelikle kuyruğa alınır ve ebeveynle paralel okunup
+// çözülür; ebeveynin upload'ı ve tamamlanması tüm bağımlılıkları yüklenene kadar bekletilir.
+// Paylaşılan bir bağımlılık (ör. birçok materyalin kullandığı doku) yalnızca bir kez yüklenir.
+
+/**
+ * @brief Bir yol için bildirilmiş bağımlılıklar (dahili).
+ */
+typedef struct fe_asset_dependency_list {
+    fe_asset_dependency_t* items;
+    uint32_t count;
+    uint32_t capacity;
+} fe_asset_dependency_list_t;
+
+// Varlık yolu tanıtıcısı -> Bildirilmiş bağımlılıklar
+FE_HASH_MAP_DECLARE(fe_asset_dependency_map, fe_string_id_t, fe_asset_dependency_list_t*, fe_string_id_hash, fe_string_id_eq)
+
+// --- Önbellek Bütçesi ---
+// Referansı sıfıra düşen varlık hemen boşaltılmaz; tipinin LRU listesine eklenir ve yeniden
+// istenirse diskten okunmadan döndürülür. Bir tipin yüklü bayt toplamı bütçesini aştığında en uzun
+// süredir kullanılmayan varlıklardan başlayarak boşaltılır. Referansı olan varlıklar hiçbir zaman
+// boşaltılmaz; bu yüzden kullanılan varlıklar tek başına bütçeyi aşabilir.
+// Bütçe 0 ise (varsayılan) kullanılmayan varlık tutulmaz: referans sıfıra düşünce boşaltılır.
+
+/**
+ * @brief Bir varlık tipinin önbellek sayaçları.
+ */
+typedef struct fe_asset_cache_stats {
+    uint64_t hits;            // Önbellekten karşılanan yüklemeler
+    uint64_t misses;          // Diskten yapılan yüklemeler
+    uint64_t evictions;       // Bütçe nedeniyle boşaltılan varlıklar
+    uint64_t evicted_bytes;
+    size_t   budget_bytes;    // 0 ise kullanılmayan varlık tutulmaz
+    size_t   resident_bytes;  // Yüklü tüm varlıkların data_size toplamı
+    size_t   unused_bytes;    // Bunun LRU'daki (referanssız) kısmı
+    uint32_t resident_count;
+    uint32_t unused_count;
+} fe_asset_cache_stats_t;
+
+/**
+ * @brief Tip başına önbellek durumu (dahili).
+ */
+typedef struct fe_asset_type_cache {
+    fe_ilist_t             lru;   // Referanssız varlıklar; baştaki en eskisi
+    fe_asset_cache_stats_t stats;
+} fe_asset_type_cache_t;
+
+// --- Asenkron Yükleme ---
+// fe_asset_manager_load_asset_async hemen bir tanıtıcı döndürür; yükleme üç aşamada ilerler:
+//   1. G/Ç:    Dosya baytları okunur. Bağlı bir pak arşivindeki dosyalar dosya önbelleğinden
+//              (sıfır kopya), diğerleri platform/fe_async_io ile arka planda okunur.
+//   2. Çözme:  Tip yükleyicisinin decode fonksiyonu iş sistemi işçilerinde çalışır.
+//   3. Yükleme: upload fonksiyonu (ör. GPU'ya aktarım) ana thread'de, kare başına sınırlı
+//              sayıda çalışır; böylece kare süresinde ani sıçrama olmaz.
+// Aşamalar fe_asset_manager_update'in her karedeki çağrısıyla ilerler. Bekleyen işler öncelik
+// sınıfına göre (CRITICAL önce) başlatılır; aynı yol için gelen istekler tek bir yüklemeyi paylaşır.
+// Yönetici ana thread'e aittir: async API'ler ve update yalnızca ana thread'den çağrılmalıdır.
+
+// Aynı anda uçuşta olabilecek en fazla asenkron yükleme ve tanıtıcı sayısı
+#define FE_ASSET_MANAGER_MAX_ASYNC_LOADS 256
+// Aynı anda dosya okuması süren en fazla yükleme
+#define FE_ASSET_MANAGER_MAX_IO_IN_FLIGHT 32
+// Aynı anda işçilerde çözülen en fazla yükleme
+#define FE_ASSET_MANAGER_MAX_DECODES_IN_FLIGHT 16
+// Bir fe_asset_manager_update çağrısında çalıştırılan en fazla upload
+#define FE_ASSET_MANAGER_MAX_UPLOADS_PER_UPDATE 8
+
+/**
+ * @brief Asenkron yükleme öncelik sınıfı. Küçük değer önce başlatılır.
+ */
+typedef enum fe_asset_load_priority {
+    FE_ASSET_LOAD_PRIORITY_CRITICAL = 0, // Oynanışı bloklayan (oyuncunun silahı, UI)
+    FE_ASSET_LOAD_PRIORITY_HIGH,         // Görüş alanındaki yakın nesneler
+    FE_ASSET_LOAD_PRIORITY_NORMAL,
+    FE_ASSET_LOAD_PRIORITY_LOW,          // Önden yükleme (prefetch), uzak LOD'lar
+    FE_ASSET_LOAD_PRIORITY_COUNT
+} fe_asset_load_priority_t;
+
+/**
+ * @brief Asenkron yüklemenin durumu.
+ */
+typedef enum fe_asset_load_state {
+    FE_ASSET_LOAD_STATE_INVALID = 0, // Tanıtıcı geçersiz veya sonucu zaten teslim edildi
+    FE_ASSET_LOAD_STATE_QUEUED,      // Başlamayı bekliyor
+    FE_ASSET_LOAD_STATE_IO,          // Dosya okunuyor
+    FE_ASSET_LOAD_STATE_DECODING,    // İşçide çözülüyor
+    FE_ASSET_LOAD_STATE_UPLOADING,   // Ana thread'de upload bekliyor
+    FE_ASSET_LOAD_STATE_READY,       // Tamamlandı
+    FE_ASSET_LOAD_STATE_FAILED,
+    FE_ASSET_LOAD_STATE_CANCELLED
+} fe_asset_load_state_t;
+
+// Asenkron yükleme tanıtıcısı. 0 geçersizdir.
+typedef uint64_t fe_asset_load_handle_t;
+#define FE_ASSET_LOAD_INVALID_HANDLE ((fe_asset_load_handle_t)0)
+
+// Asenkron yükleme kuyruğu (dahili)
+typedef struct fe_asset_load_queue fe_asset_load_queue_t;
+
 // --- Varlık Yöneticisi Yapısı ---
 // Varlıkların önbelleğini tutar.
 typedef struct fe_asset_manager {
-    FE_HASH_MAP_DEFINE(const char*, fe_asset_t*) assets_cache; // Varlık yolu -> Varlık pointer'ı
+    fe_asset_cache_map_t assets_cache; // Varlık yolu tanıtıcısı -> Varlık pointer'ı
     uint64_t next_asset_id; // Yeni varlıklara benzersiz ID atamak için sayaç
+    fe_asset_load_queue_t* load_queue; // Asenkron yükleme durumu
+    fe_asset_type_cache_t type_caches[FE_ASSET_TYPE_COUNT]; // Tip başına LRU ve bütçe
+    fe_asset_dependency_map_t declared_dependencies; // Yol -> bildirilmiş bağımlılıklar
+    fe_ilist_t detached; // Önbellekten çıkarılmış ama hâlâ referans tutulan varlıklar
 } fe_asset_manager_t;
 
 // --- Fonksiyon Deklarasyonları ---
@@ -68,9 +195,20 @@ void fe_asset_manager_shutdown(fe_asset_manager_t* manager);
  */
 fe_asset_t* fe_asset_manager_load_asset(fe_asset_manager_t* manager, const char* file_path, fe_asset_type_t asset_type);
 
+/**
+ * @brief fe_asset_manager_load_asset'in yol tanıtıcısı alan sürümü. Önbellekte bulunan
+ * varlıklar için string işlemi yapılmaz.
+ * @param manager fe_asset_manager_t yapısının işaretçisi.
+ * @param path_id Varlık yolunun tanıtıcısı (fe_string_intern(file_path)).
+ * @param asset_type Varlığın tipi.
+ * @return fe_asset_t* Yüklenen/alınan varlığın işaretçisi, hata durumunda NULL.
+ */
+fe_asset_t* fe_asset_manager_load_asset_by_id(fe_asset_manager_t* manager, fe_string_id_t path_id, fe_asset_type_t asset_type);
+
 /**
  * @brief Bir varlığın referans sayacını azaltır.
- * Sayaç sıfıra ulaştığında varlığı bellekten atar.
+ * Sayaç sıfıra ulaştığında varlık tipinin LRU listesine eklenir; tipin bütçesi aşılıyorsa
+ * (veya bütçe 0 ise) en eski kullanılmayan varlıklar bellekten atılır.
  * @param manager fe_asset_manager_t yapısının işaretçisi.
  * @param asset Varlığın işaretçisi.
  */
@@ -85,6 +223,100 @@ void fe_asset_manager_release_asset(fe_asset_manager_t* manager, fe_asset_t* ass
  */
 void fe_asset_manager_unload_all_assets_of_type(fe_asset_manager_t* manager, fe_asset_type_t asset_type);
 
+/**
+ * @brief Bir varlık tipinin önbellek bütçesini ayarlar ve gerekiyorsa hemen boşaltma yapar.
+ * @param budget_bytes Tipin yüklü bayt sınırı; 0 ise kullanılmayan varlık tutulmaz.
+ */
+void fe_asset_manager_set_type_budget(fe_asset_manager_t* manager, fe_asset_type_t asset_type, size_t budget_bytes);
+
+/**
+ * @brief Referansı olmayan tüm varlıkları bütçeden bağımsız boşaltır (ör. seviye geçişinde).
+ * @param asset_type Boşaltılacak tip. FE_ASSET_TYPE_UNKNOWN tüm tipleri boşaltır.
+ * @return uint32_t Boşaltılan varlık sayısı.
+ */
+uint32_t fe_asset_manager_purge_unused(fe_asset_manager_t* manager, fe_asset_type_t asset_type);
+
+/**
+ * @brief Önbellek sayaçlarını döndürür.
+ * @param asset_type İstenen tip. FE_ASSET_TYPE_UNKNOWN tüm tiplerin toplamını döndürür.
+ */
+void fe_asset_manager_get_cache_stats(const fe_asset_manager_t* manager, fe_asset_type_t asset_type, fe_asset_cache_stats_t* out_stats);
+
+/**
+ * @brief asset_path'in dependency_path'e bağımlı olduğunu bildirir. Aynı bildirim tekrar
+ * yapılırsa yok sayılır.
+ * @return bool Başarılı ise true; bildirim bir döngü oluşturacaksa veya parametreler geçersizse false.
+ */
+bool fe_asset_manager_add_dependency(fe_asset_manager_t* manager, const char* asset_path,
+                                     const char* dependency_path, fe_asset_type_t dependency_type);
+
+/**
+ * @brief asset_path için bildirilmiş tüm bağımlılıkları siler.
+ */
+void fe_asset_manager_clear_dependencies(fe_asset_manager_t* manager, const char* asset_path);
+
+/**
+ * @brief Toplu yükleme isteği.
+ */
+typedef struct fe_asset_load_request {
+    const char*     path;
+    fe_asset_type_t type;
+} fe_asset_load_request_t;
+
+/**
+ * @brief Birden çok varlığı bağımlılıklarıyla birlikte yükler ve hepsi bitene kadar bekler.
+ * Tüm istekler ve bağımlılık çizgesinin tamamı tek seferde asenkron kuyruğa alınır; birbirinden
+ * bağımsız yapraklar paralel okunup çözülür, paylaşılan bağımlılıklar bir kez yüklenir.
+ * @param out_assets count elemanlı dizi; her biri bir referansla döner, başarısızlarda NULL.
+ * @return uint32_t Başarıyla yüklenen istek sayısı.
+ */
+uint32_t fe_asset_manager_load_batch(fe_asset_manager_t* manager, const fe_asset_load_request_t* requests, uint32_t count,
+                                     fe_asset_load_priority_t priority, fe_asset_t** out_assets);
+
+/**
+ * @brief Bir varlığı arka planda yüklemeye başlar ve hemen döner. Varlık zaten yüklüyse
+ * tanıtıcı hemen READY olur; aynı yol zaten yükleniyorsa o yüklemeye bağlanır. Bildirilmiş
+ * bağımlılıklar da kuyruğa alınır; varlık ancak hepsi yüklenince READY olur.
+ * @param priority Öncelik sınıfı; bağlanılan yüklemenin önceliği gerekirse yükseltilir.
+ * @return fe_asset_load_handle_t Tanıtıcı; tanıtıcı tablosu doluysa veya parametreler geçersizse
+ * FE_ASSET_LOAD_INVALID_HANDLE.
+ */
+fe_asset_load_handle_t fe_asset_manager_load_asset_async(fe_asset_manager_t* manager, const char* file_path,
+                                                         fe_asset_type_t asset_type, fe_asset_load_priority_t priority);
+
+/**
+ * @brief Yüklemenin durumunu bloklamadan döndürür. READY, FAILED veya CANCELLED döndüğünde sonuç
+ * teslim edilmiş olur ve tanıtıcı serbest kalır (sonraki çağrılar INVALID döndürür).
+ * @param out_asset READY ise varlık; çağıran bir referansın sahibi olur ve
+ * fe_asset_manager_release_asset ile bırakmalıdır. Diğer durumlarda NULL.
+ */
+fe_asset_load_state_t fe_asset_manager_poll_load(fe_asset_manager_t* manager, fe_asset_load_handle_t handle, fe_asset_t** out_asset);
+
+/**
+ * @brief Yükleme bitene kadar kuyruğu ilerletir (beklerken iş sistemine yardım eder) ve sonucu
+ * fe_asset_manager_poll_load gibi teslim eder.
+ * @return fe_asset_t* Yüklenen varlık (bir referansla); başarısızlık veya iptalde NULL.
+ */
+fe_asset_t* fe_asset_manager_wait_load(fe_asset_manager_t* manager, fe_asset_load_handle_t handle);
+
+/**
+ * @brief Yüklemeyi iptal eder ve tanıtıcıyı serbest bırakır. Aynı yüklemeye bağlı başka tanıtıcı
+ * yoksa okuma bırakılır; çözme sürüyorsa sonucu geldiğinde atılır.
+ * @return bool Tanıtıcı geçerli ve henüz teslim edilmemişse true.
+ */
+bool fe_asset_manager_cancel_load(fe_asset_manager_t* manager, fe_asset_load_handle_t handle);
+
+/**
+ * @brief Henüz başlamamış bir yüklemenin öncelik sınıfını değiştirir (ör. oyuncu yaklaştıkça).
+ */
+void fe_asset_manager_set_load_priority(fe_asset_manager_t* manager, fe_asset_load_handle_t handle, fe_asset_load_priority_t priority);
+
+/**
+ * @brief Asenkron yüklemeleri ilerletir: okumaları başlatır, çözme işlerini gönderir, upload'ları
+ * çalıştırır ve tamamlanan varlıkları önbelleğe ekler. Ana thread'den kare başına bir kez çağrılır.
+ */
+void fe_asset_manager_update(fe_asset_manager_t* manager);
+
 // --- Özel Yükleyici Fonksiyon Deklarasyonları (dahili veya harici olabilir) ---
 // Bu fonksiyonlar, gerçek varlık verilerini yüklemekten sorumludur.
 // Bunlar, asset manager'dan bağımsız bir varlık yükleme modülü olabilir.
@@ -106,11 +338,58 @@ typedef bool (*fe_asset_loader_func)(const char* file_path, void** asset_out, si
  */
 typedef void (*fe_asset_unloader_func)(void* asset_data, size_t data_size);
 
+/**
+ * @brief Aşamalı yükleyicinin çözme adımı. İşçi thread'lerde çalışır; paylaşılan duruma dokunmamalıdır.
+ * @param file_path Varlık yolu (loglar için).
+ * @param file_data Dosyanın tüm baytları (çağrı süresince geçerli).
+ * @param file_size Dosya boyutu.
+ * @param asset_out Çözülmüş varlık verisi.
+ * @param data_size_out Bellekteki boyutu.
+ * @return bool Başarılı ise true.
+ */
+typedef bool (*fe_asset_decode_func)(const char* file_path, const uint8_t* file_data, size_t file_size,
+                                     void** asset_out, size_t* data_size_out);
 
-// Harici yükleyiciler için register fonksiyonları
-// Gerçek bir motor, farklı dosya formatları için farklı yükleyiciler kaydederdi.
-// Örnek:
-// void fe_asset_manager_register_loader(fe_asset_type_t type, fe_asset_loader_func loader_func, fe_asset_unloader_func unloader_func);
+/**
+ * @brief Aşamalı yükleyicinin isteğe bağlı pişirme adımı: kaynak dosya baytlarını decode'un okuyacağı
+ * çalışma zamanı formatına çevirir (ör. PNG -> sıkıştırılmış doku blobu). İşçi thread'lerde çalışır.
+ * Sonuç yalnızca dosya baytlarına bağlı olmalıdır (yol yalnızca loglar içindir); çünkü pişmiş blob
+ * türetilmiş veri önbelleğinde (platform/fe_ddc.h) içerik anahtarıyla saklanır.
+ * @param cooked_out Pişmiş blob; FE_MALLOC(..., FE_MEM_TYPE_GENERAL) ile ayrılır, yönetici serbest bırakır.
+ * @param cooked_size_out Blob boyutu.
+ * @return bool Başarılı ise true.
+ */
+typedef bool (*fe_asset_cook_func)(const char* file_path, const uint8_t* file_data, size_t file_size,
+                                   void** cooked_out, size_t* cooked_size_out);
+
+/**
+ * @brief Aşamalı yükleyicinin upload adımı (ör. GPU kaynağı oluşturma). Ana thread'de çalışır.
+ * @return bool Başarılı ise true; false ise varlık unloader ile boşaltılır.
+ */
+typedef bool (*fe_asset_upload_func)(void* asset_data, size_t data_size);
+
+/**
+ * @brief Bir varlık tipi için dosyayı kendisi okuyan (tek aşamalı) yükleyici kaydeder.
+ * Asenkron yüklemelerde loader_func işçi thread'de çağrılır.
+ */
+void fe_asset_manager_register_loader(fe_asset_type_t type, fe_asset_loader_func loader_func, fe_asset_unloader_func unloader_func);
+
+/**
+ * @brief Bir varlık tipi için aşamalı yükleyici kaydeder. Dosya baytlarını varlık yöneticisi okur;
+ * eşzamanlı yüklemede üç aşama çağıran thread'de sırayla çalışır.
+ * @param upload_func İsteğe bağlı (NULL olabilir).
+ */
+void fe_asset_manager_register_staged_loader(fe_asset_type_t type, fe_asset_decode_func decode_func,
+                                             fe_asset_upload_func upload_func, fe_asset_unloader_func unloader_func);
+
+/**
+ * @brief Aşamalı yükleyicisi olan bir tipe pişirici ekler. Kayıtlıysa decode kaynak dosya yerine
+ * pişmiş blobu alır. Pişmiş blob önce türetilmiş veri önbelleğinde (kaynak baytları + tip + sürüm
+ * anahtarıyla) aranır; yalnızca ıskalarsa pişirilir ve önbelleğe yazılır. Önbellek başlatılmamışsa
+ * her yüklemede pişirilir.
+ * @param cook_version Pişmiş format her değiştiğinde artırılmalıdır; eski kayıtlar böylece ıskalar.
+ */
+void fe_asset_manager_register_cooker(fe_asset_type_t type, fe_asset_cook_func cook_func, uint32_t cook_version);
 
 
 #endif // FE_ASSET_MANAGER_H
@@ -96,14 +96,18 @@ typedef struct fe_blueprint_connection {
     fe_blueprint_pin_t* end_pin;
 } fe_blueprint_connection_t;
 
+// ID -> düğüm/pin haritaları (girişler inline saklanır, ID hash'i satır içine alınır)
+FE_HASH_MAP_DECLARE(fe_bp_node_id_map, uint64_t, fe_blueprint_node_t*, fe_hash_map_hash_u64, fe_hash_map_eq_u64)
+FE_HASH_MAP_DECLARE(fe_bp_pin_id_map, uint64_t, fe_blueprint_pin_t*, fe_hash_map_hash_u64, fe_hash_map_eq_u64)
+
 // --- Blueprint Grafiği Yapısı (Tüm blueprint'i temsil eder) ---
 typedef struct fe_blueprint_graph {
     FE_DYNAMIC_ARRAY(fe_blueprint_node_t*)      nodes;      // Grafikteki tüm düğümler
     FE_DYNAMIC_ARRAY(fe_blueprint_connection_t*) connections; // Grafikteki tüm bağlantılar
 
     // Düğümlere ve pinlere hızlı erişim için haritalar
-    FE_HASH_MAP_DEFINE(uint64_t, fe_blueprint_node_t*) id_to_node_map;
-    FE_HASH_MAP_DEFINE(uint64_t, fe_blueprint_pin_t*) id_to_pin_map;
+    fe_bp_node_id_map_t id_to_node_map;
+    fe_bp_pin_id_map_t  id_to_pin_map;
 
     uint64_t next_id; // Yeni düğüm, pin, bağlantı için kullanılacak ID
     char     name[128]; // Blueprint'in adı (örn. "Player_AI", "Door_Logic")
@@ -3,6 +3,7 @@
 
 #include "core/utils/fe_types.h" // fe_string, fe_vec3, fe_vec4, fe_mat4 vb. için
 #include "graphics/resource/fe_texture.h" // fe_texture_t referansı için
+#include "graphics/shader/fe_shader_compiler.h" // Shader varyantlarını derlemek için
 
 // Materyal Düzenleyici Hata Kodları
 typedef enum fe_material_editor_error {
@@ -14,6 +15,10 @@ typedef enum fe_material_editor_error {
     FE_MATERIAL_EDITOR_PARSE_ERROR,
     FE_MATERIAL_EDITOR_OUT_OF_MEMORY,
     FE_MATERIAL_EDITOR_MATERIAL_NOT_FOUND,
+    FE_MATERIAL_EDITOR_NOT_INITIALIZED,
+    FE_MATERIAL_EDITOR_KEYWORD_NOT_FOUND,
+    FE_MATERIAL_EDITOR_TOO_MANY_KEYWORDS,
+    FE_MATERIAL_EDITOR_SHADER_COMPILE_FAILED, // Varyant derlenemedi (ayrıntı shader derleyici logunda)
     FE_MATERIAL_EDITOR_UNKNOWN_ERROR
 } fe_material_editor_error_t;
 
@@ -51,6 +56,35 @@ typedef struct fe_material_parameter {
     fe_material_param_value_t value; // Parametre değeri
 } fe_material_parameter_t;
 
+// --- Shader Permütasyonları ---
+// Bir materyal, shader'ının derleme zamanı anahtar kelimelerini (örn. "USE_NORMAL_MAP", "SKINNED")
+// tanımlar. Her anahtar kelime eklenme sırasına göre bir bit alır; açık olanlar bir bit maskesi
+// oluşturur. Maskedeki her anahtar kelime derlemede "#define AD 1" olarak verilir, böylece shader
+// dallanmayı GPU'da değil derleme zamanında (#ifdef/#if) yapar. Her maske için bir varyant ilk
+// istendiğinde derlenir ve materyalin varyant önbelleğinde tutulur.
+#define FE_MATERIAL_MAX_KEYWORDS 64 // Maske bit sayısı
+
+typedef uint64_t fe_material_keyword_mask_t;
+
+// Derlenmiş bir shader varyantı. Önbellek anahtarı (keyword_mask, stage, target_api) üçlüsüdür.
+typedef struct fe_material_shader_variant {
+    fe_material_keyword_mask_t keyword_mask;
+    fe_shader_stage_t stage;
+    fe_shader_target_api_t target_api;
+    fe_shader_compiler_error_t status;        // Derleme/yansıma hatası veren varyantlar da tutulur; her karede yeniden derlenmez
+    fe_compiled_shader_data_t compiled;       // status SUCCESS ise geçerlidir
+    fe_shader_reflection_data_t reflection;
+} fe_material_shader_variant_t;
+
+// Shader varyantı sayaçları (tüm materyaller)
+typedef struct fe_material_variant_stats {
+    size_t   live_variants;       // Önbelleklerde tutulan başarılı varyant sayısı
+    size_t   live_variant_bytes;  // Bu varyantların bytecode boyutları toplamı
+    size_t   failed_variants;     // Önbelleklerde tutulan başarısız varyant sayısı
+    uint64_t compilations;        // Derleyiciye giden varyant istekleri (önbellek ıskaları)
+    uint64_t cache_hits;          // Materyal önbelleğinden karşılanan istekler
+} fe_material_variant_stats_t;
+
 // --- Materyal Tanımı ---
 // Bir materyalin temel yapısını ve özelliklerini tanımlar.
 typedef struct fe_material {
@@ -64,6 +98,16 @@ typedef struct fe_material {
     size_t parameter_count;
     size_t parameter_capacity; // Ayrılmış kapasite
 
+    // Shader anahtar kelimeleri (bit i = keywords[i]) ve materyalin kullandığı varyantın maskesi
+    fe_string keywords[FE_MATERIAL_MAX_KEYWORDS];
+    uint32_t keyword_count;
+    fe_material_keyword_mask_t keyword_mask;
+
+    // Derlenmiş varyant önbelleği (dinamik dizi)
+    fe_material_shader_variant_t* variants;
+    size_t variant_count;
+    size_t variant_capacity;
+
     // Materyal editor'e özel dahili durumlar veya işaretçiler eklenebilir.
     bool is_dirty; // Materyalde değişiklik yapıldı mı?
 } fe_material_t;
@@ -79,6 +123,9 @@ typedef struct fe_material_editor_state {
     // Şu an düzenlenen materyal (eğer varsa)
     fe_material_t* current_material_being_edited;
 
+    // Shader varyantı sayaçları
+    fe_material_variant_stats_t variant_stats;
+
     // Diğer dahili durum değişkenleri
 } fe_material_editor_state_t;
 
@@ -196,5 +243,71 @@ fe_material_t* fe_material_editor_get_current_material();
  */
 void fe_material_editor_set_current_material(fe_material_t* material);
 
+// Yardımcı fonksiyon: Parametre tipini string'e çevirir
+const char* fe_material_param_type_to_string(fe_material_param_type_t type);
+
+// --- Shader Permütasyonları ---
+
+/**
+ * @brief Materyale bir shader anahtar kelimesi ekler (kapalı olarak).
+ * Mevcut maskelerin anlamı değişmez; yeni anahtar kelime bir sonraki boş biti alır.
+ *
+ * @param material Anahtar kelimenin ekleneceği materyal.
+ * @param keyword Önişlemci makrosu olarak kullanılacak ad (örn. "USE_NORMAL_MAP").
+ * @return fe_material_editor_error_t Zaten varsa SUCCESS; FE_MATERIAL_MAX_KEYWORDS dolduysa TOO_MANY_KEYWORDS.
+ */
+fe_material_editor_error_t fe_material_editor_add_keyword(fe_material_t* material, const char* keyword);
+
+/**
+ * @brief Bir anahtar kelimeyi açar veya kapatır (materyalin maskesini günceller).
+ * Önceki varyantlar önbellekte kalır; eski maskeye dönmek yeniden derleme gerektirmez.
+ *
+ * @return fe_material_editor_error_t Anahtar kelime tanımlı değilse KEYWORD_NOT_FOUND.
+ */
+fe_material_editor_error_t fe_material_editor_set_keyword(fe_material_t* material, const char* keyword, bool enabled);
+
+/**
+ * @brief Bir anahtar kelimenin bitini döndürür.
+ * @return fe_material_keyword_mask_t Anahtar kelime tanımlı değilse 0.
+ */
+fe_material_keyword_mask_t fe_material_editor_get_keyword_bit(const fe_material_t* material, const char* keyword);
+
+/**
+ * @brief Materyalin shader'ının verilen maske için derlenmiş varyantını döndürür.
+ * Varyant önbellekte yoksa burada derlenir (shader derleyicisinin disk önbelleği de devrededir).
+ *
+ * @param material Materyal.
+ * @param keyword_mask Açık anahtar kelimelerin maskesi (genellikle material->keyword_mask).
+ * @param stage Derlenecek shader aşaması.
+ * @param target_api Hedef API.
+ * @param out_variant Önbellekteki varyant. Materyal serbest bırakılana veya varyantlar
+ * geçersiz kılınana kadar geçerlidir; yeni bir varyant eklenmesi işaretçiyi geçersiz kılabilir.
+ * @return fe_material_editor_error_t Varyant kullanılabilir ise SUCCESS, derlenemediyse SHADER_COMPILE_FAILED.
+ */
+fe_material_editor_error_t fe_material_editor_get_shader_variant(fe_material_t* material, fe_material_keyword_mask_t keyword_mask,
+                                                                 fe_shader_stage_t stage, fe_shader_target_api_t target_api,
+                                                                 const fe_material_shader_variant_t** out_variant);
+
+/**
+ * @brief Önbellekte olmayan varyantları tek bir toplu derlemeyle (paralel) önceden derler.
+ * Yükleme ekranlarında veya materyal kaydedilirken, ilk kullanımda takılmayı önlemek için kullanılır.
+ *
+ * @param masks count adet maske.
+ * @return fe_material_editor_error_t Tüm varyantlar kullanılabilir ise SUCCESS.
+ */
+fe_material_editor_error_t fe_material_editor_prepare_shader_variants(fe_material_t* material, const fe_material_keyword_mask_t* masks,
+                                                                      uint32_t count, fe_shader_stage_t stage,
+                                                                      fe_shader_target_api_t target_api);
+
+/**
+ * @brief Materyalin tüm varyantlarını serbest bırakır (örn. shader dosyası değiştiğinde).
+ */
+void fe_material_editor_invalidate_shader_variants(fe_material_t* material);
+
+/**
+ * @brief Shader varyantı sayaçlarını döndürür.
+ */
+void fe_material_editor_get_variant_stats(fe_material_variant_stats_t* out_stats);
+
 
 #endif // FE_MATERIAL_EDITOR_H
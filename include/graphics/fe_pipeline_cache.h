@@ -0,0 +1,127 @@
+#ifndef FE_PIPELINE_CACHE_H
+#define FE_PIPELINE_CACHE_H
+
+#include "core/utils/fe_types.h" // Temel tipler (bool, uint64_t vb.)
+
+// --- Pipeline Tekilleştirme Önbelleği ---
+// Aynı durumla (shader'lar, vertex düzeni, rasterizasyon, karıştırma, render pass...) istenen
+// pipeline'ların yalnızca bir kez oluşturulmasını sağlar. API'den bağımsızdır: her arka uç kendi
+// pipeline yapılandırmasını kanonik bir bayt dizisine (anahtar) çevirir; önbellek anahtarı hash'ler,
+// eşit anahtarlar için mevcut pipeline'ı referans sayısını artırarak döndürür ve son referans
+// bırakıldığında pipeline'ı arka ucun yok etme fonksiyonuyla yok eder.
+// Hash çakışmaları anahtar baytları karşılaştırılarak ayıklanır; farklı durumlar asla aynı
+// pipeline'ı paylaşmaz.
+// Thread-safe değildir; pipeline'lar render thread'inden oluşturulur ve bırakılır.
+
+/**
+ * @brief Bir pipeline anahtarı oluşturmak için büyüyen bayt tamponu.
+ * Alanlar tek tek ve sabit genişlikte eklenir; yapıların doğrudan eklenmemesi gerekir
+ * (dolgu baytları ve işaretçiler anahtarı kararsız yapar).
+ */
+typedef struct fe_pipeline_key {
+    uint8_t* data;
+    size_t   size;
+    size_t   capacity;
+    bool     out_of_memory; // Bir ekleme başarısız olduysa anahtar kullanılamaz
+} fe_pipeline_key_t;
+
+/**
+ * @brief Anahtar için pipeline oluşturur.
+ * @param key Anahtar baytları (arka ucun kendi ürettiği).
+ * @param user_data fe_pipeline_cache_acquire'a verilen veri (genellikle asıl yapılandırma).
+ * @return void* Oluşturulan pipeline; başarısızsa NULL.
+ */
+typedef void* (*fe_pipeline_cache_create_func)(const void* key, size_t key_size, void* user_data);
+
+/**
+ * @brief Son referansı bırakılan pipeline'ı yok eder.
+ * @param context fe_pipeline_cache_init'e verilen bağlam (örn. mantıksal cihaz).
+ */
+typedef void (*fe_pipeline_cache_destroy_func)(void* pipeline, void* context);
+
+// Önbellekteki bir pipeline (dahili)
+typedef struct fe_pipeline_cache_entry fe_pipeline_cache_entry_t;
+
+/**
+ * @brief Önbellek sayaçları.
+ */
+typedef struct fe_pipeline_cache_stats {
+    uint32_t live_pipelines;    // Şu an önbellekte olan (en az bir referansı olan) pipeline sayısı
+    uint64_t hits;              // Mevcut bir pipeline'ı döndüren istekler
+    uint64_t misses;            // Yeni pipeline oluşturan istekler
+    uint64_t create_failures;   // Oluşturma fonksiyonunun NULL döndürdüğü istekler
+    uint64_t hash_collisions;   // Hash'i eşit ama anahtarı farklı çıkan karşılaştırmalar
+} fe_pipeline_cache_stats_t;
+
+/**
+ * @brief Tekilleştirme önbelleği. Alanlar dahilidir.
+ */
+typedef struct fe_pipeline_cache {
+    fe_pipeline_cache_entry_t**    buckets;      // Zincirli hash tablosu (2'nin kuvveti)
+    uint32_t                       bucket_count;
+    fe_pipeline_cache_destroy_func destroy_func;
+    void*                          context;
+    fe_pipeline_cache_stats_t      stats;
+} fe_pipeline_cache_t;
+
+// --- Anahtar Oluşturma ---
+
+void fe_pipeline_key_init(fe_pipeline_key_t* key);
+void fe_pipeline_key_destroy(fe_pipeline_key_t* key);
+void fe_pipeline_key_add(fe_pipeline_key_t* key, const void* data, size_t size);
+void fe_pipeline_key_add_u32(fe_pipeline_key_t* key, uint32_t value);
+void fe_pipeline_key_add_u64(fe_pipeline_key_t* key, uint64_t value);
+
+/**
+ * @brief Bir float ekler. -0.0 ile 0.0 aynı değer olarak eklenir.
+ */
+void fe_pipeline_key_add_float(fe_pipeline_key_t* key, float value);
+
+/**
+ * @brief Bir string ekler (uzunluk önekli). NULL, boş stringden farklı bir değer olarak eklenir.
+ */
+void fe_pipeline_key_add_string(fe_pipeline_key_t* key, const char* str);
+
+/**
+ * @brief Anahtarın 64-bit hash'ini döndürür.
+ */
+uint64_t fe_pipeline_key_hash(const fe_pipeline_key_t* key);
+
+// --- Önbellek ---
+
+/**
+ * @brief Önbelleği başlatır.
+ * @param destroy_func Son referans bırakıldığında çağrılır.
+ * @param context destroy_func'a iletilen bağlam.
+ * @return bool Başarılı ise true.
+ */
+bool fe_pipeline_cache_init(fe_pipeline_cache_t* cache, fe_pipeline_cache_destroy_func destroy_func, void* context);
+
+/**
+ * @brief Hâlâ referansı olan pipeline'ları uyarıyla yok eder ve önbelleği kapatır.
+ */
+void fe_pipeline_cache_shutdown(fe_pipeline_cache_t* cache);
+
+/**
+ * @brief Anahtara karşılık gelen pipeline'ı döndürür; yoksa create_func ile oluşturur.
+ * Her başarılı çağrı bir referans alır ve fe_pipeline_cache_release ile eşlenmelidir.
+ *
+ * @param out_hash İsteğe bağlı: anahtarın hash'i (release'e verilir).
+ * @return void* Pipeline; anahtar geçersizse veya oluşturma başarısızsa NULL.
+ */
+void* fe_pipeline_cache_acquire(fe_pipeline_cache_t* cache, const fe_pipeline_key_t* key,
+                                fe_pipeline_cache_create_func create_func, void* user_data, uint64_t* out_hash);
+
+/**
+ * @brief Bir referansı bırakır; son referans ise pipeline yok edilir.
+ * @param hash acquire'ın döndürdüğü hash.
+ * @return bool Pipeline önbellekte bulunduysa true.
+ */
+bool fe_pipeline_cache_release(fe_pipeline_cache_t* cache, uint64_t hash, void* pipeline);
+
+/**
+ * @brief Sayaçları döndürür.
+ */
+void fe_pipeline_cache_get_stats(const fe_pipeline_cache_t* cache, fe_pipeline_cache_stats_t* out_stats);
+
+#endif // FE_PIPELINE_CACHE_H
@@ -80,12 +80,60 @@ typedef struct fe_shader_reflection_data {
     // ... diğer kaynaklar (storage buffers, images, input attachments vb.)
 } fe_shader_reflection_data_t;
 
+// Derleme sırasında tanımlanan önişlemci makrosu (-D ad=değer)
+typedef struct fe_shader_macro {
+    const char* name;
+    const char* value; // NULL ise makro değersiz tanımlanır (#define ad)
+} fe_shader_macro_t;
+
+// Bir derleme isteğinin tüm girdileri. Önbellek anahtarı bu alanların tamamından ve kaynağın
+// #include ettiği dosyaların içeriğinden üretilir.
+typedef struct fe_shader_compile_desc {
+    const char* file_path;                 // Shader kaynak dosyasının yolu
+    fe_shader_source_language_t source_language;
+    const char* entry_point;               // Giriş noktası (örn. "main", "VSMain")
+    fe_shader_stage_t shader_stage;
+    fe_shader_target_api_t target_api;
+    const fe_shader_macro_t* macros;       // İsteğe bağlı (macro_count adet)
+    uint32_t macro_count;
+    const char* const* include_dirs;       // #include <x> ve bulunamayan #include "x" için arama dizinleri
+    uint32_t include_dir_count;
+    bool debug_info;                       // Debug bilgileri eklensin mi?
+    bool optimize;                         // Optimizasyon yapılsın mı?
+} fe_shader_compile_desc_t;
+
+// Derleyici sayaçları (süreç başlatıldığından beri)
+typedef struct fe_shader_compiler_stats {
+    uint64_t cache_hits;    // Türetilmiş veri önbelleğinden okunan (derlenmeyen) shader'lar
+    uint64_t cache_misses;  // Önbellek açıkken bulunamayıp derlenenler
+    uint64_t compilations;  // Derleyiciye giden toplam istek
+    uint64_t failures;      // Başarısız derlemeler
+} fe_shader_compiler_stats_t;
+
+// Toplu derlemede bir isteğin sonucu. Başarısız isteklerin compiled/reflection alanları boştur.
+typedef struct fe_shader_compile_result {
+    fe_shader_compiler_error_t error;
+    fe_compiled_shader_data_t compiled;      // Kullanıcı serbest bırakmalıdır (fe_shader_compiler_free_batch_results)
+    fe_shader_reflection_data_t reflection;
+} fe_shader_compile_result_t;
+
+// Toplu derlemenin özeti
+typedef struct fe_shader_batch_report {
+    uint32_t succeeded;
+    uint32_t failed;
+    uint32_t cache_hits;  // Başarılılardan önbellekten gelenler
+    char* error_log;      // Başarısız her istek için bir satır (istek sırasıyla); hata yoksa NULL.
+                          // fe_shader_compiler_free_batch_report ile serbest bırakılır.
+} fe_shader_batch_report_t;
+
 
 // --- Fonksiyon Deklarasyonları ---
 
 /**
  * @brief Shader derleyici sistemini başlatır.
- * Harici derleyici kütüphanelerini (Shaderc, DXC) yükler ve hazırlar.
+ * Harici derleyici kütüphanelerini (Shaderc, DXC) yükler ve hazırlar. Her iş sistemi thread'i kendi
+ * Shaderc derleyici nesnesini kullanır (ana thread'inki burada, işçilerinki ilk derlemelerinde
+ * oluşturulur) ve bu nesneler kapanışa kadar yeniden kullanılır.
  *
  * @return fe_shader_compiler_error_t Başarı durumunu döner.
  */
@@ -100,7 +148,7 @@ void fe_shader_compiler_shutdown();
 /**
  * @brief Shader kaynak kodunu derler.
  * Verilen shader dosyasını okur, belirtilen hedef API'ye göre derler
- * ve derlenmiş ikili veriyi döndürür.
+ * ve derlenmiş ikili veriyi döndürür. Makrosuz ve arama dizinsiz fe_shader_compiler_compile ile aynıdır.
  *
  * @param file_path Shader kaynak dosyasının yolu.
  * @param source_language Kaynak kodun dili (HLSL, GLSL, MSL).
@@ -125,6 +173,57 @@ fe_shader_compiler_error_t fe_shader_compiler_compile_shader(
     fe_shader_reflection_data_t* output_reflection_data
 );
 
+/**
+ * @brief Bir shader'ı tanımdaki makrolar ve arama dizinleriyle derler.
+ * Türetilmiş veri önbelleği (platform/fe_ddc.h) açıksa sonuç önce orada aranır; anahtar kaynak,
+ * #include edilen dosyaların içerikleri, giriş noktası, aşama, hedef, makrolar ve debug/optimize
+ * bayraklarından üretilir. Bulunursa derleyici hiç çağrılmaz; aksi halde derlenen bytecode ve
+ * yansıma verisi önbelleğe yazılır.
+ *
+ * @param desc Derleme isteği.
+ * @param output_compiled_data Derlenmiş veri. Kullanıcı bu veriyi serbest bırakmalıdır.
+ * @param output_reflection_data Yansıma verisi (isteğe bağlı, NULL olabilir).
+ * @return fe_shader_compiler_error_t Başarı durumunu döner.
+ */
+fe_shader_compiler_error_t fe_shader_compiler_compile(
+    const fe_shader_compile_desc_t* desc,
+    fe_compiled_shader_data_t* output_compiled_data,
+    fe_shader_reflection_data_t* output_reflection_data
+);
+
+/**
+ * @brief Birden çok shader'ı iş sistemi işçileri üzerinde paralel derler ve hepsi bitince döner.
+ * Her istek fe_shader_compiler_compile ile aynı şekilde (önbellek dahil) derlenir; her işçi kendi
+ * Shaderc derleyicisini ve seçeneklerini kullanır. İş sistemi başlatılmamışsa istekler sırayla derlenir.
+ *
+ * @param descs count adet derleme isteği.
+ * @param count İstek sayısı.
+ * @param out_results count elemanlı dizi; i. sonuç i. isteğe aittir.
+ * @param out_report Özet ve birleştirilmiş hata metni (isteğe bağlı, NULL olabilir).
+ * @return fe_shader_compiler_error_t Hepsi başarılıysa SUCCESS, aksi halde istek sırasındaki ilk hatanın kodu.
+ */
+fe_shader_compiler_error_t fe_shader_compiler_compile_batch(
+    const fe_shader_compile_desc_t* descs,
+    uint32_t count,
+    fe_shader_compile_result_t* out_results,
+    fe_shader_batch_report_t* out_report
+);
+
+/**
+ * @brief Toplu derleme sonuçlarının derlenmiş ve yansıma verilerini serbest bırakır.
+ */
+void fe_shader_compiler_free_batch_results(fe_shader_compile_result_t* results, uint32_t count);
+
+/**
+ * @brief Toplu derleme raporunun hata metnini serbest bırakır.
+ */
+void fe_shader_compiler_free_batch_report(fe_shader_batch_report_t* report);
+
+/**
+ * @brief Derleyici sayaçlarını döndürür.
+ */
+void fe_shader_compiler_get_stats(fe_shader_compiler_stats_t* out_stats);
+
 /**
  * @brief fe_compiled_shader_data_t tarafından tahsis edilen belleği serbest bırakır.
  *
@@ -145,6 +244,8 @@ const char* fe_shader_stage_to_string(fe_shader_stage_t stage);
 const char* fe_shader_language_to_string(fe_shader_source_language_t lang);
 // Yardımcı fonksiyon: Hedef API'yi string'e çevirir
 const char* fe_shader_target_api_to_string(fe_shader_target_api_t target);
+// Yardımcı fonksiyon: Hata kodunu string'e çevirir
+const char* fe_shader_compiler_error_to_string(fe_shader_compiler_error_t error);
 
 
 #endif // FE_SHADER_COMPILER_H
@@ -8,6 +8,8 @@
 #include "graphics/renderer/fe_renderer.h" // fe_renderer_error_t için
 #include "graphics/vulkan/fe_vk_device.h"   // fe_vk_device_t için
 #include "graphics/render_pass/fe_render_pass.h" // fe_render_pass_t için
+#include "graphics/pipeline/fe_pipeline_cache.h" // Pipeline tekilleştirme için
+#include "platform/fe_ddc.h"                     // Sürücü önbelleği verisini diskte saklamak için
 
 // --- Vulkan Pipeline Hata Kodları ---
 typedef enum fe_vk_pipeline_error {
@@ -121,8 +123,26 @@ typedef struct fe_vk_pipeline {
     VkShaderModule vertex_shader_module;
     VkShaderModule fragment_shader_module;
     // Diğer shader modülleri (geometry, compute, tessellation) eklenebilir.
+    uint64_t config_hash; // fe_vk_pipeline_cache_acquire ile alındıysa yapılandırmanın hash'i
 } fe_vk_pipeline_t;
 
+// --- Pipeline Önbelleği ---
+// İki katmandan oluşur:
+// - Tekilleştirme (fe_pipeline_cache_t): aynı yapılandırmayla istenen pipeline'lar bir kez
+//   oluşturulur ve referans sayılarak paylaşılır.
+// - Sürücü önbelleği (VkPipelineCache): yeni pipeline'lar bu önbellekle oluşturulur; böylece
+//   sürücü daha önce derlediği shader/durum kombinasyonlarını yeniden derlemez. Önbellek verisi
+//   türetilmiş veri önbelleğinde (platform/fe_ddc.h) saklanır ve sonraki çalıştırmada geri yüklenir.
+//   Anahtar GPU üreticisi, cihaz, sürücü sürümü ve pipelineCacheUUID'den oluşur; sürücü
+//   güncellenince eski veri hiç okunmaz.
+typedef struct fe_vk_pipeline_cache {
+    VkDevice            logical_device;
+    VkPipelineCache     vk_cache;
+    fe_pipeline_cache_t pipelines;
+    fe_ddc_key_t        data_key;        // Sürücü önbelleği verisinin DDC anahtarı
+    uint64_t            saved_data_hash; // Son yüklenen/kaydedilen verinin hash'i (değişmediyse yazılmaz)
+} fe_vk_pipeline_cache_t;
+
 // --- Fonksiyonlar ---
 
 /**
@@ -135,6 +155,14 @@ typedef struct fe_vk_pipeline {
  */
 fe_vk_pipeline_t* fe_vk_pipeline_create(VkDevice logical_device, const fe_vk_pipeline_config_t* config);
 
+/**
+ * @brief fe_vk_pipeline_create ile aynıdır; pipeline verilen sürücü önbelleğiyle oluşturulur.
+ *
+ * @param pipeline_cache Sürücü önbelleği (VK_NULL_HANDLE olabilir).
+ */
+fe_vk_pipeline_t* fe_vk_pipeline_create_with_cache(VkDevice logical_device, const fe_vk_pipeline_config_t* config,
+                                                   VkPipelineCache pipeline_cache);
+
 /**
  * @brief Bir Vulkan grafik pipeline'ı ve ilişkili kaynaklarını yok eder.
  *
@@ -171,4 +199,52 @@ void fe_vk_pipeline_destroy_shader_module(VkDevice logical_device, VkShaderModul
  */
 void fe_vk_pipeline_default_config(fe_vk_pipeline_config_t* config, uint32_t width, uint32_t height);
 
+/**
+ * @brief Yapılandırmayı kanonik bir tekilleştirme anahtarına çevirir.
+ * Dizilerin içerikleri ve shader yolları eklenir (işaretçiler değil). Viewport veya scissor
+ * dinamik durumsa değerleri anahtara girmez; böylece yalnızca boyutu farklı pipeline'lar paylaşılır.
+ * Shader'lar yollarıyla tanınır: bir SPIR-V dosyası değiştiğinde eski pipeline'lar bırakılmalıdır.
+ * Render pass ve pipeline layout ise nesne kimlikleriyle (işaretçi/handle) eklenir: bunlardan biri
+ * yok edilmeden önce onunla alınan tüm pipeline'lar bırakılmalıdır. Aksi halde aynı adreste
+ * oluşturulan yeni bir nesne, yok edilmiş nesneye bağlı eski pipeline'ı eşler.
+ *
+ * @param key fe_pipeline_key_init ile başlatılmış anahtar.
+ */
+void fe_vk_pipeline_config_to_key(const fe_vk_pipeline_config_t* config, fe_pipeline_key_t* key);
+
+/**
+ * @brief Pipeline önbelleğini oluşturur ve varsa diskteki sürücü önbelleği verisini yükler.
+ *
+ * @param physical_device Verinin hangi cihaz ve sürücüye ait olduğunu belirlemek için.
+ * @return fe_vk_pipeline_cache_t* Önbellek, başarısız olursa NULL.
+ */
+fe_vk_pipeline_cache_t* fe_vk_pipeline_cache_create(VkDevice logical_device, VkPhysicalDevice physical_device);
+
+/**
+ * @brief Sürücü önbelleği verisini diske yazar (değişmediyse yazmaz). Yükleme ekranlarından sonra
+ * çağrılabilir; fe_vk_pipeline_cache_destroy da çağırır.
+ * @return bool Veri yazıldıysa veya değişmediyse true.
+ */
+bool fe_vk_pipeline_cache_save(fe_vk_pipeline_cache_t* cache);
+
+/**
+ * @brief Veriyi kaydeder, önbellekte kalan pipeline'ları yok eder ve önbelleği serbest bırakır.
+ */
+void fe_vk_pipeline_cache_destroy(fe_vk_pipeline_cache_t* cache);
+
+/**
+ * @brief Yapılandırmaya karşılık gelen pipeline'ı döndürür; yoksa sürücü önbelleğiyle oluşturur.
+ * Dönen pipeline paylaşılır: fe_vk_pipeline_destroy ile değil fe_vk_pipeline_cache_release ile bırakılır.
+ * Yapılandırmadaki render pass ve pipeline layout, bu referans bırakılana kadar yok edilmemelidir
+ * (bkz. fe_vk_pipeline_config_to_key).
+ *
+ * @return fe_vk_pipeline_t* Pipeline, başarısız olursa NULL.
+ */
+fe_vk_pipeline_t* fe_vk_pipeline_cache_acquire(fe_vk_pipeline_cache_t* cache, const fe_vk_pipeline_config_t* config);
+
+/**
+ * @brief fe_vk_pipeline_cache_acquire ile alınan bir referansı bırakır; son referansta pipeline yok edilir.
+ */
+void fe_vk_pipeline_cache_release(fe_vk_pipeline_cache_t* cache, fe_vk_pipeline_t* pipeline);
+
 #endif // FE_VK_PIPELINE_H
@@ -0,0 +1,150 @@
+#ifndef FE_JOB_SYSTEM_H
+#define FE_JOB_SYSTEM_H
+
+#include "core/utils/fe_types.h"   // Temel tipler (bool, uint32_t vb.)
+#include "core/utils/fe_atomic.h"  // fe_atomic_* için
+
+// --- İş Çalma (Work-Stealing) İş Sistemi ---
+// Kısa ömürlü işleri (job) tüm çekirdeklere dağıtır:
+// - Her işçi thread'in ve ana thread'in kendi Chase-Lev deque'si vardır. Sahibi kendi
+//   deque'sinin altından (LIFO) iter/çeker; boşta kalan thread'ler diğerlerinin üstünden (FIFO) çalar.
+// - İşçi olmayan thread'lerden gönderilen işler ortak bir MPMC kuyruğa düşer.
+// - İşler bir sayaca (fe_job_counter_t) bağlanır: gönderimde sayaç artar, iş bitince azalır.
+// - fe_job_system_wait_for_counter beklerken boş durmaz; sayaç sıfırlanana kadar
+//   kendisi de iş çalıştırır (ana thread yardımı).
+// - fe_job_system_run_after ile gönderilen işler, bağımlı oldukları sayaç sıfırlanana kadar
+//   kuyruğa girmez; sayacı sıfırlayan thread onları kendi deque'sine alır.
+// - main_thread_only işaretli işler yalnızca ana thread'de (init'i çağıran thread) çalışır.
+//
+// Kullanım:
+//   fe_job_counter_t counter = FE_JOB_COUNTER_INIT;
+//   fe_job_decl_t jobs[4];
+//   for (i...) { jobs[i].func = integrate_island; jobs[i].user_data = &islands[i]; jobs[i].main_thread_only = false; }
+//   fe_job_system_run(jobs, 4, &counter);
+//   fe_job_system_wait_for_counter(&counter);
+
+// Aynı anda yaşayabilecek (gönderilmiş, henüz bitmemiş) en fazla iş sayısı. 2'nin kuvveti olmalıdır.
+#ifndef FE_JOB_SYSTEM_MAX_JOBS
+#define FE_JOB_SYSTEM_MAX_JOBS 4096
+#endif
+
+// En fazla işçi thread sayısı (ana thread hariç).
+#ifndef FE_JOB_SYSTEM_MAX_WORKERS
+#define FE_JOB_SYSTEM_MAX_WORKERS 31
+#endif
+
+/**
+ * @brief İş fonksiyonu.
+ */
+typedef void (*fe_job_func)(void* user_data);
+
+/**
+ * @brief Gönderilecek bir işin tanımı.
+ */
+typedef struct fe_job_decl {
+    fe_job_func func;             // Çalıştırılacak fonksiyon
+    void*       user_data;        // Fonksiyona iletilecek veri
+    bool        main_thread_only; // true ise yalnızca ana thread'de çalışır
+} fe_job_decl_t;
+
+/**
+ * @brief Bitmemiş iş sayacı. Sıfır ise bağlı tüm işler tamamlanmıştır.
+ * Alanlara doğrudan erişilmemelidir; FE_JOB_COUNTER_INIT ile başlatılır.
+ */
+typedef struct fe_job_counter {
+    uint32_t value;        // Bitmemiş iş sayısı
+    uint32_t lock;         // waiting listesini koruyan döndürme kilidi
+    uint32_t waiting_head; // Bu sayacı bekleyen işlerin listesi (iş indeksi + 1, 0 ise boş)
+} fe_job_counter_t;
+
+#define FE_JOB_COUNTER_INIT { 0, 0, 0 }
+
+/**
+ * @brief İş sisteminin çalışma istatistikleri.
+ */
+typedef struct fe_job_system_stats {
+    uint32_t worker_count;   // İşçi thread sayısı (ana thread hariç)
+    uint64_t jobs_executed;  // Toplam çalıştırılan iş sayısı
+    uint64_t jobs_stolen;    // Başka bir thread'in deque'sinden çalınarak çalıştırılan iş sayısı
+} fe_job_system_stats_t;
+
+/**
+ * @brief İş sistemini başlatır ve işçi thread'leri oluşturur. Çağıran thread ana thread olarak kaydedilir.
+ *
+ * @param worker_count İşçi thread sayısı. 0 ise (mantıksal işlemci sayısı - 1) kullanılır;
+ * tek çekirdekli sistemlerde işçi açılmaz ve tüm işler bekleme sırasında ana thread'de çalışır.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_job_system_init(uint32_t worker_count);
+
+/**
+ * @brief Tüm işçileri durdurur ve kaynakları serbest bırakır. Bekleyen işler çalıştırılmaz;
+ * çağırmadan önce tüm sayaçlar beklenmiş olmalıdır.
+ */
+void fe_job_system_shutdown(void);
+
+/**
+ * @brief İş sisteminin başlatılıp başlatılmadığını döndürür.
+ */
+bool fe_job_system_is_initialized(void);
+
+/**
+ * @brief İşleri hemen çalıştırılabilir olarak gönderir.
+ *
+ * @param jobs İş tanımları dizisi (çağrı döndükten sonra tekrar kullanılabilir).
+ * @param count İş sayısı.
+ * @param counter İsteğe bağlı: count kadar artırılacak, her iş bitince azaltılacak sayaç.
+ * @return bool Tüm işler gönderildiyse true. İş havuzu doluysa kalan işler çağıran thread'de
+ * hemen çalıştırılır ve yine true döner; ana thread'e özel işler ise ana thread dışından
+ * gönderildiğinde bir yuva boşalana kadar beklenir. false yalnızca sistem başlatılmamışken döner.
+ */
+bool fe_job_system_run(const fe_job_decl_t* jobs, uint32_t count, fe_job_counter_t* counter);
+
+/**
+ * @brief İşleri, dependency sayacı sıfırlandığında çalıştırılmak üzere gönderir.
+ * Sayaç zaten sıfırsa fe_job_system_run ile aynıdır.
+ *
+ * @param jobs İş tanımları dizisi.
+ * @param count İş sayısı.
+ * @param dependency Beklenecek sayaç.
+ * @param counter İsteğe bağlı: bu işlerin tamamlanmasını izleyen sayaç.
+ * @return bool Başarılı ise true.
+ */
+bool fe_job_system_run_after(const fe_job_decl_t* jobs, uint32_t count,
+                             fe_job_counter_t* dependency, fe_job_counter_t* counter);
+
+/**
+ * @brief Sayaç sıfırlanana kadar bekler; beklerken çalıştırılabilir işleri kendisi çalıştırır.
+ * Ana thread'den çağrıldığında main_thread_only işleri de çalıştırır.
+ *
+ * @param counter Beklenecek sayaç.
+ */
+void fe_job_system_wait_for_counter(fe_job_counter_t* counter);
+
+/**
+ * @brief Sayacın sıfır olup olmadığını beklemeden döndürür.
+ * Sayacı sıfırlayan thread bekleyen işleri devrederken kilidi tutar; sayaç ancak kilit
+ * de bırakıldığında bitmiş sayılır, böylece yığında duran sayaçlar güvenle yok edilebilir.
+ */
+static inline bool fe_job_counter_is_done(const fe_job_counter_t* counter) {
+    return fe_atomic_load_u32(&counter->value, FE_ATOMIC_ACQUIRE) == 0 &&
+           fe_atomic_load_u32(&counter->lock, FE_ATOMIC_ACQUIRE) == 0;
+}
+
+/**
+ * @brief Çağıran thread'in iş sistemi indeksini döndürür: ana thread 0, işçiler 1..worker_count,
+ * diğer thread'ler -1.
+ */
+int fe_job_system_thread_index(void);
+
+/**
+ * @brief Başlatılabilen işçi thread sayısını döndürür (ana thread hariç).
+ */
+uint32_t fe_job_system_worker_count(void);
+
+/**
+ * @brief Çalışma istatistiklerini döndürür.
+ */
+void fe_job_system_get_stats(fe_job_system_stats_t* out_stats);
+
+#endif // FE_JOB_SYSTEM_H
@@ -0,0 +1,150 @@
+#ifndef FE_ASYNC_IO_H
+#define FE_ASYNC_IO_H
+
+#include "core/utils/fe_types.h" // Temel tipler (bool, uint32_t, uint64_t vb.)
+
+// --- Asenkron Dosya Okuma ---
+// fe_unixio_read_file çağıran thread'i her dosya için bloklar. Bu API okuma isteklerini kuyruğa
+// alır ve hemen bir tanıtıcı döndürür; onlarca okuma aynı anda uçuşta tutulabilir:
+// - Linux'ta istekler io_uring'e toplu olarak gönderilir (liburing gerekmez, doğrudan sistem
+//   çağrıları kullanılır); dosya da IORING_OP_OPENAT ile açılır, tamamlanmaları ayrı bir thread toplar.
+// - io_uring yoksa (5.6 öncesi çekirdek, seccomp) veya diğer platformlarda, açıp pread yapan
+//   küçük bir thread havuzu kullanılır. Davranış iki yolda da aynıdır.
+// - Çağıran thread dosya sistemine hiç dokunmaz: açma hataları da isteğin FAILED sonucuyla bildirilir.
+// Sonuçlar iki şekilde alınabilir:
+// - Yoklama: fe_async_io_poll / fe_async_io_wait.
+// - Geri çağırma: isteğe verilen callback, fe_async_io_dispatch_completions'ı çağıran thread'de
+//   (genellikle kare başında ana thread) çalıştırılır. Callback'ten sonra istek otomatik bırakılır.
+//   Sonuç ve tamponun sahipliği yalnızca callback'e verilir; bu istekler için poll/wait sadece
+//   durumu döndürür.
+
+// Bir isteği tanımlayan tanıtıcı. 0 geçersizdir.
+typedef uint64_t fe_async_io_handle_t;
+#define FE_ASYNC_IO_INVALID_HANDLE ((fe_async_io_handle_t)0)
+
+/**
+ * @brief Bir okuma isteğinin durumu.
+ */
+typedef enum fe_async_io_status {
+    FE_ASYNC_IO_STATUS_INVALID = 0, // Tanıtıcı geçersiz veya bırakılmış
+    FE_ASYNC_IO_STATUS_PENDING,     // Kuyrukta veya okunuyor
+    FE_ASYNC_IO_STATUS_COMPLETE,    // Tüm baytlar okundu (dosya sonuna kadar)
+    FE_ASYNC_IO_STATUS_FAILED       // Açma veya okuma hatası (error alanına bakın)
+} fe_async_io_status_t;
+
+/**
+ * @brief Tamamlanan bir okumanın sonucu.
+ */
+typedef struct fe_async_io_result {
+    fe_async_io_status_t status;
+    void*    buffer;      // Okunan veri. İstekte buffer NULL ise sistem ayırır; sonuç poll/wait
+                          // veya callback ile teslim edildiğinde sahipliği çağırana geçer
+                          // (FE_FREE(buffer, FE_MEM_TYPE_GENERAL) ile serbest bırakılır).
+    uint64_t bytes_read;  // Okunan bayt sayısı (dosya sonu nedeniyle istenenden az olabilir)
+    int      error;       // Başarısızlıkta errno (Windows'ta GetLastError)
+} fe_async_io_result_t;
+
+/**
+ * @brief Okuma tamamlandığında fe_async_io_dispatch_completions içinden çağrılır.
+ */
+typedef void (*fe_async_io_callback_t)(fe_async_io_handle_t handle, const fe_async_io_result_t* result, void* user_data);
+
+/**
+ * @brief Okuma isteği.
+ */
+typedef struct fe_async_io_read_desc {
+    const char*            path;      // Dosya yolu (çağrı süresince geçerli olması yeterli)
+    uint64_t               offset;    // Okumaya başlanacak konum
+    uint64_t               size;      // Okunacak bayt sayısı; 0 ise offset'ten dosya sonuna kadar
+    void*                  buffer;    // Hedef tampon (en az size bayt); NULL ise sistem ayırır.
+                                      // Tampon verilirse size 0 olamaz (istek reddedilir)
+    fe_async_io_callback_t callback;  // NULL ise sonuç yoklama ile alınır
+    void*                  user_data;
+} fe_async_io_read_desc_t;
+
+/**
+ * @brief Başlatma ayarları. Sıfır değerli alanlar için varsayılanlar kullanılır.
+ */
+typedef struct fe_async_io_config {
+    uint32_t max_requests;     // Aynı anda var olabilecek istek sayısı (0 ise 256)
+    uint32_t queue_depth;      // io_uring halka derinliği (0 ise 64, 2'nin kuvvetine yuvarlanır)
+    uint32_t fallback_threads; // pread thread havuzu boyutu (0 ise 4)
+    bool     force_fallback;   // true ise io_uring denenmez
+} fe_async_io_config_t;
+
+/**
+ * @brief Asenkron I/O sayaçları.
+ */
+typedef struct fe_async_io_stats {
+    bool     using_io_uring;  // false ise thread havuzu kullanılıyor
+    uint32_t in_flight;       // Gönderilmiş, tamamlanmamış istek sayısı
+    uint64_t submitted;       // Toplam gönderilen istek
+    uint64_t completed;       // Toplam tamamlanan istek (başarılı + başarısız)
+    uint64_t bytes_read;      // Toplam okunan bayt
+} fe_async_io_stats_t;
+
+/**
+ * @brief Asenkron I/O sistemini başlatır.
+ * @param config Ayarlar (NULL ise varsayılanlar).
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_async_io_init(const fe_async_io_config_t* config);
+
+/**
+ * @brief Uçuştaki tüm okumaların bitmesini bekler ve sistemi kapatır. Bırakılmamış istekler
+ * uyarı ile loglanır; sonucu hiç teslim edilmemiş isteklerin sistem tamponları serbest bırakılır.
+ */
+void fe_async_io_shutdown(void);
+
+/**
+ * @brief Asenkron I/O sisteminin başlatılıp başlatılmadığını döndürür.
+ */
+bool fe_async_io_is_initialized(void);
+
+/**
+ * @brief Bir okuma isteğini kuyruğa alır ve hemen döner. Thread-safe'tir.
+ * @return fe_async_io_handle_t İstek tanıtıcısı; istek tablosu doluysa FE_ASYNC_IO_INVALID_HANDLE.
+ * Dosya açılamazsa istek FAILED durumuyla tamamlanır (hata loglanır).
+ */
+fe_async_io_handle_t fe_async_io_read(const fe_async_io_read_desc_t* desc);
+
+/**
+ * @brief Birden çok okuma isteğini tek seferde kuyruğa alır. io_uring'de tüm istekler tek bir
+ * io_uring_enter çağrısıyla çekirdeğe gönderilir. Thread-safe'tir.
+ * @param out_handles count elemanlı dizi; kuyruğa alınamayan istekler için FE_ASYNC_IO_INVALID_HANDLE yazılır.
+ * @return uint32_t Kuyruğa alınan istek sayısı.
+ */
+uint32_t fe_async_io_read_batch(const fe_async_io_read_desc_t* descs, uint32_t count, fe_async_io_handle_t* out_handles);
+
+/**
+ * @brief Bir isteğin durumunu bloklamadan döndürür; tamamlandıysa sonucu doldurur.
+ * @param out_result Tamamlandıysa doldurulacak sonuç (NULL olabilir). Callback'li isteklerde
+ * yalnızca status doldurulur.
+ */
+fe_async_io_status_t fe_async_io_poll(fe_async_io_handle_t handle, fe_async_io_result_t* out_result);
+
+/**
+ * @brief İstek tamamlanana kadar bekler ve sonucu doldurur (callback'li isteklerde yalnızca status).
+ */
+fe_async_io_status_t fe_async_io_wait(fe_async_io_handle_t handle, fe_async_io_result_t* out_result);
+
+/**
+ * @brief Bir isteği bırakır; tanıtıcı geçersiz olur. Tamamlanmamış (veya callback'i henüz
+ * çalışmamış) bir istek bırakılırsa sonucu geldiğinde atılır ve sistem tamponu serbest bırakılır.
+ * Callback'li istekler callback'ten sonra otomatik bırakılır; bunun için çağrılması gerekmez.
+ */
+void fe_async_io_release(fe_async_io_handle_t handle);
+
+/**
+ * @brief Tamamlanmış ve callback'i olan isteklerin callback'lerini çağıran thread'de çalıştırır.
+ * @param max_count En fazla çalıştırılacak callback sayısı (0 ise sınırsız).
+ * @return uint32_t Çalıştırılan callback sayısı.
+ */
+uint32_t fe_async_io_dispatch_completions(uint32_t max_count);
+
+/**
+ * @brief Sayaçları döndürür.
+ */
+void fe_async_io_get_stats(fe_async_io_stats_t* out_stats);
+
+#endif // FE_ASYNC_IO_H
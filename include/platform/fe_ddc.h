@@ -0,0 +1,123 @@
+#ifndef FE_DDC_H
+#define FE_DDC_H
+
+#include "core/utils/fe_types.h" // Temel tipler (bool, uint64_t vb.)
+#include "core/utils/fe_hash.h"  // Anahtar oluşturucunun hash durumu için
+
+// --- Türetilmiş Veri Önbelleği (Derived Data Cache, DDC) ---
+// Shader derleme, materyal ayrıştırma gibi işlemler her çalıştırmada kaynaktan aynı çıktıyı
+// yeniden üretir. DDC bu çıktıları ("pişmiş" bloblar) diskte, içerik anahtarıyla saklar:
+//   anahtar = hash(işlemci adı + işlemci sürümü + kaynak baytları + seçenekler)
+// Kaynak, seçenekler veya işlemci sürümü değişince anahtar da değişir; eski kayıtlar hiç
+// okunmaz (geçersiz kılma gerekmez). İşlemci çıktı formatını değiştirdiğinde sürümünü artırmalıdır.
+//
+// Disk düzeni (kök dizine göre):
+//   ab/cd/abcd....ddc  Kayıtlar; anahtarın ilk iki baytına göre 256x256 alt dizine dağıtılır ki
+//                      tek bir dizinde on binlerce dosya birikmesin.
+//   tmp/               Yazılmakta olan kayıtlar. Her kayıt önce burada tamamlanır, sonra hedefe
+//                      atomik olarak taşınır (rename / MoveFileEx). Okuyucular ve aynı anahtarı
+//                      yazan başka süreçler hiçbir zaman yarım bir kayıt görmez.
+// Her kaydın başlığı anahtarı ve yükün hash'ini içerir; bozuk veya kesilmiş kayıtlar okunurken
+// reddedilir ve silinir (ıska sayılır).
+// get/put thread-safe'tir ve birden çok süreç aynı kök dizini paylaşabilir.
+
+/**
+ * @brief 128-bit içerik anahtarı (iki farklı tohumla hesaplanmış iki XXH64).
+ */
+typedef struct fe_ddc_key {
+    uint64_t hash[2];
+} fe_ddc_key_t;
+
+/**
+ * @brief Anahtarı parça parça oluşturur. Alanlar dahilidir.
+ */
+typedef struct fe_ddc_key_builder {
+    fe_hash64_state_t lanes[2];
+} fe_ddc_key_builder_t;
+
+/**
+ * @brief Önbellek sayaçları (süreç başlatıldığından beri).
+ */
+typedef struct fe_ddc_stats {
+    uint64_t hits;
+    uint64_t misses;         // Kayıt yok veya bozuk
+    uint64_t puts;
+    uint64_t corrupt;        // Doğrulamadan geçemeyip silinen kayıt sayısı
+    uint64_t bytes_read;     // Okunan yük baytları
+    uint64_t bytes_written;  // Yazılan yük baytları
+} fe_ddc_stats_t;
+
+// --- Anahtar Oluşturma ---
+
+/**
+ * @brief Yeni bir anahtar başlatır. İşlemci adı ve sürümü her anahtara katılır; böylece farklı
+ * işlemcilerin aynı kaynaktan ürettiği çıktılar çakışmaz.
+ * @param processor_name İşlemcinin kararlı adı (örn. "shader_compiler").
+ * @param processor_version Çıktı formatı her değiştiğinde artırılan sürüm.
+ */
+void fe_ddc_key_begin(fe_ddc_key_builder_t* builder, const char* processor_name, uint32_t processor_version);
+
+/**
+ * @brief Anahtara bir bayt dizisi ekler. Uzunluk da hash'lenir; ("ab","c") ile ("a","bc") farklı anahtar verir.
+ */
+void fe_ddc_key_add(fe_ddc_key_builder_t* builder, const void* data, size_t size);
+
+/**
+ * @brief Anahtara bir string ekler. NULL, boş stringden farklı bir değer olarak eklenir.
+ */
+void fe_ddc_key_add_string(fe_ddc_key_builder_t* builder, const char* str);
+
+/**
+ * @brief Anahtara bir tamsayı seçenek ekler (enum'lar ve bool bayraklar için).
+ */
+void fe_ddc_key_add_u64(fe_ddc_key_builder_t* builder, uint64_t value);
+
+/**
+ * @brief Anahtarı tamamlar.
+ */
+fe_ddc_key_t fe_ddc_key_end(const fe_ddc_key_builder_t* builder);
+
+/**
+ * @brief Anahtarı 32 karakterlik onaltılık stringe çevirir (loglar için).
+ * @param out_str En az 33 karakterlik tampon.
+ */
+void fe_ddc_key_to_string(const fe_ddc_key_t* key, char* out_str);
+
+// --- Önbellek ---
+
+/**
+ * @brief Önbelleği verilen kök dizinle başlatır; dizin yoksa oluşturulur.
+ * @return bool Başarılı ise true. Başarısızsa önbellek kapalı kalır: get hep ıskalar, put bir şey yazmaz.
+ */
+bool fe_ddc_init(const char* root_dir);
+
+/**
+ * @brief Önbelleği kapatır. Diskteki kayıtlar korunur.
+ */
+void fe_ddc_shutdown(void);
+
+/**
+ * @brief Önbelleğin başlatılıp başlatılmadığını döndürür.
+ */
+bool fe_ddc_is_initialized(void);
+
+/**
+ * @brief Anahtara karşılık gelen kaydı okur ve doğrular.
+ * @param out_data Yük; FE_MALLOC ile ayrılır, çağıran FE_FREE(data, FE_MEM_TYPE_GENERAL) ile serbest bırakır.
+ * @param out_size Yük boyutu.
+ * @return bool Geçerli bir kayıt bulunduysa true.
+ */
+bool fe_ddc_get(const fe_ddc_key_t* key, void** out_data, size_t* out_size);
+
+/**
+ * @brief Bir kaydı yazar (varsa üzerine). Yazma geçici dizinde yapılır ve kayıt atomik olarak taşınır.
+ * @return bool Kayıt yerine konduysa true. Başarısızlık yalnızca loglanır; önbellek isteğe bağlıdır.
+ */
+bool fe_ddc_put(const fe_ddc_key_t* key, const void* data, size_t size);
+
+/**
+ * @brief Sayaçları döndürür.
+ */
+void fe_ddc_get_stats(fe_ddc_stats_t* out_stats);
+
+#endif // FE_DDC_H
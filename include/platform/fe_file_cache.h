@@ -0,0 +1,107 @@
+#ifndef FE_FILE_CACHE_H
+#define FE_FILE_CACHE_H
+
+#include "core/utils/fe_types.h" // Temel tipler (bool, uint8_t, size_t vb.)
+
+// --- Eşlenmiş Dosya Önbelleği ---
+// Shader, varlık ve navmesh gibi salt okunur dosyalar malloc'lanmış bir tampona kopyalanmak
+// yerine belleğe eşlenir ve ayrıştırıcılar doğrudan sayfa önbelleği (page cache) belleğini okur.
+// - Aynı yol için tek bir eşleme yapılır ve referans sayılır; son fe_file_cache_release'de kaldırılır.
+// - Her acquire'da verilen erişim ipucu madvise'a (Unix) iletilir: SEQUENTIAL baştan sona bir
+//   kez okunan dosyalar için agresif önden okuma yapar, WILLNEED dosyanın tamamını arka planda
+//   okumaya başlar.
+// - Önbellek başlatılmamışsa acquire yine çalışır; yalnızca eşlemeler paylaşılmaz.
+// - fe_file_cache_mount_pak ile bağlanan arşivler (platform/fe_pak.h) diskten önce aranır:
+//   arşivde bulunan bir yol için open/stat yapılmaz, sıkıştırılmamış girdiler arşiv eşlemesini
+//   doğrudan gösterir.
+//
+// Görünümler salt okunurdur. Eşlenmiş bir dosya diskte kısaltılırsa (truncate) erişim SIGBUS'a
+// yol açabilir; bu yüzden önbellek yalnızca çalışma sırasında değişmeyen içerik dosyaları içindir.
+
+/**
+ * @brief Dosyanın nasıl okunacağına dair ipucu.
+ */
+typedef enum fe_file_access_hint {
+    FE_FILE_ACCESS_HINT_NORMAL = 0, // Çekirdek varsayılanı
+    FE_FILE_ACCESS_HINT_SEQUENTIAL, // Baştan sona bir kez okunacak (shader bytecode, navmesh)
+    FE_FILE_ACCESS_HINT_RANDOM,     // Rastgele erişim (büyük arşivler); önden okuma kapatılır
+    FE_FILE_ACCESS_HINT_WILLNEED    // Tamamı yakında okunacak; hemen önden okumaya başla
+} fe_file_access_hint_t;
+
+/**
+ * @brief Eşlenmiş bir dosyanın sıfır kopyalı, salt okunur görünümü.
+ */
+typedef struct fe_file_view {
+    const uint8_t* data;  // Dosyanın ilk baytı (sayfa hizalı)
+    size_t         size;  // Dosya boyutu
+    void*          entry; // Dahili önbellek girişi; fe_file_cache_release için
+} fe_file_view_t;
+
+// Aynı anda bağlanabilecek en fazla arşiv sayısı (temel oyun + yamalar/DLC).
+#define FE_FILE_CACHE_MAX_PAKS 8
+
+/**
+ * @brief Önbellek sayaçları.
+ */
+typedef struct fe_file_cache_stats {
+    uint32_t mapped_files;  // Şu an eşlenmiş dosya sayısı
+    uint64_t mapped_bytes;  // Şu an eşlenmiş toplam bayt
+    uint64_t hits;          // Mevcut eşlemeyi paylaşan acquire sayısı
+    uint64_t misses;        // Yeni eşleme yapan acquire sayısı
+    uint64_t pak_hits;      // Bağlı bir arşivden karşılanan yeni eşlemeler (misses'e dahil)
+    uint32_t mounted_paks;  // Bağlı arşiv sayısı
+} fe_file_cache_stats_t;
+
+/**
+ * @brief Önbelleği başlatır.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_file_cache_init(void);
+
+/**
+ * @brief Önbelleği kapatır. Serbest bırakılmamış görünümler uyarı ile loglanır ve eşlemeleri kaldırılır.
+ */
+void fe_file_cache_shutdown(void);
+
+/**
+ * @brief Bir dosyanın salt okunur görünümünü alır; dosya zaten eşlenmişse eşlemeyi paylaşır.
+ * Thread-safe'tir. Eşleme ve arşivden çözme önbellek kilidi dışında yapılır; yalnızca arama ve
+ * yayımlama kilit altındadır.
+ *
+ * @param path Dosya yolu (UTF-8).
+ * @param hint Erişim ipucu (madvise).
+ * @param out_view Doldurulacak görünüm.
+ * @return bool Başarılı ise true; dosya yoksa, boşsa (diskte veya bağlı arşivde) veya eşlenemezse
+ * false. Boş arşiv girdisi diskteki aynı yoldaki dosyaya geri düşmez.
+ */
+bool fe_file_cache_acquire(const char* path, fe_file_access_hint_t hint, fe_file_view_t* out_view);
+
+/**
+ * @brief Bir görünümü bırakır. Dosyanın son görünümüyse eşleme kaldırılır. Görünüm sıfırlanır.
+ */
+void fe_file_cache_release(fe_file_view_t* view);
+
+/**
+ * @brief Bir pak arşivini bağlar. Sonraki acquire'lar yolu önce bağlı arşivlerde arar; son bağlanan
+ * arşiv öncekileri (ve diski) gölgeler, böylece yama arşivleri temel arşivin üstüne bağlanabilir.
+ * Arşivler fe_file_cache_shutdown'a kadar bağlı kalır.
+ * Zaten eşlenmiş yollar etkilenmez.
+ *
+ * @param pak_path Arşiv dosyasının yolu.
+ * @return bool Başarılı ise true; önbellek başlatılmamışsa, arşiv geçersizse veya sınıra ulaşıldıysa false.
+ */
+bool fe_file_cache_mount_pak(const char* pak_path);
+
+/**
+ * @brief Yolun bağlı bir arşivde bulunup bulunmadığını döndürür (diske bakmaz). Thread-safe'tir.
+ * Okumayı kendisi zamanlayan sistemler (ör. asenkron varlık yükleme) arşivdeki dosyaları
+ * fe_file_cache_acquire ile, diskteki dosyaları asenkron G/Ç ile okumak için kullanır.
+ */
+bool fe_file_cache_is_packed(const char* path);
+
+/**
+ * @brief Önbellek sayaçlarını döndürür.
+ */
+void fe_file_cache_get_stats(fe_file_cache_stats_t* out_stats);
+
+#endif // FE_FILE_CACHE_H
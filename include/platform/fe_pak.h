@@ -0,0 +1,128 @@
+#ifndef FE_PAK_H
+#define FE_PAK_H
+
+#include "core/utils/fe_types.h" // Temel tipler (bool, uint8_t, uint64_t vb.)
+
+// --- Pak Arşivi ---
+// Binlerce küçük varlık dosyasını tek tek open/stat etmek yerine hepsi tek bir arşivde toplanır.
+// Arşiv bir kez belleğe eşlenir; bir yolu çözmek için yol bir kez hashlenir ve sıralı içindekiler
+// tablosunda (TOC) ikili arama yapılır. Sıkıştırılmamış girdiler sıfır kopyalı okunur.
+// Arşivler tools/fe_pak_build ile üretilir.
+//
+// Dosya düzeni (küçük uçlu / little-endian; okuyucu yapıları doğrudan eşlemeden okur):
+//   fe_pak_header_t (64 bayt)
+//   Girdi verileri; her biri FE_PAK_ALIGNMENT'a hizalı (sayfa hizası madvise ve eşleme için)
+//   TOC: entry_count adet fe_pak_entry_t, (path_hash, yol) sırasına göre sıralı
+//   Yol tablosu: NUL ile sonlanan UTF-8 yollar, '/' ayraçlı, arşiv köküne göreli
+
+#define FE_PAK_MAGIC     "FEPAK\0\0\0"
+#define FE_PAK_VERSION   1u
+#define FE_PAK_ALIGNMENT 4096u
+
+/**
+ * @brief Girdi başına sıkıştırma yöntemi.
+ */
+typedef enum fe_pak_compression {
+    FE_PAK_COMPRESSION_NONE = 0,
+    FE_PAK_COMPRESSION_LZ4  = 1, // Blok formatı (core/utils/fe_lz4.h)
+    FE_PAK_COMPRESSION_ZSTD = 2  // Yalnızca FE_WITH_ZSTD ile derlenmiş okuyucular çözebilir
+} fe_pak_compression_t;
+
+/**
+ * @brief Arşiv başlığı (64 bayt).
+ */
+typedef struct fe_pak_header {
+    char     magic[8];      // FE_PAK_MAGIC
+    uint32_t version;       // FE_PAK_VERSION
+    uint32_t entry_count;
+    uint64_t toc_offset;    // İlk fe_pak_entry_t'nin dosya konumu (8 bayt hizalı)
+    uint64_t names_offset;  // Yol tablosunun dosya konumu
+    uint64_t names_size;
+    uint64_t reserved[3];
+} fe_pak_header_t;
+
+/**
+ * @brief İçindekiler tablosu girdisi (40 bayt).
+ */
+typedef struct fe_pak_entry {
+    uint64_t path_hash;     // fe_pak_hash_path(yol)
+    uint64_t offset;        // Verinin dosya konumu (FE_PAK_ALIGNMENT hizalı)
+    uint64_t stored_size;   // Arşivdeki (sıkıştırılmış) boyut
+    uint64_t size;          // Çözülmüş boyut
+    uint32_t name_offset;   // Yol tablosundaki konum
+    uint16_t name_length;   // NUL hariç
+    uint8_t  compression;   // fe_pak_compression_t
+    uint8_t  reserved;
+} fe_pak_entry_t;
+
+/**
+ * @brief Arşiv içi yolu hashler (64-bit FNV-1a). '\\' ayraçları '/' olarak hashlenir ki
+ * Windows yolları da aynı girdiye çözülsün. Arşiv oluşturucu ve okuyucu aynı fonksiyonu kullanır.
+ */
+static inline uint64_t fe_pak_hash_path(const char* path) {
+    uint64_t hash = 14695981039346656037ull;
+    for (const unsigned char* p = (const unsigned char*)path; *p; ++p) {
+        unsigned char c = (*p == '\\') ? '/' : *p;
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Açık bir arşiv (opak)
+typedef struct fe_pak fe_pak_t;
+
+/**
+ * @brief Bir girdinin okunmuş verisi.
+ */
+typedef struct fe_pak_data {
+    const uint8_t* data;
+    size_t         size;
+    void*          owned; // Sıkıştırılmış girdiler için çözülmüş tampon; fe_pak_data_release serbest bırakır
+} fe_pak_data_t;
+
+/**
+ * @brief Bir arşivi açar, belleğe eşler ve başlık ile TOC'u doğrular.
+ * @return fe_pak_t* Açık arşiv; dosya yoksa veya geçersizse NULL.
+ */
+fe_pak_t* fe_pak_open(const char* pak_path);
+
+/**
+ * @brief Arşivi kapatır. Arşivden alınmış sıfır kopyalı veriler geçersiz olur.
+ */
+void fe_pak_close(fe_pak_t* pak);
+
+/**
+ * @brief Arşiv içi yolu girdiye çözer (tek hash + TOC'ta ikili arama). Thread-safe'tir.
+ * @return const fe_pak_entry_t* Girdi; yol arşivde yoksa NULL.
+ */
+const fe_pak_entry_t* fe_pak_find(const fe_pak_t* pak, const char* path);
+
+/**
+ * @brief Girdinin verisini döndürür. Sıkıştırılmamış girdiler eşlemeyi doğrudan gösterir;
+ * sıkıştırılmış girdiler FE_MALLOC ile ayrılan bir tampona çözülür. Thread-safe'tir.
+ * @return bool Başarılı ise true; çözme hatası veya desteklenmeyen sıkıştırmada false.
+ */
+bool fe_pak_read(const fe_pak_t* pak, const fe_pak_entry_t* entry, fe_pak_data_t* out_data);
+
+/**
+ * @brief fe_pak_read'in ayırdığı tamponu (varsa) serbest bırakır ve veriyi sıfırlar.
+ */
+void fe_pak_data_release(fe_pak_data_t* data);
+
+/**
+ * @brief Arşivdeki girdi sayısı.
+ */
+uint32_t fe_pak_entry_count(const fe_pak_t* pak);
+
+/**
+ * @brief index'inci girdi (TOC sırasıyla); araçlar ve listeleme için.
+ */
+const fe_pak_entry_t* fe_pak_entry_at(const fe_pak_t* pak, uint32_t index);
+
+/**
+ * @brief Girdinin arşiv içi yolu (NUL ile sonlanır).
+ */
+const char* fe_pak_entry_path(const fe_pak_t* pak, const fe_pak_entry_t* entry);
+
+#endif // FE_PAK_H
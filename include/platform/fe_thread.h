@@ -0,0 +1,111 @@
+#ifndef FE_THREAD_H
+#define FE_THREAD_H
+
+#include "core/utils/fe_types.h" // Temel tipler (bool, uint32_t vb.) için
+
+#ifdef _WIN32
+#include <windows.h>  // HANDLE, SRWLOCK, CONDITION_VARIABLE için
+#else
+#include <pthread.h>  // pthread_t, pthread_mutex_t, pthread_cond_t için
+#endif
+
+// --- Platformdan Bağımsız Thread Katmanı ---
+// Motorun arka plan thread'leri (iş sistemi işçileri, loglama, dosya G/Ç) bu ince katmanı
+// kullanır. Windows'ta CreateThread/SRWLOCK/CONDITION_VARIABLE, diğer platformlarda
+// pthread kullanılır.
+
+// Thread'e özel (thread-local) değişken belirteci.
+#if defined(_MSC_VER)
+#define FE_THREAD_LOCAL __declspec(thread)
+#elif defined(__cplusplus)
+#define FE_THREAD_LOCAL thread_local
+#else
+#define FE_THREAD_LOCAL __thread
+#endif
+
+/**
+ * @brief Thread giriş fonksiyonu.
+ */
+typedef void (*fe_thread_func)(void* user_data);
+
+// --- Thread ---
+typedef struct fe_thread {
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    bool   started;  // Thread başarıyla oluşturulduysa true
+} fe_thread_t;
+
+/**
+ * @brief Yeni bir thread oluşturur ve func(user_data)'yı çalıştırır.
+ *
+ * @param thread Doldurulacak thread yapısı.
+ * @param func Thread'de çalışacak fonksiyon.
+ * @param user_data Fonksiyona iletilecek veri.
+ * @param name Hata ayıklayıcıda görünecek ad (isteğe bağlı, NULL olabilir).
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_thread_create(fe_thread_t* thread, fe_thread_func func, void* user_data, const char* name);
+
+/**
+ * @brief Thread'in bitmesini bekler ve kaynaklarını serbest bırakır.
+ *
+ * @param thread Beklenecek thread.
+ */
+void fe_thread_join(fe_thread_t* thread);
+
+/**
+ * @brief Çağıran thread'in işlemci zaman dilimini bırakır.
+ */
+void fe_thread_yield(void);
+
+/**
+ * @brief Sistemdeki mantıksal işlemci sayısını döndürür (en az 1).
+ */
+uint32_t fe_thread_hardware_concurrency(void);
+
+// --- Muteks ---
+typedef struct fe_mutex {
+#ifdef _WIN32
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif
+} fe_mutex_t;
+
+bool fe_mutex_init(fe_mutex_t* mutex);
+void fe_mutex_destroy(fe_mutex_t* mutex);
+void fe_mutex_lock(fe_mutex_t* mutex);
+void fe_mutex_unlock(fe_mutex_t* mutex);
+
+// --- Koşul Değişkeni ---
+typedef struct fe_cond {
+#ifdef _WIN32
+    CONDITION_VARIABLE cond;
+#else
+    pthread_cond_t cond;
+#endif
+} fe_cond_t;
+
+bool fe_cond_init(fe_cond_t* cond);
+void fe_cond_destroy(fe_cond_t* cond);
+
+/**
+ * @brief Muteksi bırakıp koşul sinyalini bekler; dönmeden önce muteksi yeniden alır.
+ * Sahte uyanmalar (spurious wakeup) olabilir; çağıran koşulu döngüde kontrol etmelidir.
+ */
+void fe_cond_wait(fe_cond_t* cond, fe_mutex_t* mutex);
+
+/**
+ * @brief fe_cond_wait gibi, ancak en fazla timeout_ms milisaniye bekler.
+ *
+ * @return bool Sinyal alındıysa true, zaman aşımında false.
+ */
+bool fe_cond_wait_timeout(fe_cond_t* cond, fe_mutex_t* mutex, uint32_t timeout_ms);
+
+void fe_cond_signal(fe_cond_t* cond);
+void fe_cond_broadcast(fe_cond_t* cond);
+
+#endif // FE_THREAD_H
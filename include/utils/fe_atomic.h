@@ -0,0 +1,313 @@
+#ifndef FE_ATOMIC_H
+#define FE_ATOMIC_H
+
+#include <stddef.h>  // size_t için
+#include <stdint.h>  // uint32_t, uint64_t için
+#include <stdbool.h> // bool için
+
+// --- Atomik İşlemler ---
+// Thread'ler arası veri aktaran yapılar (kilitsiz kuyruklar, iş sistemi sayaçları) için
+// ince bir atomik katman. <stdatomic.h> MSVC'de ve C++ derleme birimlerinde her zaman
+// kullanılamadığından GCC/Clang'da __atomic yerleşikleri, MSVC'de Interlocked* ve
+// açık bariyerli __iso_volatile_* erişimleri kullanılır.
+//
+// Doğrulama: tools/fe_ring_queue_stress.c kuyrukları ve bu katmanı çok thread'li olarak zorlar
+// (GCC/Clang'da -fsanitize=thread ile derlenmelidir).
+//
+// Atomik değişkenler düz tamsayılardır; yalnızca fe_atomic_* fonksiyonlarıyla erişilmelidir.
+//
+// Kullanım:
+//   fe_atomic_store_size(&q->tail, tail + 1, FE_ATOMIC_RELEASE);
+//   size_t head = fe_atomic_load_size(&q->head, FE_ATOMIC_ACQUIRE);
+
+// Önbellek satırı boyutu. Farklı thread'lerin yazdığı alanlar arasına bu kadar dolgu konularak
+// yanlış paylaşım (false sharing) önlenir.
+#ifndef FE_CACHE_LINE_SIZE
+#define FE_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * @brief Bellek sıralama kısıtları (C11 memory_order ile aynı anlamda).
+ */
+typedef enum fe_atomic_order {
+    FE_ATOMIC_RELAXED = 0,
+    FE_ATOMIC_ACQUIRE,
+    FE_ATOMIC_RELEASE,
+    FE_ATOMIC_ACQ_REL,
+    FE_ATOMIC_SEQ_CST
+} fe_atomic_order_t;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+
+#include <windows.h> // MemoryBarrier, YieldProcessor, Interlocked* için
+#include <intrin.h>  // __iso_volatile_load*/store*, __dmb için
+
+// Yükleme ve saklamalar __iso_volatile_* ile yapılır: bunlar /volatile ayarından bağımsız olarak
+// sıralamasız (relaxed) erişimdir. Acquire/release anlamı açık bariyerle verilir. x86/x64'te
+// donanım sıralaması (TSO) yeterli olduğundan bu bir derleyici bariyeridir; ARM'de `dmb ish`.
+// Interlocked* işlemleri her iki mimaride de tam bariyerdir; bu nedenle RMW işlemlerinde
+// sıralama parametresi kullanılmaz ve seq_cst saklamalar takasla yapılır.
+
+#if defined(_M_ARM64) || defined(_M_ARM64EC)
+#define FE_ATOMIC_MSVC_ORDER_FENCE() __dmb(_ARM64_BARRIER_ISH)
+#elif defined(_M_ARM)
+#define FE_ATOMIC_MSVC_ORDER_FENCE() __dmb(_ARM_BARRIER_ISH)
+#else
+#define FE_ATOMIC_MSVC_ORDER_FENCE() _ReadWriteBarrier()
+#endif
+
+static inline void fe_atomic_thread_fence(fe_atomic_order_t order) {
+    if (order == FE_ATOMIC_SEQ_CST) {
+        MemoryBarrier();
+    } else if (order != FE_ATOMIC_RELAXED) {
+        FE_ATOMIC_MSVC_ORDER_FENCE();
+    } else {
+        _ReadWriteBarrier();
+    }
+}
+
+static inline void fe_atomic_cpu_relax(void) {
+    YieldProcessor();
+}
+
+// Yüklemeden sonra: sonraki erişimler yüklemenin önüne geçemez
+static inline void fe_atomic_msvc_after_load(fe_atomic_order_t order) {
+    if (order != FE_ATOMIC_RELAXED && order != FE_ATOMIC_RELEASE) FE_ATOMIC_MSVC_ORDER_FENCE();
+}
+
+// Saklamadan önce: önceki erişimler saklamanın arkasına geçemez
+static inline void fe_atomic_msvc_before_store(fe_atomic_order_t order) {
+    if (order == FE_ATOMIC_RELEASE || order == FE_ATOMIC_ACQ_REL) FE_ATOMIC_MSVC_ORDER_FENCE();
+}
+
+static inline uint32_t fe_atomic_load_u32(const volatile uint32_t* ptr, fe_atomic_order_t order) {
+    uint32_t value = (uint32_t)__iso_volatile_load32((const volatile __int32*)ptr);
+    fe_atomic_msvc_after_load(order);
+    return value;
+}
+
+static inline void fe_atomic_store_u32(volatile uint32_t* ptr, uint32_t value, fe_atomic_order_t order) {
+    if (order == FE_ATOMIC_SEQ_CST) {
+        _InterlockedExchange((volatile long*)ptr, (long)value);
+        return;
+    }
+    fe_atomic_msvc_before_store(order);
+    __iso_volatile_store32((volatile __int32*)ptr, (__int32)value);
+}
+
+static inline uint32_t fe_atomic_fetch_add_u32(volatile uint32_t* ptr, uint32_t value, fe_atomic_order_t order) {
+    (void)order;
+    return (uint32_t)_InterlockedExchangeAdd((volatile long*)ptr, (long)value);
+}
+
+static inline uint32_t fe_atomic_exchange_u32(volatile uint32_t* ptr, uint32_t value, fe_atomic_order_t order) {
+    (void)order;
+    return (uint32_t)_InterlockedExchange((volatile long*)ptr, (long)value);
+}
+
+static inline bool fe_atomic_compare_exchange_u32(volatile uint32_t* ptr, uint32_t* expected, uint32_t desired, fe_atomic_order_t order) {
+    (void)order;
+    long prev = _InterlockedCompareExchange((volatile long*)ptr, (long)desired, (long)*expected);
+    if ((uint32_t)prev == *expected) return true;
+    *expected = (uint32_t)prev;
+    return false;
+}
+
+static inline uint64_t fe_atomic_load_u64(const volatile uint64_t* ptr, fe_atomic_order_t order) {
+#if defined(_WIN64)
+    uint64_t value = (uint64_t)__iso_volatile_load64((const volatile __int64*)ptr);
+    fe_atomic_msvc_after_load(order);
+    return value;
+#else
+    // 32-bit hedeflerde 64-bit okuma tek komut değildir
+    (void)order;
+    return (uint64_t)_InterlockedCompareExchange64((volatile __int64*)ptr, 0, 0);
+#endif
+}
+
+static inline void fe_atomic_store_u64(volatile uint64_t* ptr, uint64_t value, fe_atomic_order_t order) {
+#if defined(_WIN64)
+    if (order == FE_ATOMIC_SEQ_CST) {
+        _InterlockedExchange64((volatile __int64*)ptr, (__int64)value);
+        return;
+    }
+    fe_atomic_msvc_before_store(order);
+    __iso_volatile_store64((volatile __int64*)ptr, (__int64)value);
+#else
+    (void)order;
+    __int64 prev = *(volatile __int64*)ptr;
+    __int64 seen;
+    while ((seen = _InterlockedCompareExchange64((volatile __int64*)ptr, (__int64)value, prev)) != prev) prev = seen;
+#endif
+}
+
+static inline uint64_t fe_atomic_fetch_add_u64(volatile uint64_t* ptr, uint64_t value, fe_atomic_order_t order) {
+    (void)order;
+    return (uint64_t)_InterlockedExchangeAdd64((volatile __int64*)ptr, (__int64)value);
+}
+
+static inline uint64_t fe_atomic_exchange_u64(volatile uint64_t* ptr, uint64_t value, fe_atomic_order_t order) {
+    (void)order;
+    return (uint64_t)_InterlockedExchange64((volatile __int64*)ptr, (__int64)value);
+}
+
+static inline bool fe_atomic_compare_exchange_u64(volatile uint64_t* ptr, uint64_t* expected, uint64_t desired, fe_atomic_order_t order) {
+    (void)order;
+    __int64 prev = _InterlockedCompareExchange64((volatile __int64*)ptr, (__int64)desired, (__int64)*expected);
+    if ((uint64_t)prev == *expected) return true;
+    *expected = (uint64_t)prev;
+    return false;
+}
+
+static inline void* fe_atomic_load_ptr(void* const volatile* ptr, fe_atomic_order_t order) {
+#if defined(_WIN64)
+    void* value = (void*)__iso_volatile_load64((const volatile __int64*)ptr);
+#else
+    void* value = (void*)__iso_volatile_load32((const volatile __int32*)ptr);
+#endif
+    fe_atomic_msvc_after_load(order);
+    return value;
+}
+
+static inline void fe_atomic_store_ptr(void* volatile* ptr, void* value, fe_atomic_order_t order) {
+    if (order == FE_ATOMIC_SEQ_CST) {
+        _InterlockedExchangePointer(ptr, value);
+        return;
+    }
+    fe_atomic_msvc_before_store(order);
+#if defined(_WIN64)
+    __iso_volatile_store64((volatile __int64*)ptr, (__int64)value);
+#else
+    __iso_volatile_store32((volatile __int32*)ptr, (__int32)value);
+#endif
+}
+
+static inline void* fe_atomic_exchange_ptr(void* volatile* ptr, void* value, fe_atomic_order_t order) {
+    (void)order;
+    return _InterlockedExchangePointer(ptr, value);
+}
+
+static inline bool fe_atomic_compare_exchange_ptr(void* volatile* ptr, void** expected, void* desired, fe_atomic_order_t order) {
+    (void)order;
+    void* prev = _InterlockedCompareExchangePointer(ptr, desired, *expected);
+    if (prev == *expected) return true;
+    *expected = prev;
+    return false;
+}
+
+#else // GCC / Clang
+
+static inline int fe_atomic_order_to_builtin(fe_atomic_order_t order) {
+    switch (order) {
+        case FE_ATOMIC_RELAXED: return __ATOMIC_RELAXED;
+        case FE_ATOMIC_ACQUIRE: return __ATOMIC_ACQUIRE;
+        case FE_ATOMIC_RELEASE: return __ATOMIC_RELEASE;
+        case FE_ATOMIC_ACQ_REL: return __ATOMIC_ACQ_REL;
+        default:                return __ATOMIC_SEQ_CST;
+    }
+}
+
+// Başarısız karşılaştır-değiştir yalnızca yükleme yapar; release/acq_rel geçerli değildir.
+static inline int fe_atomic_failure_order_to_builtin(fe_atomic_order_t order) {
+    switch (order) {
+        case FE_ATOMIC_RELAXED:
+        case FE_ATOMIC_RELEASE: return __ATOMIC_RELAXED;
+        case FE_ATOMIC_ACQUIRE:
+        case FE_ATOMIC_ACQ_REL: return __ATOMIC_ACQUIRE;
+        default:                return __ATOMIC_SEQ_CST;
+    }
+}
+
+static inline void fe_atomic_thread_fence(fe_atomic_order_t order) {
+    __atomic_thread_fence(fe_atomic_order_to_builtin(order));
+}
+
+/**
+ * @brief Döngüde bekleyen (spin) thread'ler için işlemciye ipucu verir.
+ */
+static inline void fe_atomic_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#else
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+#endif
+}
+
+#define FE_ATOMIC_DEFINE_OPS(suffix, type) \
+    static inline type fe_atomic_load_##suffix(const volatile type* ptr, fe_atomic_order_t order) { \
+        return __atomic_load_n(ptr, fe_atomic_order_to_builtin(order)); \
+    } \
+    static inline void fe_atomic_store_##suffix(volatile type* ptr, type value, fe_atomic_order_t order) { \
+        __atomic_store_n(ptr, value, fe_atomic_order_to_builtin(order)); \
+    } \
+    static inline type fe_atomic_fetch_add_##suffix(volatile type* ptr, type value, fe_atomic_order_t order) { \
+        return __atomic_fetch_add(ptr, value, fe_atomic_order_to_builtin(order)); \
+    } \
+    static inline type fe_atomic_exchange_##suffix(volatile type* ptr, type value, fe_atomic_order_t order) { \
+        return __atomic_exchange_n(ptr, value, fe_atomic_order_to_builtin(order)); \
+    } \
+    static inline bool fe_atomic_compare_exchange_##suffix(volatile type* ptr, type* expected, type desired, fe_atomic_order_t order) { \
+        return __atomic_compare_exchange_n(ptr, expected, desired, false, \
+                                           fe_atomic_order_to_builtin(order), fe_atomic_failure_order_to_builtin(order)); \
+    }
+
+FE_ATOMIC_DEFINE_OPS(u32, uint32_t)
+FE_ATOMIC_DEFINE_OPS(u64, uint64_t)
+
+#undef FE_ATOMIC_DEFINE_OPS
+
+static inline void* fe_atomic_load_ptr(void* const volatile* ptr, fe_atomic_order_t order) {
+    return __atomic_load_n(ptr, fe_atomic_order_to_builtin(order));
+}
+
+static inline void fe_atomic_store_ptr(void* volatile* ptr, void* value, fe_atomic_order_t order) {
+    __atomic_store_n(ptr, value, fe_atomic_order_to_builtin(order));
+}
+
+static inline void* fe_atomic_exchange_ptr(void* volatile* ptr, void* value, fe_atomic_order_t order) {
+    return __atomic_exchange_n(ptr, value, fe_atomic_order_to_builtin(order));
+}
+
+static inline bool fe_atomic_compare_exchange_ptr(void* volatile* ptr, void** expected, void* desired, fe_atomic_order_t order) {
+    return __atomic_compare_exchange_n(ptr, expected, desired, false,
+                                       fe_atomic_order_to_builtin(order), fe_atomic_failure_order_to_builtin(order));
+}
+
+#undef FE_ATOMIC_MSVC_ORDER_FENCE
+
+#endif // _MSC_VER
+
+// --- size_t Yardımcıları ---
+// Kuyruk indeksleri size_t'dir; platformun kelime boyutuna göre u32/u64 işlemlerine yönlendirilir.
+
+#if SIZE_MAX == UINT64_MAX
+#define FE_ATOMIC_SIZE_SUFFIX(op) fe_atomic_##op##_u64
+#define FE_ATOMIC_SIZE_TYPE uint64_t
+#else
+#define FE_ATOMIC_SIZE_SUFFIX(op) fe_atomic_##op##_u32
+#define FE_ATOMIC_SIZE_TYPE uint32_t
+#endif
+
+static inline size_t fe_atomic_load_size(const volatile size_t* ptr, fe_atomic_order_t order) {
+    return (size_t)FE_ATOMIC_SIZE_SUFFIX(load)((const volatile FE_ATOMIC_SIZE_TYPE*)ptr, order);
+}
+
+static inline void fe_atomic_store_size(volatile size_t* ptr, size_t value, fe_atomic_order_t order) {
+    FE_ATOMIC_SIZE_SUFFIX(store)((volatile FE_ATOMIC_SIZE_TYPE*)ptr, (FE_ATOMIC_SIZE_TYPE)value, order);
+}
+
+static inline size_t fe_atomic_fetch_add_size(volatile size_t* ptr, size_t value, fe_atomic_order_t order) {
+    return (size_t)FE_ATOMIC_SIZE_SUFFIX(fetch_add)((volatile FE_ATOMIC_SIZE_TYPE*)ptr, (FE_ATOMIC_SIZE_TYPE)value, order);
+}
+
+static inline bool fe_atomic_compare_exchange_size(volatile size_t* ptr, size_t* expected, size_t desired, fe_atomic_order_t order) {
+    return FE_ATOMIC_SIZE_SUFFIX(compare_exchange)((volatile FE_ATOMIC_SIZE_TYPE*)ptr, (FE_ATOMIC_SIZE_TYPE*)expected,
+                                                   (FE_ATOMIC_SIZE_TYPE)desired, order);
+}
+
+#undef FE_ATOMIC_SIZE_SUFFIX
+#undef FE_ATOMIC_SIZE_TYPE
+
+#endif // FE_ATOMIC_H
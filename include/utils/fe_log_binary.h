@@ -0,0 +1,267 @@
+#ifndef FE_LOG_BINARY_H
+#define FE_LOG_BINARY_H
+
+#include "core/utils/fe_types.h"  // Temel tipler (bool, uint8_t, uint32_t vb.)
+#include "core/utils/fe_logger.h" // fe_log_level_t için
+
+#include <stdarg.h> // va_list için
+
+// --- İkili (Binary) Log Dosyası ---
+// Metin loglama her mesajda vsnprintf ve zaman damgası biçimlendirmesi yapar; sunucu oturumlarında
+// milyonlarca satırda hem CPU hem disk maliyeti yüksektir. İkili sink mesajı biçimlendirmez:
+// - Her log çağrı noktası (format string + dosya + satır) dosyada ilk kullanıldığında bir kez
+//   site kaydıyla tanımlanır ve bir ID alır.
+// - Her mesaj yalnızca site ID'si, zaman damgası ve argümanlardır. Argüman tipleri format
+//   string'den çağrı noktası başına bir kez çıkarılır; çözücü de aynı tipleri format'tan çıkardığı
+//   için argümanların uzunluğu yazılmaz.
+// - Sayılar değişken uzunluklu (varint, 7 bit/bayt) yazılır: küçük değerler 1-2 bayt tutar.
+//   Kısa string argümanlar içerik hash'iyle seçilen bir yuvada tutulur; aynı string tekrar
+//   geldiğinde yalnızca yuva numarası yazılır.
+//   Tipik bir mesaj metin satırının yaklaşık onda biri kadardır.
+// - tools/fe_log_decode dosyayı metne veya JSON satırlarına geri çevirir.
+//
+// Dosya düzeni (küçük uçlu / little-endian):
+//   Başlık:  "FEBLOG\0\0" (8) | u32 sürüm | u32 ayrılmış | u64 açılış anı (Unix epoch, ns)
+//   Her kayıt bir varint etiketle başlar:
+//   Site:    etiket=0 | u32 id | u8 seviye | u32 satır | u16 dosya uzunluğu | dosya | u16 format uzunluğu | format
+//   Mesaj:   etiket=site id + 1 | varint önceki mesajdan beri geçen ns | argümanlar
+//   Argümanlar format sırasıyla varint'tir:
+//   - işaretli tamsayılar zigzag (-1 -> 1, 1 -> 2), işaretsizler (size_t, %p) doğrudan;
+//   - double'lar bayt sırası ters çevrilmiş bitleridir: yuvarlak değerlerin ve float'tan yükseltilmiş
+//     değerlerin alt bitleri sıfır olduğundan kısa kalır;
+//   - string'ler: (uzunluk << 1) + baytlar ya da ((yuva << 1) | 1). Uzunluğu 1..FE_LOG_BINARY_CACHED_STRING_MAX
+//     olan her düz string, fe_log_string_slot yuvasına yazılmış sayılır (kodlayıcı ve çözücü aynı
+//     tabloyu tutar).
+//   İlk mesajın zaman farkı açılış anına göredir.
+
+#define FE_LOG_BINARY_MAGIC   "FEBLOG\0\0"
+#define FE_LOG_BINARY_VERSION 2u
+
+#define FE_LOG_BINARY_RECORD_SITE    0u // Site kaydının etiketi
+#define FE_LOG_BINARY_RECORD_MESSAGE 1u // Mesaj etiketi = FE_LOG_BINARY_RECORD_MESSAGE + site id
+
+// Bir çağrı noktasında desteklenen en fazla argüman sayısı (* genişlik/hassasiyet dahil).
+#define FE_LOG_BINARY_MAX_ARGS 16
+
+// Tek bir string argümanın dosyaya yazılan en fazla uzunluğu.
+#define FE_LOG_BINARY_MAX_STRING 1024
+
+// Bir dosyadaki en fazla çağrı noktası sayısı; site ID'leri bundan küçüktür.
+#define FE_LOG_BINARY_MAX_SITES 4096
+
+// Bir varint'in en fazla bayt sayısı (64 bit / 7).
+#define FE_LOG_BINARY_MAX_VARINT 10
+
+// Tekrarlanan string argümanlar için yuva sayısı (2'nin kuvveti) ve yuvada tutulan en uzun string.
+#define FE_LOG_BINARY_STRING_SLOTS      256
+#define FE_LOG_BINARY_CACHED_STRING_MAX 64
+
+// Tek bir mesajın argümanlarının en fazla bayt sayısı.
+#define FE_LOG_BINARY_MAX_PAYLOAD (FE_LOG_BINARY_MAX_ARGS * (FE_LOG_BINARY_MAX_VARINT + FE_LOG_BINARY_MAX_STRING))
+
+// --- Varint Kodlama ---
+
+/**
+ * @brief v'yi varint olarak yazar ve yazılan son baytın ardını döndürür.
+ */
+static inline uint8_t* fe_log_varint_put(uint8_t* p, uint64_t v) {
+    while (v >= 0x80) {
+        *p++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+/**
+ * @brief [p, end) aralığından bir varint okur.
+ * @return const uint8_t* Okunan varint'in ardı; veri bittiyse veya varint 64 biti aşıyorsa NULL.
+ */
+static inline const uint8_t* fe_log_varint_get(const uint8_t* p, const uint8_t* end, uint64_t* out_value) {
+    uint64_t value = 0;
+    for (uint32_t shift = 0; p < end && shift < 64; shift += 7) {
+        uint8_t byte = *p++;
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            *out_value = value;
+            return p;
+        }
+    }
+    return NULL;
+}
+
+static inline uint64_t fe_log_zigzag_encode(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static inline int64_t fe_log_zigzag_decode(uint64_t v) {
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+/**
+ * @brief Bir string argümanın önbellek yuvasını döndürür (FNV-1a).
+ */
+static inline uint32_t fe_log_string_slot(const char* text, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ (uint8_t)text[i]) * 16777619u;
+    }
+    return hash & (FE_LOG_BINARY_STRING_SLOTS - 1);
+}
+
+/**
+ * @brief 64 bitin bayt sırasını ters çevirir (double'ları varint'e uygun hale getirmek için; kendi tersidir).
+ */
+static inline uint64_t fe_log_reverse_bytes(uint64_t v) {
+    uint64_t r = 0;
+    for (int i = 0; i < 8; ++i) {
+        r = (r << 8) | (v & 0xFF);
+        v >>= 8;
+    }
+    return r;
+}
+
+/**
+ * @brief Format string'den çıkarılan argüman tipi. Kodlayıcı va_arg'ı, çözücü snprintf'i
+ * tam olarak bu C tipiyle çağırır.
+ */
+typedef enum fe_log_arg_type {
+    FE_LOG_ARG_NONE = 0,
+    FE_LOG_ARG_INT,       // int (ayrıca char, short, %c, * genişlik/hassasiyet)
+    FE_LOG_ARG_LONG,      // long
+    FE_LOG_ARG_LLONG,     // long long
+    FE_LOG_ARG_SIZE,      // size_t
+    FE_LOG_ARG_INTMAX,    // intmax_t
+    FE_LOG_ARG_PTRDIFF,   // ptrdiff_t
+    FE_LOG_ARG_DOUBLE,    // double (float yükseltilir)
+    FE_LOG_ARG_LDOUBLE,   // long double (dosyaya double olarak yazılır)
+    FE_LOG_ARG_STRING,    // const char*
+    FE_LOG_ARG_POINTER    // void* (%p; %n de yalnızca tüketilir)
+} fe_log_arg_type_t;
+
+/**
+ * @brief Format string'deki tek bir dönüşüm belirteci (ör. "%-8.3f").
+ */
+typedef struct fe_log_format_spec {
+    const char*       start;          // '%' karakteri
+    const char*       end;            // Dönüşüm karakterinden sonraki karakter
+    fe_log_arg_type_t width_arg;      // '*' genişlik varsa FE_LOG_ARG_INT
+    fe_log_arg_type_t precision_arg;  // '*' hassasiyet varsa FE_LOG_ARG_INT
+    fe_log_arg_type_t value_arg;      // Değerin tipi
+} fe_log_format_spec_t;
+
+/**
+ * @brief p'den itibaren bir sonraki dönüşüm belirtecini bulur ("%%" atlanır).
+ *
+ * @param p Aramaya başlanacak konum.
+ * @param out_spec Bulunan belirteç.
+ * @return bool Belirteç bulunduysa true, string bittiyse false.
+ */
+static inline bool fe_log_format_next_spec(const char* p, fe_log_format_spec_t* out_spec) {
+    for (; *p; ++p) {
+        if (*p != '%') continue;
+        if (p[1] == '%') { ++p; continue; }
+
+        const char* c = p + 1;
+        out_spec->start = p;
+        out_spec->width_arg = FE_LOG_ARG_NONE;
+        out_spec->precision_arg = FE_LOG_ARG_NONE;
+
+        while (*c == '-' || *c == '+' || *c == ' ' || *c == '#' || *c == '0') ++c;
+        if (*c == '*') { out_spec->width_arg = FE_LOG_ARG_INT; ++c; }
+        while (*c >= '0' && *c <= '9') ++c;
+        if (*c == '.') {
+            ++c;
+            if (*c == '*') { out_spec->precision_arg = FE_LOG_ARG_INT; ++c; }
+            while (*c >= '0' && *c <= '9') ++c;
+        }
+
+        // Uzunluk belirteci
+        fe_log_arg_type_t int_type = FE_LOG_ARG_INT;
+        bool long_double = false;
+        if (c[0] == 'h') { c += (c[1] == 'h') ? 2 : 1; }
+        else if (c[0] == 'l' && c[1] == 'l') { int_type = FE_LOG_ARG_LLONG; c += 2; }
+        else if (c[0] == 'l') { int_type = FE_LOG_ARG_LONG; ++c; }
+        else if (c[0] == 'z') { int_type = FE_LOG_ARG_SIZE; ++c; }
+        else if (c[0] == 'j') { int_type = FE_LOG_ARG_INTMAX; ++c; }
+        else if (c[0] == 't') { int_type = FE_LOG_ARG_PTRDIFF; ++c; }
+        else if (c[0] == 'L') { long_double = true; ++c; }
+
+        switch (*c) {
+            case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+                out_spec->value_arg = int_type; break;
+            case 'c':
+                out_spec->value_arg = FE_LOG_ARG_INT; break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                out_spec->value_arg = long_double ? FE_LOG_ARG_LDOUBLE : FE_LOG_ARG_DOUBLE; break;
+            case 's':
+                out_spec->value_arg = FE_LOG_ARG_STRING; break;
+            case 'p': case 'n':
+                out_spec->value_arg = FE_LOG_ARG_POINTER; break;
+            default:
+                // Tanınmayan belirteç: argüman tüketmeden metin olarak bırakılır
+                out_spec->value_arg = FE_LOG_ARG_NONE;
+                if (!*c) { out_spec->end = c; return true; }
+                break;
+        }
+        out_spec->end = c + 1;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Format string'in argüman tiplerini sırasıyla çıkarır ('*' genişlik/hassasiyet dahil).
+ * Kodlayıcı ve çözücü aynı listeyi kullanır; FE_LOG_BINARY_MAX_ARGS'tan fazlası yazılmaz.
+ *
+ * @param out_types En az FE_LOG_BINARY_MAX_ARGS elemanlık dizi.
+ * @return uint32_t Argüman sayısı.
+ */
+static inline uint32_t fe_log_format_arg_types(const char* format, uint8_t* out_types) {
+    uint32_t count = 0;
+    fe_log_format_spec_t spec;
+    for (const char* p = format; fe_log_format_next_spec(p, &spec); p = spec.end) {
+        fe_log_arg_type_t types[3] = { spec.width_arg, spec.precision_arg, spec.value_arg };
+        for (int t = 0; t < 3; ++t) {
+            if (types[t] != FE_LOG_ARG_NONE && count < FE_LOG_BINARY_MAX_ARGS) {
+                out_types[count++] = (uint8_t)types[t];
+            }
+        }
+        if (!*spec.end) break;
+    }
+    return count;
+}
+
+/**
+ * @brief İkili log dosyasını açar (varsa üzerine yazar) ve başlığı yazar. Açıkken
+ * min_level ve üstündeki tüm fe_log_message çağrıları bu dosyaya da yazılır.
+ *
+ * @param path Dosya yolu.
+ * @param min_level Dosyaya yazılacak en düşük seviye.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_log_binary_open(const char* path, fe_log_level_t min_level);
+
+/**
+ * @brief Tamponu yazar ve dosyayı kapatır. Başka thread'lerden loglama sürerken çağrılabilir:
+ * o anda yazmakta olan thread'ler bitene kadar bekler, sonraki mesajlar ikili dosyaya yazılmaz.
+ */
+void fe_log_binary_close(void);
+
+/**
+ * @brief Tamponlanmış kayıtları dosyaya yazar.
+ */
+void fe_log_binary_flush(void);
+
+/**
+ * @brief Verilen seviyedeki bir mesajın ikili dosyaya yazılıp yazılmayacağını döndürür.
+ */
+bool fe_log_binary_accepts(fe_log_level_t level);
+
+/**
+ * @brief Bir log mesajını ikili olarak yazar. fe_log_message tarafından çağrılır.
+ * format ve file statik ömürlü olmalıdır (FE_LOG_* makrolarındaki gibi).
+ */
+void fe_log_binary_write(fe_log_level_t level, const char* file, int line, const char* format, va_list args);
+
+#endif // FE_LOG_BINARY_H
@@ -3,6 +3,7 @@
 
 #include <stdio.h>   // FILE ve fprintf için
 #include <stdbool.h> // bool için
+#include <stdint.h>  // uint32_t, uint64_t için
 
 // --- Log Seviyeleri ---
 typedef enum fe_log_level {
@@ -53,21 +54,107 @@ typedef enum fe_log_level {
  */
 void fe_log_message(fe_log_level_t level, const char* file, int line, const char* format, ...);
 
+// --- Çağrı Noktası Hız Sınırı ---
+// Aşırı yük altında her çağrıda tetiklenen uyarılar (ör. havuz dolu, çarpışma dizisi dolu)
+// loglamanın kendisiyle yükü artırmasın diye her FE_LOG_* çağrı noktasının kendi statik sayacı
+// vardır: bir zaman penceresinde en fazla 'burst' mesaj geçer, fazlası sayılıp bastırılır.
+// Bastırılan mesajların sayısı aynı noktadan "N similar message(s) suppressed" satırıyla yazılır:
+// nokta tekrar tetiklenirse yeni pencerenin ilk mesajından önce, susarsa pencere bittikten sonraki
+// herhangi bir log çağrısında, en geç fe_logger_shutdown'da. Varsayılan: saniyede 20 mesaj.
+
+/**
+ * @brief Bir log çağrı noktasının hız sınırı durumu. FE_LOG_* makrolarında statik olarak tanımlanır;
+ * sayaçlara yalnızca atomik olarak erişilir.
+ */
+typedef struct fe_log_site {
+    uint64_t window_start_ns; // Geçerli pencerenin başlangıcı (0 ise henüz kullanılmadı)
+    uint32_t count;           // Bu pencerede geçen veya bastırılan mesaj sayısı
+    uint32_t suppressed;      // Bu pencerede bastırılan mesaj sayısı
+    uint32_t pending;         // 1 ise özeti bekleyen noktalar listesinde
+    fe_log_level_t level;     // Listeye eklenirken yazılır; özet bu konumla loglanır
+    const char* file;
+    int line;
+    struct fe_log_site* next_pending;
+} fe_log_site_t;
+
+/**
+ * @brief Çağrı noktasının bu mesajı loglayıp loglayamayacağına karar verir. Seviyesi hiçbir
+ * çıktıya ulaşmayan mesajlar için saat okunmadan false döner. Önceki pencerede bastırılmış
+ * mesajlar varsa önce onların sayısını aynı seviyede loglar. Makrolar tarafından çağrılır.
+ *
+ * @return bool Mesaj loglanmalıysa true, bastırıldıysa veya filtrelendiyse false.
+ */
+bool fe_log_site_allow(fe_log_site_t* site, fe_log_level_t level, const char* file, int line);
+
+/**
+ * @brief Çağrı noktası başına hız sınırını ayarlar.
+ *
+ * @param burst Bir pencerede geçmesine izin verilen mesaj sayısı (0 ise sınır kapalı).
+ * @param window_ms Pencere süresi (milisaniye, 0 ise 1000).
+ */
+void fe_logger_set_rate_limit(uint32_t burst, uint32_t window_ms);
+
 // --- Log Makroları ---
 // Makrolar __FILE__ ve __LINE__ otomatik olarak geçirerek hata ayıklamayı kolaylaştırır.
 // __VA_ARGS__ kullanarak değişken argümanları destekler.
 
-// DEBUG seviyesi genellikle sadece geliştirme ortamında etkin olmalıdır.
-#ifdef FE_DEBUG_BUILD
-    #define FE_LOG_DEBUG(fmt, ...) fe_log_message(FE_LOG_LEVEL_DEBUG, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+// Derleme zamanı en düşük log seviyesi (0=DEBUG, 1=INFO, 2=WARN, 3=ERROR, 4=CRITICAL, 5=hiçbiri).
+// Bunun altındaki makrolar argümanları değerlendirilmeden tamamen kaldırılır; çalışma zamanı
+// seviyeleri (fe_logger_set_*_min_level) yalnızca derlenmiş seviyeler arasında filtreler.
+// Varsayılan: debug derlemesinde DEBUG, aksi halde INFO (DEBUG logları üretimde derlenmez).
+#ifndef FE_LOG_COMPILE_MIN_LEVEL
+    #ifdef FE_DEBUG_BUILD
+        #define FE_LOG_COMPILE_MIN_LEVEL 0
+    #else
+        #define FE_LOG_COMPILE_MIN_LEVEL 1
+    #endif
+#endif
+
+// 0 ise çağrı noktası hız sınırı makrolardan tamamen kaldırılır.
+#ifndef FE_LOG_RATE_LIMIT_ENABLED
+#define FE_LOG_RATE_LIMIT_ENABLED 1
+#endif
+
+#if FE_LOG_RATE_LIMIT_ENABLED
+#define FE_LOG_AT_SITE(level, fmt, ...) do { \
+        static fe_log_site_t fe_log_site_; \
+        if (fe_log_site_allow(&fe_log_site_, level, __FILE__, __LINE__)) { \
+            fe_log_message(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__); \
+        } \
+    } while(0)
+#else
+#define FE_LOG_AT_SITE(level, fmt, ...) fe_log_message(level, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+#endif
+
+#if FE_LOG_COMPILE_MIN_LEVEL <= 0
+    #define FE_LOG_DEBUG(fmt, ...)     FE_LOG_AT_SITE(FE_LOG_LEVEL_DEBUG,    fmt, ##__VA_ARGS__)
+#else
+    #define FE_LOG_DEBUG(fmt, ...)     do {} while(0) // Derleme zamanı seviyesinin altında
+#endif
+
+#if FE_LOG_COMPILE_MIN_LEVEL <= 1
+    #define FE_LOG_INFO(fmt, ...)      FE_LOG_AT_SITE(FE_LOG_LEVEL_INFO,     fmt, ##__VA_ARGS__)
+#else
+    #define FE_LOG_INFO(fmt, ...)      do {} while(0)
+#endif
+
+#if FE_LOG_COMPILE_MIN_LEVEL <= 2
+    #define FE_LOG_WARN(fmt, ...)      FE_LOG_AT_SITE(FE_LOG_LEVEL_WARN,     fmt, ##__VA_ARGS__)
 #else
-    #define FE_LOG_DEBUG(fmt, ...) do {} while(0) // Üretim derlemesinde hiçbir şey yapma
+    #define FE_LOG_WARN(fmt, ...)      do {} while(0)
 #endif
 
-#define FE_LOG_INFO(fmt, ...)      fe_log_message(FE_LOG_LEVEL_INFO,      __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define FE_LOG_WARN(fmt, ...)      fe_log_message(FE_LOG_LEVEL_WARN,      __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define FE_LOG_ERROR(fmt, ...)     fe_log_message(FE_LOG_LEVEL_ERROR,     __FILE__, __LINE__, fmt, ##__VA_ARGS__)
-#define FE_LOG_CRITICAL(fmt, ...)  fe_log_message(FE_LOG_LEVEL_CRITICAL,  __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+#if FE_LOG_COMPILE_MIN_LEVEL <= 3
+    #define FE_LOG_ERROR(fmt, ...)     FE_LOG_AT_SITE(FE_LOG_LEVEL_ERROR,    fmt, ##__VA_ARGS__)
+#else
+    #define FE_LOG_ERROR(fmt, ...)     do {} while(0)
+#endif
+
+#if FE_LOG_COMPILE_MIN_LEVEL <= 4
+    #define FE_LOG_CRITICAL(fmt, ...)  FE_LOG_AT_SITE(FE_LOG_LEVEL_CRITICAL, fmt, ##__VA_ARGS__)
+#else
+    #define FE_LOG_CRITICAL(fmt, ...)  do {} while(0)
+#endif
 
 
 // --- Logger Kontrol Fonksiyonları ---
@@ -117,4 +204,55 @@ void fe_logger_set_console_min_level(fe_log_level_t level);
  */
 void fe_logger_set_file_min_level(fe_log_level_t level);
 
+// --- Asenkron Loglama ---
+// Asenkron modda fe_log_message yalnızca mesajı biçimlendirip çağıran thread'in kendi kilitsiz
+// halka arabelleğine (fe_spsc_queue_t) koyar; zaman damgası alma, dosya/konsol yazma ve
+// flush işlemleri arka plan thread'inde toplu writev ile yapılır. Zaman damgası string'i
+// saniyede bir kez üretilip önbelleğe alınır.
+// Halka doluysa block_min_level altındaki mesajlar düşürülür (sayılır ve periyodik olarak
+// raporlanır); bu seviye ve üstü yer açılana kadar bekler, böylece hatalar kaybolmaz.
+
+/**
+ * @brief Asenkron loglama ayarları. Sıfır değerli alanlar için varsayılanlar kullanılır.
+ */
+typedef struct fe_logger_async_config {
+    uint32_t       ring_capacity;      // Thread başına kuyruktaki kayıt sayısı (0 ise 1024)
+    uint32_t       flush_interval_ms;  // Arka plan thread'inin yeni kayıt beklerken en uzun uyuma süresi (0 ise 10)
+    fe_log_level_t block_min_level;    // Halka doluyken beklenecek en düşük seviye (DEBUG=0 olduğundan varsayılan için WARN verin)
+} fe_logger_async_config_t;
+
+/**
+ * @brief Asenkron loglama sayaçları.
+ */
+typedef struct fe_logger_async_stats {
+    uint64_t written;      // Arka plan thread'inin yazdığı kayıt sayısı
+    uint64_t dropped;      // Halka dolu olduğu için düşürülen kayıt sayısı
+    uint32_t thread_count; // Kendi halkası olan thread sayısı
+} fe_logger_async_stats_t;
+
+/**
+ * @brief Asenkron modu başlatır ve arka plan yazma thread'ini açar. Logger başlatılmış olmalıdır.
+ *
+ * @param config Ayarlar (NULL ise varsayılanlar; block_min_level WARN olur).
+ * @return bool Başarılı ise true, aksi takdirde false (loglama eşzamanlı devam eder).
+ */
+bool fe_logger_start_async(const fe_logger_async_config_t* config);
+
+/**
+ * @brief Bekleyen tüm kayıtları yazar, arka plan thread'ini durdurur ve eşzamanlı moda döner.
+ * Başka thread'ler log üretmiyorken çağrılmalıdır. fe_logger_shutdown bunu otomatik çağırır.
+ */
+void fe_logger_stop_async(void);
+
+/**
+ * @brief Asenkron modda o ana kadar kuyruğa girmiş tüm kayıtları yazıp döner.
+ * Eşzamanlı modda yalnızca dosyayı flush eder.
+ */
+void fe_logger_flush(void);
+
+/**
+ * @brief Asenkron loglama sayaçlarını döndürür.
+ */
+void fe_logger_get_async_stats(fe_logger_async_stats_t* out_stats);
+
 #endif // FE_LOGGER_H
@@ -0,0 +1,33 @@
+#ifndef FE_LZ4_H
+#define FE_LZ4_H
+
+#include "core/utils/fe_types.h" // Temel tipler (bool, size_t vb.)
+
+// --- LZ4 Blok Sıkıştırma ---
+// Standart LZ4 blok formatının (çerçevesiz) bağımlılıksız bir uygulaması. Pak arşivleri gibi
+// çözme hızının oranından önemli olduğu yerlerde kullanılır. Üretilen bloklar referans lz4
+// kütüphanesiyle (LZ4_decompress_safe) çözülebilir ve tersi de geçerlidir.
+// Sıkıştırıcı açgözlü (greedy) tek geçişlidir; oran lz4'ün varsayılan hızlı moduna yakındır.
+
+/**
+ * @brief src_size baytlık girdinin sıkıştırılmış halinin alabileceği en büyük boyut.
+ */
+static inline size_t fe_lz4_compress_bound(size_t src_size) {
+    return src_size + src_size / 255 + 16;
+}
+
+/**
+ * @brief Bir bloğu sıkıştırır.
+ * @param dst_capacity Hedef tampon boyutu; fe_lz4_compress_bound kadar ise işlem hiç başarısız olmaz.
+ * @return size_t Sıkıştırılmış boyut; hedef tampon yetmezse 0.
+ */
+size_t fe_lz4_compress(const void* src, size_t src_size, void* dst, size_t dst_capacity);
+
+/**
+ * @brief Bir bloğu çözer. Bozuk veya kötü niyetli girdide tampon dışına yazmaz/okumaz.
+ * @param dst_size Çözülmüş verinin tam boyutu (blok formatı bunu kendisi saklamaz).
+ * @return bool Blok geçerliyse ve tam olarak dst_size bayt ürettiyse true.
+ */
+bool fe_lz4_decompress(const void* src, size_t src_size, void* dst, size_t dst_size);
+
+#endif // FE_LZ4_H
@@ -0,0 +1,142 @@
+#ifndef FE_PROFILER_H
+#define FE_PROFILER_H
+
+#include "core/utils/fe_types.h" // Temel tipler (bool, uint32_t, uint64_t vb.)
+
+// --- Hiyerarşik CPU Profilleyici ---
+// Sistemlerin kare içindeki sürelerini ölçmek için düşük maliyetli bölge (zone) ölçümü:
+// - FE_PROFILE_BEGIN("Physics.Step") / FE_PROFILE_END() çiftleri iç içe kullanılabilir;
+//   her bölge bittiğinde başlangıç, bitiş, derinlik ve alt bölgelerde geçen süreyle birlikte
+//   çağıran thread'in kendi halka arabelleğine yazılır (kilit yok, paylaşım yok).
+// - Zaman damgası Linux'ta CLOCK_MONOTONIC_RAW, Windows'ta QueryPerformanceCounter'dan alınır.
+//   FE_PROFILER_USE_RDTSC tanımlıysa x86'da rdtsc kullanılır (init'te ns'ye kalibre edilir).
+// - fe_profiler_frame_mark her karenin başında ana thread'den çağrılır: tüm thread'lerin
+//   arabellekleri boşaltılır ve bölgeler isme göre toplanıp son karenin istatistiği olur.
+// - fe_profiler_capture_begin / fe_profiler_capture_end_to_file arasındaki bölgeler
+//   Chrome trace-event JSON'u olarak (chrome://tracing, Perfetto) dışa aktarılır.
+//
+// Bölge adları statik ömürlü string'ler olmalıdır; yalnızca işaretçileri saklanır.
+// FE_PROFILER_ENABLED 0 ise makrolar derleme sırasında tamamen kaldırılır.
+//
+// Kullanım:
+//   FE_PROFILE_BEGIN("AI.Update");
+//   ...
+//   FE_PROFILE_END();
+
+#ifndef FE_PROFILER_ENABLED
+#define FE_PROFILER_ENABLED 1
+#endif
+
+// Profil verisi üretebilecek en fazla thread sayısı.
+#ifndef FE_PROFILER_MAX_THREADS
+#define FE_PROFILER_MAX_THREADS 64
+#endif
+
+// Thread başına halka arabelleğindeki bölge kaydı sayısı. 2'nin kuvveti olmalıdır.
+// Kareler arasında bundan fazla bölge biten thread'in en eski kayıtları düşürülür.
+#ifndef FE_PROFILER_RING_SIZE
+#define FE_PROFILER_RING_SIZE 8192
+#endif
+
+// En fazla iç içe bölge derinliği.
+#ifndef FE_PROFILER_MAX_DEPTH
+#define FE_PROFILER_MAX_DEPTH 32
+#endif
+
+// Kare istatistiğinde tutulabilecek farklı bölge adı sayısı.
+#ifndef FE_PROFILER_MAX_ZONE_NAMES
+#define FE_PROFILER_MAX_ZONE_NAMES 128
+#endif
+
+/**
+ * @brief Bir bölge adının son karedeki toplam istatistiği (tüm thread'ler birlikte).
+ */
+typedef struct fe_profiler_zone_stats {
+    const char* name;        // Bölge adı
+    uint32_t    call_count;  // Bu karede bitme sayısı
+    double      total_ms;    // Toplam süre (alt bölgeler dahil)
+    double      self_ms;     // Alt bölgeler hariç süre
+    double      max_ms;      // Tek bir çağrının en uzun süresi
+} fe_profiler_zone_stats_t;
+
+/**
+ * @brief Son tamamlanan karenin profil özeti.
+ */
+typedef struct fe_profiler_frame_stats {
+    uint64_t frame;           // Kare numarası (fe_profiler_frame_mark çağrı sayısı)
+    double   frame_ms;        // İki frame_mark arasındaki süre
+    uint32_t zone_count;      // zones dizisindeki geçerli eleman sayısı
+    uint64_t dropped_zones;   // Arabellek taşması veya isim tablosu dolması nedeniyle kaybolan bölgeler
+    fe_profiler_zone_stats_t zones[FE_PROFILER_MAX_ZONE_NAMES]; // Toplam süreye göre azalan sırada
+} fe_profiler_frame_stats_t;
+
+/**
+ * @brief Profilleyiciyi başlatır ve çağıran thread'i "Main" olarak kaydeder.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_profiler_init(void);
+
+/**
+ * @brief Profilleyiciyi kapatır ve tüm thread arabelleklerini serbest bırakır.
+ * Çağırmadan önce diğer thread'lerin bölge üretmesi durdurulmuş olmalıdır.
+ */
+void fe_profiler_shutdown(void);
+
+/**
+ * @brief Çağıran thread'in izleme çıktısında görünecek adını ayarlar.
+ */
+void fe_profiler_set_thread_name(const char* name);
+
+/**
+ * @brief Çağıran thread'de yeni bir bölge açar.
+ * @param name Statik ömürlü bölge adı.
+ */
+void fe_profiler_zone_begin(const char* name);
+
+/**
+ * @brief Çağıran thread'de en son açılan bölgeyi kapatır ve kaydeder.
+ */
+void fe_profiler_zone_end(void);
+
+/**
+ * @brief Bir önceki kareyi kapatır: tüm thread arabelleklerini boşaltır, kare istatistiğini
+ * günceller ve yakalama açıksa bölgeleri yakalama arabelleğine ekler. Ana thread'den çağrılmalıdır.
+ */
+void fe_profiler_frame_mark(void);
+
+/**
+ * @brief Son tamamlanan karenin profil özetini döndürür.
+ */
+const fe_profiler_frame_stats_t* fe_profiler_get_frame_stats(void);
+
+/**
+ * @brief Chrome trace yakalamasını başlatır. Sonraki frame_mark'lardan itibaren bölgeler biriktirilir.
+ * @param max_zones Biriktirilecek en fazla bölge sayısı; dolunca yeni bölgeler yok sayılır.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+bool fe_profiler_capture_begin(uint32_t max_zones);
+
+/**
+ * @brief Yakalamayı bitirir ve biriken bölgeleri Chrome trace-event JSON dosyası olarak yazar.
+ * @param path Yazılacak dosya yolu.
+ * @return bool Dosya yazıldıysa true, aksi takdirde false.
+ */
+bool fe_profiler_capture_end_to_file(const char* path);
+
+/**
+ * @brief Bir yakalama sürüyorsa true döndürür.
+ */
+bool fe_profiler_is_capturing(void);
+
+// --- Ölçüm Makroları ---
+#if FE_PROFILER_ENABLED
+#define FE_PROFILE_BEGIN(name)  fe_profiler_zone_begin(name)
+#define FE_PROFILE_END()        fe_profiler_zone_end()
+#define FE_PROFILE_FRAME_MARK() fe_profiler_frame_mark()
+#else
+#define FE_PROFILE_BEGIN(name)  ((void)0)
+#define FE_PROFILE_END()        ((void)0)
+#define FE_PROFILE_FRAME_MARK() ((void)0)
+#endif
+
+#endif // FE_PROFILER_H
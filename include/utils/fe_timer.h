@@ -2,6 +2,7 @@
 #define FE_TIMER_H
 
 #include <stdbool.h> // bool için
+#include <stdint.h>  // uint64_t için
 
 // --- Zamanlayıcı Hata Kodları ---
 typedef enum fe_timer_error {
@@ -63,4 +64,99 @@ double fe_timer_get_total_time();
  */
 long long fe_timer_get_frequency();
 
+// --- Yüksek Çözünürlüklü Zaman ---
+
+/**
+ * @brief Monotonik saatin nanosaniye cinsinden değerini döndürür.
+ * fe_timer_init gerektirmez ve her thread'den çağrılabilir; başlangıç noktası tanımsızdır,
+ * yalnızca farklar anlamlıdır.
+ * @return uint64_t Nanosaniye.
+ */
+uint64_t fe_timer_now_ns();
+
+/**
+ * @brief Mutlak bir monotonik zamana (fe_timer_now_ns tabanında) kadar bekler.
+ * Son spin_ns nanosaniye hariç işletim sistemi uykusuyla (Linux'ta
+ * clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME)), kalan kısım meşgul beklemeyle geçirilir;
+ * böylece zamanlayıcı dilimi kadar fazla uyuma önlenir.
+ * @param deadline_ns Uyanılacak mutlak zaman (nanosaniye).
+ * @param spin_ns Son ne kadarlık sürenin meşgul beklemeyle geçirileceği (nanosaniye).
+ * @return uint64_t İşletim sistemi uykusunun hedefini (deadline_ns - spin_ns) ne kadar geçtiği
+ * (nanosaniye); uyku gerekmediyse 0. Spin payını uyarlamak için kullanılabilir.
+ */
+uint64_t fe_timer_sleep_until_ns(uint64_t deadline_ns, uint64_t spin_ns);
+
+// --- Kare Hızı Ayarlayıcı (Frame Pacer) ---
+// Kareleri sabit bir periyoda hizalar. Her kare bir önceki karenin son tarihinden (deadline)
+// bir periyot sonrasına kadar bekler; böylece hatalar birikmez. Uyku + spin ayrımı,
+// işletim sisteminin gözlenen fazla uyuma süresine göre uyarlanır: uyku ne kadar geç uyanıyorsa
+// spin payı o kadar büyür. Kare son tarihi kaçırılırsa kare "kaçırılmış" sayılır ve
+// yakalamaya çalışmak yerine zamanlama şimdiden yeniden başlatılır.
+//
+// Kullanım:
+//   fe_frame_pacer_t pacer;
+//   fe_frame_pacer_init(&pacer, 144.0);
+//   while (running) { fe_frame_pacer_wait(&pacer); update(); render(); }
+
+/**
+ * @brief Kare zamanlaması istatistikleri (fe_frame_pacer_reset_stats'tan bu yana).
+ */
+typedef struct fe_frame_pacer_stats {
+    uint64_t frame_count;        // Ölçülen kare aralığı sayısı
+    uint64_t missed_deadlines;   // Beklemeye son tarih geçtikten sonra gelinen kare sayısı
+    double   target_frame_ms;    // Hedef kare süresi
+    double   last_frame_ms;      // Son kare süresi (ardışık iki kare başlangıcı arası)
+    double   mean_frame_ms;      // Ortalama kare süresi
+    double   frame_variance_ms2; // Kare süresi varyansı (ms^2)
+    double   min_frame_ms;       // En kısa kare süresi
+    double   max_frame_ms;       // En uzun kare süresi
+    double   mean_wake_error_us; // Hedeflenen başlangıca göre ortalama geç kalma (mikrosaniye)
+    double   spin_margin_us;     // Güncel spin payı (mikrosaniye)
+} fe_frame_pacer_stats_t;
+
+/**
+ * @brief Kare hızı ayarlayıcı durumu. Alanlara doğrudan erişilmemelidir.
+ */
+typedef struct fe_frame_pacer {
+    uint64_t period_ns;          // Hedef kare periyodu (0 ise bekleme yapılmaz)
+    uint64_t next_deadline_ns;   // Bir sonraki karenin başlaması gereken an (0 ise henüz belirlenmedi)
+    uint64_t last_frame_start_ns;// Son karenin başladığı an
+    uint64_t spin_margin_ns;     // Uykunun son tarihten ne kadar önce bırakılacağı
+    double   oversleep_ema_ns;   // İşletim sistemi uykusunun hedefini aşma miktarının üstel ortalaması
+    double   frame_m2;           // Welford varyans toplamı (ms^2)
+    double   wake_error_sum_us;  // Beklenen karelerdeki geç kalma toplamı
+    uint64_t wake_error_count;   // Beklenen (son tarihten önce gelinen) kare sayısı
+    fe_frame_pacer_stats_t stats;
+} fe_frame_pacer_t;
+
+/**
+ * @brief Kare hızı ayarlayıcıyı başlatır.
+ * @param pacer Başlatılacak ayarlayıcı.
+ * @param target_frame_rate Hedef kare hızı (Hz). 0 veya negatif ise bekleme yapılmaz,
+ * yalnızca istatistik toplanır.
+ */
+void fe_frame_pacer_init(fe_frame_pacer_t* pacer, double target_frame_rate);
+
+/**
+ * @brief Hedef kare hızını değiştirir; zamanlama bir sonraki karede yeniden başlar.
+ */
+void fe_frame_pacer_set_target(fe_frame_pacer_t* pacer, double target_frame_rate);
+
+/**
+ * @brief Bir sonraki karenin son tarihine kadar bekler ve kare istatistiklerini günceller.
+ * Her karenin başında bir kez çağrılmalıdır.
+ * @return uint64_t Yeni karenin başlangıç zamanı (fe_timer_now_ns tabanında).
+ */
+uint64_t fe_frame_pacer_wait(fe_frame_pacer_t* pacer);
+
+/**
+ * @brief Toplanan istatistikleri döndürür.
+ */
+void fe_frame_pacer_get_stats(const fe_frame_pacer_t* pacer, fe_frame_pacer_stats_t* out_stats);
+
+/**
+ * @brief İstatistikleri sıfırlar (zamanlama ve spin payı korunur).
+ */
+void fe_frame_pacer_reset_stats(fe_frame_pacer_t* pacer);
+
 #endif // FE_TIMER_H
@@ -2,6 +2,7 @@
 #include "core/utils/fe_logger.h"
 #include "core/memory/fe_memory_manager.h"
 #include "core/math/fe_math.h" // fe_vec3 için
+#include "core/utils/fe_profiler.h" // AI güncelleme süresini ölçmek için
 
 #include <string.h> // memset için
 
@@ -316,13 +317,17 @@ void fe_ai_manager_update(fe_ai_manager_t* manager, uint32_t delta_time_ms, uint
     if (!manager) return;
 
     manager->current_game_time_ms = current_game_time_ms;
+    FE_PROFILE_BEGIN("AI.Update");
 
     // AI algılama sistemini güncelle (bu, tüm perceiver'ları kendi iç zamanlamalarına göre güncelleyecek)
     // AI ajanlarının perceiver bileşenlerini güncellemeleri, onların pozisyon ve yönlerini perception_system'a bildirmesiyle gerçekleşir.
     // perception_system_update çağrısı, bu bildirilen verileri işler.
+    FE_PROFILE_BEGIN("AI.Perception");
     fe_perception_system_update(manager->perception_system, delta_time_ms, current_game_time_ms);
+    FE_PROFILE_END();
 
     // Her bir AI ajanını güncelle
+    FE_PROFILE_BEGIN("AI.Agents");
     size_t num_agents = fe_array_get_size(&manager->ai_agents);
     for (size_t i = 0; i < num_agents; ++i) {
         fe_ai_agent_t* agent = (fe_ai_agent_t*)fe_array_get_at(&manager->ai_agents, i);
@@ -330,6 +335,8 @@ void fe_ai_manager_update(fe_ai_manager_t* manager, uint32_t delta_time_ms, uint
             fe_ai_agent_update(agent, manager, delta_time_ms, current_game_time_ms);
         }
     }
+    FE_PROFILE_END();
+    FE_PROFILE_END();
 }
 
 fe_ai_agent_t* fe_ai_manager_get_agent(const fe_ai_manager_t* manager, uint32_t entity_id) {
@@ -2,6 +2,7 @@
 #include "core/utils/fe_logger.h"
 #include "core/math/fe_math.h" // For fe_vec3_dist_sq, fe_vec3_cross, fe_vec3_normalize etc.
 #include "core/containers/fe_heap.h" // A* için min-heap (öncelik kuyruğu)
+#include "platform/fe_file_cache.h" // NavMesh dosyalarını eşlenmiş bellekten okumak için
 #include <float.h> // For FLT_MAX
 #include <string.h> // For memset, memcpy
 
@@ -255,6 +256,85 @@ bool fe_nav_mesh_build_connections(fe_nav_mesh_t* nav_mesh) {
     return true;
 }
 
+// Eşlenmiş dosyadan hizasız u32 okur (dosya düzeni küçük uçludur)
+static inline uint32_t fe_nav_mesh_read_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool fe_nav_mesh_load_from_file(fe_nav_mesh_t* nav_mesh, const char* file_path) {
+    if (!nav_mesh || !file_path) {
+        FE_LOG_ERROR("fe_nav_mesh_load_from_file: Invalid parameters.");
+        return false;
+    }
+
+    fe_file_view_t view;
+    if (!fe_file_cache_acquire(file_path, FE_FILE_ACCESS_HINT_SEQUENTIAL, &view)) {
+        FE_LOG_ERROR("fe_nav_mesh_load_from_file: Failed to map '%s'.", file_path);
+        return false;
+    }
+
+    const uint8_t* p = view.data;
+    const uint8_t* end = view.data + view.size;
+    bool success = false;
+
+    if (view.size < 16 || fe_nav_mesh_read_u32(p) != FE_NAV_MESH_FILE_MAGIC ||
+        fe_nav_mesh_read_u32(p + 4) != FE_NAV_MESH_FILE_VERSION) {
+        FE_LOG_ERROR("fe_nav_mesh_load_from_file: '%s' is not a version %u NavMesh file.", file_path, FE_NAV_MESH_FILE_VERSION);
+        fe_file_cache_release(&view);
+        return false;
+    }
+    uint32_t vertex_count = fe_nav_mesh_read_u32(p + 8);
+    uint32_t polygon_count = fe_nav_mesh_read_u32(p + 12);
+    p += 16;
+
+    if ((uint64_t)vertex_count * 12 > (uint64_t)(end - p) ||
+        !fe_nav_mesh_init(nav_mesh, vertex_count ? vertex_count : 1, polygon_count ? polygon_count : 1)) {
+        FE_LOG_ERROR("fe_nav_mesh_load_from_file: '%s' is truncated or could not be allocated.", file_path);
+        fe_file_cache_release(&view);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < vertex_count; ++i, p += 12) {
+        float xyz[3];
+        memcpy(xyz, p, sizeof(xyz));
+        fe_vec3_t position = { xyz[0], xyz[1], xyz[2] };
+        fe_nav_mesh_add_vertex(nav_mesh, position);
+    }
+
+    uint32_t loaded_polygons = 0;
+    for (; loaded_polygons < polygon_count; ++loaded_polygons) {
+        if (end - p < 4) break;
+        fe_nav_mesh_polygon_t polygon;
+        memset(&polygon, 0, sizeof(polygon));
+        polygon.vertex_count = fe_nav_mesh_read_u32(p);
+        p += 4;
+        if (polygon.vertex_count < 3 || polygon.vertex_count > FE_NAV_MESH_MAX_VERTICES_PER_POLYGON ||
+            (size_t)(end - p) < polygon.vertex_count * 4u) {
+            break;
+        }
+        bool indices_valid = true;
+        for (uint32_t v = 0; v < polygon.vertex_count; ++v, p += 4) {
+            polygon.vertex_indices[v] = fe_nav_mesh_read_u32(p);
+            indices_valid = indices_valid && polygon.vertex_indices[v] < vertex_count;
+        }
+        if (!indices_valid || fe_nav_mesh_add_polygon(nav_mesh, &polygon) == FE_INVALID_ID) break;
+    }
+
+    if (loaded_polygons != polygon_count) {
+        FE_LOG_ERROR("fe_nav_mesh_load_from_file: '%s' has an invalid polygon at index %u.", file_path, loaded_polygons);
+        fe_nav_mesh_destroy(nav_mesh);
+    } else {
+        success = fe_nav_mesh_build_connections(nav_mesh);
+        if (success) {
+            FE_LOG_INFO("NavMesh loaded from '%s' (%u vertices, %u polygons).", file_path, vertex_count, polygon_count);
+        } else {
+            fe_nav_mesh_destroy(nav_mesh);
+        }
+    }
+
+    fe_file_cache_release(&view);
+    return success;
+}
 
 bool fe_nav_mesh_find_polygon_for_point(const fe_nav_mesh_t* nav_mesh, fe_vec3_t point, uint32_t* polygon_id_out) {
     if (!nav_mesh || !polygon_id_out) {
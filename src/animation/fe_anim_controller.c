@@ -28,7 +28,7 @@ static fe_mat4 get_animated_local_bone_transform_for_layer(
     if (layer->use_partial_mask) {
         // Eğer bir kök kemik adı belirtilmişse ve bu kemik hiyerarşide değilse, bu katmanı atla
         // Bu basit bir kontrol, tam maskeleme için daha karmaşık bir ağaç geçişi gerekebilir.
-        if (fe_string_is_empty(&layer->affected_bone_root) || !fe_string_equal(&layer->affected_bone_root, bone->name.data)) {
+        if (layer->affected_bone_root_id == FE_STRING_ID_INVALID || layer->affected_bone_root_id != bone->name_id) {
             // Eğer kemik, maskenin kök kemiği veya onun çocuğu değilse, sadece bind pose dönüşümünü kullan
             // Daha gelişmiş maskeleme için, bu kemiğin layer->affected_bone_root kemiğinin çocuğu olup olmadığını kontrol etmeliyiz.
             // Şimdilik sadece kök kemik ise maske uygular, diğerleri bind pose'dan gelir
@@ -40,12 +40,12 @@ static fe_mat4 get_animated_local_bone_transform_for_layer(
             
             // Eğer kemik adı maskenin kök kemik adı değilse, bu katman bu kemiği etkilemez.
             bool is_affected_bone = false;
-            if (!fe_string_is_empty(&layer->affected_bone_root)) {
+            if (layer->affected_bone_root_id != FE_STRING_ID_INVALID) {
                 // Kemiğin hiyerarşisinde affected_bone_root olup olmadığını kontrol et.
                 int current_bone_idx = bone_index;
                 while (current_bone_idx != -1) {
                     fe_skeleton_bone_t* current_bone = (fe_skeleton_bone_t*)fe_array_get_at(&skeleton->bones, current_bone_idx);
-                    if (fe_string_equal(&layer->affected_bone_root, current_bone->name.data)) {
+                    if (current_bone->name_id == layer->affected_bone_root_id) {
                         is_affected_bone = true;
                         break;
                     }
@@ -66,10 +66,9 @@ static fe_mat4 get_animated_local_bone_transform_for_layer(
     // Animasyon durumundan yerel dönüşümü al
     if (layer->anim_state && layer->anim_state->current_clip && layer->anim_state->is_playing) {
         fe_animation_clip_t* clip = layer->anim_state->current_clip;
-        int* channel_index_ptr = (int*)fe_hash_map_get(&clip->bone_channel_map, bone->name.data);
+        fe_animation_bone_channel_t* channel = fe_animation_clip_find_bone_channel(clip, bone->name_id);
 
-        if (channel_index_ptr) {
-            fe_animation_bone_channel_t* channel = (fe_animation_bone_channel_t*)fe_array_get_at(&clip->bone_channels, *channel_index_ptr);
+        if (channel) {
 
             fe_vec3 animated_pos;
             fe_quat animated_rot;
@@ -114,7 +113,7 @@ fe_anim_controller_t* fe_anim_controller_create(fe_skeleton_t* skeleton) {
     controller->current_transition = NULL;
     controller->transition_from_clip = NULL;
 
-    fe_hash_map_init(&controller->registered_clips, sizeof(fe_animation_clip_t*), 8, FE_HASH_MAP_STRING_KEY, FE_MEM_TYPE_ANIMATION_CONTROLLER, __FILE__, __LINE__);
+    fe_anim_clip_map_init(&controller->registered_clips, 8);
 
     // Animasyon katmanlarını başlat
     for (int i = 0; i < FE_ANIM_LAYER_COUNT; ++i) {
@@ -128,6 +127,7 @@ fe_anim_controller_t* fe_anim_controller_create(fe_skeleton_t* skeleton) {
         controller->layers[i].weight = (i == FE_ANIM_LAYER_BASE) ? 1.0f : 0.0f; // Varsayılan olarak sadece Base katmanı aktif
         controller->layers[i].blend_mode = FE_ANIM_BLEND_OVERRIDE; // Şu an sadece override destekleniyor
         fe_string_init(&controller->layers[i].affected_bone_root, "");
+        controller->layers[i].affected_bone_root_id = FE_STRING_ID_INVALID;
         controller->layers[i].use_partial_mask = false;
     }
 
@@ -152,7 +152,7 @@ void fe_anim_controller_destroy(fe_anim_controller_t* controller) {
         fe_string_destroy(&controller->layers[i].affected_bone_root);
     }
     
-    fe_hash_map_destroy(&controller->registered_clips);
+    fe_anim_clip_map_shutdown(&controller->registered_clips);
     FE_FREE(controller, FE_MEM_TYPE_ANIMATION_CONTROLLER);
     FE_LOG_DEBUG("Animation controller destroyed.");
 }
@@ -164,7 +164,7 @@ fe_anim_controller_error_t fe_anim_controller_register_clip(fe_anim_controller_t
     }
     if (!controller->is_initialized) return FE_ANIM_CONTROLLER_NOT_INITIALIZED;
 
-    if (fe_hash_map_insert(&controller->registered_clips, clip->name.data, &clip)) {
+    if (fe_anim_clip_map_insert(&controller->registered_clips, clip->name_id, clip)) {
         FE_LOG_DEBUG("Registered animation clip '%s'.", clip->name.data);
         return FE_ANIM_CONTROLLER_SUCCESS;
     }
@@ -179,7 +179,7 @@ fe_anim_controller_error_t fe_anim_controller_unregister_clip(fe_anim_controller
     }
     if (!controller->is_initialized) return FE_ANIM_CONTROLLER_NOT_INITIALIZED;
 
-    if (fe_hash_map_remove(&controller->registered_clips, clip_name)) {
+    if (fe_anim_clip_map_remove(&controller->registered_clips, fe_string_intern_find(clip_name))) {
         FE_LOG_DEBUG("Unregistered animation clip '%s'.", clip_name);
         return FE_ANIM_CONTROLLER_SUCCESS;
     }
@@ -188,13 +188,28 @@ fe_anim_controller_error_t fe_anim_controller_unregister_clip(fe_anim_controller
 }
 
 fe_anim_controller_error_t fe_anim_controller_play(fe_anim_controller_t* controller, const char* clip_name, fe_anim_layer_priority_t layer, fe_animation_loop_mode_t loop_mode, float playback_speed) {
-    if (!controller || !clip_name || layer >= FE_ANIM_LAYER_COUNT || playback_speed <= 0.0f) {
+    if (!clip_name) {
+        FE_LOG_ERROR("Invalid arguments for fe_anim_controller_play.");
+        return FE_ANIM_CONTROLLER_INVALID_ARGUMENT;
+    }
+    // Havuzda olmayan bir ad kayıtlı bir klibe ait olamaz; havuzu büyütmemek için ekleme yapmadan ara.
+    fe_string_id_t clip_id = fe_string_intern_find(clip_name);
+    if (clip_id == FE_STRING_ID_INVALID) {
+        FE_LOG_ERROR("Animation clip '%s' not found.", clip_name);
+        return FE_ANIM_CONTROLLER_ANIM_NOT_FOUND;
+    }
+    return fe_anim_controller_play_by_id(controller, clip_id, layer, loop_mode, playback_speed);
+}
+
+fe_anim_controller_error_t fe_anim_controller_play_by_id(fe_anim_controller_t* controller, fe_string_id_t clip_id, fe_anim_layer_priority_t layer, fe_animation_loop_mode_t loop_mode, float playback_speed) {
+    if (!controller || clip_id == FE_STRING_ID_INVALID || layer >= FE_ANIM_LAYER_COUNT || playback_speed <= 0.0f) {
         FE_LOG_ERROR("Invalid arguments for fe_anim_controller_play.");
         return FE_ANIM_CONTROLLER_INVALID_ARGUMENT;
     }
     if (!controller->is_initialized) return FE_ANIM_CONTROLLER_NOT_INITIALIZED;
 
-    fe_animation_clip_t** clip_ptr = (fe_animation_clip_t**)fe_hash_map_get(&controller->registered_clips, clip_name);
+    const char* clip_name = fe_string_intern_c_str(clip_id); // Yalnızca loglama için
+    fe_animation_clip_t** clip_ptr = fe_anim_clip_map_get(&controller->registered_clips, clip_id);
     if (!clip_ptr || !*clip_ptr) {
         FE_LOG_ERROR("Animation clip '%s' not found.", clip_name);
         return FE_ANIM_CONTROLLER_ANIM_NOT_FOUND;
@@ -220,13 +235,27 @@ fe_anim_controller_error_t fe_anim_controller_play(fe_anim_controller_t* control
 }
 
 fe_anim_controller_error_t fe_anim_controller_crossfade(fe_anim_controller_t* controller, const char* target_clip_name, float transition_duration, fe_anim_layer_priority_t layer, fe_animation_loop_mode_t loop_mode, float playback_speed) {
-    if (!controller || !target_clip_name || transition_duration < 0.0f || layer >= FE_ANIM_LAYER_COUNT || playback_speed <= 0.0f) {
+    if (!target_clip_name) {
+        FE_LOG_ERROR("Invalid arguments for fe_anim_controller_crossfade.");
+        return FE_ANIM_CONTROLLER_INVALID_ARGUMENT;
+    }
+    fe_string_id_t target_clip_id = fe_string_intern_find(target_clip_name);
+    if (target_clip_id == FE_STRING_ID_INVALID) {
+        FE_LOG_ERROR("Target animation clip '%s' not found for crossfade.", target_clip_name);
+        return FE_ANIM_CONTROLLER_ANIM_NOT_FOUND;
+    }
+    return fe_anim_controller_crossfade_by_id(controller, target_clip_id, transition_duration, layer, loop_mode, playback_speed);
+}
+
+fe_anim_controller_error_t fe_anim_controller_crossfade_by_id(fe_anim_controller_t* controller, fe_string_id_t target_clip_id, float transition_duration, fe_anim_layer_priority_t layer, fe_animation_loop_mode_t loop_mode, float playback_speed) {
+    if (!controller || target_clip_id == FE_STRING_ID_INVALID || transition_duration < 0.0f || layer >= FE_ANIM_LAYER_COUNT || playback_speed <= 0.0f) {
         FE_LOG_ERROR("Invalid arguments for fe_anim_controller_crossfade.");
         return FE_ANIM_CONTROLLER_INVALID_ARGUMENT;
     }
     if (!controller->is_initialized) return FE_ANIM_CONTROLLER_NOT_INITIALIZED;
 
-    fe_animation_clip_t** target_clip_ptr = (fe_animation_clip_t**)fe_hash_map_get(&controller->registered_clips, target_clip_name);
+    const char* target_clip_name = fe_string_intern_c_str(target_clip_id); // Yalnızca loglama için
+    fe_animation_clip_t** target_clip_ptr = fe_anim_clip_map_get(&controller->registered_clips, target_clip_id);
     if (!target_clip_ptr || !*target_clip_ptr) {
         FE_LOG_ERROR("Target animation clip '%s' not found for crossfade.", target_clip_name);
         return FE_ANIM_CONTROLLER_ANIM_NOT_FOUND;
@@ -336,9 +365,11 @@ fe_anim_controller_error_t fe_anim_controller_set_layer_partial_mask(fe_anim_con
     controller->layers[layer].use_partial_mask = use_mask;
     if (use_mask && bone_root) {
         fe_string_set(&controller->layers[layer].affected_bone_root, bone_root);
+        controller->layers[layer].affected_bone_root_id = fe_string_intern(bone_root);
         FE_LOG_DEBUG("Layer %d partial mask enabled with root bone '%s'.", layer, bone_root);
     } else {
         fe_string_set(&controller->layers[layer].affected_bone_root, ""); // Kök kemik yok
+        controller->layers[layer].affected_bone_root_id = FE_STRING_ID_INVALID;
         FE_LOG_DEBUG("Layer %d partial mask %s.", layer, use_mask ? "enabled (no specific root)" : "disabled");
     }
     return FE_ANIM_CONTROLLER_SUCCESS;
@@ -411,11 +442,9 @@ fe_anim_controller_error_t fe_anim_controller_update(fe_anim_controller_t* contr
                         // Geçişin "başlangıç" klibinden gelen transformu al
                         fe_mat4 from_clip_transform = FE_MAT4_IDENTITY;
                         if (controller->transition_from_clip) {
-                            int* channel_index_ptr = (int*)fe_hash_map_get(&controller->transition_from_clip->bone_channel_map, 
-                                ((fe_skeleton_bone_t*)fe_array_get_at(&controller->skeleton->bones, bone_idx))->name.data);
-                            if (channel_index_ptr) {
-                                fe_animation_bone_channel_t* channel = (fe_animation_bone_channel_t*)fe_array_get_at(
-                                    &controller->transition_from_clip->bone_channels, *channel_index_ptr);
+                            fe_animation_bone_channel_t* channel = fe_animation_clip_find_bone_channel(controller->transition_from_clip,
+                                ((fe_skeleton_bone_t*)fe_array_get_at(&controller->skeleton->bones, bone_idx))->name_id);
+                            if (channel) {
                                 fe_vec3 pos, scale; fe_quat rot;
                                 get_interpolated_bone_transform(channel, controller->layers[i].anim_state->current_time, &pos, &rot, &scale);
                                 fe_mat4 mat_pos = fe_mat4_translate(FE_MAT4_IDENTITY, pos);
@@ -141,10 +141,11 @@ fe_animation_clip_t* fe_animation_clip_create(const char* name, float duration,
     }
 
     fe_string_init(&clip->name, name);
+    clip->name_id = fe_string_intern(name);
     clip->duration = duration;
     clip->ticks_per_second = ticks_per_second;
     fe_array_init(&clip->bone_channels, sizeof(fe_animation_bone_channel_t), 4, FE_MEM_TYPE_ANIMATION, __FILE__, __LINE__);
-    fe_hash_map_init(&clip->bone_channel_map, sizeof(int), 4, FE_HASH_MAP_STRING_KEY, FE_MEM_TYPE_ANIMATION, __FILE__, __LINE__);
+    fe_anim_name_index_map_init(&clip->bone_channel_map, 4);
 
     FE_LOG_DEBUG("Animation clip '%s' created (Duration: %.2f, Ticks/Sec: %.2f).", name, duration, ticks_per_second);
     return clip;
@@ -156,7 +157,13 @@ fe_animation_bone_channel_t* fe_animation_clip_add_bone_channel(fe_animation_cli
         return NULL;
     }
 
-    int* existing_index = (int*)fe_hash_map_get(&clip->bone_channel_map, bone_name);
+    fe_string_id_t bone_name_id = fe_string_intern(bone_name);
+    if (bone_name_id == FE_STRING_ID_INVALID) {
+        FE_LOG_CRITICAL("Failed to intern bone channel name '%s'.", bone_name);
+        return NULL;
+    }
+
+    int* existing_index = fe_anim_name_index_map_get(&clip->bone_channel_map, bone_name_id);
     if (existing_index) {
         FE_LOG_WARN("Bone channel '%s' already exists in animation clip '%s'. Returning existing.", bone_name, clip->name.data);
         return (fe_animation_bone_channel_t*)fe_array_get_at(&clip->bone_channels, *existing_index);
@@ -164,6 +171,7 @@ fe_animation_bone_channel_t* fe_animation_clip_add_bone_channel(fe_animation_cli
 
     fe_animation_bone_channel_t new_channel;
     fe_string_init(&new_channel.bone_name, bone_name);
+    new_channel.bone_name_id = bone_name_id;
     fe_array_init(&new_channel.position_keyframes, sizeof(fe_animation_keyframe_t), 8, FE_MEM_TYPE_ANIMATION, __FILE__, __LINE__);
     fe_array_init(&new_channel.rotation_keyframes, sizeof(fe_animation_keyframe_t), 8, FE_MEM_TYPE_ANIMATION, __FILE__, __LINE__);
     fe_array_init(&new_channel.scale_keyframes, sizeof(fe_animation_keyframe_t), 8, FE_MEM_TYPE_ANIMATION, __FILE__, __LINE__);
@@ -178,7 +186,7 @@ fe_animation_bone_channel_t* fe_animation_clip_add_bone_channel(fe_animation_cli
         return NULL;
     }
 
-    if (!fe_hash_map_insert(&clip->bone_channel_map, bone_name, &index)) {
+    if (!fe_anim_name_index_map_insert(&clip->bone_channel_map, bone_name_id, index)) {
         FE_LOG_CRITICAL("Failed to insert bone channel index into hash map for clip '%s'.", clip->name.data);
         // Array'dan geri alma veya hata yönetimi burada daha karmaşık olabilir
         // Basitçe burada bırakıyoruz ve bellek kaçağını kabul ediyoruz, veya array'den elementi kaldırmayı deneyebiliriz.
@@ -190,6 +198,14 @@ fe_animation_bone_channel_t* fe_animation_clip_add_bone_channel(fe_animation_cli
     return added_channel;
 }
 
+fe_animation_bone_channel_t* fe_animation_clip_find_bone_channel(const fe_animation_clip_t* clip, fe_string_id_t bone_name_id) {
+    if (!clip || bone_name_id == FE_STRING_ID_INVALID) return NULL;
+
+    int* channel_index = fe_anim_name_index_map_get(&clip->bone_channel_map, bone_name_id);
+    if (!channel_index) return NULL;
+    return (fe_animation_bone_channel_t*)fe_array_get_at(&clip->bone_channels, *channel_index);
+}
+
 fe_animation_error_t fe_animation_bone_channel_add_keyframe(fe_array_t* keyframes, float time, fe_vec3 pos, fe_quat rot, fe_vec3 scale) {
     if (!keyframes || time < 0.0f) {
         return FE_ANIMATION_INVALID_ARGUMENT;
@@ -227,7 +243,7 @@ void fe_animation_clip_destroy(fe_animation_clip_t* clip) {
         fe_array_destroy(&channel->scale_keyframes);
     }
     fe_array_destroy(&clip->bone_channels);
-    fe_hash_map_destroy(&clip->bone_channel_map);
+    fe_anim_name_index_map_shutdown(&clip->bone_channel_map);
     fe_string_destroy(&clip->name);
     FE_FREE(clip, FE_MEM_TYPE_ANIMATION);
     FE_LOG_DEBUG("Animation clip destroyed.");
@@ -248,7 +264,7 @@ fe_skeleton_t* fe_skeleton_create(const char* name) {
 
     fe_string_init(&skeleton->name, name);
     fe_array_init(&skeleton->bones, sizeof(fe_skeleton_bone_t), 16, FE_MEM_TYPE_ANIMATION, __FILE__, __LINE__);
-    fe_hash_map_init(&skeleton->bone_map, sizeof(int), 16, FE_HASH_MAP_STRING_KEY, FE_MEM_TYPE_ANIMATION, __FILE__, __LINE__);
+    fe_anim_name_index_map_init(&skeleton->bone_map, 16);
 
     FE_LOG_DEBUG("Skeleton '%s' created.", name);
     return skeleton;
@@ -260,7 +276,13 @@ fe_skeleton_bone_t* fe_skeleton_add_bone(fe_skeleton_t* skeleton, const char* na
         return NULL;
     }
 
-    int* existing_index = (int*)fe_hash_map_get(&skeleton->bone_map, name);
+    fe_string_id_t name_id = fe_string_intern(name);
+    if (name_id == FE_STRING_ID_INVALID) {
+        FE_LOG_CRITICAL("Failed to intern bone name '%s'.", name);
+        return NULL;
+    }
+
+    int* existing_index = fe_anim_name_index_map_get(&skeleton->bone_map, name_id);
     if (existing_index) {
         FE_LOG_WARN("Bone '%s' already exists in skeleton '%s'. Returning existing.", name, skeleton->name.data);
         return (fe_skeleton_bone_t*)fe_array_get_at(&skeleton->bones, *existing_index);
@@ -268,6 +290,7 @@ fe_skeleton_bone_t* fe_skeleton_add_bone(fe_skeleton_t* skeleton, const char* na
 
     fe_skeleton_bone_t new_bone;
     fe_string_init(&new_bone.name, name);
+    new_bone.name_id = name_id;
     new_bone.parent_index = parent_index;
     new_bone.local_transform = local_transform;
     new_bone.inverse_bind_transform = inverse_bind_transform;
@@ -280,7 +303,7 @@ fe_skeleton_bone_t* fe_skeleton_add_bone(fe_skeleton_t* skeleton, const char* na
         return NULL;
     }
 
-    if (!fe_hash_map_insert(&skeleton->bone_map, name, &index)) {
+    if (!fe_anim_name_index_map_insert(&skeleton->bone_map, name_id, index)) {
         FE_LOG_CRITICAL("Failed to insert bone '%s' index into hash map for skeleton '%s'.", name, skeleton->name.data);
         // Hata yönetimi
         return NULL;
@@ -299,12 +322,19 @@ void fe_skeleton_destroy(fe_skeleton_t* skeleton) {
         fe_string_destroy(&bone->name);
     }
     fe_array_destroy(&skeleton->bones);
-    fe_hash_map_destroy(&skeleton->bone_map);
+    fe_anim_name_index_map_shutdown(&skeleton->bone_map);
     fe_string_destroy(&skeleton->name);
     FE_FREE(skeleton, FE_MEM_TYPE_ANIMATION);
     FE_LOG_DEBUG("Skeleton destroyed.");
 }
 
+int fe_skeleton_find_bone_index(const fe_skeleton_t* skeleton, fe_string_id_t bone_name_id) {
+    if (!skeleton || bone_name_id == FE_STRING_ID_INVALID) return -1;
+
+    int* bone_index = fe_anim_name_index_map_get(&skeleton->bone_map, bone_name_id);
+    return bone_index ? *bone_index : -1;
+}
+
 const fe_mat4* fe_skeleton_get_final_bone_transform(const fe_skeleton_t* skeleton, int bone_index) {
     if (!skeleton || bone_index < 0 || bone_index >= (int)fe_array_get_size(&skeleton->bones)) {
         FE_LOG_ERROR("Invalid skeleton or bone index %d.", bone_index);
@@ -434,10 +464,9 @@ fe_animation_error_t fe_animation_state_update(fe_animation_state_t* state, fe_s
 
         fe_mat4 bone_local_anim_transform = FE_MAT4_IDENTITY;
 
-        // Kemiğin animasyon kanalını bul
-        int* channel_index_ptr = (int*)fe_hash_map_get(&state->current_clip->bone_channel_map, bone->name.data);
-        if (channel_index_ptr) {
-            fe_animation_bone_channel_t* channel = (fe_animation_bone_channel_t*)fe_array_get_at(&state->current_clip->bone_channels, *channel_index_ptr);
+        // Kemiğin animasyon kanalını bul (ad tanıtıcısıyla; string hashlenmez)
+        fe_animation_bone_channel_t* channel = fe_animation_clip_find_bone_channel(state->current_clip, bone->name_id);
+        if (channel) {
 
             fe_vec3 animated_pos;
             fe_quat animated_rot;
@@ -1,7 +1,17 @@
 #include "core/fe_application.h"
 #include "core/utils/fe_logger.h"      // Loglama için
-#include "core/time/fe_time.h"          // Zaman fonksiyonları için (fe_get_time, fe_sleep)
+#include "core/time/fe_time.h"          // Zaman fonksiyonları için (fe_get_time)
 #include "platform/fe_platform.h"       // Platforma özgü işlemler (pencere oluşturma vb.)
+#include "core/containers/fe_string_intern.h" // Kapanışta string havuzunu serbest bırakmak için
+#include "core/jobs/fe_job_system.h"    // Modül güncellemelerini paralel zamanlamak için
+#include "core/utils/fe_profiler.h"     // Kare ve modül süresi ölçümü için
+#include "platform/fe_file_cache.h"     // Modüllerin paylaştığı eşlenmiş dosya önbelleği için
+#include "platform/fe_async_io.h"       // Varlık okumalarının arka planda yapılması için
+#include "platform/fe_ddc.h"            // Pişmiş varlık ve shader'ların çalıştırmalar arasında saklanması için
+
+#include <string.h> // strcmp, memset için
+#include <stdio.h>  // snprintf için
+#include <math.h>   // sqrt için
 
 // --- Harici Modül Bağımlılıkları (Varsayım) ---
 // Bu modüllerin .h dosyalarını include etmemiz ve fe_application_module_t
@@ -17,6 +27,321 @@
 // Uygulama durumu genellikle tekil (singleton) bir nesne olarak yönetilir.
 static fe_application_state_t g_app_state;
 
+// --- Modül Güncelleme Grafiği ---
+// reads/writes kümeleri, update_after bağımlılıkları ve ana thread modüllerinin kayıt sırası
+// init'te bir DAG'a çevrilir.
+// Her karede bağımlılığı olmayan modüller iş sistemine verilir; biten her modül, tüm
+// bağımlılıkları tamamlanan ardıllarını gönderir. Ana thread bu sırada kare sayacını bekler
+// ve beklerken işlere (ana thread'e özel modüller dahil) yardım eder.
+typedef struct fe_application_module_node {
+    fe_application_module_t* module;
+    uint32_t                 dependency_count; // Bu modülden önce bitmesi gereken modül sayısı
+    uint32_t                 pending;          // Bu karede henüz bitmemiş bağımlılık sayısı (atomik)
+    uint32_t                 dependent_count;  // Bu modülü bekleyen modül sayısı
+    uint8_t                  dependents[FE_MAX_APPLICATION_MODULES]; // Bekleyen modüllerin indeksleri
+    double                   start_time;       // Bu karede update'in başladığı an (saniye)
+    double                   end_time;         // Bu karede update'in bittiği an (saniye)
+} fe_application_module_node_t;
+
+// Kritik yol izlenirken "bağımlılığı yok" (kök modül) değeri.
+#define FE_APPLICATION_MODULE_NONE 0xFF
+
+// Modüllerin reads/writes ile bildirebileceği farklı veri kümesi sayısı üst sınırı.
+#define FE_MAX_APPLICATION_RESOURCES 64
+
+/**
+ * @brief Grafik kurulurken bir veri kümesine en son kimin eriştiğini izler.
+ */
+typedef struct fe_application_resource_state {
+    const char* name;
+    size_t      last_writer;  // Kümeyi en son yazan modül ((size_t)-1 ise yok)
+    uint32_t    reader_mask;  // last_writer'dan sonra kümeyi okuyan modüller (modül indeksi bitleri)
+} fe_application_resource_state_t;
+
+static fe_application_module_node_t       g_module_nodes[FE_MAX_APPLICATION_MODULES];
+static fe_job_counter_t                   g_module_frame_counter = FE_JOB_COUNTER_INIT;
+static fe_application_frame_graph_stats_t g_frame_graph_stats;
+
+/**
+ * @brief from modülü bitmeden to modülünün başlamamasını sağlayan kenarı ekler (tekrarları yok sayar).
+ */
+static void fe_application_add_module_edge(size_t from, size_t to) {
+    fe_application_module_node_t* node = &g_module_nodes[from];
+    for (uint32_t i = 0; i < node->dependent_count; ++i) {
+        if (node->dependents[i] == to) return;
+    }
+    node->dependents[node->dependent_count++] = (uint8_t)to;
+    g_module_nodes[to].dependency_count++;
+}
+
+/**
+ * @brief Adı verilen veri kümesinin izleme kaydını bulur, yoksa ekler. Tablo doluysa NULL döner.
+ */
+static fe_application_resource_state_t* fe_application_find_resource(fe_application_resource_state_t* resources,
+                                                                     size_t* resource_count, const char* name) {
+    for (size_t r = 0; r < *resource_count; ++r) {
+        if (strcmp(resources[r].name, name) == 0) return &resources[r];
+    }
+    if (*resource_count >= FE_MAX_APPLICATION_RESOURCES) return NULL;
+    fe_application_resource_state_t* resource = &resources[(*resource_count)++];
+    resource->name = name;
+    resource->last_writer = (size_t)-1;
+    resource->reader_mask = 0;
+    return resource;
+}
+
+/**
+ * @brief i. modülün reads/writes kümelerinden, kendisinden önce kaydedilmiş modüllere kenar ekler.
+ * Okuma: son yazıcıyı bekler (RAW). Yazma: son yazıcıyı (WAW) ve ondan sonraki okuyucuları (WAR) bekler.
+ */
+static void fe_application_add_resource_edges(size_t i, fe_application_resource_state_t* resources,
+                                              size_t* resource_count) {
+    fe_application_module_t* module = g_app_state.modules[i];
+
+    for (const char* const* name = module->reads; name && *name; ++name) {
+        fe_application_resource_state_t* resource = fe_application_find_resource(resources, resource_count, *name);
+        if (!resource) {
+            FE_LOG_WARN("Resource limit reached (%d); read of '%s' by module '%s' ignored.",
+                        FE_MAX_APPLICATION_RESOURCES, *name, module->name);
+            continue;
+        }
+        if (resource->last_writer != (size_t)-1 && resource->last_writer != i) {
+            fe_application_add_module_edge(resource->last_writer, i);
+        }
+        resource->reader_mask |= 1u << i;
+    }
+
+    for (const char* const* name = module->writes; name && *name; ++name) {
+        fe_application_resource_state_t* resource = fe_application_find_resource(resources, resource_count, *name);
+        if (!resource) {
+            FE_LOG_WARN("Resource limit reached (%d); write of '%s' by module '%s' ignored.",
+                        FE_MAX_APPLICATION_RESOURCES, *name, module->name);
+            continue;
+        }
+        if (resource->last_writer != (size_t)-1 && resource->last_writer != i) {
+            fe_application_add_module_edge(resource->last_writer, i);
+        }
+        for (size_t j = 0; j < i; ++j) {
+            if (resource->reader_mask & (1u << j)) fe_application_add_module_edge(j, i);
+        }
+        resource->last_writer = i;
+        resource->reader_mask = 0;
+    }
+}
+
+/**
+ * @brief Modüllerin güncelleme grafiğini kurar ve paralel güncellemenin kullanılıp kullanılamayacağını döndürür.
+ * Bağımlılık döngüsü varsa hata loglanır ve sıralı güncellemeye dönülür.
+ */
+static bool fe_application_build_module_graph(void) {
+    memset(g_module_nodes, 0, sizeof(g_module_nodes));
+    bool any_parallel = false;
+    size_t previous_main_thread = (size_t)-1;
+    fe_application_resource_state_t resources[FE_MAX_APPLICATION_RESOURCES];
+    size_t resource_count = 0;
+
+    for (size_t i = 0; i < g_app_state.module_count; ++i) {
+        g_module_nodes[i].module = g_app_state.modules[i];
+    }
+
+    for (size_t i = 0; i < g_app_state.module_count; ++i) {
+        fe_application_module_t* module = g_app_state.modules[i];
+        any_parallel |= module->update_in_parallel;
+
+        // Ana thread modülleri, eski davranışla uyumlu olarak kayıt sırasıyla zincirlenir.
+        if (!module->update_in_parallel) {
+            if (previous_main_thread != (size_t)-1) {
+                fe_application_add_module_edge(previous_main_thread, i);
+            }
+            previous_main_thread = i;
+        }
+
+        fe_application_add_resource_edges(i, resources, &resource_count);
+
+        for (const char* const* name = module->update_after; name && *name; ++name) {
+            size_t found = (size_t)-1;
+            for (size_t j = 0; j < g_app_state.module_count; ++j) {
+                if (strcmp(g_app_state.modules[j]->name, *name) == 0) {
+                    found = j;
+                    break;
+                }
+            }
+            if (found == (size_t)-1) {
+                FE_LOG_WARN("Module '%s' depends on unknown module '%s'; dependency ignored.", module->name, *name);
+            } else if (found != i) {
+                fe_application_add_module_edge(found, i);
+            }
+        }
+    }
+
+    if (!any_parallel) {
+        return false; // Tüm modüller ana thread'de: grafiğe gerek yok
+    }
+
+    // Kahn algoritmasıyla döngü kontrolü
+    uint32_t remaining[FE_MAX_APPLICATION_MODULES];
+    size_t stack[FE_MAX_APPLICATION_MODULES];
+    size_t stack_size = 0, visited = 0;
+    for (size_t i = 0; i < g_app_state.module_count; ++i) {
+        remaining[i] = g_module_nodes[i].dependency_count;
+        if (remaining[i] == 0) stack[stack_size++] = i;
+    }
+    while (stack_size > 0) {
+        fe_application_module_node_t* node = &g_module_nodes[stack[--stack_size]];
+        visited++;
+        for (uint32_t k = 0; k < node->dependent_count; ++k) {
+            if (--remaining[node->dependents[k]] == 0) stack[stack_size++] = node->dependents[k];
+        }
+    }
+    if (visited != g_app_state.module_count) {
+        FE_LOG_ERROR("Module update dependencies contain a cycle; falling back to sequential updates.");
+        return false;
+    }
+
+    for (size_t i = 0; i < g_app_state.module_count; ++i) {
+        for (uint32_t k = 0; k < g_module_nodes[i].dependent_count; ++k) {
+            FE_LOG_DEBUG("Module graph: '%s' -> '%s'", g_module_nodes[i].module->name,
+                         g_module_nodes[g_module_nodes[i].dependents[k]].module->name);
+        }
+    }
+    return true;
+}
+
+static void fe_application_module_update_job(void* user_data);
+
+static void fe_application_submit_module(fe_application_module_node_t* node) {
+    fe_job_decl_t decl;
+    decl.func = fe_application_module_update_job;
+    decl.user_data = node;
+    decl.main_thread_only = !node->module->update_in_parallel;
+    fe_job_system_run(&decl, 1, &g_module_frame_counter);
+}
+
+static void fe_application_module_update_job(void* user_data) {
+    fe_application_module_node_t* node = (fe_application_module_node_t*)user_data;
+    fe_application_module_t* module = node->module;
+    node->start_time = fe_get_time();
+    FE_PROFILE_BEGIN(module->name);
+    if (module->is_active() && module->update) {
+        module->update(g_app_state.delta_time);
+    }
+    FE_PROFILE_END();
+    node->end_time = fe_get_time();
+
+    // Ardıllar, bu işin sayacı azalmadan önce gönderilir; kare sayacı erken sıfırlanmaz.
+    for (uint32_t k = 0; k < node->dependent_count; ++k) {
+        fe_application_module_node_t* dependent = &g_module_nodes[node->dependents[k]];
+        if (fe_atomic_fetch_add_u32(&dependent->pending, (uint32_t)-1, FE_ATOMIC_ACQ_REL) == 1) {
+            fe_application_submit_module(dependent);
+        }
+    }
+}
+
+/**
+ * @brief Bu karenin modül sürelerini ve kritik yolunu g_frame_graph_stats'a yazar,
+ * istenirse loglar. Tüm modül işleri bittikten sonra ana thread'de çağrılır.
+ *
+ * @param frame_start Modül güncellemelerinin başladığı an (saniye).
+ * @param sequential true ise modüller kayıt sırasıyla çalışmıştır; her modülün tek öncülü bir öncekidir.
+ */
+static void fe_application_record_frame_graph(double frame_start, bool sequential) {
+    fe_application_frame_graph_stats_t* stats = &g_frame_graph_stats;
+    size_t module_count = g_app_state.module_count;
+    if (module_count == 0) return;
+
+    // Her modülün kritik öncülü, bağımlılıklarından en son biteni (onu başlatmayı geciktiren) olur.
+    uint8_t critical_dependency[FE_MAX_APPLICATION_MODULES];
+    for (size_t i = 0; i < module_count; ++i) {
+        critical_dependency[i] = (sequential && i > 0) ? (uint8_t)(i - 1) : FE_APPLICATION_MODULE_NONE;
+    }
+    if (!sequential) {
+        for (size_t i = 0; i < module_count; ++i) {
+            const fe_application_module_node_t* node = &g_module_nodes[i];
+            for (uint32_t k = 0; k < node->dependent_count; ++k) {
+                uint8_t dependent = node->dependents[k];
+                uint8_t current = critical_dependency[dependent];
+                if (current == FE_APPLICATION_MODULE_NONE || node->end_time > g_module_nodes[current].end_time) {
+                    critical_dependency[dependent] = (uint8_t)i;
+                }
+            }
+        }
+    }
+
+    // Kritik yol en son biten modülde biter
+    size_t last = 0;
+    for (size_t i = 0; i < module_count; ++i) {
+        stats->module_ms[i] = (g_module_nodes[i].end_time - g_module_nodes[i].start_time) * 1000.0;
+        if (g_module_nodes[i].end_time > g_module_nodes[last].end_time) last = i;
+    }
+    stats->frame = g_app_state.frame_count;
+    stats->total_ms = (g_module_nodes[last].end_time - frame_start) * 1000.0;
+
+    uint8_t reversed[FE_MAX_APPLICATION_MODULES];
+    uint32_t length = 0;
+    for (size_t i = last; i != FE_APPLICATION_MODULE_NONE && length < module_count;
+         i = critical_dependency[i]) {
+        reversed[length++] = (uint8_t)i;
+    }
+    stats->critical_path_length = length;
+    stats->critical_path_ms = 0.0;
+    for (uint32_t k = 0; k < length; ++k) {
+        stats->critical_path[k] = reversed[length - 1 - k];
+        stats->critical_path_ms += stats->module_ms[stats->critical_path[k]];
+    }
+
+    uint32_t interval = g_app_state.config.critical_path_log_interval;
+    if (interval > 0 && g_app_state.frame_count % interval == 0) {
+        char path[512];
+        size_t offset = 0;
+        path[0] = '\0';
+        for (uint32_t k = 0; k < length && offset < sizeof(path); ++k) {
+            uint8_t index = stats->critical_path[k];
+            int written = snprintf(path + offset, sizeof(path) - offset, "%s%s (%.2f ms)",
+                                   k > 0 ? " -> " : "", g_module_nodes[index].module->name, stats->module_ms[index]);
+            if (written < 0) break;
+            offset += (size_t)written;
+        }
+        FE_LOG_INFO("Frame %llu critical path: %s [%.2f ms of %.2f ms]", (unsigned long long)stats->frame,
+                    path, stats->critical_path_ms, stats->total_ms);
+    }
+}
+
+/**
+ * @brief Tüm modülleri bu kare için günceller.
+ */
+static void fe_application_update_modules(void) {
+    double frame_start = fe_get_time();
+
+    if (!g_app_state.parallel_updates) {
+        // Sıralı güncellemede her modül bir öncekini bekler; kritik yol tüm zincirdir.
+        for (size_t i = 0; i < g_app_state.module_count; ++i) {
+            fe_application_module_t* module = g_app_state.modules[i];
+            fe_application_module_node_t* node = &g_module_nodes[i];
+            node->module = module;
+            node->start_time = fe_get_time();
+            FE_PROFILE_BEGIN(module->name);
+            if (module && module->is_active() && module->update) {
+                module->update(g_app_state.delta_time);
+            }
+            FE_PROFILE_END();
+            node->end_time = fe_get_time();
+        }
+        fe_application_record_frame_graph(frame_start, true);
+        return;
+    }
+
+    for (size_t i = 0; i < g_app_state.module_count; ++i) {
+        fe_atomic_store_u32(&g_module_nodes[i].pending, g_module_nodes[i].dependency_count, FE_ATOMIC_RELAXED);
+    }
+    for (size_t i = 0; i < g_app_state.module_count; ++i) {
+        if (g_module_nodes[i].dependency_count == 0) {
+            fe_application_submit_module(&g_module_nodes[i]);
+        }
+    }
+    fe_job_system_wait_for_counter(&g_module_frame_counter);
+    fe_application_record_frame_graph(frame_start, false);
+}
+
 // --- Uygulama Olay Dinleyici Implementasyonu ---
 bool fe_application_on_event(fe_event_type type, struct fe_event_context* context) {
     // FE_LOG_DEBUG("Application received event: %d", type); // Debug için çok fazla olabilir
@@ -71,6 +396,7 @@ bool fe_application_init(const fe_application_config_t* config) {
     g_app_state.delta_time = 0.0f;
     g_app_state.frame_count = 0;
     g_app_state.last_frame_time = fe_get_time(); // Zamanlayıcıyı başlat
+    fe_frame_pacer_init(&g_app_state.frame_pacer, g_app_state.config.target_frame_rate);
 
     // Platform sistemini başlat
     if (!fe_platform_init()) {
@@ -94,6 +420,33 @@ bool fe_application_init(const fe_application_config_t* config) {
     // Pencere olayları için ana uygulama olay dinleyicisini kaydet (platforma özgü olabilir)
     // fe_platform_set_event_callback(fe_application_on_event); // Varsayımsal bir platform fonksiyonu
 
+    // Profilleyici iş sisteminden önce başlar; işçi thread'ler açılırken adlarını kaydeder.
+    fe_profiler_init();
+
+    // Modüller shader ve veri dosyalarını initialize sırasında eşlemeye başlayabilir
+    fe_file_cache_init();
+
+    // Arşiv modüllerden önce bağlanır; bulunamazsa dosyalar diskten okunmaya devam eder
+    if (g_app_state.config.pak_path[0] != '\0' && !fe_file_cache_mount_pak(g_app_state.config.pak_path)) {
+        FE_LOG_WARN("Failed to mount pak archive '%s'; files will be read from disk.", g_app_state.config.pak_path);
+    }
+
+    // Önbellek isteğe bağlıdır; yoksa shader'lar ve pişmiş varlıklar her çalıştırmada yeniden üretilir
+    if (g_app_state.config.derived_data_path[0] != '\0' && !fe_ddc_init(g_app_state.config.derived_data_path)) {
+        FE_LOG_WARN("Failed to initialize derived data cache; derived data will be rebuilt.");
+    }
+
+    // Başlatılamazsa asenkron okuma istekleri geçersiz tanıtıcı döndürür; eşzamanlı yollar çalışır
+    if (!fe_async_io_init(NULL)) {
+        FE_LOG_WARN("Failed to initialize async I/O.");
+    }
+
+    // İş sistemini modüllerden önce başlat; modüller initialize sırasında iş gönderebilir.
+    // Başlatılamazsa modüller eskisi gibi ana thread'de sırayla güncellenir.
+    if (!fe_job_system_init(g_app_state.config.worker_thread_count)) {
+        FE_LOG_WARN("Failed to initialize job system; modules will update sequentially.");
+    }
+
     // Kayıtlı modülleri başlat
     for (size_t i = 0; i < g_app_state.module_count; ++i) {
         fe_application_module_t* module = g_app_state.modules[i];
@@ -107,6 +460,11 @@ bool fe_application_init(const fe_application_config_t* config) {
                         g_app_state.modules[j]->shutdown();
                     }
                 }
+                fe_async_io_shutdown();
+                fe_job_system_shutdown();
+                fe_ddc_shutdown();
+                fe_file_cache_shutdown();
+                fe_profiler_shutdown();
                 fe_platform_destroy_window(g_app_state.main_window);
                 fe_platform_shutdown();
                 return false;
@@ -114,6 +472,11 @@ bool fe_application_init(const fe_application_config_t* config) {
         }
     }
 
+    g_app_state.parallel_updates = fe_job_system_is_initialized() && fe_application_build_module_graph();
+    if (g_app_state.parallel_updates) {
+        FE_LOG_INFO("Module updates scheduled on job system (%u worker thread(s)).", fe_job_system_worker_count());
+    }
+
     g_app_state.is_running = true;
     FE_LOG_INFO("Fiction Engine Application initialized successfully.");
     return true;
@@ -123,48 +486,53 @@ void fe_application_run(void) {
     FE_LOG_INFO("Entering application run loop...");
 
     while (g_app_state.is_running) {
+        // Hedef kare hızı varsa karenin son tarihine kadar bekle (uyku + son kısımda spin).
+        // Hedef yoksa beklemez, yalnızca kare süresi istatistiği toplar.
+        fe_frame_pacer_wait(&g_app_state.frame_pacer);
+
+        // Önceki karenin profil bölgelerini topla ve yeni kareyi başlat
+        FE_PROFILE_FRAME_MARK();
+
         // Zamanı güncelle
         double current_time = fe_get_time();
         g_app_state.delta_time = (float)(current_time - g_app_state.last_frame_time);
         g_app_state.last_frame_time = current_time;
 
-        // Hedef kare hızına ulaşmak için bekle (varsa)
-        if (g_app_state.config.target_frame_rate > 0) {
-            float target_frame_duration = 1.0f / g_app_state.config.target_frame_rate;
-            if (g_app_state.delta_time < target_frame_duration) {
-                float sleep_time_sec = target_frame_duration - g_app_state.delta_time;
-                // fe_sleep milisaniye bekler, bu yüzden saniyeyi milisaniyeye çevir
-                fe_sleep((uint32_t)(sleep_time_sec * 1000.0f)); 
-                
-                // Uyuduktan sonra delta_time'ı yeniden hesapla
-                // Bu, gerçek zamanlı simülasyonlar için daha doğru bir yaklaşımdır.
-                current_time = fe_get_time();
-                g_app_state.delta_time = (float)(current_time - g_app_state.last_frame_time);
-                g_app_state.last_frame_time = current_time;
-            }
-        }
-
         // Platform olaylarını işle (örn. pencere olayları, girdi)
         // Bu, fe_application_on_event'i tetikleyecektir.
+        FE_PROFILE_BEGIN("Platform.PumpMessages");
         fe_platform_pump_messages(); 
+        FE_PROFILE_END();
 
-        // Modülleri güncelle
-        for (size_t i = 0; i < g_app_state.module_count; ++i) {
-            fe_application_module_t* module = g_app_state.modules[i];
-            if (module && module->is_active() && module->update) {
-                module->update(g_app_state.delta_time);
-            }
-        }
+        // Tamamlanan dosya okumalarının callback'lerini ana thread'de çalıştır
+        FE_PROFILE_BEGIN("AsyncIO.Dispatch");
+        fe_async_io_dispatch_completions(0);
+        FE_PROFILE_END();
+
+        // Modülleri güncelle (bağımsız modüller iş sistemi üzerinde paralel çalışır)
+        FE_PROFILE_BEGIN("Modules.Update");
+        fe_application_update_modules();
+        FE_PROFILE_END();
 
         // Pencereyi güncelleyin (örn. takas arabellekleri)
         if (g_app_state.main_window) {
+            FE_PROFILE_BEGIN("Platform.SwapBuffers");
             fe_platform_window_swap_buffers(g_app_state.main_window);
+            FE_PROFILE_END();
         }
         
         g_app_state.frame_count++;
         // FE_LOG_DEBUG("Frame: %llu, Delta Time: %.4fms, FPS: %.2f", g_app_state.frame_count, g_app_state.delta_time * 1000.0f, 1.0f / g_app_state.delta_time);
     }
 
+    fe_frame_pacer_stats_t pacing;
+    fe_frame_pacer_get_stats(&g_app_state.frame_pacer, &pacing);
+    FE_LOG_INFO("Frame pacing: %llu frames, mean %.3f ms (target %.3f), stddev %.3f ms, min %.3f / max %.3f ms, "
+                "%llu missed deadline(s), mean wake error %.1f us, spin margin %.1f us",
+                (unsigned long long)pacing.frame_count, pacing.mean_frame_ms, pacing.target_frame_ms,
+                sqrt(pacing.frame_variance_ms2), pacing.min_frame_ms, pacing.max_frame_ms,
+                (unsigned long long)pacing.missed_deadlines, pacing.mean_wake_error_us, pacing.spin_margin_us);
+
     FE_LOG_INFO("Exiting application run loop.");
 }
 
@@ -185,17 +553,36 @@ void fe_application_shutdown(void) {
         }
     }
 
+    // Uçuştaki okumaları bekle; callback'leri artık çalıştırılmaz
+    fe_async_io_shutdown();
+
+    // Modüller kapandı; artık iş gönderecek kimse yok
+    fe_job_system_shutdown();
+
+    // Önbelleğe yazabilecek işler bitti
+    fe_ddc_shutdown();
+
+    // Hiçbir modül artık eşlenmiş dosya görünümü tutmuyor
+    fe_file_cache_shutdown();
+
+    // İşçi thread'ler durdu; profil arabellekleri güvenle serbest bırakılabilir
+    fe_profiler_shutdown();
+
     // Ana pencereyi yok et
     if (g_app_state.main_window) {
         fe_platform_destroy_window(g_app_state.main_window);
         g_app_state.main_window = NULL;
     }
 
+    // Modüllerin tuttuğu tüm tanıtıcılar artık geçersiz; string havuzunu serbest bırak
+    fe_string_intern_shutdown();
+
     // Platform sistemini kapat
     fe_platform_shutdown();
 
     // Uygulama durumunu temizle
     memset(&g_app_state, 0, sizeof(fe_application_state_t));
+    memset(&g_frame_graph_stats, 0, sizeof(g_frame_graph_stats));
 
     FE_LOG_INFO("Fiction Engine Application shut down successfully.");
 
@@ -228,3 +615,7 @@ bool fe_application_register_module(fe_application_module_t* module) {
 const fe_application_state_t* fe_application_get_state(void) {
     return &g_app_state;
 }
+
+const fe_application_frame_graph_stats_t* fe_application_get_frame_graph_stats(void) {
+    return &g_frame_graph_stats;
+}
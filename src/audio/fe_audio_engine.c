@@ -2,6 +2,7 @@
 #include "core/utils/fe_logger.h"
 #include "core/memory/fe_memory_manager.h"
 #include "core/math/fe_math.h" // fe_vec3_normalize, fe_vec3_dist, fe_rad_to_deg için
+#include "core/containers/fe_hash_map.g.h" // Yüklü ses/müzik haritaları için
 
 // SDL_mixer kütüphanesini dahil et
 #include <SDL.h>
@@ -21,11 +22,15 @@ typedef struct fe_loaded_music {
     // Ek metadata eklenebilir
 } fe_loaded_music_t;
 
+// ID tanıtıcısı -> yüklü ses/müzik haritaları. Değerler inline saklanır.
+FE_HASH_MAP_DECLARE(fe_loaded_sound_map, fe_string_id_t, fe_loaded_sound_t, fe_string_id_hash, fe_string_id_eq)
+FE_HASH_MAP_DECLARE(fe_loaded_music_map, fe_string_id_t, fe_loaded_music_t, fe_string_id_hash, fe_string_id_eq)
+
 // --- Ses Motoru Durumu (Singleton) ---
 typedef struct fe_audio_engine_state {
     bool is_initialized;
-    fe_hash_map_t loaded_sounds; // fe_sound_id_t -> fe_loaded_sound_t*
-    fe_hash_map_t loaded_music;  // fe_music_id_t -> fe_loaded_music_t*
+    fe_loaded_sound_map_t loaded_sounds; // fe_sound_id_t tanıtıcısı -> fe_loaded_sound_t
+    fe_loaded_music_map_t loaded_music;  // fe_music_id_t tanıtıcısı -> fe_loaded_music_t
     
     fe_audio_listener_t listener; // Tekil dinleyici
 
@@ -157,8 +162,8 @@ fe_audio_error_t fe_audio_engine_init(int frequency, int channels, int chunk_siz
         g_audio_engine_state.max_channels = 8; // Varsayılan bir değer
     }
 
-    fe_hash_map_init(&g_audio_engine_state.loaded_sounds, sizeof(fe_loaded_sound_t), 16, FE_HASH_MAP_STRING_KEY, FE_MEM_TYPE_AUDIO, __FILE__, __LINE__);
-    fe_hash_map_init(&g_audio_engine_state.loaded_music, sizeof(fe_loaded_music_t), 4, FE_HASH_MAP_STRING_KEY, FE_MEM_TYPE_AUDIO, __FILE__, __LINE__);
+    fe_loaded_sound_map_init(&g_audio_engine_state.loaded_sounds, 16);
+    fe_loaded_music_map_init(&g_audio_engine_state.loaded_music, 4);
     
     // Varsayılan ses seviyelerini ayarla
     fe_audio_engine_set_master_volume(1.0f);
@@ -182,29 +187,22 @@ void fe_audio_engine_shutdown() {
     }
 
     // Yüklü tüm sesleri boşalt
-    // Hash map'i iterasyonla dolaşmak için fe_hash_map_for_each kullanılabilir.
-    fe_hash_map_iterator_t sound_it = fe_hash_map_begin(&g_audio_engine_state.loaded_sounds);
-    while (fe_hash_map_iterator_is_valid(&sound_it)) {
-        fe_loaded_sound_t* sound = (fe_loaded_sound_t*)fe_hash_map_iterator_get_value(&sound_it);
-        if (sound && sound->chunk) {
-            Mix_FreeChunk(sound->chunk);
-            sound->chunk = NULL;
+    FE_HASH_MAP_FOREACH(&g_audio_engine_state.loaded_sounds, fe_string_id_t, sound_key, fe_loaded_sound_t, sound) {
+        (void)sound_key;
+        if (sound.chunk) {
+            Mix_FreeChunk(sound.chunk);
         }
-        fe_hash_map_iterator_next(&sound_it);
     }
-    fe_hash_map_destroy(&g_audio_engine_state.loaded_sounds);
+    fe_loaded_sound_map_shutdown(&g_audio_engine_state.loaded_sounds);
 
     // Yüklü tüm müzikleri boşalt
-    fe_hash_map_iterator_t music_it = fe_hash_map_begin(&g_audio_engine_state.loaded_music);
-    while (fe_hash_map_iterator_is_valid(&music_it)) {
-        fe_loaded_music_t* music = (fe_loaded_music_t*)fe_hash_map_iterator_get_value(&music_it);
-        if (music && music->music) {
-            Mix_FreeMusic(music->music);
-            music->music = NULL;
+    FE_HASH_MAP_FOREACH(&g_audio_engine_state.loaded_music, fe_string_id_t, music_key, fe_loaded_music_t, music) {
+        (void)music_key;
+        if (music.music) {
+            Mix_FreeMusic(music.music);
         }
-        fe_hash_map_iterator_next(&music_it);
     }
-    fe_hash_map_destroy(&g_audio_engine_state.loaded_music);
+    fe_loaded_music_map_shutdown(&g_audio_engine_state.loaded_music);
 
     // SDL_mixer'ı kapat
     Mix_CloseAudio();
@@ -222,7 +220,13 @@ fe_audio_error_t fe_audio_engine_load_sound(fe_sound_id_t sound_id, const fe_str
         return FE_AUDIO_INVALID_ARGUMENT;
     }
 
-    if (fe_hash_map_get(&g_audio_engine_state.loaded_sounds, sound_id.data) != NULL) {
+    fe_string_id_t sound_name_id = fe_string_intern(sound_id.data);
+    if (sound_name_id == FE_STRING_ID_INVALID) {
+        FE_LOG_CRITICAL("Failed to intern sound ID '%s'.", sound_id.data);
+        return FE_AUDIO_OUT_OF_MEMORY;
+    }
+
+    if (fe_loaded_sound_map_contains(&g_audio_engine_state.loaded_sounds, sound_name_id)) {
         FE_LOG_WARN("Sound '%s' already loaded. Skipping.", sound_id.data);
         return FE_AUDIO_SUCCESS; // Zaten yüklüyse başarı dön
     }
@@ -236,7 +240,7 @@ fe_audio_error_t fe_audio_engine_load_sound(fe_sound_id_t sound_id, const fe_str
     fe_loaded_sound_t loaded_sound;
     loaded_sound.chunk = chunk;
 
-    if (!fe_hash_map_insert(&g_audio_engine_state.loaded_sounds, sound_id.data, &loaded_sound)) {
+    if (!fe_loaded_sound_map_insert(&g_audio_engine_state.loaded_sounds, sound_name_id, loaded_sound)) {
         FE_LOG_CRITICAL("Failed to insert loaded sound '%s' into hash map.", sound_id.data);
         Mix_FreeChunk(chunk); // Belleği serbest bırak
         return FE_AUDIO_OUT_OF_MEMORY;
@@ -253,7 +257,8 @@ fe_audio_error_t fe_audio_engine_unload_sound(fe_sound_id_t sound_id) {
         return FE_AUDIO_INVALID_ARGUMENT;
     }
 
-    fe_loaded_sound_t* loaded_sound = (fe_loaded_sound_t*)fe_hash_map_get(&g_audio_engine_state.loaded_sounds, sound_id.data);
+    fe_string_id_t sound_name_id = fe_string_intern_find(sound_id.data);
+    fe_loaded_sound_t* loaded_sound = fe_loaded_sound_map_get(&g_audio_engine_state.loaded_sounds, sound_name_id);
     if (!loaded_sound) {
         FE_LOG_WARN("Sound '%s' not found for unloading.", sound_id.data);
         return FE_AUDIO_SOUND_NOT_FOUND;
@@ -262,7 +267,7 @@ fe_audio_error_t fe_audio_engine_unload_sound(fe_sound_id_t sound_id) {
     Mix_FreeChunk(loaded_sound->chunk);
     loaded_sound->chunk = NULL;
 
-    if (!fe_hash_map_remove(&g_audio_engine_state.loaded_sounds, sound_id.data)) {
+    if (!fe_loaded_sound_map_remove(&g_audio_engine_state.loaded_sounds, sound_name_id)) {
         FE_LOG_ERROR("Failed to remove sound '%s' from hash map.", sound_id.data);
         return FE_AUDIO_UNKNOWN_ERROR; // Veya daha spesifik bir hata
     }
@@ -278,7 +283,13 @@ fe_audio_error_t fe_audio_engine_load_music(fe_music_id_t music_id, const fe_str
         return FE_AUDIO_INVALID_ARGUMENT;
     }
 
-    if (fe_hash_map_get(&g_audio_engine_state.loaded_music, music_id.data) != NULL) {
+    fe_string_id_t music_name_id = fe_string_intern(music_id.data);
+    if (music_name_id == FE_STRING_ID_INVALID) {
+        FE_LOG_CRITICAL("Failed to intern music ID '%s'.", music_id.data);
+        return FE_AUDIO_OUT_OF_MEMORY;
+    }
+
+    if (fe_loaded_music_map_contains(&g_audio_engine_state.loaded_music, music_name_id)) {
         FE_LOG_WARN("Music '%s' already loaded. Skipping.", music_id.data);
         return FE_AUDIO_SUCCESS;
     }
@@ -292,7 +303,7 @@ fe_audio_error_t fe_audio_engine_load_music(fe_music_id_t music_id, const fe_str
     fe_loaded_music_t loaded_music;
     loaded_music.music = music;
 
-    if (!fe_hash_map_insert(&g_audio_engine_state.loaded_music, music_id.data, &loaded_music)) {
+    if (!fe_loaded_music_map_insert(&g_audio_engine_state.loaded_music, music_name_id, loaded_music)) {
         FE_LOG_CRITICAL("Failed to insert loaded music '%s' into hash map.", music_id.data);
         Mix_FreeMusic(music);
         return FE_AUDIO_OUT_OF_MEMORY;
@@ -309,7 +320,8 @@ fe_audio_error_t fe_audio_engine_unload_music(fe_music_id_t music_id) {
         return FE_AUDIO_INVALID_ARGUMENT;
     }
 
-    fe_loaded_music_t* loaded_music = (fe_loaded_music_t*)fe_hash_map_get(&g_audio_engine_state.loaded_music, music_id.data);
+    fe_string_id_t music_name_id = fe_string_intern_find(music_id.data);
+    fe_loaded_music_t* loaded_music = fe_loaded_music_map_get(&g_audio_engine_state.loaded_music, music_name_id);
     if (!loaded_music) {
         FE_LOG_WARN("Music '%s' not found for unloading.", music_id.data);
         return FE_AUDIO_MUSIC_NOT_FOUND;
@@ -318,7 +330,7 @@ fe_audio_error_t fe_audio_engine_unload_music(fe_music_id_t music_id) {
     Mix_FreeMusic(loaded_music->music);
     loaded_music->music = NULL;
 
-    if (!fe_hash_map_remove(&g_audio_engine_state.loaded_music, music_id.data)) {
+    if (!fe_loaded_music_map_remove(&g_audio_engine_state.loaded_music, music_name_id)) {
         FE_LOG_ERROR("Failed to remove music '%s' from hash map.", music_id.data);
         return FE_AUDIO_UNKNOWN_ERROR;
     }
@@ -328,18 +340,27 @@ fe_audio_error_t fe_audio_engine_unload_music(fe_music_id_t music_id) {
 }
 
 int fe_audio_engine_play_sound(fe_sound_id_t sound_id, int loops, int channel_hint, float volume, float pitch) {
-    if (!g_audio_engine_state.is_initialized) {
-        FE_LOG_ERROR("Audio engine not initialized. Cannot play sound.");
-        return -1;
-    }
     if (fe_string_is_empty(&sound_id)) {
         FE_LOG_ERROR("Sound ID is empty for playing sound.");
         return -1;
     }
+    fe_string_id_t sound_name_id = fe_string_intern_find(sound_id.data);
+    if (sound_name_id == FE_STRING_ID_INVALID) {
+        FE_LOG_ERROR("Sound '%s' not loaded or chunk is NULL. Cannot play.", sound_id.data);
+        return -1;
+    }
+    return fe_audio_engine_play_sound_by_id(sound_name_id, loops, channel_hint, volume, pitch);
+}
+
+int fe_audio_engine_play_sound_by_id(fe_string_id_t sound_name_id, int loops, int channel_hint, float volume, float pitch) {
+    if (!g_audio_engine_state.is_initialized) {
+        FE_LOG_ERROR("Audio engine not initialized. Cannot play sound.");
+        return -1;
+    }
 
-    fe_loaded_sound_t* loaded_sound = (fe_loaded_sound_t*)fe_hash_map_get(&g_audio_engine_state.loaded_sounds, sound_id.data);
+    fe_loaded_sound_t* loaded_sound = fe_loaded_sound_map_get(&g_audio_engine_state.loaded_sounds, sound_name_id);
     if (!loaded_sound || !loaded_sound->chunk) {
-        FE_LOG_ERROR("Sound '%s' not loaded or chunk is NULL. Cannot play.", sound_id.data);
+        FE_LOG_ERROR("Sound '%s' not loaded or chunk is NULL. Cannot play.", fe_string_intern_c_str(sound_name_id));
         return -1;
     }
 
@@ -348,7 +369,7 @@ int fe_audio_engine_play_sound(fe_sound_id_t sound_id, int loops, int channel_hi
     // Mix_PlayChannel'a -1 verirsek otomatik kanal seçer
     int channel = Mix_PlayChannel(channel_hint, loaded_sound->chunk, loops);
     if (channel == -1) {
-        FE_LOG_ERROR("Failed to play sound '%s'. SDL_mixer Error: %s", sound_id.data, Mix_GetError());
+        FE_LOG_ERROR("Failed to play sound '%s'. SDL_mixer Error: %s", fe_string_intern_c_str(sound_name_id), Mix_GetError());
         return -1;
     }
 
@@ -358,10 +379,10 @@ int fe_audio_engine_play_sound(fe_sound_id_t sound_id, int loops, int channel_hi
     // Pitch için ya sesi yeniden örneklemek ya da alternatif bir ses kütüphanesi kullanmak gerekir.
     // Burada pitch'i uygulamıyoruz, sadece API'de yer tutuyor.
     if (pitch != 1.0f) {
-        FE_LOG_WARN("SDL_mixer does not directly support pitch adjustment. Pitch for sound '%s' will be ignored.", sound_id.data);
+        FE_LOG_WARN("SDL_mixer does not directly support pitch adjustment. Pitch for sound '%s' will be ignored.", fe_string_intern_c_str(sound_name_id));
     }
 
-    FE_LOG_DEBUG("Played sound '%s' on channel %d.", sound_id.data, channel);
+    FE_LOG_DEBUG("Played sound '%s' on channel %d.", fe_string_intern_c_str(sound_name_id), channel);
     return channel;
 }
 
@@ -384,10 +405,21 @@ fe_audio_error_t fe_audio_engine_play_music(fe_music_id_t music_id, int loops) {
         FE_LOG_ERROR("Music ID is empty for playing music.");
         return FE_AUDIO_INVALID_ARGUMENT;
     }
+    fe_string_id_t music_name_id = fe_string_intern_find(music_id.data);
+    if (music_name_id == FE_STRING_ID_INVALID) {
+        FE_LOG_ERROR("Music '%s' not loaded or chunk is NULL. Cannot play.", music_id.data);
+        return FE_AUDIO_MUSIC_NOT_FOUND;
+    }
+    return fe_audio_engine_play_music_by_id(music_name_id, loops);
+}
 
-    fe_loaded_music_t* loaded_music = (fe_loaded_music_t*)fe_hash_map_get(&g_audio_engine_state.loaded_music, music_id.data);
+fe_audio_error_t fe_audio_engine_play_music_by_id(fe_string_id_t music_name_id, int loops) {
+    if (!g_audio_engine_state.is_initialized) return FE_AUDIO_NOT_INITIALIZED;
+
+    const char* music_name = fe_string_intern_c_str(music_name_id); // Yalnızca loglama için
+    fe_loaded_music_t* loaded_music = fe_loaded_music_map_get(&g_audio_engine_state.loaded_music, music_name_id);
     if (!loaded_music || !loaded_music->music) {
-        FE_LOG_ERROR("Music '%s' not loaded or chunk is NULL. Cannot play.", music_id.data);
+        FE_LOG_ERROR("Music '%s' not loaded or chunk is NULL. Cannot play.", music_name);
         return FE_AUDIO_MUSIC_NOT_FOUND;
     }
 
@@ -402,14 +434,14 @@ fe_audio_error_t fe_audio_engine_play_music(fe_music_id_t music_id, int loops) {
     else if (loops < 0) mix_loops = -1; // Sonsuz döngü
 
     if (Mix_PlayMusic(loaded_music->music, mix_loops) == -1) {
-        FE_LOG_ERROR("Failed to play music '%s'. SDL_mixer Error: %s", music_id.data, Mix_GetError());
+        FE_LOG_ERROR("Failed to play music '%s'. SDL_mixer Error: %s", music_name, Mix_GetError());
         return FE_AUDIO_PLAY_ERROR;
     }
     
     // O anki müzik ses seviyesini ayarla
     Mix_VolumeMusic(fe_audio_mixer_volume_to_sdl(g_audio_engine_state.music_volume * g_audio_engine_state.master_volume));
 
-    FE_LOG_INFO("Played music '%s'. Loops: %d", music_id.data, loops);
+    FE_LOG_INFO("Played music '%s'. Loops: %d", music_name, loops);
     return FE_AUDIO_SUCCESS;
 }
 
@@ -492,24 +524,38 @@ fe_audio_error_t fe_audio_engine_set_listener(const fe_audio_listener_t* listene
 }
 
 int fe_audio_engine_play_spatial_sound(fe_sound_id_t sound_id, const fe_audio_emitter_t* emitter, int loops) {
+    if (fe_string_is_empty(&sound_id) || !emitter) {
+        FE_LOG_ERROR("Sound ID is empty or emitter is NULL for playing spatial sound.");
+        return -1;
+    }
+    fe_string_id_t sound_name_id = fe_string_intern_find(sound_id.data);
+    if (sound_name_id == FE_STRING_ID_INVALID) {
+        FE_LOG_ERROR("Spatial sound '%s' not loaded or chunk is NULL. Cannot play.", sound_id.data);
+        return -1;
+    }
+    return fe_audio_engine_play_spatial_sound_by_id(sound_name_id, emitter, loops);
+}
+
+int fe_audio_engine_play_spatial_sound_by_id(fe_string_id_t sound_name_id, const fe_audio_emitter_t* emitter, int loops) {
     if (!g_audio_engine_state.is_initialized) {
         FE_LOG_ERROR("Audio engine not initialized. Cannot play spatial sound.");
         return -1;
     }
-    if (fe_string_is_empty(&sound_id) || !emitter) {
+    if (!emitter) {
         FE_LOG_ERROR("Sound ID is empty or emitter is NULL for playing spatial sound.");
         return -1;
     }
 
-    fe_loaded_sound_t* loaded_sound = (fe_loaded_sound_t*)fe_hash_map_get(&g_audio_engine_state.loaded_sounds, sound_id.data);
+    const char* sound_name = fe_string_intern_c_str(sound_name_id); // Yalnızca loglama için
+    fe_loaded_sound_t* loaded_sound = fe_loaded_sound_map_get(&g_audio_engine_state.loaded_sounds, sound_name_id);
     if (!loaded_sound || !loaded_sound->chunk) {
-        FE_LOG_ERROR("Spatial sound '%s' not loaded or chunk is NULL. Cannot play.", sound_id.data);
+        FE_LOG_ERROR("Spatial sound '%s' not loaded or chunk is NULL. Cannot play.", sound_name);
         return -1;
     }
 
     int channel = Mix_PlayChannel(-1, loaded_sound->chunk, loops);
     if (channel == -1) {
-        FE_LOG_ERROR("Failed to play spatial sound '%s'. SDL_mixer Error: %s", sound_id.data, Mix_GetError());
+        FE_LOG_ERROR("Failed to play spatial sound '%s'. SDL_mixer Error: %s", sound_name, Mix_GetError());
         return -1;
     }
 
@@ -535,6 +581,6 @@ int fe_audio_engine_play_spatial_sound(fe_sound_id_t sound_id, const fe_audio_em
      Mix_SetDistance(channel, (uint8_t)(distance / max_dist * 255.0f)); // Mesafe 0 (yakın) -> 255 (uzak)
 
     FE_LOG_DEBUG("Played spatial sound '%s' on channel %d. Vol: %d, Pan L:%u R:%u", 
-                 sound_id.data, channel, final_volume_sdl, left_pan, right_pan);
+                 sound_name, channel, final_volume_sdl, left_pan, right_pan);
     return channel;
 }
@@ -0,0 +1,410 @@
+#include "core/containers/fe_chunk_list.h"
+#include "core/utils/fe_logger.h" // Loglama için
+
+#include <string.h> // memcpy, memmove, memset için
+#include <stdint.h> // SIZE_MAX için
+
+// Bir blok bu sayının altına düştüğünde komşusuyla birleştirilmeye çalışılır.
+#define FE_CHUNK_LIST_MERGE_THRESHOLD (FE_CHUNK_LIST_BLOCK_ELEMENTS / 4)
+
+// --- Yardımcı Fonksiyonlar (Dahili Kullanım İçin) ---
+
+static inline uint8_t* fe_chunk_list_slot(const fe_chunk_list_t* list, const fe_chunk_list_block_t* block, size_t offset) {
+    return fe_chunk_list_block_data(block) + offset * list->element_size;
+}
+
+/**
+ * @brief Yeni bir blok tahsis eder ve verilen bloğun ardına (after NULL ise listenin başına) bağlar.
+ * Liste başına bir yedek blok saklanır; ekle/sil sınırında gidip gelen kullanımda
+ * her seferinde tahsis yapılmaz.
+ */
+static fe_chunk_list_block_t* fe_chunk_list_link_new_block(fe_chunk_list_t* list, fe_chunk_list_block_t* after) {
+    fe_chunk_list_block_t* block = list->spare;
+    if (block) {
+        list->spare = NULL;
+    } else {
+        // fe_chunk_list_init, element_size'ı bu çarpım taşmayacak şekilde sınırlar
+        size_t block_bytes = sizeof(fe_chunk_list_block_t) + FE_CHUNK_LIST_BLOCK_ELEMENTS * list->element_size;
+        block = (fe_chunk_list_block_t*)FE_MALLOC(block_bytes, FE_MEM_TYPE_CONTAINER);
+        if (!block) {
+            FE_LOG_ERROR("fe_chunk_list: Failed to allocate %zu bytes for list block.", block_bytes);
+            return NULL;
+        }
+    }
+    block->count = 0;
+    block->reserved = 0;
+    block->prev = after;
+    block->next = after ? after->next : list->head;
+    if (block->next) {
+        block->next->prev = block;
+    } else {
+        list->tail = block;
+    }
+    if (after) {
+        after->next = block;
+    } else {
+        list->head = block;
+    }
+    list->block_count++;
+    return block;
+}
+
+/**
+ * @brief Bir bloğu listeden çıkarır; yedek boşsa orada saklar, değilse serbest bırakır.
+ */
+static void fe_chunk_list_unlink_block(fe_chunk_list_t* list, fe_chunk_list_block_t* block) {
+    if (block->prev) {
+        block->prev->next = block->next;
+    } else {
+        list->head = block->next;
+    }
+    if (block->next) {
+        block->next->prev = block->prev;
+    } else {
+        list->tail = block->prev;
+    }
+    list->block_count--;
+
+    if (!list->spare) {
+        list->spare = block;
+    } else {
+        FE_FREE(block, FE_MEM_TYPE_CONTAINER);
+    }
+}
+
+/**
+ * @brief Elemanı (copy callback ile veya memcpy) hedef yuvaya kopyalar.
+ */
+static bool fe_chunk_list_copy_in(const fe_chunk_list_t* list, void* dest, const void* data) {
+    if (list->data_copy_cb) {
+        if (!list->data_copy_cb(dest, data, list->element_size)) {
+            FE_LOG_ERROR("fe_chunk_list: Failed to copy data using custom copy callback.");
+            return false;
+        }
+    } else {
+        memcpy(dest, data, list->element_size);
+    }
+    return true;
+}
+
+/**
+ * @brief index'inci elemanı içeren bloğu bulur. Hangi uç daha yakınsa oradan blok atlanır.
+ *
+ * @param out_offset Elemanın blok içindeki konumu.
+ */
+static fe_chunk_list_block_t* fe_chunk_list_locate(const fe_chunk_list_t* list, size_t index, size_t* out_offset) {
+    fe_chunk_list_block_t* block;
+    if (index < list->size / 2) {
+        block = list->head;
+        while (index >= block->count) {
+            index -= block->count;
+            block = block->next;
+        }
+    } else {
+        size_t from_end = list->size - index; // 1..size
+        block = list->tail;
+        while (from_end > block->count) {
+            from_end -= block->count;
+            block = block->prev;
+        }
+        index = block->count - from_end;
+    }
+    *out_offset = index;
+    return block;
+}
+
+/**
+ * @brief Bloktaki bir elemanı kaldırır; bloğu gerekirse serbest bırakır veya komşusuyla birleştirir.
+ */
+static void fe_chunk_list_remove_in_block(fe_chunk_list_t* list, fe_chunk_list_block_t* block, size_t offset) {
+    uint8_t* slot = fe_chunk_list_slot(list, block, offset);
+    if (list->data_free_cb) {
+        list->data_free_cb(slot);
+    }
+    memmove(slot, slot + list->element_size, (block->count - offset - 1) * list->element_size);
+    block->count--;
+    list->size--;
+
+    if (block->count == 0) {
+        fe_chunk_list_unlink_block(list, block);
+        return;
+    }
+    if (block->count >= FE_CHUNK_LIST_MERGE_THRESHOLD) {
+        return;
+    }
+
+    // Seyrekleşen bloğu bir komşuya katarak blok sayısını ve gezinme atlamalarını düşük tut.
+    fe_chunk_list_block_t* next = block->next;
+    fe_chunk_list_block_t* prev = block->prev;
+    if (next && block->count + next->count <= FE_CHUNK_LIST_BLOCK_ELEMENTS) {
+        memcpy(fe_chunk_list_slot(list, block, block->count), fe_chunk_list_block_data(next), next->count * list->element_size);
+        block->count += next->count;
+        fe_chunk_list_unlink_block(list, next);
+    } else if (prev && prev->count + block->count <= FE_CHUNK_LIST_BLOCK_ELEMENTS) {
+        memcpy(fe_chunk_list_slot(list, prev, prev->count), fe_chunk_list_block_data(block), block->count * list->element_size);
+        prev->count += block->count;
+        fe_chunk_list_unlink_block(list, block);
+    }
+}
+
+// --- Parçalı Liste Fonksiyonları Implementasyonları ---
+
+bool fe_chunk_list_init(fe_chunk_list_t* list,
+                        size_t element_size,
+                        fe_data_free_func data_free_callback,
+                        fe_compare_func data_compare_callback,
+                        fe_data_copy_func data_copy_callback) {
+    if (!list || element_size == 0) {
+        FE_LOG_ERROR("fe_chunk_list_init: List pointer is NULL or element size is zero.");
+        return false;
+    }
+    if (element_size > (SIZE_MAX - sizeof(fe_chunk_list_block_t)) / FE_CHUNK_LIST_BLOCK_ELEMENTS) {
+        FE_LOG_ERROR("fe_chunk_list_init: Element size %zu is too large for a list block.", element_size);
+        return false;
+    }
+    memset(list, 0, sizeof(fe_chunk_list_t));
+
+    list->element_size = element_size;
+    list->data_free_cb = data_free_callback;
+    list->data_compare_cb = data_compare_callback;
+    list->data_copy_cb = data_copy_callback;
+
+    FE_LOG_DEBUG("Chunk list initialized (element size: %zu).", element_size);
+    return true;
+}
+
+void fe_chunk_list_shutdown(fe_chunk_list_t* list) {
+    if (!list) return;
+
+    fe_chunk_list_clear(list);
+    if (list->spare) {
+        FE_FREE(list->spare, FE_MEM_TYPE_CONTAINER);
+    }
+    memset(list, 0, sizeof(fe_chunk_list_t));
+    FE_LOG_DEBUG("Chunk list shut down.");
+}
+
+bool fe_chunk_list_prepend(fe_chunk_list_t* list, const void* data) {
+    if (!list || !data || list->element_size == 0) {
+        FE_LOG_ERROR("fe_chunk_list_prepend: Invalid parameters.");
+        return false;
+    }
+
+    fe_chunk_list_block_t* block = list->head;
+    if (!block || block->count == FE_CHUNK_LIST_BLOCK_ELEMENTS) {
+        // Dolu bloğu bölmek yerine başa yeni blok aç; art arda başa eklemede bloklar dolu kalır.
+        block = fe_chunk_list_link_new_block(list, NULL);
+        if (!block) return false;
+    }
+
+    uint8_t* base = fe_chunk_list_block_data(block);
+    memmove(base + list->element_size, base, block->count * list->element_size);
+    if (!fe_chunk_list_copy_in(list, base, data)) {
+        memmove(base, base + list->element_size, block->count * list->element_size);
+        if (block->count == 0) fe_chunk_list_unlink_block(list, block);
+        return false;
+    }
+    block->count++;
+    list->size++;
+    return true;
+}
+
+bool fe_chunk_list_append(fe_chunk_list_t* list, const void* data) {
+    if (!list || !data || list->element_size == 0) {
+        FE_LOG_ERROR("fe_chunk_list_append: Invalid parameters.");
+        return false;
+    }
+
+    fe_chunk_list_block_t* block = list->tail;
+    if (!block || block->count == FE_CHUNK_LIST_BLOCK_ELEMENTS) {
+        block = fe_chunk_list_link_new_block(list, list->tail);
+        if (!block) return false;
+    }
+
+    if (!fe_chunk_list_copy_in(list, fe_chunk_list_slot(list, block, block->count), data)) {
+        if (block->count == 0) fe_chunk_list_unlink_block(list, block);
+        return false;
+    }
+    block->count++;
+    list->size++;
+    return true;
+}
+
+bool fe_chunk_list_insert_at(fe_chunk_list_t* list, size_t index, const void* data) {
+    if (!list || !data || list->element_size == 0 || index > list->size) {
+        FE_LOG_ERROR("fe_chunk_list_insert_at: Invalid parameters (index: %zu, size: %zu).", index, list ? list->size : 0);
+        return false;
+    }
+    if (index == list->size) {
+        return fe_chunk_list_append(list, data);
+    }
+    if (index == 0) {
+        return fe_chunk_list_prepend(list, data);
+    }
+
+    size_t offset;
+    fe_chunk_list_block_t* block = fe_chunk_list_locate(list, index, &offset);
+
+    if (block->count == FE_CHUNK_LIST_BLOCK_ELEMENTS) {
+        // Dolu bloğu ikiye böl: üst yarı yeni bloğa taşınır.
+        fe_chunk_list_block_t* upper = fe_chunk_list_link_new_block(list, block);
+        if (!upper) return false;
+        size_t half = FE_CHUNK_LIST_BLOCK_ELEMENTS / 2;
+        memcpy(fe_chunk_list_block_data(upper), fe_chunk_list_slot(list, block, half), (block->count - half) * list->element_size);
+        upper->count = block->count - half;
+        block->count = half;
+        if (offset > half) {
+            block = upper;
+            offset -= half;
+        }
+    }
+
+    uint8_t* slot = fe_chunk_list_slot(list, block, offset);
+    memmove(slot + list->element_size, slot, (block->count - offset) * list->element_size);
+    if (!fe_chunk_list_copy_in(list, slot, data)) {
+        memmove(slot, slot + list->element_size, (block->count - offset) * list->element_size);
+        return false;
+    }
+    block->count++;
+    list->size++;
+    return true;
+}
+
+bool fe_chunk_list_remove_head(fe_chunk_list_t* list) {
+    if (!list || list->size == 0) {
+        FE_LOG_ERROR("fe_chunk_list_remove_head: List is empty or NULL.");
+        return false;
+    }
+    fe_chunk_list_remove_in_block(list, list->head, 0);
+    return true;
+}
+
+bool fe_chunk_list_remove_tail(fe_chunk_list_t* list) {
+    if (!list || list->size == 0) {
+        FE_LOG_ERROR("fe_chunk_list_remove_tail: List is empty or NULL.");
+        return false;
+    }
+    fe_chunk_list_remove_in_block(list, list->tail, list->tail->count - 1);
+    return true;
+}
+
+bool fe_chunk_list_remove_at(fe_chunk_list_t* list, size_t index) {
+    if (!list || index >= list->size) {
+        FE_LOG_ERROR("fe_chunk_list_remove_at: Invalid parameters (index: %zu, size: %zu).", index, list ? list->size : 0);
+        return false;
+    }
+    size_t offset;
+    fe_chunk_list_block_t* block = fe_chunk_list_locate(list, index, &offset);
+    fe_chunk_list_remove_in_block(list, block, offset);
+    return true;
+}
+
+bool fe_chunk_list_remove(fe_chunk_list_t* list, const void* data) {
+    if (!list || !data || list->size == 0) {
+        FE_LOG_ERROR("fe_chunk_list_remove: Invalid parameters.");
+        return false;
+    }
+    if (!list->data_compare_cb) {
+        FE_LOG_ERROR("fe_chunk_list_remove: Cannot remove, no comparison callback provided during init.");
+        return false;
+    }
+
+    for (fe_chunk_list_block_t* block = list->head; block; block = block->next) {
+        uint8_t* slot = fe_chunk_list_block_data(block);
+        for (size_t i = 0; i < block->count; ++i, slot += list->element_size) {
+            if (list->data_compare_cb(slot, data) == 0) {
+                fe_chunk_list_remove_in_block(list, block, i);
+                return true;
+            }
+        }
+    }
+
+    FE_LOG_WARN("fe_chunk_list_remove: Data not found in list.");
+    return false;
+}
+
+void* fe_chunk_list_peek_head(const fe_chunk_list_t* list) {
+    if (!list || list->size == 0) {
+        return NULL;
+    }
+    return fe_chunk_list_block_data(list->head);
+}
+
+void* fe_chunk_list_peek_tail(const fe_chunk_list_t* list) {
+    if (!list || list->size == 0) {
+        return NULL;
+    }
+    return fe_chunk_list_slot(list, list->tail, list->tail->count - 1);
+}
+
+void* fe_chunk_list_get_at(const fe_chunk_list_t* list, size_t index) {
+    if (!list || index >= list->size) {
+        return NULL;
+    }
+    size_t offset;
+    fe_chunk_list_block_t* block = fe_chunk_list_locate(list, index, &offset);
+    return fe_chunk_list_slot(list, block, offset);
+}
+
+bool fe_chunk_list_contains(const fe_chunk_list_t* list, const void* data) {
+    if (!list || !data || list->size == 0) {
+        return false;
+    }
+    if (!list->data_compare_cb) {
+        FE_LOG_ERROR("fe_chunk_list_contains: Cannot search, no comparison callback provided during init.");
+        return false;
+    }
+
+    for (const fe_chunk_list_block_t* block = list->head; block; block = block->next) {
+        const uint8_t* slot = fe_chunk_list_block_data(block);
+        for (size_t i = 0; i < block->count; ++i, slot += list->element_size) {
+            if (list->data_compare_cb(slot, data) == 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool fe_chunk_list_is_empty(const fe_chunk_list_t* list) {
+    return list ? (list->size == 0) : true;
+}
+
+size_t fe_chunk_list_size(const fe_chunk_list_t* list) {
+    return list ? list->size : 0;
+}
+
+void fe_chunk_list_clear(fe_chunk_list_t* list) {
+    if (!list) return;
+
+    fe_chunk_list_block_t* block = list->head;
+    while (block) {
+        fe_chunk_list_block_t* next = block->next;
+        if (list->data_free_cb) {
+            uint8_t* slot = fe_chunk_list_block_data(block);
+            for (size_t i = 0; i < block->count; ++i, slot += list->element_size) {
+                list->data_free_cb(slot);
+            }
+        }
+        FE_FREE(block, FE_MEM_TYPE_CONTAINER);
+        block = next;
+    }
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->block_count = 0;
+}
+
+void fe_chunk_list_for_each(const fe_chunk_list_t* list, fe_chunk_list_iter_callback callback) {
+    if (!list || !callback) {
+        FE_LOG_WARN("fe_chunk_list_for_each: List or callback is NULL.");
+        return;
+    }
+
+    for (const fe_chunk_list_block_t* block = list->head; block; block = block->next) {
+        uint8_t* slot = fe_chunk_list_block_data(block);
+        for (size_t i = 0; i < block->count; ++i, slot += list->element_size) {
+            callback(slot);
+        }
+    }
+}
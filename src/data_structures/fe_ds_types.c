@@ -1,6 +1,7 @@
 #include "core/ds/fe_ds_types.h"
 #include "core/utils/fe_logger.h" // Loglama için
 #include <string.h> // strlen, strcmp için
+#include <time.h>   // time, clock için (hash tohumu)
 
 // --- FNV-1a 64-bit Hash Fonksiyonu Implementasyonu ---
 // Kaynak: http://www.isthe.com/chongo/tech/comp/fnv/
@@ -22,11 +23,121 @@ uint64_t fe_ds_hash_fnv1a(const void* data, size_t size) {
     return hash;
 }
 
-uint64_t fe_ds_hash_string(const char* str) {
+// --- Hızlı Hash Ailesi Implementasyonu ---
+
+uint64_t fe_ds_hash_fast(const void* data, size_t size) {
+    return fe_ds_hash_fast_seeded(data, size, FE_DS_HASH_DEFAULT_SEED);
+}
+
+uint64_t fe_ds_hash_fast_seeded(const void* data, size_t size, uint64_t seed) {
+    if (!data && size > 0) {
+        return 0; // Geçersiz giriş için 0 döndür
+    }
+    return fe_ds_hash_bytes_inline(data, size, seed);
+}
+
+// Tek geçişli string hash'i yalnızca küçük-endian platformlarda ve adres denetleyicisi
+// (AddressSanitizer) kapalıyken kullanılır. Hizalı 8 baytlık okumalar string sonunu aşabilir;
+// hizalı bir okuma asla sayfa sınırını geçmediği için bu güvenlidir (libc strlen ile aynı teknik),
+// ancak ASan bunu hata olarak raporlar.
+#if defined(__SANITIZE_ADDRESS__)
+    #define FE_DS_HASH_STRING_SINGLE_PASS 0
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define FE_DS_HASH_STRING_SINGLE_PASS 0
+    #endif
+#endif
+#ifndef FE_DS_HASH_STRING_SINGLE_PASS
+    #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) && (defined(__GNUC__) || defined(__clang__))
+        #define FE_DS_HASH_STRING_SINGLE_PASS 1
+    #else
+        #define FE_DS_HASH_STRING_SINGLE_PASS 0
+    #endif
+#endif
+
+#if FE_DS_HASH_STRING_SINGLE_PASS
+#define FE_DS_ONES_64  ((uint64_t)0x0101010101010101ULL)
+#define FE_DS_HIGHS_64 ((uint64_t)0x8080808080808080ULL)
+
+// Kelimedeki sıfır baytları işaretler. En düşük işaretli bayt her zaman ilk sıfır bayttır.
+static inline uint64_t fe_ds_zero_byte_mask(uint64_t w) {
+    return (w - FE_DS_ONES_64) & ~w & FE_DS_HIGHS_64;
+}
+
+// Hizalı bir kelime okur (may_alias: farklı tipteki belleği okumak için).
+typedef uint64_t __attribute__((__may_alias__)) fe_ds_aliased_u64_t;
+
+static uint64_t fe_ds_hash_string_single_pass(const char* str, uint64_t seed) {
+    const fe_ds_aliased_u64_t* wp = (const fe_ds_aliased_u64_t*)((uintptr_t)str & ~(uintptr_t)7);
+    const unsigned shift = (unsigned)((uintptr_t)str & 7) * 8;
+    uint64_t h = seed ^ FE_DS_HASH_SECRET0;
+    uint64_t len = 0;
+    uint64_t cur = *wp;
+
+    for (;;) {
+        uint64_t chunk;
+        if (shift == 0) {
+            chunk = cur;
+        } else {
+            // Hizasız başlangıç: iki hizalı kelimeden string'e göre 8 baytlık parçayı birleştir.
+            // Bir sonraki kelime yalnızca bu kelimenin kalanında sonlandırıcı yoksa okunur.
+            uint64_t lo = cur >> shift;
+            if (fe_ds_zero_byte_mask(lo | (~(uint64_t)0 << (64 - shift)))) {
+                chunk = lo;
+            } else {
+                cur = *++wp;
+                chunk = lo | (cur << (64 - shift));
+            }
+        }
+
+        uint64_t zero_mask = fe_ds_zero_byte_mask(chunk);
+        if (zero_mask) {
+            unsigned tail_bytes = (unsigned)__builtin_ctzll(zero_mask) / 8;
+            uint64_t tail = tail_bytes ? (chunk & (~(uint64_t)0 >> (64 - 8 * tail_bytes))) : 0;
+            len += tail_bytes;
+            h = fe_ds_hash_mum(tail ^ FE_DS_HASH_SECRET1, h ^ FE_DS_HASH_SECRET3);
+            return fe_ds_hash_mum(h ^ FE_DS_HASH_SECRET0, len ^ FE_DS_HASH_SECRET1);
+        }
+
+        h = fe_ds_hash_mum(chunk ^ FE_DS_HASH_SECRET1, h ^ FE_DS_HASH_SECRET2);
+        len += 8;
+        if (shift == 0) {
+            cur = *++wp;
+        }
+    }
+}
+#endif
+
+uint64_t fe_ds_hash_string_seeded(const char* str, uint64_t seed) {
     if (!str) {
         return 0;
     }
-    return fe_ds_hash_fnv1a(str, strlen(str));
+#if FE_DS_HASH_STRING_SINGLE_PASS
+    return fe_ds_hash_string_single_pass(str, seed);
+#else
+    return fe_ds_hash_bytes_inline(str, strlen(str), seed);
+#endif
+}
+
+uint64_t fe_ds_hash_string(const char* str) {
+    return fe_ds_hash_string_seeded(str, FE_DS_HASH_DEFAULT_SEED);
+}
+
+uint64_t fe_ds_hash_random_seed(void) {
+    static uint64_t s_seed = 0;
+    if (s_seed == 0) {
+        // Zaman, saat ve adres uzayı rastgeleleştirmesinden (ASLR) gelen entropiyi karıştır.
+        uint64_t local_marker = 0;
+        uint64_t entropy[4] = {
+            (uint64_t)time(NULL),
+            (uint64_t)clock(),
+            (uint64_t)(uintptr_t)&local_marker,
+            (uint64_t)(uintptr_t)&fe_ds_hash_random_seed
+        };
+        uint64_t seed = fe_ds_hash_fast_seeded(entropy, sizeof(entropy), FE_DS_HASH_SECRET2);
+        s_seed = seed ? seed : FE_DS_HASH_SECRET3;
+    }
+    return s_seed;
 }
 
 // --- Karşılaştırma Fonksiyonları Implementasyonları ---
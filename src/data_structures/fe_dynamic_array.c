@@ -0,0 +1,51 @@
+#include "core/containers/fe_dynamic_array.h"
+#include "core/utils/fe_logger.h" // Loglama için
+#include <string.h>               // memcpy için
+#include <stdint.h>               // SIZE_MAX için
+
+bool fe_dynamic_array_grow_raw(void** data, size_t* capacity, size_t element_size, size_t min_capacity) {
+    if (!data || !capacity || element_size == 0) {
+        FE_LOG_ERROR("fe_dynamic_array_grow_raw: Invalid parameters.");
+        return false;
+    }
+    if (min_capacity <= *capacity) {
+        return true; // Zaten yeterli yer var
+    }
+
+    size_t new_capacity = *capacity > SIZE_MAX / 2 ? SIZE_MAX : *capacity * 2; // Amortize O(1) ekleme için kapasiteyi ikiye katla
+    if (new_capacity < min_capacity) new_capacity = min_capacity;
+    if (new_capacity < 4) new_capacity = 4; // Çok küçük dizilerde sık büyümeyi önle
+    if (new_capacity > SIZE_MAX / element_size) {
+        FE_LOG_ERROR("fe_dynamic_array_grow_raw: %zu elements of %zu bytes overflow size_t.", new_capacity, element_size);
+        return false;
+    }
+
+    void* new_data = FE_MALLOC(new_capacity * element_size, FE_MEM_TYPE_CONTAINER);
+    if (!new_data) {
+        FE_LOG_ERROR("fe_dynamic_array_grow_raw: Failed to allocate %zu elements (%zu bytes each).",
+                     new_capacity, element_size);
+        return false;
+    }
+
+    // Eski elemanları yeni bloğa taşı. Eleman sayısı kapasiteyi aşamayacağı için
+    // tüm eski kapasiteyi kopyalamak güvenlidir.
+    if (*data) {
+        memcpy(new_data, *data, *capacity * element_size);
+        FE_FREE(*data, FE_MEM_TYPE_CONTAINER);
+    }
+
+    *data = new_data;
+    *capacity = new_capacity;
+    return true;
+}
+
+void fe_dynamic_array_free_raw(void** data, size_t* size, size_t* capacity) {
+    if (!data) return;
+
+    if (*data) {
+        FE_FREE(*data, FE_MEM_TYPE_CONTAINER);
+    }
+    *data = NULL;
+    if (size) *size = 0;
+    if (capacity) *capacity = 0;
+}
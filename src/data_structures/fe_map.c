@@ -5,6 +5,17 @@
 
 // --- Yardımcı Fonksiyonlar (Dahili Kullanım İçin) ---
 
+/**
+ * @brief Bir anahtarın hash değerini hesaplar.
+ * Özel bir callback verilmemişse varsayılan hızlı hash doğrudan (dolaylı çağrı olmadan) kullanılır.
+ */
+static inline uint64_t fe_map_hash_key(const fe_map_t* map, const void* key, size_t key_size) {
+    if (map->hash_key_cb) {
+        return map->hash_key_cb(key, key_size);
+    }
+    return fe_ds_hash_bytes_inline(key, key_size, map->hash_seed);
+}
+
 /**
  * @brief Yeni bir harita girişi (entry) oluşturur ve verileri kopyalar.
  *
@@ -104,96 +115,208 @@ static void fe_map_destroy_entry(fe_map_entry_t* entry,
 }
 
 /**
- * @brief Haritayı yeniden boyutlandırır (rehashing).
- * Tüm mevcut elemanları yeni, daha büyük bir kova dizisine yeniden dağıtır.
+ * @brief Bir girişi kovanın başına bağlar. Düğümün data alanı doğrudan fe_map_entry_t*'yi
+ * işaret eder (fe_list_append gibi veriyi kopyalamaz); düğüm ve giriş fe_map tarafından serbest bırakılır.
+ *
+ * @param bucket Girişin ekleneceği kova.
+ * @param entry Eklenecek giriş.
+ * @return bool Başarılı ise true, aksi takdirde false.
+ */
+static bool fe_map_link_entry(fe_list_t* bucket, fe_map_entry_t* entry) {
+    fe_list_node_t* node = FE_MALLOC(sizeof(fe_list_node_t), FE_MEM_TYPE_CONTAINER);
+    if (!node) {
+        FE_LOG_ERROR("fe_map_link_entry: Failed to allocate bucket node.");
+        return false;
+    }
+    node->data = entry;
+    node->data_size = sizeof(fe_map_entry_t);
+    node->next = bucket->head;
+    bucket->head = node;
+    bucket->size++;
+    return true;
+}
+
+/**
+ * @brief Belirtilen kapasitede boş bir kova dizisi tahsis eder.
+ * Sıfırlanmış bir fe_list_t, fe_list_init(list, NULL, NULL, NULL) ile başlatılmış boş bir
+ * listeyle aynıdır; binlerce kova için fe_list_init çağırmak (ve her biri için log yazmak)
+ * yeniden boyutlandırmanın maliyetine eklenmesin diye doğrudan memset kullanılır.
+ *
+ * @param capacity Kova sayısı.
+ * @return fe_list_t* Kova dizisi, hata durumunda NULL.
+ */
+static fe_list_t* fe_map_alloc_buckets(size_t capacity) {
+    fe_list_t* buckets = FE_MALLOC(sizeof(fe_list_t) * capacity, FE_MEM_TYPE_CONTAINER);
+    if (!buckets) {
+        FE_LOG_ERROR("fe_map_alloc_buckets: Failed to allocate %zu buckets.", capacity);
+        return NULL;
+    }
+    memset(buckets, 0, sizeof(fe_list_t) * capacity);
+    return buckets;
+}
+
+/**
+ * @brief Bir kovadaki tüm düğümleri (entry'leri yeniden tahsis etmeden) hedef kova dizisine taşır.
+ *
+ * @param bucket Boşaltılacak kaynak kova.
+ * @param dest_buckets Hedef kova dizisi.
+ * @param dest_capacity Hedef kova dizisinin kapasitesi.
+ * @return size_t Taşınan giriş sayısı.
+ */
+static size_t fe_map_move_bucket(fe_list_t* bucket, fe_list_t* dest_buckets, size_t dest_capacity) {
+    size_t moved = 0;
+    fe_list_node_t* current_node = bucket->head;
+    bucket->head = NULL;
+    bucket->size = 0;
+
+    while (current_node) {
+        fe_map_entry_t* entry = (fe_map_entry_t*)current_node->data;
+        fe_list_node_t* next_old_node = current_node->next;
+        size_t new_index = entry->key_hash % dest_capacity;
+
+        // Düğümü doğrudan yeni kova listesinin başına ekle (en hızlı)
+        current_node->next = dest_buckets[new_index].head;
+        dest_buckets[new_index].head = current_node;
+        dest_buckets[new_index].size++;
+
+        current_node = next_old_node;
+        moved++;
+    }
+    return moved;
+}
+
+/**
+ * @brief Devam eden artımlı yeniden boyutlandırmada en fazla max_buckets eski kovayı yeni tabloya taşır.
+ * Tüm eski kovalar taşındığında eski tablo serbest bırakılır.
+ *
+ * @param map İşlem yapılacak harita.
+ * @param max_buckets Bu adımda taşınacak en fazla kova sayısı.
+ */
+static void fe_map_migrate_buckets(fe_map_t* map, size_t max_buckets) {
+    if (!map->old_buckets) return;
+
+    // Boş kovalar ucuzdur; tamamen boş bölgelerde adımın ilerlemesi için onları da sınırla.
+    size_t visited = 0;
+    size_t max_visits = max_buckets * 4;
+    while (map->rehash_index < map->old_capacity && max_buckets > 0 && visited < max_visits) {
+        fe_list_t* bucket = &map->old_buckets[map->rehash_index++];
+        visited++;
+        if (bucket->head) {
+            fe_map_move_bucket(bucket, map->buckets, map->capacity);
+            max_buckets--;
+        }
+    }
+
+    if (map->rehash_index >= map->old_capacity) {
+        FE_FREE(map->old_buckets, FE_MEM_TYPE_CONTAINER);
+        map->old_buckets = NULL;
+        map->old_capacity = 0;
+        map->rehash_index = 0;
+        FE_LOG_DEBUG("fe_map: Incremental rehash finished. Capacity: %zu", map->capacity);
+    }
+}
+
+/**
+ * @brief Haritayı yeni kapasiteye yeniden boyutlandırır (rehashing).
+ * Artımlı modda yalnızca yeni tablo tahsis edilir; girişler sonraki işlemlerde
+ * FE_MAP_REHASH_BUCKETS_PER_OP kova adımlarla taşınır. Aksi halde tüm girişler hemen taşınır.
+ * Her iki durumda da fe_map_entry_t'lerin kendileri yeniden tahsis edilmez, sadece listeler arası taşınır.
  *
  * @param map Yeniden boyutlandırılacak harita.
+ * @param new_capacity Yeni kova sayısı.
+ * @param incremental true ise artımlı (amortize) yeniden boyutlandırma başlatılır.
  * @return bool Başarılı ise true, aksi takdirde false.
  */
-static bool fe_map_resize(fe_map_t* map) {
+static bool fe_map_resize(fe_map_t* map, size_t new_capacity, bool incremental) {
     if (!map) return false;
-
-    size_t old_capacity = map->capacity;
-    size_t new_capacity = old_capacity * 2; // Basitçe kapasiteyi ikiye katla
     if (new_capacity < 8) new_capacity = 8; // Minimum kapasiteyi koru
 
-    FE_LOG_INFO("Resizing map from %zu to %zu capacity.", old_capacity, new_capacity);
+    // Önceki artımlı taşıma bitmeden yeni bir tane başlatılamaz; kalanını tamamla.
+    // (Kapasite iki katına çıktığı için bu durum ancak çok sayıda eklemeden sonra oluşur.)
+    if (map->old_buckets) {
+        fe_map_migrate_buckets(map, (size_t)-1 / 8);
+    }
 
-    fe_list_t* new_buckets = FE_MALLOC(sizeof(fe_list_t) * new_capacity, FE_MEM_TYPE_CONTAINER);
+    FE_LOG_INFO("Resizing map from %zu to %zu capacity (%s).", map->capacity, new_capacity,
+                incremental ? "incremental" : "immediate");
+
+    fe_list_t* new_buckets = fe_map_alloc_buckets(new_capacity);
     if (!new_buckets) {
         FE_LOG_ERROR("fe_map_resize: Failed to allocate new buckets array.");
         return false;
     }
 
-    // Yeni kovaları başlat
-    for (size_t i = 0; i < new_capacity; ++i) {
-        // Liste düğümlerini yok eden özel bir serbest bırakma işlevi sağlıyoruz.
-        // fe_list_destroy_node zaten fe_map_entry_t*'yi serbest bırakacak.
-        fe_list_init(&new_buckets[i], NULL, NULL, NULL); 
+    if (incremental) {
+        map->old_buckets = map->buckets;
+        map->old_capacity = map->capacity;
+        map->rehash_index = 0;
+        map->buckets = new_buckets;
+        map->capacity = new_capacity;
+        return true;
     }
 
-    // Eski kovaları dolaş ve elemanları yeni kovalara rehashing yap
-    for (size_t i = 0; i < old_capacity; ++i) {
-        fe_list_node_t* current_node = fe_list_get_iterator(&map->buckets[i]);
-        while (current_node) {
-            fe_map_entry_t* entry = (fe_map_entry_t*)current_node->data;
-            
-            // Yeni indeksi hesapla
-            size_t new_index = entry->key_hash % new_capacity;
-            
-            // Mevcut düğümü doğrudan yeni listeye ekle (veriyi yeniden kopyalamadan)
-            // Bu, fe_list'in append/prepend'ini kullanmak yerine doğrudan düğüm bağlantısını değiştirir.
-            // Bu durumda, fe_list'in dahili belleğini bypass ediyoruz, bu yüzden dikkatli olun.
-            // Daha sağlam bir yaklaşım, entry->key ve entry->value'yu kopyalamaktır.
-            // Basitlik ve performans için burada düğümü taşıyoruz.
-            
-            fe_list_node_t* next_old_node = current_node->next;
-            
-            // Düğümü eski listeden kaldır
-            // Bu, fe_list_remove_at veya fe_list_remove_head gibi bir mekanizma gerektirir.
-            // Ancak şu anki fe_list implementasyonumuzda bunu doğrudan yapmak karmaşık.
-            // En basit yol: eski listeyi temizle ve yeni listeye yeniden ekle.
-            // Ancak bu, data_copy_cb'ye ihtiyaç duyar.
-            
-            // Yeniden ekleme stratejisi:
-            // Her girişi çıkar, yeni kova dizisine ekle.
-            // Bu, her anahtar/değer için yeniden bellek tahsisatı ve kopyalama anlamına gelir.
-            // Daha verimli olan, düğümleri doğrudan taşımaktır.
-            // Mevcut fe_list yapımız bunu doğrudan desteklemediği için
-            // bu örnekte yeniden ekleme yolunu seçelim, ancak bunun bir performans bedeli var.
-
-            // Mevcut anahtar ve değerleri kopyala (derin kopya)
-            fe_map_set(&new_buckets[new_index], entry->key, entry->key_size, entry->value, entry->value_size);
-            
-            current_node = next_old_node;
-        }
+    size_t rehashed_count = 0;
+    for (size_t i = 0; i < map->capacity; ++i) {
+        rehashed_count += fe_map_move_bucket(&map->buckets[i], new_buckets, new_capacity);
     }
-    
-    // Eski kovaları ve içindeki düğümleri temizle (düğüm verisi taşındığı için sadece düğüm bellekleri temizlenir)
-    for (size_t i = 0; i < old_capacity; ++i) {
-        fe_list_shutdown(&map->buckets[i]); // Sadece liste yapısını kapatır, düğüm içeriğini serbest bırakmaz.
-                                            // Çünkü düğüm verileri (entryler) yeni listeye taşındı.
-                                            // TODO: fe_list_shutdown'ın derin temizleme yapıp yapmadığını kontrol et.
-                                            // Eğer yapıyorsa, buradaki yaklaşım yanlış olabilir.
-                                            // fe_list_shutdown, node->data'yı da serbest bırakır.
-                                            // Bu durumda, entryleri tek tek taşımalıyız.
-
-        // Revize Edilmiş Rehashing Stratejisi:
-        // Her elemanı tek tek çıkar, yeni kovaya ekle.
-        // Bu, kopyalama geri arama fonksiyonları gerektirir.
-        // fe_list_init için NULL free_cb ile başlattığımız kovalar, fe_map_entry_t*'yi serbest bırakmamalı.
-    }
-    
-    // Eski kova dizisini serbest bırak
     FE_FREE(map->buckets, FE_MEM_TYPE_CONTAINER);
 
     map->buckets = new_buckets;
     map->capacity = new_capacity;
-    
-    FE_LOG_INFO("Map resized successfully to %zu capacity.", map->capacity);
+
+    FE_LOG_INFO("Map resized successfully. Total rehashed entries: %zu", rehashed_count);
     return true;
 }
 
+/**
+ * @brief Anahtarı içeren düğümü bulur. Artımlı yeniden boyutlandırma sürerken önce yeni,
+ * sonra eski tablodaki ilgili kovaya bakılır.
+ *
+ * @param map Aranacak harita.
+ * @param key Aranacak anahtar.
+ * @param key_hash Anahtarın hash değeri.
+ * @param out_bucket Düğümün bulunduğu kova (NULL olabilir).
+ * @param out_prev Düğümden önceki düğüm; düğüm kovanın başıysa NULL (NULL olabilir).
+ * @return fe_list_node_t* Bulunan düğüm, yoksa NULL.
+ */
+static fe_list_node_t* fe_map_find_node(const fe_map_t* map, const void* key, uint64_t key_hash,
+                                        fe_list_t** out_bucket, fe_list_node_t** out_prev) {
+    fe_list_t* candidates[2];
+    size_t candidate_count = 0;
+    candidates[candidate_count++] = &map->buckets[key_hash % map->capacity];
+    if (map->old_buckets) {
+        size_t old_index = key_hash % map->old_capacity;
+        if (old_index >= map->rehash_index) { // Daha küçük indeksler zaten taşındı
+            candidates[candidate_count++] = &map->old_buckets[old_index];
+        }
+    }
+
+    for (size_t c = 0; c < candidate_count; ++c) {
+        fe_list_node_t* prev_node = NULL;
+        fe_list_node_t* current_node = fe_list_get_iterator(candidates[c]);
+        while (current_node) {
+            fe_map_entry_t* entry = (fe_map_entry_t*)current_node->data;
+            if (entry->key_hash == key_hash &&
+                map->compare_key_cb(entry->key, key) == 0) {
+                if (out_bucket) *out_bucket = candidates[c];
+                if (out_prev) *out_prev = prev_node;
+                return current_node;
+            }
+            prev_node = current_node;
+            current_node = current_node->next;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Verilen sayıda girişi yük faktörünü aşmadan tutabilecek kova sayısını hesaplar.
+ */
+static size_t fe_map_capacity_for(const fe_map_t* map, size_t count) {
+    float threshold = map->load_factor_threshold > 0.0f ? map->load_factor_threshold : 0.75f;
+    return (size_t)ceilf((float)count / threshold) + 1;
+}
+
 // --- Hash Haritası Fonksiyonları Implementasyonları ---
 
 bool fe_map_init(fe_map_t* map,
@@ -204,8 +327,8 @@ bool fe_map_init(fe_map_t* map,
                  fe_data_free_func free_value_callback,
                  fe_data_copy_func copy_key_callback,
                  fe_data_copy_func copy_value_callback) {
-    if (!map || !hash_key_callback || !compare_key_callback) {
-        FE_LOG_ERROR("fe_map_init: Invalid parameters (map, hash_key_callback, or compare_key_callback is NULL).");
+    if (!map || !compare_key_callback) {
+        FE_LOG_ERROR("fe_map_init: Invalid parameters (map or compare_key_callback is NULL).");
         return false;
     }
     if (initial_capacity == 0) {
@@ -218,51 +341,76 @@ bool fe_map_init(fe_map_t* map,
     map->capacity = initial_capacity;
     map->size = 0;
     map->load_factor_threshold = 0.75f; // Yaygın bir varsayılan yük faktörü
+    map->incremental_resize = false;
 
     map->hash_key_cb = hash_key_callback;
+    map->hash_seed = FE_DS_HASH_DEFAULT_SEED;
     map->compare_key_cb = compare_key_callback;
     map->free_key_cb = free_key_callback;
     map->free_value_cb = free_value_callback;
     map->copy_key_cb = copy_key_callback;
     map->copy_value_cb = copy_value_callback;
 
-    map->buckets = FE_MALLOC(sizeof(fe_list_t) * map->capacity, FE_MEM_TYPE_CONTAINER);
+    // fe_map_entry_t* olarak saklandığı için, kova listeleri kendi elemanlarını serbest bırakmaz
+    // (NULL free_cb); entry'lerin serbest bırakılması fe_map_destroy_entry tarafından yönetilir.
+    map->buckets = fe_map_alloc_buckets(map->capacity);
     if (!map->buckets) {
         FE_LOG_ERROR("fe_map_init: Failed to allocate memory for buckets array.");
         return false;
     }
 
-    // Her kovayı bir bağlantılı liste olarak başlat
-    for (size_t i = 0; i < map->capacity; ++i) {
-        // fe_map_entry_t* olarak saklandığı için, fe_list'in kendi elemanlarını serbest bırakmasını istemiyoruz.
-        // fe_map_entry_t*'nin serbest bırakılması fe_map_destroy_entry tarafından yönetilecek.
-        // Ancak fe_list_node_t.data pointer'ı doğrudan fe_map_entry_t* olduğu için,
-        // fe_list_node_t'yi serbest bırakırken, node->data serbest bırakılmamalı.
-        // Bu yüzden NULL free_cb kullanıyoruz.
-        if (!fe_list_init(&map->buckets[i], NULL, NULL, NULL)) { 
-            FE_LOG_ERROR("fe_map_init: Failed to initialize bucket list at index %zu.", i);
-            // Başarısız durumda önceki tahsisleri temizle
-            for (size_t j = 0; j < i; ++j) {
-                fe_list_shutdown(&map->buckets[j]);
-            }
-            FE_FREE(map->buckets, FE_MEM_TYPE_CONTAINER);
-            return false;
-        }
-    }
-
     FE_LOG_INFO("Hash map initialized with capacity %zu.", map->capacity);
     return true;
 }
 
-void fe_map_shutdown(fe_map_t* map) {
+bool fe_map_set_hash_seed(fe_map_t* map, uint64_t seed) {
+    if (!map) return false;
+    if (map->size > 0) {
+        FE_LOG_ERROR("fe_map_set_hash_seed: Seed can only be changed while the map is empty.");
+        return false;
+    }
+    map->hash_seed = seed;
+    return true;
+}
+
+void fe_map_set_incremental_resize(fe_map_t* map, bool enabled) {
     if (!map) return;
+    map->incremental_resize = enabled;
+    if (!enabled && map->old_buckets) {
+        fe_map_migrate_buckets(map, (size_t)-1 / 8); // Devam eden taşımayı hemen bitir
+    }
+}
 
-    fe_map_clear(map); // Tüm elemanları temizle
+bool fe_map_reserve(fe_map_t* map, size_t expected_count) {
+    if (!map || !map->buckets) {
+        FE_LOG_ERROR("fe_map_reserve: Invalid map.");
+        return false;
+    }
 
-    // Kovaları kapat ve serbest bırak
-    for (size_t i = 0; i < map->capacity; ++i) {
-        fe_list_shutdown(&map->buckets[i]);
+    size_t needed_capacity = fe_map_capacity_for(map, expected_count);
+    if (needed_capacity <= map->capacity) {
+        return true; // Zaten yeterli kova var
     }
+    // Yükleme zamanı işlemi olduğu için her zaman anında yeniden boyutlandırılır.
+    return fe_map_resize(map, needed_capacity, false);
+}
+
+size_t fe_map_rehash_step(fe_map_t* map, size_t max_buckets) {
+    if (!map || !map->old_buckets) return 0;
+    fe_map_migrate_buckets(map, max_buckets > 0 ? max_buckets : 1);
+    return map->old_buckets ? map->old_capacity - map->rehash_index : 0;
+}
+
+bool fe_map_is_rehashing(const fe_map_t* map) {
+    return map ? (map->old_buckets != NULL) : false;
+}
+
+void fe_map_shutdown(fe_map_t* map) {
+    if (!map) return;
+
+    fe_map_clear(map); // Tüm elemanları ve düğümleri temizle (eski tabloyu da serbest bırakır)
+
+    // Kovalar artık boş; kova dizisini serbest bırak
     FE_FREE(map->buckets, FE_MEM_TYPE_CONTAINER);
 
     memset(map, 0, sizeof(fe_map_t)); // Harita yapısını sıfırla
@@ -275,73 +423,71 @@ bool fe_map_set(fe_map_t* map, const void* key, size_t key_size, const void* val
         return false;
     }
 
+    // Artımlı yeniden boyutlandırma sürüyorsa sınırlı sayıda kovayı taşı
+    if (map->old_buckets) {
+        fe_map_migrate_buckets(map, FE_MAP_REHASH_BUCKETS_PER_OP);
+    }
+
     // Yük faktörünü kontrol et ve gerekiyorsa yeniden boyutlandır
     if ((float)(map->size + 1) / map->capacity > map->load_factor_threshold) {
-        if (!fe_map_resize(map)) {
+        if (!fe_map_resize(map, map->capacity * 2, map->incremental_resize)) {
             FE_LOG_ERROR("fe_map_set: Failed to resize map during insertion.");
             return false; // Yeniden boyutlandırma hatası
         }
     }
 
-    uint64_t key_hash = map->hash_key_cb(key, key_size);
-    size_t bucket_index = key_hash % map->capacity;
+    uint64_t key_hash = fe_map_hash_key(map, key, key_size);
 
-    fe_list_t* bucket = &map->buckets[bucket_index];
+    // Mevcut anahtar varsa (yeni veya eski tabloda) değerini güncelle
+    fe_list_node_t* existing_node = fe_map_find_node(map, key, key_hash, NULL, NULL);
+    if (existing_node) {
+        fe_map_entry_t* existing_entry = (fe_map_entry_t*)existing_node->data;
+        // Anahtar bulundu, değeri güncelle
+        FE_LOG_DEBUG("fe_map_set: Updating existing key. Key Hash: %llu", key_hash);
 
-    // Kovayı dolaş, mevcut anahtar varsa değerini güncelle
-    fe_list_node_t* current_node = fe_list_get_iterator(bucket);
-    while (current_node) {
-        fe_map_entry_t* existing_entry = (fe_map_entry_t*)current_node->data;
-        if (existing_entry->key_hash == key_hash &&
-            map->compare_key_cb(existing_entry->key, key) == 0) {
-            // Anahtar bulundu, değeri güncelle
-            FE_LOG_DEBUG("fe_map_set: Updating existing key. Key Hash: %llu", key_hash);
-            
-            // Eski değeri serbest bırak (eğer free_value_cb varsa)
-            if (existing_entry->value) {
-                if (map->free_value_cb) {
-                    map->free_value_cb(existing_entry->value);
-                } else {
-                    FE_FREE(existing_entry->value, FE_MEM_TYPE_CONTAINER);
-                }
+        // Eski değeri serbest bırak (eğer free_value_cb varsa)
+        if (existing_entry->value) {
+            if (map->free_value_cb) {
+                map->free_value_cb(existing_entry->value);
+            } else {
+                FE_FREE(existing_entry->value, FE_MEM_TYPE_CONTAINER);
             }
-            
-            // Yeni değeri kopyala
-            existing_entry->value = FE_MALLOC(value_size, FE_MEM_TYPE_CONTAINER);
-            if (!existing_entry->value) {
-                FE_LOG_ERROR("fe_map_set: Failed to reallocate memory for updated value.");
+        }
+
+        // Yeni değeri kopyala
+        existing_entry->value = FE_MALLOC(value_size, FE_MEM_TYPE_CONTAINER);
+        if (!existing_entry->value) {
+            FE_LOG_ERROR("fe_map_set: Failed to reallocate memory for updated value.");
+            return false;
+        }
+        if (map->copy_value_cb) {
+            if (!map->copy_value_cb(existing_entry->value, value, value_size)) {
+                FE_LOG_ERROR("fe_map_set: Custom value copy failed for update.");
+                FE_FREE(existing_entry->value, FE_MEM_TYPE_CONTAINER);
                 return false;
             }
-            if (map->copy_value_cb) {
-                if (!map->copy_value_cb(existing_entry->value, value, value_size)) {
-                    FE_LOG_ERROR("fe_map_set: Custom value copy failed for update.");
-                    FE_FREE(existing_entry->value, FE_MEM_TYPE_CONTAINER);
-                    return false;
-                }
-            } else {
-                memcpy(existing_entry->value, value, value_size);
-            }
-            existing_entry->value_size = value_size;
-            return true;
+        } else {
+            memcpy(existing_entry->value, value, value_size);
         }
-        current_node = current_node->next;
+        existing_entry->value_size = value_size;
+        return true;
     }
 
-    // Anahtar bulunamadı, yeni bir giriş ekle
+    // Anahtar bulunamadı, yeni bir giriş ekle (her zaman yeni tabloya)
     fe_map_entry_t* new_entry = fe_map_create_entry(key, key_size, value, value_size, key_hash, map->copy_key_cb, map->copy_value_cb);
     if (!new_entry) {
         return false;
     }
 
-    // Entry'yi kovadaki listeye ekle.
-    // fe_list'in dahili copy_cb'si (bizim fe_map_create_entry'mizin tersine)
-    // fe_map_entry_t* adresini kopyalayacak, kendisini değil. Bu yüzden fe_list_append'e NULL veriyoruz.
-    if (!fe_list_append(bucket, new_entry, sizeof(fe_map_entry_t*))) { // fe_map_entry_t*'nin boyutu
+    fe_list_t* bucket = &map->buckets[key_hash % map->capacity];
+
+    // Entry'yi kovadaki listeye bağla (entry kopyalanmaz, düğüm doğrudan onu işaret eder)
+    if (!fe_map_link_entry(bucket, new_entry)) {
         FE_LOG_ERROR("fe_map_set: Failed to append entry to bucket list.");
         fe_map_destroy_entry(new_entry, map->free_key_cb, map->free_value_cb); // Başarısız olursa serbest bırak
         return false;
     }
-    
+
     map->size++;
     FE_LOG_DEBUG("fe_map_set: Added new entry. Total size: %zu, Capacity: %zu", map->size, map->capacity);
     return true;
@@ -356,26 +502,18 @@ bool fe_map_get(const fe_map_t* map, const void* key, size_t key_size, void** ou
         return false; // Harita boş
     }
 
-    uint64_t key_hash = map->hash_key_cb(key, key_size);
-    size_t bucket_index = key_hash % map->capacity;
-
-    fe_list_t* bucket = &map->buckets[bucket_index];
-    fe_list_node_t* current_node = fe_list_get_iterator(bucket);
-
-    while (current_node) {
-        fe_map_entry_t* entry = (fe_map_entry_t*)current_node->data;
-        if (entry->key_hash == key_hash &&
-            map->compare_key_cb(entry->key, key) == 0) {
-            // Anahtar bulundu
-            if (out_value) {
-                *out_value = entry->value; // Doğrudan değeri döndür, kullanıcı bunu kopyalamalı veya kullanmalı
-            }
-            if (out_value_size) {
-                *out_value_size = entry->value_size;
-            }
-            return true;
+    uint64_t key_hash = fe_map_hash_key(map, key, key_size);
+    fe_list_node_t* node = fe_map_find_node(map, key, key_hash, NULL, NULL);
+    if (node) {
+        fe_map_entry_t* entry = (fe_map_entry_t*)node->data;
+        // Anahtar bulundu
+        if (out_value) {
+            *out_value = entry->value; // Doğrudan değeri döndür, kullanıcı bunu kopyalamalı veya kullanmalı
         }
-        current_node = current_node->next;
+        if (out_value_size) {
+            *out_value_size = entry->value_size;
+        }
+        return true;
     }
     FE_LOG_DEBUG("fe_map_get: Key not found. Key Hash: %llu", key_hash);
     return false; // Anahtar bulunamadı
@@ -387,52 +525,36 @@ bool fe_map_remove(fe_map_t* map, const void* key, size_t key_size) {
         return false;
     }
 
-    uint64_t key_hash = map->hash_key_cb(key, key_size);
-    size_t bucket_index = key_hash % map->capacity;
+    // Artımlı yeniden boyutlandırma sürüyorsa sınırlı sayıda kovayı taşı
+    if (map->old_buckets) {
+        fe_map_migrate_buckets(map, FE_MAP_REHASH_BUCKETS_PER_OP);
+    }
+
+    uint64_t key_hash = fe_map_hash_key(map, key, key_size);
 
-    fe_list_t* bucket = &map->buckets[bucket_index];
-    
-    fe_list_node_t* current_node = fe_list_get_iterator(bucket);
+    fe_list_t* bucket = NULL;
     fe_list_node_t* prev_node = NULL;
-    int index_in_bucket = 0; // Kovadaki pozisyonu bulmak için
+    fe_list_node_t* current_node = fe_map_find_node(map, key, key_hash, &bucket, &prev_node);
+    if (!current_node) {
+        FE_LOG_WARN("fe_map_remove: Key not found for removal. Key Hash: %llu", key_hash);
+        return false; // Anahtar bulunamadı
+    }
 
-    while (current_node) {
-        fe_map_entry_t* entry_to_check = (fe_map_entry_t*)current_node->data;
-        if (entry_to_check->key_hash == key_hash &&
-            map->compare_key_cb(entry_to_check->key, key) == 0) {
-            // Anahtar bulundu, kaldır
-            fe_map_destroy_entry(entry_to_check, map->free_key_cb, map->free_value_cb);
-            
-            // fe_list'ten düğümü kaldır
-            // fe_list_remove_at fonksiyonu, düğüm verisinin serbest bırakılmasını yönetir.
-            // Ancak biz entry'yi zaten serbest bıraktık. Bu yüzden fe_list_remove_at'in
-            // düğüm verisini serbest bırakmasını engelleyecek şekilde NULL free_cb ile başlatmıştık listeyi.
-            // Bu kısım, fe_list implementasyonunun nasıl yapıldığına bağlı olarak kritik.
-            // Eğer fe_list_remove_at çağrıldığında, içindeki fe_list_destroy_node
-            // kendi data_free_cb'ini çağırıyorsa ve bu NULL ise, sorun yok.
-            // Eğer doğrudan FE_FREE(node->data) yapıyorsa, zaten bizim fe_map_entry_t*'mizi serbest bırakmış oluruz.
-            // En güvenlisi, fe_list_remove_at'in bir void* döndürüp dışarıda serbest bırakmaya izin vermesidir.
-            // Mevcut fe_list_remove_at bool döndürdüğü için, biz burada destroy'u yaptık ve şimdi listeyi manipüle edeceğiz.
-            
-            if (prev_node) {
-                prev_node->next = current_node->next;
-            } else {
-                bucket->head = current_node->next;
-            }
-            FE_FREE(current_node, FE_MEM_TYPE_CONTAINER); // Düğümün kendisini serbest bırak
-            bucket->size--; // Kovadaki liste boyutunu güncelle
-            
-            map->size--; // Haritadaki toplam eleman sayısını güncelle
-            FE_LOG_DEBUG("fe_map_remove: Key removed. New map size: %zu", map->size);
-            return true;
-        }
-        prev_node = current_node;
-        current_node = current_node->next;
-        index_in_bucket++;
+    // Anahtar bulundu, kaldır. Entry'yi kendimiz serbest bırakıyoruz; kova listeleri NULL free_cb
+    // ile başlatıldığı için düğüm bağlantısını doğrudan değiştirip sadece düğümü serbest bırakıyoruz.
+    fe_map_destroy_entry((fe_map_entry_t*)current_node->data, map->free_key_cb, map->free_value_cb);
+
+    if (prev_node) {
+        prev_node->next = current_node->next;
+    } else {
+        bucket->head = current_node->next;
     }
+    FE_FREE(current_node, FE_MEM_TYPE_CONTAINER); // Düğümün kendisini serbest bırak
+    bucket->size--; // Kovadaki liste boyutunu güncelle
 
-    FE_LOG_WARN("fe_map_remove: Key not found for removal. Key Hash: %llu", key_hash);
-    return false; // Anahtar bulunamadı
+    map->size--; // Haritadaki toplam eleman sayısını güncelle
+    FE_LOG_DEBUG("fe_map_remove: Key removed. New map size: %zu", map->size);
+    return true;
 }
 
 bool fe_map_contains(const fe_map_t* map, const void* key, size_t key_size) {
@@ -449,18 +571,34 @@ bool fe_map_is_empty(const fe_map_t* map) {
     return map ? (map->size == 0) : true;
 }
 
-void fe_map_clear(fe_map_t* map) {
-    if (!map) return;
-
-    for (size_t i = 0; i < map->capacity; ++i) {
-        fe_list_t* bucket = &map->buckets[i];
+/**
+ * @brief Bir kova dizisindeki tüm girişleri ve düğümleri serbest bırakır.
+ */
+static void fe_map_clear_buckets(fe_map_t* map, fe_list_t* buckets, size_t capacity) {
+    for (size_t i = 0; i < capacity; ++i) {
+        fe_list_t* bucket = &buckets[i];
         fe_list_node_t* current_node = fe_list_get_iterator(bucket);
         while (current_node) {
-            fe_map_entry_t* entry = (fe_map_entry_t*)current_node->data;
-            fe_map_destroy_entry(entry, map->free_key_cb, map->free_value_cb);
-            current_node = current_node->next; // Bir sonraki düğüme geçmeden önce entry'yi serbest bıraktık
+            fe_list_node_t* next_node = current_node->next;
+            fe_map_destroy_entry((fe_map_entry_t*)current_node->data, map->free_key_cb, map->free_value_cb);
+            FE_FREE(current_node, FE_MEM_TYPE_CONTAINER); // Düğümün data'sı entry'dir, zaten serbest bırakıldı
+            current_node = next_node;
         }
-        fe_list_clear(bucket); // Sadece düğümleri serbest bırakır (data serbest bırakılmaz, çünkü zaten biz hallettik)
+        bucket->head = NULL;
+        bucket->size = 0;
+    }
+}
+
+void fe_map_clear(fe_map_t* map) {
+    if (!map) return;
+
+    fe_map_clear_buckets(map, map->buckets, map->capacity);
+    if (map->old_buckets) {
+        fe_map_clear_buckets(map, map->old_buckets, map->old_capacity);
+        FE_FREE(map->old_buckets, FE_MEM_TYPE_CONTAINER);
+        map->old_buckets = NULL;
+        map->old_capacity = 0;
+        map->rehash_index = 0;
     }
     map->size = 0;
     FE_LOG_DEBUG("Map cleared. Size: %zu", map->size);
@@ -472,86 +610,18 @@ void fe_map_for_each(const fe_map_t* map, fe_map_iter_callback callback) {
         return;
     }
 
-    for (size_t i = 0; i < map->capacity; ++i) {
-        fe_list_t* bucket = &map->buckets[i];
-        fe_list_node_t* current_node = fe_list_get_iterator(bucket);
-        while (current_node) {
-            fe_map_entry_t* entry = (fe_map_entry_t*)current_node->data;
-            callback(entry->key, entry->key_size, entry->value, entry->value_size);
-            current_node = current_node->next;
-        }
-    }
-}
-
-
-// --- Rehashing için yeniden gözden geçirilmiş ve daha güvenli fe_map_resize ---
-static bool fe_map_resize(fe_map_t* map) {
-    if (!map) return false;
-
-    size_t old_capacity = map->capacity;
-    size_t new_capacity = old_capacity * 2; // Basitçe kapasiteyi ikiye katla
-    if (new_capacity < 8) new_capacity = 8; // Minimum kapasiteyi koru
-
-    FE_LOG_INFO("Resizing map from %zu to %zu capacity.", old_capacity, new_capacity);
-
-    fe_list_t* new_buckets = FE_MALLOC(sizeof(fe_list_t) * new_capacity, FE_MEM_TYPE_CONTAINER);
-    if (!new_buckets) {
-        FE_LOG_ERROR("fe_map_resize: Failed to allocate new buckets array.");
-        return false;
-    }
+    for (int table = 0; table < 2; ++table) {
+        const fe_list_t* buckets = (table == 0) ? map->buckets : map->old_buckets;
+        size_t capacity = (table == 0) ? map->capacity : map->old_capacity;
+        if (!buckets) continue;
 
-    // Yeni kovaları başlat, liste düğüm verisini serbest bırakmayacak şekilde
-    for (size_t i = 0; i < new_capacity; ++i) {
-        if (!fe_list_init(&new_buckets[i], NULL, NULL, NULL)) { 
-            FE_LOG_ERROR("fe_map_resize: Failed to initialize new bucket list at index %zu.", i);
-            // Hata durumunda önceden tahsis edilen yeni kovaları temizle
-            for (size_t j = 0; j < i; ++j) {
-                fe_list_shutdown(&new_buckets[j]);
+        for (size_t i = 0; i < capacity; ++i) {
+            fe_list_node_t* current_node = fe_list_get_iterator(&buckets[i]);
+            while (current_node) {
+                fe_map_entry_t* entry = (fe_map_entry_t*)current_node->data;
+                callback(entry->key, entry->key_size, entry->value, entry->value_size);
+                current_node = current_node->next;
             }
-            FE_FREE(new_buckets, FE_MEM_TYPE_CONTAINER);
-            return false;
-        }
-    }
-
-    // Mevcut elemanları yeni kovalara taşı (rehashing)
-    // Bu işlem sırasında, fe_map_entry_t'lerin kendileri yeniden tahsis edilmez, sadece listeler arası taşınır.
-    size_t rehashed_count = 0;
-    for (size_t i = 0; i < old_capacity; ++i) {
-        // Eski kova listesinin başına ve sonuna referanslar alıyoruz
-        fe_list_node_t* current_node = map->buckets[i].head;
-        map->buckets[i].head = NULL; // Eski kovayı boşalt
-        map->buckets[i].size = 0; // Eski kovanın boyutunu sıfırla
-
-        while (current_node) {
-            fe_map_entry_t* entry = (fe_map_entry_t*)current_node->data;
-            size_t new_index = entry->key_hash % new_capacity;
-
-            // Düğümü eski listeden ayır
-            fe_list_node_t* next_old_node = current_node->next;
-            current_node->next = NULL; // Düğümü bağımsız yap
-
-            // Düğümü doğrudan yeni kova listesinin başına ekle (en hızlı)
-            current_node->next = new_buckets[new_index].head;
-            new_buckets[new_index].head = current_node;
-            new_buckets[new_index].size++;
-            
-            current_node = next_old_node;
-            rehashed_count++;
         }
     }
-
-    // Eski kova dizisini serbest bırak
-    for (size_t i = 0; i < old_capacity; ++i) {
-        // Zaten listeleri boşalttık, sadece liste başlıklarını free ediyoruz.
-        // Aslında fe_list_shutdown'ı burada çağırmaya gerek yok, çünkü head'i NULL yaptık.
-        // Ama yine de güvenlik için çağrılabilir, zaten boş olduğu için bir şey yapmaz.
-        fe_list_shutdown(&map->buckets[i]); 
-    }
-    FE_FREE(map->buckets, FE_MEM_TYPE_CONTAINER);
-
-    map->buckets = new_buckets;
-    map->capacity = new_capacity;
-    
-    FE_LOG_INFO("Map resized successfully. Total rehashed entries: %zu", rehashed_count);
-    return true;
 }
@@ -0,0 +1,118 @@
+#include "core/containers/fe_ring_queue.h"
+#include "core/memory/fe_memory_manager.h" // FE_MALLOC, FE_FREE için
+#include "core/utils/fe_logger.h"          // Loglama için
+
+#include <string.h> // memset için
+
+// --- Yardımcı Fonksiyonlar ---
+
+/**
+ * @brief Kapasiteyi 2'nin kuvvetine yukarı yuvarlar (en az 2). Taşma olursa 0 döndürür.
+ */
+static size_t fe_ring_queue_round_capacity(size_t capacity) {
+    size_t rounded = 2;
+    while (rounded < capacity) {
+        if (rounded > ((size_t)-1 >> 1)) {
+            return 0;
+        }
+        rounded <<= 1;
+    }
+    return rounded;
+}
+
+// --- SPSC Kuyruk ---
+
+bool fe_spsc_queue_init(fe_spsc_queue_t* queue, size_t capacity, size_t element_size) {
+    if (!queue || element_size == 0) {
+        FE_LOG_ERROR("fe_spsc_queue_init: Invalid queue or zero element size.");
+        return false;
+    }
+    memset(queue, 0, sizeof(fe_spsc_queue_t));
+
+    size_t rounded = fe_ring_queue_round_capacity(capacity);
+    if (rounded == 0 || rounded > (size_t)-1 / element_size) {
+        FE_LOG_ERROR("fe_spsc_queue_init: Capacity %zu with element size %zu is too large.", capacity, element_size);
+        return false;
+    }
+
+    queue->buffer = (uint8_t*)FE_MALLOC(rounded * element_size, FE_MEM_TYPE_CONTAINER);
+    if (!queue->buffer) {
+        FE_LOG_ERROR("fe_spsc_queue_init: Failed to allocate %zu bytes for ring buffer.", rounded * element_size);
+        return false;
+    }
+    queue->capacity = rounded;
+    queue->mask = rounded - 1;
+    queue->element_size = element_size;
+
+    FE_LOG_DEBUG("SPSC queue initialized (capacity: %zu, element size: %zu).", rounded, element_size);
+    return true;
+}
+
+void fe_spsc_queue_shutdown(fe_spsc_queue_t* queue) {
+    if (!queue) return;
+    if (queue->buffer) {
+        FE_FREE(queue->buffer, FE_MEM_TYPE_CONTAINER);
+    }
+    memset(queue, 0, sizeof(fe_spsc_queue_t));
+}
+
+size_t fe_spsc_queue_size_approx(const fe_spsc_queue_t* queue) {
+    if (!queue) return 0;
+    // Önce head okunur: tail ondan sonra okunduğu için fark hiçbir zaman negatif olmaz.
+    size_t head = fe_atomic_load_size(&queue->head, FE_ATOMIC_ACQUIRE);
+    size_t tail = fe_atomic_load_size(&queue->tail, FE_ATOMIC_ACQUIRE);
+    return tail - head;
+}
+
+// --- MPMC Kuyruk ---
+
+bool fe_mpmc_queue_init(fe_mpmc_queue_t* queue, size_t capacity, size_t element_size) {
+    if (!queue || element_size == 0) {
+        FE_LOG_ERROR("fe_mpmc_queue_init: Invalid queue or zero element size.");
+        return false;
+    }
+    memset(queue, 0, sizeof(fe_mpmc_queue_t));
+
+    size_t rounded = fe_ring_queue_round_capacity(capacity);
+    // Hücre: sıra numarası + eleman, bir sonraki hücrenin sıra numarası hizalı kalacak şekilde yuvarlanır.
+    size_t stride = sizeof(size_t) + ((element_size + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1));
+    if (rounded == 0 || stride < element_size || rounded > (size_t)-1 / stride) {
+        FE_LOG_ERROR("fe_mpmc_queue_init: Capacity %zu with element size %zu is too large.", capacity, element_size);
+        return false;
+    }
+
+    queue->cells = (uint8_t*)FE_MALLOC(rounded * stride, FE_MEM_TYPE_CONTAINER);
+    if (!queue->cells) {
+        FE_LOG_ERROR("fe_mpmc_queue_init: Failed to allocate %zu bytes for queue cells.", rounded * stride);
+        return false;
+    }
+    for (size_t i = 0; i < rounded; ++i) {
+        *(size_t*)(queue->cells + i * stride) = i;
+    }
+    queue->capacity = rounded;
+    queue->mask = rounded - 1;
+    queue->element_size = element_size;
+    queue->cell_stride = stride;
+
+    FE_LOG_DEBUG("MPMC queue initialized (capacity: %zu, element size: %zu).", rounded, element_size);
+    return true;
+}
+
+void fe_mpmc_queue_shutdown(fe_mpmc_queue_t* queue) {
+    if (!queue) return;
+    if (queue->cells) {
+        FE_FREE(queue->cells, FE_MEM_TYPE_CONTAINER);
+    }
+    memset(queue, 0, sizeof(fe_mpmc_queue_t));
+}
+
+size_t fe_mpmc_queue_size_approx(const fe_mpmc_queue_t* queue) {
+    if (!queue) return 0;
+    size_t dequeue = fe_atomic_load_size(&queue->dequeue_pos, FE_ATOMIC_ACQUIRE);
+    size_t enqueue = fe_atomic_load_size(&queue->enqueue_pos, FE_ATOMIC_ACQUIRE);
+    // Rezerve edilip henüz yazılmamış/okunmamış hücreler nedeniyle fark kısa süreliğine
+    // kapasiteyi aşabilir veya negatif olabilir; sınırlar içine kıstırılır.
+    if (enqueue <= dequeue) return 0;
+    size_t size = enqueue - dequeue;
+    return size > queue->capacity ? queue->capacity : size;
+}
@@ -0,0 +1,392 @@
+#include "core/containers/fe_sort.h"
+#include "core/memory/fe_memory_manager.h" // FE_MALLOC, FE_FREE için
+#include "core/utils/fe_logger.h"          // Loglama için
+
+#include "core/jobs/fe_job_system.h"      // Paralel sıralama görevleri için
+
+#include <string.h> // memcpy, memmove, memset için
+
+// --- Radix Sort ---
+
+#define FE_SORT_RADIX_BITS    8
+#define FE_SORT_RADIX_BUCKETS (1u << FE_SORT_RADIX_BITS)
+#define FE_SORT_RADIX_MASK    (FE_SORT_RADIX_BUCKETS - 1u)
+
+size_t fe_sort_radix_u32_scratch_size(size_t count, bool with_payloads) {
+    return count * (sizeof(uint32_t) + (with_payloads ? sizeof(uint32_t) : 0));
+}
+
+size_t fe_sort_radix_u64_scratch_size(size_t count, bool with_payloads) {
+    return count * (sizeof(uint64_t) + (with_payloads ? sizeof(uint32_t) : 0));
+}
+
+/**
+ * @brief Anahtar tipi ve geçiş sayısı için radix sort gövdesini üretir.
+ * Küçük dizilerde kararlı eklemeli sıralama kullanılır. Tüm histogramlar tek okumada çıkarılır;
+ * tüm elemanların aynı basamağa düştüğü geçişler (histogramda tek dolu kova) atlanır.
+ */
+#define FE_SORT_DEFINE_RADIX(suffix, key_t, pass_count) \
+    static void fe_sort_insertion_##suffix(key_t* keys, uint32_t* payloads, size_t count) { \
+        for (size_t i = 1; i < count; ++i) { \
+            key_t key = keys[i]; \
+            size_t j = i; \
+            if (payloads) { \
+                uint32_t payload = payloads[i]; \
+                while (j > 0 && keys[j - 1] > key) { keys[j] = keys[j - 1]; payloads[j] = payloads[j - 1]; --j; } \
+                keys[j] = key; payloads[j] = payload; \
+            } else { \
+                while (j > 0 && keys[j - 1] > key) { keys[j] = keys[j - 1]; --j; } \
+                keys[j] = key; \
+            } \
+        } \
+    } \
+    \
+    bool fe_sort_radix_##suffix(key_t* keys, uint32_t* payloads, size_t count, void* scratch) { \
+        if (!keys) return false; \
+        if (count < 2) return true; \
+        if (count < FE_SORT_SMALL_THRESHOLD) { \
+            fe_sort_insertion_##suffix(keys, payloads, count); \
+            return true; \
+        } \
+        \
+        void* owned_scratch = NULL; \
+        if (!scratch) { \
+            size_t scratch_size = fe_sort_radix_##suffix##_scratch_size(count, payloads != NULL); \
+            owned_scratch = FE_MALLOC(scratch_size, FE_MEM_TYPE_TEMP); \
+            if (!owned_scratch) { \
+                FE_LOG_ERROR("fe_sort_radix_" #suffix ": Failed to allocate %zu bytes of scratch.", scratch_size); \
+                return false; \
+            } \
+            scratch = owned_scratch; \
+        } \
+        \
+        size_t histograms[pass_count][FE_SORT_RADIX_BUCKETS]; \
+        memset(histograms, 0, sizeof(histograms)); \
+        for (size_t i = 0; i < count; ++i) { \
+            key_t key = keys[i]; \
+            for (unsigned pass = 0; pass < (pass_count); ++pass) { \
+                histograms[pass][(key >> (pass * FE_SORT_RADIX_BITS)) & FE_SORT_RADIX_MASK]++; \
+            } \
+        } \
+        \
+        key_t* src_keys = keys; \
+        key_t* dst_keys = (key_t*)scratch; \
+        uint32_t* src_payloads = payloads; \
+        uint32_t* dst_payloads = payloads ? (uint32_t*)(dst_keys + count) : NULL; \
+        \
+        for (unsigned pass = 0; pass < (pass_count); ++pass) { \
+            unsigned shift = pass * FE_SORT_RADIX_BITS; \
+            size_t* histogram = histograms[pass]; \
+            if (histogram[(src_keys[0] >> shift) & FE_SORT_RADIX_MASK] == count) { \
+                continue; /* Bu basamak tüm anahtarlarda aynı */ \
+            } \
+            size_t offset = 0; \
+            for (unsigned bucket = 0; bucket < FE_SORT_RADIX_BUCKETS; ++bucket) { \
+                size_t bucket_count = histogram[bucket]; \
+                histogram[bucket] = offset; \
+                offset += bucket_count; \
+            } \
+            if (src_payloads) { \
+                for (size_t i = 0; i < count; ++i) { \
+                    key_t key = src_keys[i]; \
+                    size_t pos = histogram[(key >> shift) & FE_SORT_RADIX_MASK]++; \
+                    dst_keys[pos] = key; \
+                    dst_payloads[pos] = src_payloads[i]; \
+                } \
+            } else { \
+                for (size_t i = 0; i < count; ++i) { \
+                    key_t key = src_keys[i]; \
+                    dst_keys[histogram[(key >> shift) & FE_SORT_RADIX_MASK]++] = key; \
+                } \
+            } \
+            key_t* swap_keys = src_keys; src_keys = dst_keys; dst_keys = swap_keys; \
+            uint32_t* swap_payloads = src_payloads; src_payloads = dst_payloads; dst_payloads = swap_payloads; \
+        } \
+        \
+        /* Tek sayıda geçiş yapıldıysa sonuç geçici tampondadır */ \
+        if (src_keys != keys) { \
+            memcpy(keys, src_keys, count * sizeof(key_t)); \
+            if (payloads) memcpy(payloads, src_payloads, count * sizeof(uint32_t)); \
+        } \
+        \
+        if (owned_scratch) FE_FREE(owned_scratch, FE_MEM_TYPE_TEMP); \
+        return true; \
+    }
+
+FE_SORT_DEFINE_RADIX(u32, uint32_t, 4)
+FE_SORT_DEFINE_RADIX(u64, uint64_t, 8)
+
+// --- Birleştirmeli Sıralama ---
+
+// Eklemeli sıralama ile oluşturulan başlangıç koşularının uzunluğu.
+#define FE_SORT_MERGE_RUN_LENGTH 32
+
+// Sık kullanılan eleman boyutlarında memcpy çağrısı yerine doğrudan kopyalama yapılır.
+static inline void fe_sort_copy_element(void* dest, const void* src, size_t element_size) {
+    switch (element_size) {
+        case 4:  memcpy(dest, src, 4); break;
+        case 8:  memcpy(dest, src, 8); break;
+        case 16: memcpy(dest, src, 16); break;
+        default: memcpy(dest, src, element_size); break;
+    }
+}
+
+#define FE_SORT_AT(base, index, element_size) ((char*)(base) + (size_t)(index) * (element_size))
+
+/**
+ * @brief Kararlı eklemeli sıralama. hold, bir elemanlık geçici alandır.
+ */
+static void fe_sort_insertion_generic(char* base, size_t count, size_t element_size, fe_compare_func compare, char* hold) {
+    for (size_t i = 1; i < count; ++i) {
+        char* current = FE_SORT_AT(base, i, element_size);
+        if (compare(current - element_size, current) <= 0) continue;
+
+        fe_sort_copy_element(hold, current, element_size);
+        size_t j = i - 1;
+        while (j > 0 && compare(FE_SORT_AT(base, j - 1, element_size), hold) > 0) {
+            --j;
+        }
+        memmove(FE_SORT_AT(base, j + 1, element_size), FE_SORT_AT(base, j, element_size), (i - j) * element_size);
+        fe_sort_copy_element(FE_SORT_AT(base, j, element_size), hold, element_size);
+    }
+}
+
+/**
+ * @brief İki sıralı diziyi dest'e kararlı olarak birleştirir (eşitlikte a'dan alınır).
+ */
+static void fe_sort_merge_runs(const char* a, size_t a_count, const char* b, size_t b_count,
+                               char* dest, size_t element_size, fe_compare_func compare) {
+    const char* a_end = a + a_count * element_size;
+    const char* b_end = b + b_count * element_size;
+
+    // Koşular zaten sıralıysa (sık görülen durum) eleman eleman karşılaştırma yapma
+    if (a_count == 0 || b_count == 0 || compare(a_end - element_size, b) <= 0) {
+        memcpy(dest, a, a_count * element_size);
+        memcpy(dest + a_count * element_size, b, b_count * element_size);
+        return;
+    }
+
+    while (a < a_end && b < b_end) {
+        if (compare(a, b) <= 0) {
+            fe_sort_copy_element(dest, a, element_size);
+            a += element_size;
+        } else {
+            fe_sort_copy_element(dest, b, element_size);
+            b += element_size;
+        }
+        dest += element_size;
+    }
+    if (a < a_end) memcpy(dest, a, (size_t)(a_end - a));
+    if (b < b_end) memcpy(dest, b, (size_t)(b_end - b));
+}
+
+/**
+ * @brief base[0..count) aralığını tmp'yi kullanarak sıralar; sonuç base'de kalır.
+ */
+static void fe_sort_merge_range(char* base, char* tmp, size_t count, size_t element_size, fe_compare_func compare, char* hold) {
+    for (size_t start = 0; start < count; start += FE_SORT_MERGE_RUN_LENGTH) {
+        size_t run = count - start < FE_SORT_MERGE_RUN_LENGTH ? count - start : FE_SORT_MERGE_RUN_LENGTH;
+        fe_sort_insertion_generic(FE_SORT_AT(base, start, element_size), run, element_size, compare, hold);
+    }
+
+    char* src = base;
+    char* dst = tmp;
+    for (size_t width = FE_SORT_MERGE_RUN_LENGTH; width < count; width *= 2) {
+        for (size_t start = 0; start < count; start += 2 * width) {
+            size_t mid = start + width < count ? start + width : count;
+            size_t end = start + 2 * width < count ? start + 2 * width : count;
+            fe_sort_merge_runs(FE_SORT_AT(src, start, element_size), mid - start,
+                               FE_SORT_AT(src, mid, element_size), end - mid,
+                               FE_SORT_AT(dst, start, element_size), element_size, compare);
+        }
+        char* swap = src; src = dst; dst = swap;
+    }
+    if (src != base) {
+        memcpy(base, src, count * element_size);
+    }
+}
+
+bool fe_sort_merge(void* base, size_t count, size_t element_size, fe_compare_func compare) {
+    if (!base || !compare || element_size == 0) return false;
+    if (count < 2) return true;
+
+    char* scratch = (char*)FE_MALLOC((count + 1) * element_size, FE_MEM_TYPE_TEMP);
+    if (!scratch) {
+        FE_LOG_ERROR("fe_sort_merge: Failed to allocate scratch for %zu elements.", count);
+        return false;
+    }
+    fe_sort_merge_range((char*)base, scratch, count, element_size, compare, FE_SORT_AT(scratch, count, element_size));
+    FE_FREE(scratch, FE_MEM_TYPE_TEMP);
+    return true;
+}
+
+// --- Paralel Birleştirmeli Sıralama ---
+
+/**
+ * @brief Paralel sıralamanın tüm görevler tarafından paylaşılan durumu.
+ * Dizi thread_count parçaya bölünür; önce her görev kendi parçasını sıralar, ardından her
+ * turda komşu parça grupları birleştirilir. Bir grubun birleştirmesi, çıktı aralığı eşit
+ * parçalara bölünerek (merge path / co-rank) gruptaki tüm görevlere dağıtılır; böylece
+ * son turda bile tüm thread'ler çalışır. Görevler iş sisteminde çalışır.
+ */
+typedef struct fe_sort_parallel_ctx {
+    char* base;
+    char* tmp;
+    char* holds;                // Thread başına bir elemanlık geçici alan
+    size_t count;
+    size_t element_size;
+    fe_compare_func compare;
+    uint32_t thread_count;
+    size_t bounds[FE_SORT_MAX_THREADS + 1]; // Parça sınırları
+    uint32_t round;             // 0: parça sıralama, r > 0: 2^(r-1) parçalık grupların birleştirilmesi
+    const char* src;            // Birleştirme turunun kaynağı
+    char* dst;                  // Birleştirme turunun hedefi
+} fe_sort_parallel_ctx_t;
+
+typedef struct fe_sort_worker {
+    fe_sort_parallel_ctx_t* ctx;
+    uint32_t index;
+} fe_sort_worker_t;
+
+/**
+ * @brief a ve b'nin kararlı birleştirmesinin ilk k elemanına a'dan kaç eleman girdiğini bulur.
+ */
+static size_t fe_sort_co_rank(size_t k, const char* a, size_t a_count, const char* b, size_t b_count,
+                              size_t element_size, fe_compare_func compare) {
+    size_t lo = k > b_count ? k - b_count : 0;
+    size_t hi = k < a_count ? k : a_count;
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        // b[j-1] < a[i] ise a'dan i eleman almak yeterli olabilir; değilse daha fazla gerekir
+        if (compare(FE_SORT_AT(b, j - 1, element_size), FE_SORT_AT(a, i, element_size)) < 0) {
+            hi = i;
+        } else {
+            lo = i + 1;
+        }
+    }
+    return lo;
+}
+
+static void fe_sort_parallel_run_task(fe_sort_parallel_ctx_t* ctx, uint32_t index) {
+    size_t element_size = ctx->element_size;
+    char* hold = FE_SORT_AT(ctx->holds, index, element_size);
+
+    if (ctx->round == 0) {
+        size_t start = ctx->bounds[index];
+        size_t count = ctx->bounds[index + 1] - start;
+        fe_sort_merge_range(FE_SORT_AT(ctx->base, start, element_size), FE_SORT_AT(ctx->tmp, start, element_size),
+                            count, element_size, ctx->compare, hold);
+        return;
+    }
+
+    uint32_t half = 1u << (ctx->round - 1);          // Grubun sol yarısındaki parça sayısı
+    uint32_t group_first = (index / (2 * half)) * (2 * half);
+    uint32_t group_mid = group_first + half < ctx->thread_count ? group_first + half : ctx->thread_count;
+    uint32_t group_end = group_first + 2 * half < ctx->thread_count ? group_first + 2 * half : ctx->thread_count;
+    uint32_t local = index - group_first;
+    uint32_t group_threads = group_end - group_first;
+
+    size_t out_start = ctx->bounds[group_first];
+    size_t a_count = ctx->bounds[group_mid] - out_start;
+    size_t b_count = ctx->bounds[group_end] - ctx->bounds[group_mid];
+    size_t total = a_count + b_count;
+    const char* a = FE_SORT_AT(ctx->src, out_start, element_size);
+    const char* b = FE_SORT_AT(ctx->src, ctx->bounds[group_mid], element_size);
+
+    size_t k0 = total * local / group_threads;
+    size_t k1 = total * (local + 1) / group_threads;
+    size_t i0 = fe_sort_co_rank(k0, a, a_count, b, b_count, element_size, ctx->compare);
+    size_t i1 = fe_sort_co_rank(k1, a, a_count, b, b_count, element_size, ctx->compare);
+    size_t j0 = k0 - i0;
+    size_t j1 = k1 - i1;
+
+    fe_sort_merge_runs(FE_SORT_AT(a, i0, element_size), i1 - i0, FE_SORT_AT(b, j0, element_size), j1 - j0,
+                       FE_SORT_AT(ctx->dst, out_start + k0, element_size), element_size, ctx->compare);
+}
+
+static void fe_sort_parallel_job(void* user_data) {
+    fe_sort_worker_t* worker = (fe_sort_worker_t*)user_data;
+    fe_sort_parallel_run_task(worker->ctx, worker->index);
+}
+
+/**
+ * @brief Geçerli turun görevlerini iş sistemine gönderir ve bitmelerini bekler. Çağıran thread
+ * beklerken görevleri kendisi de çalıştırır. İş sistemi yoksa görevler sırayla çalıştırılır;
+ * sonuç değişmez.
+ */
+static void fe_sort_parallel_run_round(fe_sort_parallel_ctx_t* ctx) {
+    fe_sort_worker_t workers[FE_SORT_MAX_THREADS];
+    fe_job_decl_t decls[FE_SORT_MAX_THREADS];
+
+    for (uint32_t i = 0; i < ctx->thread_count; ++i) {
+        workers[i].ctx = ctx;
+        workers[i].index = i;
+        decls[i].func = fe_sort_parallel_job;
+        decls[i].user_data = &workers[i];
+        decls[i].main_thread_only = false;
+    }
+    fe_job_counter_t counter = FE_JOB_COUNTER_INIT;
+    if (fe_job_system_is_initialized() && fe_job_system_run(decls, ctx->thread_count, &counter)) {
+        fe_job_system_wait_for_counter(&counter);
+    } else {
+        for (uint32_t i = 0; i < ctx->thread_count; ++i) fe_sort_parallel_run_task(ctx, i);
+    }
+}
+
+bool fe_sort_parallel_merge(void* base, size_t count, size_t element_size, fe_compare_func compare, uint32_t thread_count) {
+    if (!base || !compare || element_size == 0) return false;
+    if (count < 2) return true;
+
+    if (thread_count == 0) {
+        thread_count = fe_job_system_is_initialized() ? fe_job_system_worker_count() + 1 : 1;
+    }
+    if (thread_count > FE_SORT_MAX_THREADS) thread_count = FE_SORT_MAX_THREADS;
+    size_t max_useful = count / FE_SORT_PARALLEL_MIN_PER_THREAD;
+    if (thread_count > max_useful) thread_count = max_useful > 0 ? (uint32_t)max_useful : 1;
+    if (thread_count <= 1) {
+        return fe_sort_merge(base, count, element_size, compare);
+    }
+
+    char* scratch = (char*)FE_MALLOC((count + thread_count) * element_size, FE_MEM_TYPE_TEMP);
+    if (!scratch) {
+        FE_LOG_ERROR("fe_sort_parallel_merge: Failed to allocate scratch for %zu elements.", count);
+        return false;
+    }
+
+    fe_sort_parallel_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.base = (char*)base;
+    ctx.tmp = scratch;
+    ctx.holds = FE_SORT_AT(scratch, count, element_size);
+    ctx.count = count;
+    ctx.element_size = element_size;
+    ctx.compare = compare;
+    ctx.thread_count = thread_count;
+    for (uint32_t i = 0; i <= thread_count; ++i) {
+        ctx.bounds[i] = count * i / thread_count;
+    }
+
+    // Tur 0: her thread kendi parçasını sıralar (sonuç base'de)
+    ctx.round = 0;
+    fe_sort_parallel_run_round(&ctx);
+
+    // Birleştirme turları: base <-> tmp arasında gidip gelir
+    const char* src = ctx.base;
+    char* dst = ctx.tmp;
+    for (uint32_t half = 1, round = 1; half < thread_count; half *= 2, ++round) {
+        ctx.round = round;
+        ctx.src = src;
+        ctx.dst = dst;
+        fe_sort_parallel_run_round(&ctx);
+        const char* next_src = dst;
+        dst = (char*)src;
+        src = next_src;
+    }
+    if (src != ctx.base) {
+        memcpy(ctx.base, src, count * element_size);
+    }
+
+    FE_FREE(scratch, FE_MEM_TYPE_TEMP);
+    return true;
+}
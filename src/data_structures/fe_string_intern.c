@@ -0,0 +1,311 @@
+#include "core/containers/fe_string_intern.h"
+#include "core/memory/fe_memory_manager.h" // FE_MALLOC, FE_FREE için
+#include "core/utils/fe_logger.h"          // Loglama için
+
+#include <string.h> // memcmp, memcpy, strlen için
+
+#ifdef _WIN32
+#include <windows.h> // SRWLOCK için
+#else
+#include <pthread.h> // pthread_rwlock_t için
+#endif
+
+// --- Dahili Sabitler ---
+#define FE_STRING_INTERN_PAGE_SIZE ((uint32_t)1 << FE_STRING_INTERN_PAGE_BITS)
+#define FE_STRING_INTERN_PAGE_MASK (FE_STRING_INTERN_PAGE_SIZE - 1)
+#define FE_STRING_INTERN_MAX_ENTRIES ((uint64_t)FE_STRING_INTERN_PAGE_SIZE * FE_STRING_INTERN_MAX_PAGES)
+#define FE_STRING_INTERN_INITIAL_SLOTS 1024
+#define FE_STRING_INTERN_ARENA_BLOCK_SIZE (64 * 1024) // String baytlarının tahsis edildiği blok boyutu
+
+/**
+ * @brief Havuzdaki tek bir string'in meta verisi. Sayfalarda tutulur ve asla taşınmaz.
+ */
+typedef struct fe_string_intern_entry {
+    const char* str;    // Arena içindeki null ile sonlanan kopya
+    uint64_t    hash;   // fe_ds_hash_fast(str, length)
+    uint32_t    length; // Bayt cinsinden uzunluk
+} fe_string_intern_entry_t;
+
+/**
+ * @brief String baytlarını tutan arena bloğu. Bloklar tek yönlü listede zincirlenir.
+ */
+typedef struct fe_string_intern_block {
+    struct fe_string_intern_block* next;
+    // Ardından string baytları gelir
+} fe_string_intern_block_t;
+
+// --- Havuz Durumu (Singleton) ---
+static struct {
+    fe_string_intern_entry_t* pages[FE_STRING_INTERN_MAX_PAGES]; // id -> giriş (id 0 ayrılmıştır)
+    uint32_t  entry_count;     // Kullanılan giriş sayısı (ayrılmış 0. giriş dahil)
+
+    uint32_t* slots;           // Açık adresleme indeksi: hash -> id (0 = boş kova)
+    uint32_t  slot_capacity;   // Kova sayısı (2'nin kuvveti)
+
+    fe_string_intern_block_t* blocks; // Arena blokları
+    char*  arena_cursor;       // Geçerli bloktaki bir sonraki boş bayt
+    size_t arena_remaining;    // Geçerli blokta kalan bayt
+} g_string_intern;
+
+#ifdef _WIN32
+static SRWLOCK g_string_intern_lock = SRWLOCK_INIT;
+#define FE_STRING_INTERN_READ_LOCK()    AcquireSRWLockShared(&g_string_intern_lock)
+#define FE_STRING_INTERN_READ_UNLOCK()  ReleaseSRWLockShared(&g_string_intern_lock)
+#define FE_STRING_INTERN_WRITE_LOCK()   AcquireSRWLockExclusive(&g_string_intern_lock)
+#define FE_STRING_INTERN_WRITE_UNLOCK() ReleaseSRWLockExclusive(&g_string_intern_lock)
+#else
+static pthread_rwlock_t g_string_intern_lock = PTHREAD_RWLOCK_INITIALIZER;
+#define FE_STRING_INTERN_READ_LOCK()    pthread_rwlock_rdlock(&g_string_intern_lock)
+#define FE_STRING_INTERN_READ_UNLOCK()  pthread_rwlock_unlock(&g_string_intern_lock)
+#define FE_STRING_INTERN_WRITE_LOCK()   pthread_rwlock_wrlock(&g_string_intern_lock)
+#define FE_STRING_INTERN_WRITE_UNLOCK() pthread_rwlock_unlock(&g_string_intern_lock)
+#endif
+
+// Geçersiz tanıtıcı için döndürülen giriş; havuz başlatılmamış olsa bile güvenlidir.
+static const fe_string_intern_entry_t g_string_intern_empty_entry = { "", 0, 0 };
+
+// --- Dahili Yardımcı Fonksiyonlar ---
+
+static inline const fe_string_intern_entry_t* fe_string_intern_entry_at(fe_string_id_t id) {
+    return &g_string_intern.pages[id >> FE_STRING_INTERN_PAGE_BITS][id & FE_STRING_INTERN_PAGE_MASK];
+}
+
+// Verilen içeriğin indeksteki kovasını bulur. Bulunursa id'yi, bulunamazsa 0 döndürür;
+// her iki durumda da out_slot son incelenen kovayı (ekleme yeri) gösterir.
+static fe_string_id_t fe_string_intern_lookup_locked(const char* str, size_t length, uint64_t hash, uint32_t* out_slot) {
+    uint32_t mask = g_string_intern.slot_capacity - 1;
+    uint32_t slot = (uint32_t)hash & mask;
+    for (;;) {
+        fe_string_id_t id = g_string_intern.slots[slot];
+        if (id == FE_STRING_ID_INVALID) {
+            if (out_slot) *out_slot = slot;
+            return FE_STRING_ID_INVALID;
+        }
+        const fe_string_intern_entry_t* entry = fe_string_intern_entry_at(id);
+        if (entry->hash == hash && entry->length == length && memcmp(entry->str, str, length) == 0) {
+            if (out_slot) *out_slot = slot;
+            return id;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+static bool fe_string_intern_grow_slots_locked(uint32_t new_capacity) {
+    uint32_t* new_slots = (uint32_t*)FE_MALLOC(sizeof(uint32_t) * new_capacity, FE_MEM_TYPE_STRING);
+    if (!new_slots) {
+        FE_LOG_ERROR("fe_string_intern: Failed to allocate index with %u slots.", new_capacity);
+        return false;
+    }
+    memset(new_slots, 0, sizeof(uint32_t) * new_capacity);
+
+    // Girişlerin hash'leri saklandığı için yeniden hashleme string'lere dokunmaz.
+    uint32_t mask = new_capacity - 1;
+    for (fe_string_id_t id = 1; id < g_string_intern.entry_count; ++id) {
+        uint32_t slot = (uint32_t)fe_string_intern_entry_at(id)->hash & mask;
+        while (new_slots[slot] != FE_STRING_ID_INVALID) {
+            slot = (slot + 1) & mask;
+        }
+        new_slots[slot] = id;
+    }
+
+    if (g_string_intern.slots) {
+        FE_FREE(g_string_intern.slots, FE_MEM_TYPE_STRING);
+    }
+    g_string_intern.slots = new_slots;
+    g_string_intern.slot_capacity = new_capacity;
+    return true;
+}
+
+static bool fe_string_intern_init_locked(void) {
+    if (g_string_intern.slots) return true;
+
+    g_string_intern.pages[0] = (fe_string_intern_entry_t*)FE_MALLOC(
+        sizeof(fe_string_intern_entry_t) * FE_STRING_INTERN_PAGE_SIZE, FE_MEM_TYPE_STRING);
+    if (!g_string_intern.pages[0]) {
+        FE_LOG_ERROR("fe_string_intern: Failed to allocate first entry page.");
+        return false;
+    }
+    g_string_intern.pages[0][0] = g_string_intern_empty_entry; // id 0 = FE_STRING_ID_INVALID
+    g_string_intern.entry_count = 1;
+
+    if (!fe_string_intern_grow_slots_locked(FE_STRING_INTERN_INITIAL_SLOTS)) {
+        FE_FREE(g_string_intern.pages[0], FE_MEM_TYPE_STRING);
+        g_string_intern.pages[0] = NULL;
+        g_string_intern.entry_count = 0;
+        return false;
+    }
+    return true;
+}
+
+// String baytlarını arenaya kopyalar. Büyük string'ler kendi bloklarını alır.
+static char* fe_string_intern_copy_locked(const char* str, size_t length) {
+    size_t needed = length + 1;
+    if (needed > g_string_intern.arena_remaining) {
+        size_t payload = needed > FE_STRING_INTERN_ARENA_BLOCK_SIZE / 4 ? needed : FE_STRING_INTERN_ARENA_BLOCK_SIZE;
+        fe_string_intern_block_t* block = (fe_string_intern_block_t*)FE_MALLOC(
+            sizeof(fe_string_intern_block_t) + payload, FE_MEM_TYPE_STRING);
+        if (!block) {
+            FE_LOG_ERROR("fe_string_intern: Failed to allocate %zu byte string block.", payload);
+            return NULL;
+        }
+        block->next = g_string_intern.blocks;
+        g_string_intern.blocks = block;
+
+        char* bytes = (char*)(block + 1);
+        if (payload != FE_STRING_INTERN_ARENA_BLOCK_SIZE) {
+            // Özel blok; geçerli arenayı değiştirme
+            memcpy(bytes, str, length);
+            bytes[length] = '\0';
+            return bytes;
+        }
+        g_string_intern.arena_cursor = bytes;
+        g_string_intern.arena_remaining = payload;
+    }
+
+    char* dest = g_string_intern.arena_cursor;
+    memcpy(dest, str, length);
+    dest[length] = '\0';
+    g_string_intern.arena_cursor += needed;
+    g_string_intern.arena_remaining -= needed;
+    return dest;
+}
+
+static fe_string_id_t fe_string_intern_insert_locked(const char* str, size_t length, uint64_t hash) {
+    if (!fe_string_intern_init_locked()) return FE_STRING_ID_INVALID;
+
+    uint32_t slot = 0;
+    fe_string_id_t existing = fe_string_intern_lookup_locked(str, length, hash, &slot);
+    if (existing != FE_STRING_ID_INVALID) return existing;
+
+    if (g_string_intern.entry_count >= FE_STRING_INTERN_MAX_ENTRIES || length > UINT32_MAX) {
+        FE_LOG_ERROR("fe_string_intern: Table full (%u entries) or string too long.", g_string_intern.entry_count);
+        return FE_STRING_ID_INVALID;
+    }
+
+    fe_string_id_t id = g_string_intern.entry_count;
+    uint32_t page = id >> FE_STRING_INTERN_PAGE_BITS;
+    if (!g_string_intern.pages[page]) {
+        g_string_intern.pages[page] = (fe_string_intern_entry_t*)FE_MALLOC(
+            sizeof(fe_string_intern_entry_t) * FE_STRING_INTERN_PAGE_SIZE, FE_MEM_TYPE_STRING);
+        if (!g_string_intern.pages[page]) {
+            FE_LOG_ERROR("fe_string_intern: Failed to allocate entry page %u.", page);
+            return FE_STRING_ID_INVALID;
+        }
+    }
+
+    char* copy = fe_string_intern_copy_locked(str, length);
+    if (!copy) return FE_STRING_ID_INVALID;
+
+    fe_string_intern_entry_t* entry = &g_string_intern.pages[page][id & FE_STRING_INTERN_PAGE_MASK];
+    entry->str = copy;
+    entry->hash = hash;
+    entry->length = (uint32_t)length;
+    g_string_intern.entry_count++;
+
+    // Yük faktörü 1/2'yi aşarsa indeksi büyüt (yeni kova yeri yeniden hesaplanır), aksi halde
+    // arama sırasında bulunan boş kovaya yaz.
+    if ((uint64_t)(g_string_intern.entry_count - 1) * 2 > g_string_intern.slot_capacity) {
+        if (!fe_string_intern_grow_slots_locked(g_string_intern.slot_capacity * 2)) {
+            g_string_intern.entry_count--;
+            return FE_STRING_ID_INVALID;
+        }
+    } else {
+        g_string_intern.slots[slot] = id;
+    }
+    return id;
+}
+
+// --- Fonksiyon Implementasyonları ---
+
+fe_string_id_t fe_string_intern_with_hash(const char* str, size_t length, uint64_t hash) {
+    if (!str) return FE_STRING_ID_INVALID;
+
+    // Çoğu çağrı zaten havuzda olan string'ler içindir; önce paylaşımlı kilitle ara.
+    fe_string_id_t id = FE_STRING_ID_INVALID;
+    FE_STRING_INTERN_READ_LOCK();
+    if (g_string_intern.slots) {
+        id = fe_string_intern_lookup_locked(str, length, hash, NULL);
+    }
+    FE_STRING_INTERN_READ_UNLOCK();
+    if (id != FE_STRING_ID_INVALID) return id;
+
+    FE_STRING_INTERN_WRITE_LOCK();
+    id = fe_string_intern_insert_locked(str, length, hash);
+    FE_STRING_INTERN_WRITE_UNLOCK();
+    return id;
+}
+
+fe_string_id_t fe_string_intern_n(const char* str, size_t length) {
+    if (!str) return FE_STRING_ID_INVALID;
+    return fe_string_intern_with_hash(str, length, fe_ds_hash_fast(str, length));
+}
+
+fe_string_id_t fe_string_intern(const char* str) {
+    if (!str) return FE_STRING_ID_INVALID;
+    return fe_string_intern_n(str, strlen(str));
+}
+
+fe_string_id_t fe_string_intern_find(const char* str) {
+    if (!str) return FE_STRING_ID_INVALID;
+    size_t length = strlen(str);
+    uint64_t hash = fe_ds_hash_fast(str, length);
+
+    fe_string_id_t id = FE_STRING_ID_INVALID;
+    FE_STRING_INTERN_READ_LOCK();
+    if (g_string_intern.slots) {
+        id = fe_string_intern_lookup_locked(str, length, hash, NULL);
+    }
+    FE_STRING_INTERN_READ_UNLOCK();
+    return id;
+}
+
+const char* fe_string_intern_c_str(fe_string_id_t id) {
+    if (id == FE_STRING_ID_INVALID) return g_string_intern_empty_entry.str;
+    return fe_string_intern_entry_at(id)->str;
+}
+
+size_t fe_string_intern_length(fe_string_id_t id) {
+    if (id == FE_STRING_ID_INVALID) return 0;
+    return fe_string_intern_entry_at(id)->length;
+}
+
+uint64_t fe_string_intern_hash(fe_string_id_t id) {
+    if (id == FE_STRING_ID_INVALID) return 0;
+    return fe_string_intern_entry_at(id)->hash;
+}
+
+size_t fe_string_intern_count(void) {
+    FE_STRING_INTERN_READ_LOCK();
+    size_t count = g_string_intern.entry_count > 0 ? g_string_intern.entry_count - 1 : 0;
+    FE_STRING_INTERN_READ_UNLOCK();
+    return count;
+}
+
+void fe_string_intern_shutdown(void) {
+    FE_STRING_INTERN_WRITE_LOCK();
+    size_t count = g_string_intern.entry_count > 0 ? g_string_intern.entry_count - 1 : 0;
+
+    for (uint32_t page = 0; page < FE_STRING_INTERN_MAX_PAGES && g_string_intern.pages[page]; ++page) {
+        FE_FREE(g_string_intern.pages[page], FE_MEM_TYPE_STRING);
+        g_string_intern.pages[page] = NULL;
+    }
+    while (g_string_intern.blocks) {
+        fe_string_intern_block_t* next = g_string_intern.blocks->next;
+        FE_FREE(g_string_intern.blocks, FE_MEM_TYPE_STRING);
+        g_string_intern.blocks = next;
+    }
+    if (g_string_intern.slots) {
+        FE_FREE(g_string_intern.slots, FE_MEM_TYPE_STRING);
+    }
+
+    g_string_intern.slots = NULL;
+    g_string_intern.slot_capacity = 0;
+    g_string_intern.entry_count = 0;
+    g_string_intern.arena_cursor = NULL;
+    g_string_intern.arena_remaining = 0;
+    FE_STRING_INTERN_WRITE_UNLOCK();
+
+    if (count > 0) {
+        FE_LOG_DEBUG("String intern table shut down (%zu strings released).", count);
+    }
+}
@@ -1,7 +1,14 @@
 #include "core/assets/fe_asset_manager.h"
 #include "core/utils/fe_logger.h"
 #include "core/memory/fe_memory_manager.h"
+#include "core/containers/fe_dynamic_array.h" // Boşaltılacak varlıkları geçici olarak toplamak için
 #include "platform/fe_platform_file.h" // Genel dosya I/O fonksiyonları için (fe_platform_file_read_binary, fe_platform_file_get_size)
+#include "platform/fe_file_cache.h"    // Aşamalı yükleyicilere dosya baytlarını vermek için
+#include "platform/fe_async_io.h"      // Asenkron yüklemelerin G/Ç aşaması için
+#include "core/jobs/fe_job_system.h"   // Asenkron yüklemelerin çözme aşaması için
+#include "core/utils/fe_atomic.h"      // Çözme işlerinin tamamlanma bayrağı için
+#include "platform/fe_thread.h"        // fe_thread_yield için
+#include "platform/fe_ddc.h"           // Pişmiş blobları çalıştırmalar arasında saklamak için
 
 #include <string.h> // strcmp, strcpy için
 #include <stdio.h>  // snprintf için
@@ -107,6 +114,295 @@ void fe_mock_model_unloader(void* asset_data, size_t data_size) {
 // Gerçekte bu bir hash tablosu veya daha sofistike bir kayıt sistemi olurdu.
 static fe_asset_loader_func   s_asset_loaders[FE_ASSET_TYPE_COUNT];
 static fe_asset_unloader_func s_asset_unloaders[FE_ASSET_TYPE_COUNT];
+// Aşamalı yükleyiciler (decode tanımlıysa s_asset_loaders yerine kullanılır)
+static fe_asset_decode_func   s_asset_decoders[FE_ASSET_TYPE_COUNT];
+static fe_asset_upload_func   s_asset_uploaders[FE_ASSET_TYPE_COUNT];
+// İsteğe bağlı pişiriciler ve pişmiş format sürümleri (yalnızca aşamalı yükleyicilerle)
+static fe_asset_cook_func     s_asset_cookers[FE_ASSET_TYPE_COUNT];
+static uint32_t               s_asset_cook_versions[FE_ASSET_TYPE_COUNT];
+
+void fe_asset_manager_register_loader(fe_asset_type_t type, fe_asset_loader_func loader_func, fe_asset_unloader_func unloader_func) {
+    if (type == FE_ASSET_TYPE_UNKNOWN || type >= FE_ASSET_TYPE_COUNT) {
+        FE_LOG_ERROR("fe_asset_manager_register_loader: Invalid asset type %d.", type);
+        return;
+    }
+    s_asset_loaders[type] = loader_func;
+    s_asset_unloaders[type] = unloader_func;
+    s_asset_decoders[type] = NULL;
+    s_asset_uploaders[type] = NULL;
+    s_asset_cookers[type] = NULL; // Tek aşamalı yükleyici dosyayı kendisi okur; pişirme uygulanamaz
+}
+
+void fe_asset_manager_register_staged_loader(fe_asset_type_t type, fe_asset_decode_func decode_func,
+                                             fe_asset_upload_func upload_func, fe_asset_unloader_func unloader_func) {
+    if (type == FE_ASSET_TYPE_UNKNOWN || type >= FE_ASSET_TYPE_COUNT || !decode_func) {
+        FE_LOG_ERROR("fe_asset_manager_register_staged_loader: Invalid asset type %d or decode function.", type);
+        return;
+    }
+    s_asset_loaders[type] = NULL;
+    s_asset_unloaders[type] = unloader_func;
+    s_asset_decoders[type] = decode_func;
+    s_asset_uploaders[type] = upload_func;
+}
+
+void fe_asset_manager_register_cooker(fe_asset_type_t type, fe_asset_cook_func cook_func, uint32_t cook_version) {
+    if (type == FE_ASSET_TYPE_UNKNOWN || type >= FE_ASSET_TYPE_COUNT || (cook_func && !s_asset_decoders[type])) {
+        FE_LOG_ERROR("fe_asset_manager_register_cooker: Invalid asset type %d or no staged loader registered.", type);
+        return;
+    }
+    s_asset_cookers[type] = cook_func;
+    s_asset_cook_versions[type] = cook_version;
+}
+
+static bool fe_asset_manager_has_loader(fe_asset_type_t type) {
+    return s_asset_loaders[type] != NULL || s_asset_decoders[type] != NULL;
+}
+
+/**
+ * @brief Dosya baytlarını tipin decode fonksiyonuna verir. Tip için pişirici kayıtlıysa decode pişmiş
+ * blobu görür; blob türetilmiş veri önbelleğinden okunur, yoksa pişirilip önbelleğe yazılır.
+ * Çağıran thread'de çalışır.
+ */
+static bool fe_asset_manager_decode_bytes(fe_asset_type_t type, const char* file_path, const uint8_t* file_data,
+                                          size_t file_size, void** data_out, size_t* size_out) {
+    fe_asset_cook_func cook_func = s_asset_cookers[type];
+    if (!cook_func) return s_asset_decoders[type](file_path, file_data, file_size, data_out, size_out);
+
+    fe_ddc_key_t key = {{0, 0}};
+    bool use_cache = fe_ddc_is_initialized();
+    if (use_cache) {
+        fe_ddc_key_builder_t builder;
+        fe_ddc_key_begin(&builder, "asset_cook", s_asset_cook_versions[type]);
+        fe_ddc_key_add_u64(&builder, (uint64_t)type);
+        fe_ddc_key_add(&builder, file_data, file_size);
+        key = fe_ddc_key_end(&builder);
+    }
+
+    void* cooked = NULL;
+    size_t cooked_size = 0;
+    if (!use_cache || !fe_ddc_get(&key, &cooked, &cooked_size)) {
+        if (!cook_func(file_path, file_data, file_size, &cooked, &cooked_size)) {
+            FE_LOG_ERROR("Failed to cook asset: %s (Type: %d)", file_path, type);
+            return false;
+        }
+        if (use_cache) fe_ddc_put(&key, cooked, cooked_size);
+    }
+    bool ok = s_asset_decoders[type](file_path, (const uint8_t*)cooked, cooked_size, data_out, size_out);
+    if (cooked) FE_FREE(cooked, FE_MEM_TYPE_GENERAL);
+    return ok;
+}
+
+/**
+ * @brief Aşamalı yükleyicinin okuma + çözme adımları; dosya önbelleği üzerinden okur.
+ * Çağıran thread'de çalışır (eşzamanlı yüklemede ana thread, asenkron yüklemede işçi).
+ */
+static bool fe_asset_manager_decode_from_file(fe_asset_type_t type, const char* file_path, void** data_out, size_t* size_out) {
+    fe_file_view_t view;
+    if (!fe_file_cache_acquire(file_path, FE_FILE_ACCESS_HINT_SEQUENTIAL, &view)) {
+        FE_LOG_ERROR("Failed to read asset file: %s", file_path);
+        return false;
+    }
+    bool ok = fe_asset_manager_decode_bytes(type, file_path, view.data, view.size, data_out, size_out);
+    fe_file_cache_release(&view);
+    return ok;
+}
+
+/**
+ * @brief Yüklenmiş veriyi bir fe_asset_t'ye sarar ve önbelleğe ekler. Başarısızlıkta veriyi boşaltır.
+ */
+static fe_asset_t* fe_asset_manager_insert_asset(fe_asset_manager_t* manager, fe_string_id_t path_id, fe_asset_type_t asset_type,
+                                                 void* loaded_data_ptr, size_t loaded_data_size) {
+    const char* file_path = fe_string_intern_c_str(path_id);
+    fe_asset_t* new_asset = FE_MALLOC(sizeof(fe_asset_t), FE_MEM_TYPE_ASSET_STRUCT);
+    if (!new_asset) {
+        FE_LOG_ERROR("Failed to allocate fe_asset_t for: %s", file_path);
+        if (s_asset_unloaders[asset_type]) { // Yüklenen veriyi boşalt
+             s_asset_unloaders[asset_type](loaded_data_ptr, loaded_data_size);
+        }
+        return NULL;
+    }
+
+    memset(new_asset, 0, sizeof(fe_asset_t));
+    new_asset->id = manager->next_asset_id++;
+    strncpy(new_asset->path, file_path, sizeof(new_asset->path) - 1);
+    new_asset->path[sizeof(new_asset->path) - 1] = '\0';
+    new_asset->path_id = path_id;
+    new_asset->type = asset_type;
+    new_asset->ref_count = 1; // İlk referans
+    new_asset->data_size = loaded_data_size;
+    new_asset->data_ptr = loaded_data_ptr;
+    fe_ilist_node_init(&new_asset->lru_node);
+
+    fe_asset_cache_map_insert(&manager->assets_cache, path_id, new_asset);
+    fe_asset_cache_stats_t* stats = &manager->type_caches[asset_type].stats;
+    stats->resident_bytes += loaded_data_size;
+    stats->resident_count++;
+
+    FE_LOG_INFO("Asset loaded and cached: %s (ID: %llu, Type: %d, Ref Count: %u)",
+                file_path, new_asset->id, new_asset->type, new_asset->ref_count);
+    return new_asset;
+}
+
+/**
+ * @brief Yolu ve kimliğiyle tutulan bir varlığı bulur: önce önbellekte, sonra tip uyumsuzluğuyla
+ * önbellekten ayrılmış varlıklarda arar. Zorla boşaltılmışsa NULL döner.
+ */
+static fe_asset_t* fe_asset_manager_find_asset(fe_asset_manager_t* manager, fe_string_id_t path_id, uint64_t asset_id) {
+    fe_asset_t** cached = fe_asset_cache_map_get(&manager->assets_cache, path_id);
+    if (cached && *cached && (*cached)->id == asset_id) return *cached;
+    FE_ILIST_FOREACH(&manager->detached, it) {
+        fe_asset_t* asset = FE_ILIST_CONTAINER_OF(it, fe_asset_t, lru_node);
+        if (asset->id == asset_id) return asset;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bir varlığın tuttuğu bağımlılık referanslarını bırakır ve diziyi serbest bırakır.
+ * Bağımlılıklar işaretçiyle değil yol + kimlikle tutulur; arada zorla boşaltılmış (ve belki
+ * yeniden yüklenmiş) bir bağımlılığın referansı bırakılmaz.
+ */
+static void fe_asset_manager_release_dependencies(fe_asset_manager_t* manager, fe_asset_dependency_t* dependencies, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_asset_t* dep = fe_asset_manager_find_asset(manager, dependencies[i].path_id, dependencies[i].asset_id);
+        if (dep) fe_asset_manager_release_asset(manager, dep);
+    }
+    if (dependencies) FE_FREE(dependencies, FE_MEM_TYPE_GENERAL);
+}
+
+/**
+ * @brief Yüklenmiş bağımlılıkları varlığa bağlar; referansların sahipliği varlığa geçer.
+ */
+static bool fe_asset_manager_attach_dependencies(fe_asset_t* asset, fe_asset_t* const* deps, uint32_t count) {
+    if (count == 0) return true;
+    asset->dependencies = (fe_asset_dependency_t*)FE_MALLOC(sizeof(fe_asset_dependency_t) * count, FE_MEM_TYPE_GENERAL);
+    if (!asset->dependencies) return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        asset->dependencies[i].path_id = deps[i]->path_id;
+        asset->dependencies[i].type = deps[i]->type;
+        asset->dependencies[i].asset_id = deps[i]->id;
+    }
+    asset->dependency_count = count;
+    return true;
+}
+
+/**
+ * @brief Varlığı boşaltır, önbellekten çıkarır ve tipin sayaçlarını günceller.
+ */
+static void fe_asset_manager_destroy_asset(fe_asset_manager_t* manager, fe_asset_t* asset) {
+    fe_asset_type_cache_t* cache = &manager->type_caches[asset->type];
+    if (asset->detached) {
+        fe_ilist_remove(&manager->detached, &asset->lru_node);
+    } else if (fe_ilist_node_is_linked(&asset->lru_node)) {
+        fe_ilist_remove(&cache->lru, &asset->lru_node);
+        cache->stats.unused_bytes -= asset->data_size;
+    }
+    cache->stats.resident_bytes -= asset->data_size;
+    cache->stats.resident_count--;
+
+    if (s_asset_unloaders[asset->type]) {
+        s_asset_unloaders[asset->type](asset->data_ptr, asset->data_size);
+    } else {
+        FE_LOG_WARN("No unloader registered for asset type %d.", asset->type);
+    }
+    // Aynı yola başka tipte yeniden yüklenmiş bir varlık varsa onun girişi korunur
+    fe_asset_t** mapped = fe_asset_cache_map_get(&manager->assets_cache, asset->path_id);
+    if (mapped && *mapped == asset) fe_asset_cache_map_remove(&manager->assets_cache, asset->path_id);
+
+    // Bağımlılık referansları varlık serbest bırakıldıktan sonra bırakılır; bırakma zinciri
+    // (LRU'ya ekleme, bütçe boşaltması) yarı silinmiş bir varlık görmez
+    fe_asset_dependency_t* dependencies = asset->dependencies;
+    uint32_t dependency_count = asset->dependency_count;
+    FE_FREE(asset, FE_MEM_TYPE_ASSET_STRUCT);
+    fe_asset_manager_release_dependencies(manager, dependencies, dependency_count);
+}
+
+/**
+ * @brief Tipin yüklü bayt toplamı bütçeye inene kadar en eski kullanılmayan varlıkları boşaltır.
+ */
+static void fe_asset_manager_evict_to_budget(fe_asset_manager_t* manager, fe_asset_type_t asset_type) {
+    fe_asset_type_cache_t* cache = &manager->type_caches[asset_type];
+    while (cache->stats.resident_bytes > cache->stats.budget_bytes || cache->stats.budget_bytes == 0) {
+        fe_ilist_node_t* oldest = fe_ilist_front(&cache->lru);
+        if (!oldest) break; // Kalanların hepsi kullanımda
+        fe_asset_t* asset = FE_ILIST_CONTAINER_OF(oldest, fe_asset_t, lru_node);
+        FE_LOG_DEBUG("Evicting unused asset: %s (ID: %llu, %zu bytes)", asset->path, asset->id, asset->data_size);
+        cache->stats.evictions++;
+        cache->stats.evicted_bytes += asset->data_size;
+        fe_asset_manager_destroy_asset(manager, asset);
+    }
+}
+
+/**
+ * @brief Önbellekteki bir varlığa ref_add referans ekler; kullanılmıyorsa LRU'dan çıkarır.
+ */
+static void fe_asset_manager_acquire_cached(fe_asset_manager_t* manager, fe_asset_t* asset, uint32_t ref_add) {
+    fe_asset_type_cache_t* cache = &manager->type_caches[asset->type];
+    if (fe_ilist_node_is_linked(&asset->lru_node)) {
+        fe_ilist_remove(&cache->lru, &asset->lru_node);
+        cache->stats.unused_bytes -= asset->data_size;
+    }
+    asset->ref_count += ref_add;
+    cache->stats.hits++;
+}
+
+/**
+ * @brief Aynı yola başka tipte bir varlık yüklenmeden önce önbellekteki varlığı yolundan çıkarır.
+ * Kullanılmıyorsa hemen boşaltılır. Kullanılıyorsa tutanların referansları geçerli kalır; varlık
+ * önbellekten ayrılır ve son referans bırakılınca LRU'ya girmeden boşaltılır.
+ */
+static void fe_asset_manager_displace_asset(fe_asset_manager_t* manager, fe_asset_t* asset) {
+    if (asset->ref_count == 0) {
+        fe_asset_manager_destroy_asset(manager, asset); // Kullanılmıyor; LRU'dan doğrudan at
+        return;
+    }
+    fe_asset_cache_map_remove(&manager->assets_cache, asset->path_id);
+    asset->detached = true;
+    fe_ilist_push_back(&manager->detached, &asset->lru_node);
+}
+
+/**
+ * @brief Eşzamanlı yüklemede alınmış bağımlılık referanslarını bırakır ve diziyi serbest bırakır.
+ */
+static void fe_asset_manager_release_loaded(fe_asset_manager_t* manager, fe_asset_t** assets, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_asset_manager_release_asset(manager, assets[i]);
+    }
+    if (assets) FE_FREE(assets, FE_MEM_TYPE_GENERAL);
+}
+
+/**
+ * @brief path_id için bildirilmiş bağımlılıkları eşzamanlı yükler (her biri kendi bağımlılıklarını
+ * özyinelemeli olarak yükler). Biri bile başarısız olursa alınan referanslar bırakılır.
+ */
+static bool fe_asset_manager_load_dependencies(fe_asset_manager_t* manager, fe_string_id_t path_id,
+                                               fe_asset_t*** out_deps, uint32_t* out_count) {
+    *out_deps = NULL;
+    *out_count = 0;
+    fe_asset_dependency_list_t** declared = fe_asset_dependency_map_get(&manager->declared_dependencies, path_id);
+    if (!declared || !*declared || (*declared)->count == 0) return true;
+
+    uint32_t count = (*declared)->count;
+    fe_asset_t** deps = (fe_asset_t**)FE_MALLOC(sizeof(fe_asset_t*) * count, FE_MEM_TYPE_GENERAL);
+    if (!deps) return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        // Bildirim listesi özyineleme sırasında değişmez, ancak harita yeniden boyutlanabilir
+        declared = fe_asset_dependency_map_get(&manager->declared_dependencies, path_id);
+        fe_asset_dependency_t dep = (*declared)->items[i];
+        deps[i] = fe_asset_manager_load_asset_by_id(manager, dep.path_id, dep.type);
+        if (!deps[i]) {
+            fe_asset_manager_release_loaded(manager, deps, i);
+            return false;
+        }
+    }
+    *out_deps = deps;
+    *out_count = count;
+    return true;
+}
+
+// Asenkron yükleme kuyruğu (dosyanın sonunda)
+static bool fe_asset_load_queue_create(fe_asset_manager_t* manager);
+static void fe_asset_load_queue_destroy(fe_asset_manager_t* manager);
 
 // --- Fonksiyon Implementasyonları ---
 
@@ -118,19 +414,33 @@ bool fe_asset_manager_init(fe_asset_manager_t* manager) {
 
     memset(manager, 0, sizeof(fe_asset_manager_t));
     manager->next_asset_id = 1; // ID'leri 1'den başlat
+    for (int i = 0; i < FE_ASSET_TYPE_COUNT; ++i) {
+        fe_ilist_init(&manager->type_caches[i].lru);
+    }
+    fe_ilist_init(&manager->detached);
 
     // Hash haritasını başlat
-    if (!FE_HASH_MAP_INIT(&manager->assets_cache, 128)) { // Başlangıç kapasitesi 128
+    if (!fe_asset_cache_map_init(&manager->assets_cache, 128)) { // Başlangıç kapasitesi 128
         FE_LOG_FATAL("Failed to initialize asset cache hash map.");
         return false;
     }
 
-    // Yükleyicileri kaydet (Mock implementasyonlar)
-    s_asset_loaders[FE_ASSET_TYPE_TEXTURE] = fe_mock_texture_loader;
-    s_asset_unloaders[FE_ASSET_TYPE_TEXTURE] = fe_mock_texture_unloader;
+    if (!fe_asset_dependency_map_init(&manager->declared_dependencies, 64)) {
+        FE_LOG_FATAL("Failed to initialize asset dependency map.");
+        fe_asset_cache_map_shutdown(&manager->assets_cache);
+        return false;
+    }
 
-    s_asset_loaders[FE_ASSET_TYPE_MODEL] = fe_mock_model_loader;
-    s_asset_unloaders[FE_ASSET_TYPE_MODEL] = fe_mock_model_unloader;
+    if (!fe_asset_load_queue_create(manager)) {
+        FE_LOG_FATAL("Failed to allocate asset load queue.");
+        fe_asset_dependency_map_shutdown(&manager->declared_dependencies);
+        fe_asset_cache_map_shutdown(&manager->assets_cache);
+        return false;
+    }
+
+    // Yükleyicileri kaydet (Mock implementasyonlar)
+    fe_asset_manager_register_loader(FE_ASSET_TYPE_TEXTURE, fe_mock_texture_loader, fe_mock_texture_unloader);
+    fe_asset_manager_register_loader(FE_ASSET_TYPE_MODEL, fe_mock_model_loader, fe_mock_model_unloader);
 
     FE_LOG_INFO("FE Asset Manager initialized.");
     return true;
@@ -143,19 +453,43 @@ void fe_asset_manager_shutdown(fe_asset_manager_t* manager) {
 
     FE_LOG_INFO("Shutting down FE Asset Manager. Unloading all assets...");
 
+    // Uçuştaki asenkron yüklemeleri iptal et; işçilerdeki çözmeler beklenir
+    fe_asset_load_queue_destroy(manager);
+
     // Tüm varlıkları tek tek boşalt
-    FE_HASH_MAP_FOREACH(&manager->assets_cache, char*, path_key, fe_asset_t*, asset_val) {
+    FE_HASH_MAP_FOREACH(&manager->assets_cache, fe_string_id_t, path_key, fe_asset_t*, asset_val) {
+        (void)path_key;
         if (asset_val) {
             FE_LOG_DEBUG("Forcibly unloading asset: %s (ID: %llu, Type: %d)", asset_val->path, asset_val->id, asset_val->type);
             if (s_asset_unloaders[asset_val->type]) {
                 s_asset_unloaders[asset_val->type](asset_val->data_ptr, asset_val->data_size);
             }
+            if (asset_val->dependencies) FE_FREE(asset_val->dependencies, FE_MEM_TYPE_GENERAL); // Hepsi zaten atılıyor
             FE_FREE(asset_val, FE_MEM_TYPE_ASSET_STRUCT); // Varlık yapısının kendisini serbest bırak
         }
     }
     
     // Hash haritasını temizle ve kapat
-    FE_HASH_MAP_SHUTDOWN(&manager->assets_cache);
+    fe_asset_cache_map_shutdown(&manager->assets_cache);
+
+    // Önbellekten ayrılmış ama hâlâ tutulan varlıklar
+    fe_ilist_node_t* node;
+    while ((node = fe_ilist_pop_front(&manager->detached)) != NULL) {
+        fe_asset_t* asset = FE_ILIST_CONTAINER_OF(node, fe_asset_t, lru_node);
+        FE_LOG_DEBUG("Forcibly unloading detached asset: %s (ID: %llu, Type: %d)", asset->path, asset->id, asset->type);
+        if (s_asset_unloaders[asset->type]) s_asset_unloaders[asset->type](asset->data_ptr, asset->data_size);
+        if (asset->dependencies) FE_FREE(asset->dependencies, FE_MEM_TYPE_GENERAL);
+        FE_FREE(asset, FE_MEM_TYPE_ASSET_STRUCT);
+    }
+
+    FE_HASH_MAP_FOREACH(&manager->declared_dependencies, fe_string_id_t, decl_key, fe_asset_dependency_list_t*, decl_list) {
+        (void)decl_key;
+        if (decl_list) {
+            FE_FREE(decl_list->items, FE_MEM_TYPE_GENERAL);
+            FE_FREE(decl_list, FE_MEM_TYPE_GENERAL);
+        }
+    }
+    fe_asset_dependency_map_shutdown(&manager->declared_dependencies);
 
     FE_LOG_INFO("FE Asset Manager shut down. All assets unloaded.");
 }
@@ -166,62 +500,83 @@ fe_asset_t* fe_asset_manager_load_asset(fe_asset_manager_t* manager, const char*
         return NULL;
     }
 
+    fe_string_id_t path_id = fe_string_intern(file_path);
+    if (path_id == FE_STRING_ID_INVALID) {
+        FE_LOG_ERROR("fe_asset_manager_load_asset: Failed to intern path: %s", file_path);
+        return NULL;
+    }
+    return fe_asset_manager_load_asset_by_id(manager, path_id, asset_type);
+}
+
+fe_asset_t* fe_asset_manager_load_asset_by_id(fe_asset_manager_t* manager, fe_string_id_t path_id, fe_asset_type_t asset_type) {
+    if (!manager || path_id == FE_STRING_ID_INVALID || asset_type == FE_ASSET_TYPE_UNKNOWN || asset_type >= FE_ASSET_TYPE_COUNT) {
+        FE_LOG_ERROR("fe_asset_manager_load_asset_by_id: Invalid parameters.");
+        return NULL;
+    }
+    const char* file_path = fe_string_intern_c_str(path_id);
+
     // 1. Önbellekte varlığı kontrol et
-    fe_asset_t** cached_asset_ptr = FE_HASH_MAP_GET(&manager->assets_cache, file_path);
+    fe_asset_t** cached_asset_ptr = fe_asset_cache_map_get(&manager->assets_cache, path_id);
     if (cached_asset_ptr && *cached_asset_ptr) {
         fe_asset_t* cached_asset = *cached_asset_ptr;
         if (cached_asset->type == asset_type) { // Tip uyumsuzluğu kontrolü
-            cached_asset->ref_count++;
+            fe_asset_manager_acquire_cached(manager, cached_asset, 1);
             FE_LOG_DEBUG("Asset already loaded: %s (Ref Count: %u)", file_path, cached_asset->ref_count);
             return cached_asset;
         } else {
             FE_LOG_WARN("Asset '%s' found in cache but with mismatched type. Requested: %d, Cached: %d. Forcing reload.",
                         file_path, asset_type, cached_asset->type);
             // Tip uyumsuzluğu varsa, mevcut varlığı boşaltıp yeniden yükleyebiliriz
-            fe_asset_manager_release_asset(manager, cached_asset); // Referans sayısını azalt, gerekirse boşalt
-            FE_HASH_MAP_REMOVE(&manager->assets_cache, file_path); // Cache'den de kaldır ki yeniden yüklenebilsin.
+            fe_asset_manager_displace_asset(manager, cached_asset);
         }
     }
 
     // 2. Yükleyici fonksiyonu bul
-    fe_asset_loader_func loader = s_asset_loaders[asset_type];
-    if (!loader) {
+    if (!fe_asset_manager_has_loader(asset_type)) {
         FE_LOG_ERROR("No loader registered for asset type: %d for file: %s", asset_type, file_path);
         return NULL;
     }
 
-    // 3. Varlığı yükle
+    // 3. Bildirilmiş bağımlılıkları önce yükle; her biri bir referansla tutulur
+    fe_asset_t** deps = NULL;
+    uint32_t dep_count = 0;
+    if (!fe_asset_manager_load_dependencies(manager, path_id, &deps, &dep_count)) {
+        FE_LOG_ERROR("Failed to load dependencies of: %s", file_path);
+        return NULL;
+    }
+
+    // 4. Varlığı yükle (aşamalı yükleyicilerde okuma, çözme ve upload burada sırayla yapılır)
+    manager->type_caches[asset_type].stats.misses++;
     void* loaded_data_ptr = NULL;
     size_t loaded_data_size = 0;
-    if (!loader(file_path, &loaded_data_ptr, &loaded_data_size)) {
+    bool loaded = s_asset_decoders[asset_type]
+                      ? fe_asset_manager_decode_from_file(asset_type, file_path, &loaded_data_ptr, &loaded_data_size)
+                      : s_asset_loaders[asset_type](file_path, &loaded_data_ptr, &loaded_data_size);
+    if (!loaded) {
         FE_LOG_ERROR("Failed to load asset data for: %s (Type: %d)", file_path, asset_type);
+        fe_asset_manager_release_loaded(manager, deps, dep_count);
         return NULL;
     }
-
-    // 4. fe_asset_t yapısını oluştur ve doldur
-    fe_asset_t* new_asset = FE_MALLOC(sizeof(fe_asset_t), FE_MEM_TYPE_ASSET_STRUCT);
-    if (!new_asset) {
-        FE_LOG_ERROR("Failed to allocate fe_asset_t for: %s", file_path);
-        if (s_asset_unloaders[asset_type]) { // Yüklenen veriyi boşalt
-             s_asset_unloaders[asset_type](loaded_data_ptr, loaded_data_size);
-        }
+    if (s_asset_uploaders[asset_type] && !s_asset_uploaders[asset_type](loaded_data_ptr, loaded_data_size)) {
+        FE_LOG_ERROR("Failed to upload asset: %s (Type: %d)", file_path, asset_type);
+        if (s_asset_unloaders[asset_type]) s_asset_unloaders[asset_type](loaded_data_ptr, loaded_data_size);
+        fe_asset_manager_release_loaded(manager, deps, dep_count);
         return NULL;
     }
 
-    memset(new_asset, 0, sizeof(fe_asset_t));
-    new_asset->id = manager->next_asset_id++;
-    strncpy(new_asset->path, file_path, sizeof(new_asset->path) - 1);
-    new_asset->path[sizeof(new_asset->path) - 1] = '\0';
-    new_asset->type = asset_type;
-    new_asset->ref_count = 1; // İlk referans
-    new_asset->data_size = loaded_data_size;
-    new_asset->data_ptr = loaded_data_ptr;
-
-    // 5. Önbelleğe ekle
-    FE_HASH_MAP_INSERT(&manager->assets_cache, new_asset->path, new_asset);
-
-    FE_LOG_INFO("Asset loaded and cached: %s (ID: %llu, Type: %d, Ref Count: %u)",
-                file_path, new_asset->id, new_asset->type, new_asset->ref_count);
+    // 5-6. fe_asset_t yapısını oluştur ve önbelleğe ekle; bütçe aşıldıysa kullanılmayanları boşalt
+    fe_asset_t* new_asset = fe_asset_manager_insert_asset(manager, path_id, asset_type, loaded_data_ptr, loaded_data_size);
+    if (new_asset && !fe_asset_manager_attach_dependencies(new_asset, deps, dep_count)) {
+        FE_LOG_ERROR("Failed to allocate dependency list for: %s", file_path);
+        fe_asset_manager_release_asset(manager, new_asset);
+        new_asset = NULL;
+    }
+    if (new_asset) {
+        if (deps) FE_FREE(deps, FE_MEM_TYPE_GENERAL); // Referanslar artık varlığın
+        fe_asset_manager_evict_to_budget(manager, asset_type);
+    } else {
+        fe_asset_manager_release_loaded(manager, deps, dep_count);
+    }
     return new_asset;
 }
 
@@ -233,22 +588,135 @@ void fe_asset_manager_release_asset(fe_asset_manager_t* manager, fe_asset_t* ass
     asset->ref_count--;
     FE_LOG_DEBUG("Asset %s ref count decreased to %u.", asset->path, asset->ref_count);
 
-    if (asset->ref_count == 0) {
-        FE_LOG_INFO("Asset %s (ID: %llu) ref count is zero, unloading.", asset->path, asset->id);
+    if (asset->ref_count == 0 && asset->detached) {
+        fe_asset_manager_destroy_asset(manager, asset); // Önbellekten erişilemez; saklamanın anlamı yok
+    } else if (asset->ref_count == 0) {
+        // Hemen boşaltılmaz; en yeni kullanılmayan olarak LRU'nun sonuna eklenir
+        fe_asset_type_cache_t* cache = &manager->type_caches[asset->type];
+        fe_ilist_push_back(&cache->lru, &asset->lru_node);
+        cache->stats.unused_bytes += asset->data_size;
+        FE_LOG_DEBUG("Asset %s (ID: %llu) ref count is zero, moved to LRU.", asset->path, asset->id);
+        fe_asset_manager_evict_to_budget(manager, asset->type);
+    }
+}
 
-        // Varlığı boşalt
-        if (s_asset_unloaders[asset->type]) {
-            s_asset_unloaders[asset->type](asset->data_ptr, asset->data_size);
-        } else {
-            FE_LOG_WARN("No unloader registered for asset type %d.", asset->type);
+void fe_asset_manager_set_type_budget(fe_asset_manager_t* manager, fe_asset_type_t asset_type, size_t budget_bytes) {
+    if (!manager || asset_type == FE_ASSET_TYPE_UNKNOWN || asset_type >= FE_ASSET_TYPE_COUNT) {
+        FE_LOG_ERROR("fe_asset_manager_set_type_budget: Invalid parameters.");
+        return;
+    }
+    manager->type_caches[asset_type].stats.budget_bytes = budget_bytes;
+    fe_asset_manager_evict_to_budget(manager, asset_type);
+}
+
+uint32_t fe_asset_manager_purge_unused(fe_asset_manager_t* manager, fe_asset_type_t asset_type) {
+    if (!manager || asset_type >= FE_ASSET_TYPE_COUNT) return 0;
+    uint32_t purged = 0;
+    uint32_t pass_purged;
+    do { // Atılan varlıkların bıraktığı bağımlılıklar başka tiplerin LRU'suna düşebilir
+        pass_purged = 0;
+        for (int t = 0; t < FE_ASSET_TYPE_COUNT; ++t) {
+            if (asset_type != FE_ASSET_TYPE_UNKNOWN && t != (int)asset_type) continue;
+            fe_ilist_node_t* node;
+            while ((node = fe_ilist_front(&manager->type_caches[t].lru)) != NULL) {
+                fe_asset_manager_destroy_asset(manager, FE_ILIST_CONTAINER_OF(node, fe_asset_t, lru_node));
+                pass_purged++;
+            }
         }
+        purged += pass_purged;
+    } while (pass_purged > 0 && asset_type == FE_ASSET_TYPE_UNKNOWN);
+    if (purged > 0) FE_LOG_INFO("Purged %u unused asset(s) of type %d.", purged, asset_type);
+    return purged;
+}
 
-        // Hash haritasından kaldır
-        FE_HASH_MAP_REMOVE(&manager->assets_cache, asset->path);
+void fe_asset_manager_get_cache_stats(const fe_asset_manager_t* manager, fe_asset_type_t asset_type, fe_asset_cache_stats_t* out_stats) {
+    if (!out_stats) return;
+    memset(out_stats, 0, sizeof(fe_asset_cache_stats_t));
+    if (!manager || asset_type >= FE_ASSET_TYPE_COUNT) return;
+    for (int t = 0; t < FE_ASSET_TYPE_COUNT; ++t) {
+        if (asset_type != FE_ASSET_TYPE_UNKNOWN && t != (int)asset_type) continue;
+        const fe_asset_type_cache_t* cache = &manager->type_caches[t];
+        out_stats->hits += cache->stats.hits;
+        out_stats->misses += cache->stats.misses;
+        out_stats->evictions += cache->stats.evictions;
+        out_stats->evicted_bytes += cache->stats.evicted_bytes;
+        out_stats->budget_bytes += cache->stats.budget_bytes;
+        out_stats->resident_bytes += cache->stats.resident_bytes;
+        out_stats->unused_bytes += cache->stats.unused_bytes;
+        out_stats->resident_count += cache->stats.resident_count;
+        out_stats->unused_count += (uint32_t)fe_ilist_size(&cache->lru);
+    }
+}
 
-        // Varlık yapısının kendisini serbest bırak
-        FE_FREE(asset, FE_MEM_TYPE_ASSET_STRUCT);
+/**
+ * @brief from'un bildirilmiş bağımlılıklarından (dolaylı olarak) target'a ulaşılıp ulaşılamadığını döndürür.
+ */
+static bool fe_asset_manager_depends_on(fe_asset_manager_t* manager, fe_string_id_t from, fe_string_id_t target) {
+    if (from == target) return true;
+    fe_asset_dependency_list_t** declared = fe_asset_dependency_map_get(&manager->declared_dependencies, from);
+    if (!declared || !*declared) return false;
+    for (uint32_t i = 0; i < (*declared)->count; ++i) {
+        if (fe_asset_manager_depends_on(manager, (*declared)->items[i].path_id, target)) return true;
+    }
+    return false;
+}
+
+bool fe_asset_manager_add_dependency(fe_asset_manager_t* manager, const char* asset_path,
+                                     const char* dependency_path, fe_asset_type_t dependency_type) {
+    if (!manager || !asset_path || !dependency_path || dependency_type == FE_ASSET_TYPE_UNKNOWN ||
+        dependency_type >= FE_ASSET_TYPE_COUNT) {
+        FE_LOG_ERROR("fe_asset_manager_add_dependency: Invalid parameters.");
+        return false;
+    }
+    fe_string_id_t asset_id = fe_string_intern(asset_path);
+    fe_string_id_t dep_id = fe_string_intern(dependency_path);
+    if (asset_id == FE_STRING_ID_INVALID || dep_id == FE_STRING_ID_INVALID) return false;
+    if (fe_asset_manager_depends_on(manager, dep_id, asset_id)) {
+        FE_LOG_ERROR("fe_asset_manager_add_dependency: '%s' -> '%s' would create a cycle.", asset_path, dependency_path);
+        return false;
+    }
+
+    fe_asset_dependency_list_t** found = fe_asset_dependency_map_get(&manager->declared_dependencies, asset_id);
+    fe_asset_dependency_list_t* list = found ? *found : NULL;
+    if (!list) {
+        list = (fe_asset_dependency_list_t*)FE_MALLOC(sizeof(fe_asset_dependency_list_t), FE_MEM_TYPE_GENERAL);
+        if (!list) return false;
+        memset(list, 0, sizeof(fe_asset_dependency_list_t));
+        if (!fe_asset_dependency_map_insert(&manager->declared_dependencies, asset_id, list)) {
+            FE_FREE(list, FE_MEM_TYPE_GENERAL);
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < list->count; ++i) {
+        if (list->items[i].path_id == dep_id && list->items[i].type == dependency_type) return true;
+    }
+    if (list->count == list->capacity) {
+        uint32_t new_capacity = list->capacity ? list->capacity * 2 : 4;
+        fe_asset_dependency_t* items = (fe_asset_dependency_t*)FE_MALLOC(sizeof(fe_asset_dependency_t) * new_capacity, FE_MEM_TYPE_GENERAL);
+        if (!items) return false;
+        if (list->items) {
+            memcpy(items, list->items, sizeof(fe_asset_dependency_t) * list->count);
+            FE_FREE(list->items, FE_MEM_TYPE_GENERAL);
+        }
+        list->items = items;
+        list->capacity = new_capacity;
     }
+    fe_asset_dependency_t* dep = &list->items[list->count++];
+    dep->path_id = dep_id;
+    dep->type = dependency_type;
+    dep->asset_id = 0;
+    return true;
+}
+
+void fe_asset_manager_clear_dependencies(fe_asset_manager_t* manager, const char* asset_path) {
+    if (!manager || !asset_path) return;
+    fe_string_id_t asset_id = fe_string_intern(asset_path);
+    fe_asset_dependency_list_t** found = fe_asset_dependency_map_get(&manager->declared_dependencies, asset_id);
+    if (!found || !*found) return;
+    fe_asset_dependency_list_t* list = *found;
+    fe_asset_dependency_map_remove(&manager->declared_dependencies, asset_id);
+    if (list->items) FE_FREE(list->items, FE_MEM_TYPE_GENERAL);
+    FE_FREE(list, FE_MEM_TYPE_GENERAL);
 }
 
 void fe_asset_manager_unload_all_assets_of_type(fe_asset_manager_t* manager, fe_asset_type_t asset_type) {
@@ -259,27 +727,35 @@ void fe_asset_manager_unload_all_assets_of_type(fe_asset_manager_t* manager, fe_
     FE_LOG_INFO("Forcibly unloading all assets of type %d...", asset_type);
 
     // Temp list oluştur çünkü hash map üzerinde iterasyon yaparken öğeleri sileceğiz.
-    FE_DYNAMIC_ARRAY_DEFINE(fe_asset_t*) assets_to_remove;
+    // İşaretçi yerine yol + kimlik saklanır: bir varlığı atmak bağımlılıklarını bırakır ve bu zincir
+    // listedeki başka bir varlığı bizden önce atabilir.
+    FE_DYNAMIC_ARRAY_DEFINE(fe_asset_dependency_t) assets_to_remove;
     FE_DYNAMIC_ARRAY_INIT(&assets_to_remove, 16); // Başlangıç kapasitesi
 
-    FE_HASH_MAP_FOREACH(&manager->assets_cache, char*, path_key, fe_asset_t*, asset_val) {
+    FE_HASH_MAP_FOREACH(&manager->assets_cache, fe_string_id_t, path_key, fe_asset_t*, asset_val) {
+        (void)path_key;
         if (asset_val && (asset_type == FE_ASSET_TYPE_UNKNOWN || asset_val->type == asset_type)) {
-            FE_DYNAMIC_ARRAY_ADD(&assets_to_remove, asset_val);
+            fe_asset_dependency_t entry = { asset_val->path_id, asset_val->type, asset_val->id };
+            FE_DYNAMIC_ARRAY_ADD(&assets_to_remove, entry);
+        }
+    }
+    FE_ILIST_FOREACH(&manager->detached, it) { // Önbellekten ayrılmış ama hâlâ tutulanlar da atılır
+        fe_asset_t* detached = FE_ILIST_CONTAINER_OF(it, fe_asset_t, lru_node);
+        if (asset_type == FE_ASSET_TYPE_UNKNOWN || detached->type == asset_type) {
+            fe_asset_dependency_t entry = { detached->path_id, detached->type, detached->id };
+            FE_DYNAMIC_ARRAY_ADD(&assets_to_remove, entry);
         }
     }
 
     for (size_t i = 0; i < assets_to_remove.size; ++i) {
-        fe_asset_t* asset_to_unload = FE_DYNAMIC_ARRAY_GET(&assets_to_remove, i);
+        fe_asset_dependency_t entry = FE_DYNAMIC_ARRAY_GET(&assets_to_remove, i);
+        fe_asset_t* asset_to_unload = fe_asset_manager_find_asset(manager, entry.path_id, entry.asset_id);
         if (asset_to_unload) {
             FE_LOG_DEBUG("Forcibly unloading asset: %s (ID: %llu, Ref Count: %u)",
                          asset_to_unload->path, asset_to_unload->id, asset_to_unload->ref_count);
             
-            if (s_asset_unloaders[asset_to_unload->type]) {
-                s_asset_unloaders[asset_to_unload->type](asset_to_unload->data_ptr, asset_to_unload->data_size);
-            }
-            // Hash map'ten kaldır ve kendi struct'ını serbest bırak
-            FE_HASH_MAP_REMOVE(&manager->assets_cache, asset_to_unload->path);
-            FE_FREE(asset_to_unload, FE_MEM_TYPE_ASSET_STRUCT);
+            // Boşalt, hash map'ten (ve LRU'dan) kaldır ve kendi struct'ını serbest bırak
+            fe_asset_manager_destroy_asset(manager, asset_to_unload);
         }
     }
     
@@ -287,3 +763,720 @@ void fe_asset_manager_unload_all_assets_of_type(fe_asset_manager_t* manager, fe_
 
     FE_LOG_INFO("Finished forcibly unloading assets of type %d.", asset_type);
 }
+
+// --- Asenkron Yükleme ---
+
+/**
+ * @brief Bir yol için tek bir yükleme işi. Aynı yolu isteyen tanıtıcılar aynı görevi paylaşır.
+ */
+typedef enum fe_asset_task_stage {
+    FE_ASSET_TASK_FREE = 0,
+    FE_ASSET_TASK_QUEUED,        // Öncelik kuyruğunda
+    FE_ASSET_TASK_IO,            // fe_async_io okuması sürüyor
+    FE_ASSET_TASK_DECODE_READY,  // Çözme kuyruğunda
+    FE_ASSET_TASK_DECODING,      // İşçide
+    FE_ASSET_TASK_UPLOAD_READY   // Ana thread'de upload bekliyor
+} fe_asset_task_stage_t;
+
+typedef struct fe_asset_load_task {
+    fe_asset_task_stage_t    stage;
+    fe_string_id_t           path_id;
+    fe_asset_type_t          type;
+    fe_asset_load_priority_t priority;
+    uint32_t                 waiters;     // Bu göreve bağlı tanıtıcı sayısı; 0 ise sonuç atılır
+    int32_t                  next;        // Kuyruk bağlantısı (görev indeksi, -1 son)
+    fe_async_io_handle_t     io_handle;
+    uint8_t*                 io_buffer;   // fe_async_io'nun ayırdığı tampon (sahibiz)
+    size_t                   io_size;
+    bool                     io_done;     // Dosya fe_async_io ile okundu
+    // İşçinin yazdığı alanlar; ana thread decode_done'u gördükten sonra okur
+    void*                    data;
+    size_t                   data_size;
+    bool                     decode_ok;
+    uint32_t                 decode_done;
+    // Bildirilmiş bağımlılıklar; upload hepsi çözülene kadar bekletilir
+    struct fe_asset_load_dep* deps;
+    uint32_t                 dep_count;
+} fe_asset_load_task_t;
+
+/**
+ * @brief Bir görevin bağımlılığı: önce tanıtıcı, teslim alınınca varlık.
+ */
+typedef struct fe_asset_load_dep {
+    fe_asset_load_handle_t handle; // Teslim alınınca veya başlatılamadıysa 0
+    fe_asset_t*            asset;  // READY teslim alındıysa (bir referansla)
+} fe_asset_load_dep_t;
+
+/**
+ * @brief Çağırana verilen tanıtıcının durumu. Görev bitince sonuç buraya taşınır ve görev serbest kalır.
+ */
+typedef struct fe_asset_load_slot {
+    uint32_t              generation;
+    bool                  in_use;
+    int32_t               task;    // Bekleniyorsa görev indeksi, sonuçlandıysa -1
+    fe_asset_load_state_t result;  // task == -1 iken teslim edilecek sonuç
+    fe_asset_t*           asset;   // READY ise tanıtıcıya ait referans
+} fe_asset_load_slot_t;
+
+typedef struct fe_asset_load_list {
+    int32_t head;
+    int32_t tail;
+} fe_asset_load_list_t;
+
+struct fe_asset_load_queue {
+    fe_asset_manager_t*  manager;
+    fe_asset_load_task_t tasks[FE_ASSET_MANAGER_MAX_ASYNC_LOADS];
+    fe_asset_load_slot_t slots[FE_ASSET_MANAGER_MAX_ASYNC_LOADS];
+    fe_asset_load_list_t queued[FE_ASSET_LOAD_PRIORITY_COUNT];   // QUEUED görevler
+    fe_asset_load_list_t decodes[FE_ASSET_LOAD_PRIORITY_COUNT];  // DECODE_READY görevler
+    uint32_t             io_in_flight;
+    uint32_t             decodes_in_flight;
+    fe_job_counter_t     decode_counter;                         // İşçideki tüm çözmeler
+};
+
+static void fe_asset_load_list_push(fe_asset_load_queue_t* queue, fe_asset_load_list_t* list, int32_t index) {
+    queue->tasks[index].next = -1;
+    if (list->tail >= 0) queue->tasks[list->tail].next = index;
+    else list->head = index;
+    list->tail = index;
+}
+
+static int32_t fe_asset_load_list_pop(fe_asset_load_queue_t* queue, fe_asset_load_list_t* list) {
+    int32_t index = list->head;
+    if (index < 0) return -1;
+    list->head = queue->tasks[index].next;
+    if (list->head < 0) list->tail = -1;
+    queue->tasks[index].next = -1;
+    return index;
+}
+
+static void fe_asset_load_list_remove(fe_asset_load_queue_t* queue, fe_asset_load_list_t* list, int32_t index) {
+    int32_t prev = -1;
+    for (int32_t i = list->head; i >= 0; prev = i, i = queue->tasks[i].next) {
+        if (i != index) continue;
+        if (prev >= 0) queue->tasks[prev].next = queue->tasks[i].next;
+        else list->head = queue->tasks[i].next;
+        if (list->tail == i) list->tail = prev;
+        queue->tasks[i].next = -1;
+        return;
+    }
+}
+
+/**
+ * @brief Kuyruklardaki en yüksek öncelikli görevi çıkarır.
+ */
+static int32_t fe_asset_load_lists_pop(fe_asset_load_queue_t* queue, fe_asset_load_list_t* lists) {
+    for (int p = 0; p < FE_ASSET_LOAD_PRIORITY_COUNT; ++p) {
+        int32_t index = fe_asset_load_list_pop(queue, &lists[p]);
+        if (index >= 0) return index;
+    }
+    return -1;
+}
+
+static fe_asset_load_handle_t fe_asset_load_make_handle(fe_asset_load_queue_t* queue, const fe_asset_load_slot_t* slot) {
+    uint32_t index = (uint32_t)(slot - queue->slots);
+    return ((uint64_t)slot->generation << 32) | (uint64_t)(index + 1);
+}
+
+static fe_asset_load_slot_t* fe_asset_load_lookup(fe_asset_load_queue_t* queue, fe_asset_load_handle_t handle) {
+    uint32_t index = (uint32_t)(handle & 0xFFFFFFFFu);
+    if (!queue || index == 0 || index > FE_ASSET_MANAGER_MAX_ASYNC_LOADS) return NULL;
+    fe_asset_load_slot_t* slot = &queue->slots[index - 1];
+    if (!slot->in_use || slot->generation != (uint32_t)(handle >> 32)) return NULL;
+    return slot;
+}
+
+static void fe_asset_load_free_slot(fe_asset_load_slot_t* slot) {
+    uint32_t generation = slot->generation + 1;
+    memset(slot, 0, sizeof(fe_asset_load_slot_t));
+    slot->generation = generation ? generation : 1;
+    slot->task = -1;
+}
+
+static void fe_asset_load_free_task(fe_asset_load_task_t* task) {
+    if (task->io_handle != FE_ASYNC_IO_INVALID_HANDLE) fe_async_io_release(task->io_handle);
+    if (task->io_buffer) FE_FREE(task->io_buffer, FE_MEM_TYPE_GENERAL);
+    if (task->deps) FE_FREE(task->deps, FE_MEM_TYPE_GENERAL);
+    memset(task, 0, sizeof(fe_asset_load_task_t));
+    task->next = -1;
+}
+
+/**
+ * @brief Görevin bağımlılıklarını bırakır: teslim alınmış varlıkların referansını bırakır,
+ * bekleyen tanıtıcıları iptal eder.
+ */
+static void fe_asset_load_drop_dependencies(fe_asset_load_queue_t* queue, fe_asset_load_task_t* task) {
+    fe_asset_load_dep_t* deps = task->deps;
+    uint32_t count = task->dep_count;
+    task->deps = NULL;
+    task->dep_count = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (deps[i].asset) fe_asset_manager_release_asset(queue->manager, deps[i].asset);
+        else if (deps[i].handle) fe_asset_manager_cancel_load(queue->manager, deps[i].handle);
+    }
+    if (deps) FE_FREE(deps, FE_MEM_TYPE_GENERAL);
+}
+
+/**
+ * @brief Görevi bekleyen tüm tanıtıcılara sonucu yazar ve görevi serbest bırakır.
+ * READY ise her tanıtıcı varlıktan bir referans alır.
+ */
+static void fe_asset_load_resolve(fe_asset_load_queue_t* queue, int32_t task_index, fe_asset_load_state_t result, fe_asset_t* asset) {
+    fe_asset_load_drop_dependencies(queue, &queue->tasks[task_index]); // READY'de önceden varlığa aktarılmıştır
+    for (uint32_t i = 0; i < FE_ASSET_MANAGER_MAX_ASYNC_LOADS; ++i) {
+        fe_asset_load_slot_t* slot = &queue->slots[i];
+        if (!slot->in_use || slot->task != task_index) continue;
+        slot->task = -1;
+        slot->result = result;
+        slot->asset = asset;
+    }
+    fe_asset_load_free_task(&queue->tasks[task_index]);
+}
+
+static fe_asset_load_state_t fe_asset_load_stage_to_state(fe_asset_task_stage_t stage) {
+    switch (stage) {
+        case FE_ASSET_TASK_QUEUED:       return FE_ASSET_LOAD_STATE_QUEUED;
+        case FE_ASSET_TASK_IO:           return FE_ASSET_LOAD_STATE_IO;
+        case FE_ASSET_TASK_DECODE_READY:
+        case FE_ASSET_TASK_DECODING:     return FE_ASSET_LOAD_STATE_DECODING;
+        case FE_ASSET_TASK_UPLOAD_READY: return FE_ASSET_LOAD_STATE_UPLOADING;
+        default:                         return FE_ASSET_LOAD_STATE_INVALID;
+    }
+}
+
+static bool fe_asset_load_queue_create(fe_asset_manager_t* manager) {
+    fe_asset_load_queue_t* queue = (fe_asset_load_queue_t*)FE_MALLOC(sizeof(fe_asset_load_queue_t), FE_MEM_TYPE_GENERAL);
+    if (!queue) return false;
+    memset(queue, 0, sizeof(fe_asset_load_queue_t));
+    queue->manager = manager;
+    for (uint32_t i = 0; i < FE_ASSET_MANAGER_MAX_ASYNC_LOADS; ++i) {
+        queue->tasks[i].next = -1;
+        fe_asset_load_free_slot(&queue->slots[i]);
+    }
+    for (int p = 0; p < FE_ASSET_LOAD_PRIORITY_COUNT; ++p) {
+        queue->queued[p].head = queue->queued[p].tail = -1;
+        queue->decodes[p].head = queue->decodes[p].tail = -1;
+    }
+    manager->load_queue = queue;
+    return true;
+}
+
+static void fe_asset_load_queue_destroy(fe_asset_manager_t* manager) {
+    fe_asset_load_queue_t* queue = manager->load_queue;
+    if (!queue) return;
+
+    // İşçiler görev yapılarına yazıyor olabilir; önce tüm çözmelerin bitmesini bekle
+    if (queue->decodes_in_flight > 0 && fe_job_system_is_initialized()) {
+        fe_job_system_wait_for_counter(&queue->decode_counter);
+    }
+    uint32_t cancelled = 0;
+    for (uint32_t i = 0; i < FE_ASSET_MANAGER_MAX_ASYNC_LOADS; ++i) {
+        fe_asset_load_task_t* task = &queue->tasks[i];
+        if (task->stage == FE_ASSET_TASK_FREE) continue;
+        if ((task->stage == FE_ASSET_TASK_DECODING || task->stage == FE_ASSET_TASK_UPLOAD_READY) && task->decode_ok &&
+            s_asset_unloaders[task->type]) {
+            s_asset_unloaders[task->type](task->data, task->data_size);
+        }
+        fe_asset_load_free_task(task);
+        cancelled++;
+    }
+    for (uint32_t i = 0; i < FE_ASSET_MANAGER_MAX_ASYNC_LOADS; ++i) {
+        fe_asset_load_slot_t* slot = &queue->slots[i];
+        if (slot->in_use && slot->asset) slot->asset->ref_count--; // Teslim edilmemiş referanslar
+    }
+    if (cancelled > 0) {
+        FE_LOG_WARN("Asset manager shutdown: %u async load(s) cancelled.", cancelled);
+    }
+    FE_FREE(queue, FE_MEM_TYPE_GENERAL);
+    manager->load_queue = NULL;
+}
+
+static void fe_asset_decode_job(void* user_data) {
+    fe_asset_load_task_t* task = (fe_asset_load_task_t*)user_data;
+    const char* file_path = fe_string_intern_c_str(task->path_id);
+
+    bool ok;
+    if (!s_asset_decoders[task->type]) {
+        ok = s_asset_loaders[task->type](file_path, &task->data, &task->data_size);
+    } else if (task->io_done) {
+        ok = fe_asset_manager_decode_bytes(task->type, file_path, task->io_buffer, task->io_size, &task->data, &task->data_size);
+    } else {
+        // G/Ç aşaması atlandı (pak arşivi veya asenkron G/Ç kapalı); dosya önbelleğinden burada oku
+        ok = fe_asset_manager_decode_from_file(task->type, file_path, &task->data, &task->data_size);
+    }
+    task->decode_ok = ok;
+    fe_atomic_store_u32(&task->decode_done, 1, FE_ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Bekleyen görevlerden en yüksek öncelikliyi başlatır. Aşamalı yükleyicili ve pak dışındaki
+ * dosyalar fe_async_io ile okunur; diğerleri doğrudan çözme kuyruğuna geçer (okuma işçide yapılır).
+ * @return bool Bir görev başlatıldıysa true; kuyruk boşsa veya G/Ç sınırına ulaşıldıysa false.
+ */
+static bool fe_asset_load_start_next(fe_asset_load_queue_t* queue) {
+    int32_t index = -1;
+    int p = 0;
+    for (; p < FE_ASSET_LOAD_PRIORITY_COUNT && index < 0; ++p) {
+        index = queue->queued[p].head;
+    }
+    if (index < 0) return false;
+    fe_asset_load_task_t* task = &queue->tasks[index];
+    const char* file_path = fe_string_intern_c_str(task->path_id);
+
+    bool use_async_io = s_asset_decoders[task->type] && fe_async_io_is_initialized() && !fe_file_cache_is_packed(file_path);
+    if (use_async_io && queue->io_in_flight >= FE_ASSET_MANAGER_MAX_IO_IN_FLIGHT) return false; // Öncelik sırası korunur
+
+    fe_asset_load_list_pop(queue, &queue->queued[task->priority]);
+    if (use_async_io) {
+        fe_async_io_read_desc_t desc;
+        memset(&desc, 0, sizeof(desc));
+        desc.path = file_path;
+        task->io_handle = fe_async_io_read(&desc);
+        if (task->io_handle != FE_ASYNC_IO_INVALID_HANDLE) {
+            task->stage = FE_ASSET_TASK_IO;
+            queue->io_in_flight++;
+            return true;
+        }
+    }
+    task->stage = FE_ASSET_TASK_DECODE_READY;
+    fe_asset_load_list_push(queue, &queue->decodes[task->priority], index);
+    return true;
+}
+
+/**
+ * @brief Tamamlanan okumaları toplar ve çözme kuyruğuna taşır.
+ */
+static void fe_asset_load_collect_io(fe_asset_load_queue_t* queue) {
+    for (int32_t i = 0; i < FE_ASSET_MANAGER_MAX_ASYNC_LOADS && queue->io_in_flight > 0; ++i) {
+        fe_asset_load_task_t* task = &queue->tasks[i];
+        if (task->stage != FE_ASSET_TASK_IO) continue;
+
+        fe_async_io_result_t result;
+        fe_async_io_status_t status = fe_async_io_poll(task->io_handle, &result);
+        if (status == FE_ASYNC_IO_STATUS_PENDING) continue;
+
+        queue->io_in_flight--;
+        fe_async_io_release(task->io_handle);
+        task->io_handle = FE_ASYNC_IO_INVALID_HANDLE;
+        task->io_buffer = (uint8_t*)result.buffer;
+        task->io_size = (size_t)result.bytes_read;
+        if (status != FE_ASYNC_IO_STATUS_COMPLETE) {
+            FE_LOG_ERROR("Failed to read asset file: %s (error %d)", fe_string_intern_c_str(task->path_id), result.error);
+            fe_asset_load_resolve(queue, i, FE_ASSET_LOAD_STATE_FAILED, NULL);
+            continue;
+        }
+        task->io_done = true;
+        task->stage = FE_ASSET_TASK_DECODE_READY;
+        fe_asset_load_list_push(queue, &queue->decodes[task->priority], i);
+    }
+}
+
+/**
+ * @brief Çözme kuyruğundaki görevleri sınır dolana kadar işçilere gönderir. İş sistemi yoksa
+ * çözme burada, ana thread'de yapılır.
+ */
+static void fe_asset_load_dispatch_decodes(fe_asset_load_queue_t* queue) {
+    while (queue->decodes_in_flight < FE_ASSET_MANAGER_MAX_DECODES_IN_FLIGHT) {
+        int32_t index = fe_asset_load_lists_pop(queue, queue->decodes);
+        if (index < 0) return;
+        fe_asset_load_task_t* task = &queue->tasks[index];
+        task->stage = FE_ASSET_TASK_DECODING;
+        task->decode_done = 0;
+        queue->decodes_in_flight++;
+
+        fe_job_decl_t decl = { fe_asset_decode_job, task, false };
+        if (!fe_job_system_is_initialized() || !fe_job_system_run(&decl, 1, &queue->decode_counter)) {
+            fe_asset_decode_job(task);
+        }
+    }
+}
+
+/**
+ * @brief Çözmesi biten görevleri upload aşamasına geçirir; iptal edilmiş olanların sonucunu atar.
+ */
+static void fe_asset_load_collect_decodes(fe_asset_load_queue_t* queue) {
+    for (int32_t i = 0; i < FE_ASSET_MANAGER_MAX_ASYNC_LOADS && queue->decodes_in_flight > 0; ++i) {
+        fe_asset_load_task_t* task = &queue->tasks[i];
+        if (task->stage != FE_ASSET_TASK_DECODING || !fe_atomic_load_u32(&task->decode_done, FE_ATOMIC_ACQUIRE)) continue;
+
+        queue->decodes_in_flight--;
+        if (task->io_buffer) {
+            FE_FREE(task->io_buffer, FE_MEM_TYPE_GENERAL);
+            task->io_buffer = NULL;
+        }
+        if (!task->decode_ok) {
+            FE_LOG_ERROR("Failed to load asset data for: %s (Type: %d)", fe_string_intern_c_str(task->path_id), task->type);
+            fe_asset_load_resolve(queue, i, FE_ASSET_LOAD_STATE_FAILED, NULL);
+            continue;
+        }
+        if (task->waiters == 0) { // Çözme sürerken tüm tanıtıcılar iptal edildi
+            if (s_asset_unloaders[task->type]) s_asset_unloaders[task->type](task->data, task->data_size);
+            fe_asset_load_drop_dependencies(queue, task);
+            fe_asset_load_free_task(task);
+            continue;
+        }
+        task->stage = FE_ASSET_TASK_UPLOAD_READY;
+    }
+}
+
+/**
+ * @brief Görevin bekleyen bağımlılık tanıtıcılarını yoklar ve çözülenleri teslim alır.
+ * @return int 1: hepsi yüklü, 0: bekleyen var, -1: biri başarısız oldu.
+ */
+static int fe_asset_load_gather_dependencies(fe_asset_manager_t* manager, fe_asset_load_task_t* task) {
+    int result = 1;
+    for (uint32_t i = 0; i < task->dep_count; ++i) {
+        fe_asset_load_dep_t* dep = &task->deps[i];
+        if (dep->asset) continue;
+        if (dep->handle == FE_ASSET_LOAD_INVALID_HANDLE) return -1; // Kuyruğa alınamamıştı
+        fe_asset_load_state_t state = fe_asset_manager_poll_load(manager, dep->handle, &dep->asset);
+        if (state == FE_ASSET_LOAD_STATE_READY) {
+            dep->handle = FE_ASSET_LOAD_INVALID_HANDLE;
+        } else if (state == FE_ASSET_LOAD_STATE_FAILED || state == FE_ASSET_LOAD_STATE_CANCELLED ||
+                   state == FE_ASSET_LOAD_STATE_INVALID) {
+            dep->handle = FE_ASSET_LOAD_INVALID_HANDLE;
+            return -1;
+        } else {
+            result = 0;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Teslim alınmış bağımlılıkları yeni yüklenen varlığa aktarır; referanslar artık varlığındır.
+ */
+static bool fe_asset_load_transfer_dependencies(fe_asset_load_task_t* task, fe_asset_t* asset) {
+    if (task->dep_count == 0) return true;
+    asset->dependencies = (fe_asset_dependency_t*)FE_MALLOC(sizeof(fe_asset_dependency_t) * task->dep_count, FE_MEM_TYPE_GENERAL);
+    if (!asset->dependencies) return false;
+    for (uint32_t i = 0; i < task->dep_count; ++i) {
+        fe_asset_t* dep = task->deps[i].asset;
+        asset->dependencies[i].path_id = dep->path_id;
+        asset->dependencies[i].type = dep->type;
+        asset->dependencies[i].asset_id = dep->id;
+    }
+    asset->dependency_count = task->dep_count;
+    FE_FREE(task->deps, FE_MEM_TYPE_GENERAL);
+    task->deps = NULL;
+    task->dep_count = 0;
+    return true;
+}
+
+/**
+ * @brief Upload aşamasındaki görevleri öncelik sırasıyla, çağrı başına sınırlı sayıda tamamlar.
+ * Bağımlılıkları henüz yüklenmemiş görevler beklemeye devam eder.
+ */
+static void fe_asset_load_run_uploads(fe_asset_manager_t* manager, fe_asset_load_queue_t* queue) {
+    uint32_t budget = FE_ASSET_MANAGER_MAX_UPLOADS_PER_UPDATE;
+    for (int p = 0; p < FE_ASSET_LOAD_PRIORITY_COUNT && budget > 0; ++p) {
+        for (int32_t i = 0; i < FE_ASSET_MANAGER_MAX_ASYNC_LOADS && budget > 0; ++i) {
+            fe_asset_load_task_t* task = &queue->tasks[i];
+            if (task->stage != FE_ASSET_TASK_UPLOAD_READY || (int)task->priority != p) continue;
+
+            const char* file_path = fe_string_intern_c_str(task->path_id);
+            int deps_state = fe_asset_load_gather_dependencies(manager, task);
+            if (deps_state == 0) continue;
+            if (deps_state < 0) {
+                FE_LOG_ERROR("Failed to load dependencies of: %s", file_path);
+                if (s_asset_unloaders[task->type]) s_asset_unloaders[task->type](task->data, task->data_size);
+                fe_asset_load_resolve(queue, i, FE_ASSET_LOAD_STATE_FAILED, NULL);
+                continue;
+            }
+            budget--;
+
+            if (s_asset_uploaders[task->type] && !s_asset_uploaders[task->type](task->data, task->data_size)) {
+                FE_LOG_ERROR("Failed to upload asset: %s (Type: %d)", file_path, task->type);
+                if (s_asset_unloaders[task->type]) s_asset_unloaders[task->type](task->data, task->data_size);
+                fe_asset_load_resolve(queue, i, FE_ASSET_LOAD_STATE_FAILED, NULL);
+                continue;
+            }
+
+            // Bu sırada eşzamanlı olarak yüklenmişse mevcut varlık kullanılır
+            fe_asset_t* asset = NULL;
+            fe_asset_t** cached = fe_asset_cache_map_get(&manager->assets_cache, task->path_id);
+            if (cached && *cached && (*cached)->type == task->type) {
+                asset = *cached;
+                if (s_asset_unloaders[task->type]) s_asset_unloaders[task->type](task->data, task->data_size);
+                fe_asset_manager_acquire_cached(manager, asset, task->waiters);
+            } else {
+                if (cached && *cached) { // Yol bu sırada başka tipte yüklenmiş
+                    FE_LOG_WARN("Asset '%s' is cached with type %d; replacing it with type %d.", file_path, (*cached)->type, task->type);
+                    fe_asset_manager_displace_asset(manager, *cached);
+                }
+                asset = fe_asset_manager_insert_asset(manager, task->path_id, task->type, task->data, task->data_size);
+                if (asset && !fe_asset_load_transfer_dependencies(task, asset)) {
+                    FE_LOG_ERROR("Failed to allocate dependency list for: %s", file_path);
+                    fe_asset_manager_destroy_asset(manager, asset);
+                    asset = NULL;
+                }
+                if (asset) {
+                    asset->ref_count = task->waiters; // Her tanıtıcı bir referansın sahibi
+                    fe_asset_manager_evict_to_budget(manager, task->type);
+                }
+            }
+            fe_asset_load_resolve(queue, i, asset ? FE_ASSET_LOAD_STATE_READY : FE_ASSET_LOAD_STATE_FAILED, asset);
+        }
+    }
+}
+
+void fe_asset_manager_update(fe_asset_manager_t* manager) {
+    if (!manager || !manager->load_queue) return;
+    fe_asset_load_queue_t* queue = manager->load_queue;
+
+    fe_asset_load_collect_io(queue);
+    while (fe_asset_load_start_next(queue)) {}
+    fe_asset_load_dispatch_decodes(queue);
+    fe_asset_load_collect_decodes(queue);
+    fe_asset_load_run_uploads(manager, queue);
+}
+
+/**
+ * @brief Yeni bir görev için bildirilmiş bağımlılıkların her birini asenkron yüklemeye başlar.
+ * Kuyruğa alınamayan bağımlılık geçersiz tanıtıcıyla kaydedilir; görev upload'da başarısız olur.
+ */
+static bool fe_asset_load_queue_dependencies(fe_asset_manager_t* manager, int32_t task_index, fe_asset_load_priority_t priority) {
+    fe_asset_dependency_list_t** declared =
+        fe_asset_dependency_map_get(&manager->declared_dependencies, manager->load_queue->tasks[task_index].path_id);
+    if (!declared || !*declared || (*declared)->count == 0) return true;
+
+    uint32_t count = (*declared)->count;
+    fe_asset_load_dep_t* deps = (fe_asset_load_dep_t*)FE_MALLOC(sizeof(fe_asset_load_dep_t) * count, FE_MEM_TYPE_GENERAL);
+    if (!deps) return false;
+    memset(deps, 0, sizeof(fe_asset_load_dep_t) * count);
+    fe_asset_load_task_t* task = &manager->load_queue->tasks[task_index];
+    task->deps = deps; // Özyinelemeden önce bağlanır ki iptal edilirse birlikte bırakılsın
+    task->dep_count = count;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        declared = fe_asset_dependency_map_get(&manager->declared_dependencies, task->path_id);
+        fe_asset_dependency_t dep = (*declared)->items[i];
+        deps[i].handle = fe_asset_manager_load_asset_async(manager, fe_string_intern_c_str(dep.path_id), dep.type, priority);
+    }
+    return true;
+}
+
+fe_asset_load_handle_t fe_asset_manager_load_asset_async(fe_asset_manager_t* manager, const char* file_path,
+                                                         fe_asset_type_t asset_type, fe_asset_load_priority_t priority) {
+    if (!manager || !manager->load_queue || !file_path || file_path[0] == '\0' || asset_type == FE_ASSET_TYPE_UNKNOWN ||
+        asset_type >= FE_ASSET_TYPE_COUNT || priority >= FE_ASSET_LOAD_PRIORITY_COUNT) {
+        FE_LOG_ERROR("fe_asset_manager_load_asset_async: Invalid parameters.");
+        return FE_ASSET_LOAD_INVALID_HANDLE;
+    }
+    if (!fe_asset_manager_has_loader(asset_type)) {
+        FE_LOG_ERROR("No loader registered for asset type: %d for file: %s", asset_type, file_path);
+        return FE_ASSET_LOAD_INVALID_HANDLE;
+    }
+    fe_asset_load_queue_t* queue = manager->load_queue;
+
+    fe_asset_load_slot_t* slot = NULL;
+    for (uint32_t i = 0; i < FE_ASSET_MANAGER_MAX_ASYNC_LOADS && !slot; ++i) {
+        if (!queue->slots[i].in_use) slot = &queue->slots[i];
+    }
+    fe_string_id_t path_id = fe_string_intern(file_path);
+    if (!slot || path_id == FE_STRING_ID_INVALID) {
+        FE_LOG_WARN("fe_asset_manager_load_asset_async: Cannot queue '%s' (handle table full or intern failed).", file_path);
+        return FE_ASSET_LOAD_INVALID_HANDLE;
+    }
+
+    // 1. Zaten yüklü: tanıtıcı hemen sonuçlanır
+    fe_asset_t** cached = fe_asset_cache_map_get(&manager->assets_cache, path_id);
+    if (cached && *cached && (*cached)->type == asset_type) {
+        fe_asset_manager_acquire_cached(manager, *cached, 1);
+        slot->in_use = true;
+        slot->task = -1;
+        slot->result = FE_ASSET_LOAD_STATE_READY;
+        slot->asset = *cached;
+        return fe_asset_load_make_handle(queue, slot);
+    }
+
+    // 2. Aynı yol zaten yükleniyor: o göreve bağlan
+    int32_t task_index = -1;
+    int32_t free_index = -1;
+    for (int32_t i = 0; i < FE_ASSET_MANAGER_MAX_ASYNC_LOADS; ++i) {
+        fe_asset_load_task_t* task = &queue->tasks[i];
+        if (task->stage == FE_ASSET_TASK_FREE) {
+            if (free_index < 0) free_index = i;
+        } else if (task->path_id == path_id && task->type == asset_type) {
+            task_index = i;
+            break;
+        }
+    }
+
+    bool created = false;
+    if (task_index < 0) {
+        // 3. Yeni görev
+        if (free_index < 0) {
+            FE_LOG_WARN("fe_asset_manager_load_asset_async: Too many loads in flight; cannot queue '%s'.", file_path);
+            return FE_ASSET_LOAD_INVALID_HANDLE;
+        }
+        task_index = free_index;
+        fe_asset_load_task_t* task = &queue->tasks[task_index];
+        memset(task, 0, sizeof(fe_asset_load_task_t));
+        manager->type_caches[asset_type].stats.misses++;
+        task->stage = FE_ASSET_TASK_QUEUED;
+        task->path_id = path_id;
+        task->type = asset_type;
+        task->priority = priority;
+        fe_asset_load_list_push(queue, &queue->queued[priority], task_index);
+        created = true;
+    }
+    queue->tasks[task_index].waiters++;
+
+    slot->in_use = true;
+    slot->task = task_index;
+    fe_asset_load_handle_t handle = fe_asset_load_make_handle(queue, slot);
+    if (priority < queue->tasks[task_index].priority) {
+        fe_asset_manager_set_load_priority(manager, handle, priority);
+    }
+
+    // 4. Bağımlılıklar da kuyruğa alınır (özyinelemeli; paylaşılanlar mevcut görevlere bağlanır)
+    if (created && !fe_asset_load_queue_dependencies(manager, task_index, priority)) {
+        FE_LOG_ERROR("fe_asset_manager_load_asset_async: Out of memory queueing dependencies of '%s'.", file_path);
+        fe_asset_manager_cancel_load(manager, handle);
+        return FE_ASSET_LOAD_INVALID_HANDLE;
+    }
+    return handle;
+}
+
+void fe_asset_manager_set_load_priority(fe_asset_manager_t* manager, fe_asset_load_handle_t handle, fe_asset_load_priority_t priority) {
+    if (!manager || priority >= FE_ASSET_LOAD_PRIORITY_COUNT) return;
+    fe_asset_load_queue_t* queue = manager->load_queue;
+    fe_asset_load_slot_t* slot = fe_asset_load_lookup(queue, handle);
+    if (!slot || slot->task < 0) return;
+    fe_asset_load_task_t* task = &queue->tasks[slot->task];
+    if (task->priority == priority) return;
+
+    // Kuyrukta bekleyen görev yeni sınıfın sonuna taşınır; başlamış görevlerde yalnızca upload sırası değişir
+    if (task->stage == FE_ASSET_TASK_QUEUED) {
+        fe_asset_load_list_remove(queue, &queue->queued[task->priority], slot->task);
+        fe_asset_load_list_push(queue, &queue->queued[priority], slot->task);
+    } else if (task->stage == FE_ASSET_TASK_DECODE_READY) {
+        fe_asset_load_list_remove(queue, &queue->decodes[task->priority], slot->task);
+        fe_asset_load_list_push(queue, &queue->decodes[priority], slot->task);
+    }
+    bool raised = priority < task->priority;
+    task->priority = priority;
+
+    // Yükseltme bağımlılıklara da uygulanır; ebeveyn onlardan önce tamamlanamaz
+    for (uint32_t i = 0; raised && i < task->dep_count; ++i) {
+        if (task->deps[i].handle) fe_asset_manager_set_load_priority(manager, task->deps[i].handle, priority);
+    }
+}
+
+fe_asset_load_state_t fe_asset_manager_poll_load(fe_asset_manager_t* manager, fe_asset_load_handle_t handle, fe_asset_t** out_asset) {
+    if (out_asset) *out_asset = NULL;
+    if (!manager) return FE_ASSET_LOAD_STATE_INVALID;
+    fe_asset_load_slot_t* slot = fe_asset_load_lookup(manager->load_queue, handle);
+    if (!slot) return FE_ASSET_LOAD_STATE_INVALID;
+    if (slot->task >= 0) {
+        return fe_asset_load_stage_to_state(manager->load_queue->tasks[slot->task].stage);
+    }
+
+    // Sonuç teslim edilir; referansın sahipliği çağırana geçer
+    fe_asset_load_state_t result = slot->result;
+    if (out_asset) {
+        *out_asset = slot->asset;
+    } else if (slot->asset) {
+        fe_asset_manager_release_asset(manager, slot->asset);
+    }
+    fe_asset_load_free_slot(slot);
+    return result;
+}
+
+fe_asset_t* fe_asset_manager_wait_load(fe_asset_manager_t* manager, fe_asset_load_handle_t handle) {
+    if (!manager) return NULL;
+    fe_asset_load_queue_t* queue = manager->load_queue;
+    fe_asset_load_slot_t* slot = fe_asset_load_lookup(queue, handle);
+    if (!slot) return NULL;
+
+    // Beklenen yükleme kuyrukta başkalarının arkasında kalmasın
+    fe_asset_manager_set_load_priority(manager, handle, FE_ASSET_LOAD_PRIORITY_CRITICAL);
+    while (slot->task >= 0) {
+        fe_asset_load_task_t* task = &queue->tasks[slot->task];
+        if (task->stage == FE_ASSET_TASK_IO) {
+            fe_async_io_wait(task->io_handle, NULL);
+        } else if (task->stage == FE_ASSET_TASK_DECODING && fe_job_system_is_initialized()) {
+            fe_job_system_wait_for_counter(&queue->decode_counter); // Beklerken işlere yardım eder
+        } else if ((task->stage == FE_ASSET_TASK_QUEUED && queue->io_in_flight >= FE_ASSET_MANAGER_MAX_IO_IN_FLIGHT) ||
+                   task->stage == FE_ASSET_TASK_UPLOAD_READY) {
+            fe_thread_yield(); // G/Ç kotası dolu veya bağımlılıklar bekleniyor
+        }
+        fe_asset_manager_update(manager);
+    }
+
+    fe_asset_t* asset = NULL;
+    fe_asset_manager_poll_load(manager, handle, &asset);
+    return asset;
+}
+
+uint32_t fe_asset_manager_load_batch(fe_asset_manager_t* manager, const fe_asset_load_request_t* requests, uint32_t count,
+                                     fe_asset_load_priority_t priority, fe_asset_t** out_assets) {
+    if (!manager || !requests || !out_assets) {
+        FE_LOG_ERROR("fe_asset_manager_load_batch: Invalid parameters.");
+        return 0;
+    }
+    fe_asset_load_handle_t* handles = (fe_asset_load_handle_t*)FE_MALLOC(sizeof(fe_asset_load_handle_t) * (count ? count : 1), FE_MEM_TYPE_GENERAL);
+    if (!handles) return 0;
+
+    // Önce çizgenin tamamı kuyruğa alınır; böylece tüm yapraklar aynı anda okunur ve çözülür
+    for (uint32_t i = 0; i < count; ++i) {
+        handles[i] = fe_asset_manager_load_asset_async(manager, requests[i].path, requests[i].type, priority);
+    }
+
+    uint32_t loaded = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        out_assets[i] = handles[i] ? fe_asset_manager_wait_load(manager, handles[i]) : NULL;
+        if (out_assets[i]) loaded++;
+    }
+    FE_FREE(handles, FE_MEM_TYPE_GENERAL);
+
+    if (loaded < count) {
+        FE_LOG_WARN("fe_asset_manager_load_batch: %u of %u asset(s) failed to load.", count - loaded, count);
+    }
+    return loaded;
+}
+
+bool fe_asset_manager_cancel_load(fe_asset_manager_t* manager, fe_asset_load_handle_t handle) {
+    if (!manager) return false;
+    fe_asset_load_queue_t* queue = manager->load_queue;
+    fe_asset_load_slot_t* slot = fe_asset_load_lookup(queue, handle);
+    if (!slot) return false;
+
+    if (slot->task < 0) {
+        // Sonuç gelmiş ama teslim edilmemiş: tanıtıcının referansını bırak
+        if (slot->asset) fe_asset_manager_release_asset(manager, slot->asset);
+        fe_asset_load_free_slot(slot);
+        return true;
+    }
+
+    int32_t index = slot->task;
+    fe_asset_load_task_t* task = &queue->tasks[index];
+    fe_asset_load_free_slot(slot);
+    if (--task->waiters > 0) return true; // Başka tanıtıcılar hâlâ bekliyor
+
+    // Yalnızca bu yükleme için istenmiş bağımlılıklar da iptal olur. Çözme sürüyorsa görev yeni bir
+    // istekle yeniden bağlanabilir; bağımlılıklar o zaman fe_asset_load_collect_decodes'da bırakılır
+    if (task->stage != FE_ASSET_TASK_DECODING) fe_asset_load_drop_dependencies(queue, task);
+    switch (task->stage) {
+        case FE_ASSET_TASK_QUEUED:
+            fe_asset_load_list_remove(queue, &queue->queued[task->priority], index);
+            fe_asset_load_free_task(task);
+            break;
+        case FE_ASSET_TASK_IO:
+            queue->io_in_flight--;
+            fe_asset_load_free_task(task); // Okuma bırakılır; sonucu geldiğinde fe_async_io tarafından atılır
+            break;
+        case FE_ASSET_TASK_DECODE_READY:
+            fe_asset_load_list_remove(queue, &queue->decodes[task->priority], index);
+            fe_asset_load_free_task(task);
+            break;
+        case FE_ASSET_TASK_UPLOAD_READY:
+            if (s_asset_unloaders[task->type]) s_asset_unloaders[task->type](task->data, task->data_size);
+            fe_asset_load_free_task(task);
+            break;
+        default:
+            break; // DECODING: işçi bitince fe_asset_load_collect_decodes sonucu atar
+    }
+    return true;
+}
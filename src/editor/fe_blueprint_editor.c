@@ -55,8 +55,8 @@ bool fe_blueprint_graph_init(fe_blueprint_graph_t* graph, const char* name) {
 
     if (!FE_DYNAMIC_ARRAY_INIT(&graph->nodes, 8)) return false;
     if (!FE_DYNAMIC_ARRAY_INIT(&graph->connections, 16)) return false;
-    if (!FE_HASH_MAP_INIT(&graph->id_to_node_map, 16)) return false;
-    if (!FE_HASH_MAP_INIT(&graph->id_to_pin_map, 32)) return false;
+    if (!fe_bp_node_id_map_init(&graph->id_to_node_map, 16)) return false;
+    if (!fe_bp_pin_id_map_init(&graph->id_to_pin_map, 32)) return false;
 
     return true;
 }
@@ -80,8 +80,8 @@ void fe_blueprint_graph_shutdown(fe_blueprint_graph_t* graph) {
     }
     FE_DYNAMIC_ARRAY_SHUTDOWN(&graph->nodes);
 
-    FE_HASH_MAP_SHUTDOWN(&graph->id_to_node_map);
-    FE_HASH_MAP_SHUTDOWN(&graph->id_to_pin_map);
+    fe_bp_node_id_map_shutdown(&graph->id_to_node_map);
+    fe_bp_pin_id_map_shutdown(&graph->id_to_pin_map);
 
     FE_LOG_INFO("Blueprint graph '%s' shut down.", graph->name);
 }
@@ -310,7 +310,7 @@ fe_blueprint_node_t* fe_blueprint_editor_add_node(fe_blueprint_editor_t* editor,
     fe_bp_editor_setup_node_pins(new_node, editor->current_graph);
 
     FE_DYNAMIC_ARRAY_ADD(&editor->current_graph->nodes, new_node);
-    FE_HASH_MAP_INSERT(&editor->current_graph->id_to_node_map, new_node->id, new_node);
+    fe_bp_node_id_map_insert(&editor->current_graph->id_to_node_map, new_node->id, new_node);
 
     FE_LOG_INFO("Added new blueprint node: %s (ID: %llu, Type: %d) at (%.1f, %.1f)",
                 new_node->name, new_node->id, new_node->type, new_node->pos.x, new_node->pos.y);
@@ -341,7 +341,7 @@ bool fe_blueprint_editor_remove_node(fe_blueprint_editor_t* editor, fe_blueprint
         }
     }
 
-    FE_HASH_MAP_REMOVE(&editor->current_graph->id_to_node_map, node_to_remove->id);
+    fe_bp_node_id_map_remove(&editor->current_graph->id_to_node_map, node_to_remove->id);
 
     if (removed_from_array) {
         fe_bp_editor_destroy_node(editor->current_graph, node_to_remove);
@@ -546,7 +546,7 @@ static fe_blueprint_pin_t* fe_bp_editor_create_pin(fe_blueprint_graph_t* graph,
     } else {
         FE_DYNAMIC_ARRAY_ADD(&parent_node->output_pins, new_pin);
     }
-    FE_HASH_MAP_INSERT(&graph->id_to_pin_map, new_pin->id, new_pin);
+    fe_bp_pin_id_map_insert(&graph->id_to_pin_map, new_pin->id, new_pin);
 
     return new_pin;
 }
@@ -576,7 +576,7 @@ static void fe_bp_editor_destroy_pin(fe_blueprint_graph_t* graph, fe_blueprint_p
         FE_FREE(pin->default_value.s_val, FE_MEM_TYPE_EDITOR);
     }
 
-    FE_HASH_MAP_REMOVE(&graph->id_to_pin_map, pin->id);
+    fe_bp_pin_id_map_remove(&graph->id_to_pin_map, pin->id);
     FE_FREE(pin, FE_MEM_TYPE_EDITOR);
 }
 
@@ -615,12 +615,12 @@ static void fe_bp_editor_destroy_connection(fe_blueprint_graph_t* graph, fe_blue
 
 
 static fe_blueprint_pin_t* fe_bp_editor_find_pin_by_id(fe_blueprint_graph_t* graph, uint64_t pin_id) {
-    fe_blueprint_pin_t** found_pin_ptr = FE_HASH_MAP_GET(&graph->id_to_pin_map, pin_id);
+    fe_blueprint_pin_t** found_pin_ptr = fe_bp_pin_id_map_get(&graph->id_to_pin_map, pin_id);
     return found_pin_ptr ? *found_pin_ptr : NULL;
 }
 
 static fe_blueprint_node_t* fe_bp_editor_find_node_by_id(fe_blueprint_graph_t* graph, uint64_t node_id) {
-    fe_blueprint_node_t** found_node_ptr = FE_HASH_MAP_GET(&graph->id_to_node_map, node_id);
+    fe_blueprint_node_t** found_node_ptr = fe_bp_node_id_map_get(&graph->id_to_node_map, node_id);
     return found_node_ptr ? *found_node_ptr : NULL;
 }
 
@@ -28,10 +28,37 @@ static void fe_material_editor_free_parameter(fe_material_parameter_t* param) {
     fe_string_destroy(&param->name);
 }
 
+// Materyalin varyant önbelleğini serbest bırakır ve sayaçlardan düşer
+static void fe_material_editor_free_variants(fe_material_t* material) {
+    fe_material_variant_stats_t* stats = &g_material_editor_state.variant_stats;
+    for (size_t i = 0; i < material->variant_count; ++i) {
+        fe_material_shader_variant_t* variant = &material->variants[i];
+        if (variant->status == FE_SHADER_COMPILER_SUCCESS) {
+            stats->live_variants--;
+            stats->live_variant_bytes -= variant->compiled.size;
+        } else {
+            stats->failed_variants--;
+        }
+        fe_shader_compiler_free_compiled_shader_data(&variant->compiled);
+        fe_shader_compiler_free_reflection_data(&variant->reflection);
+    }
+    if (material->variants) {
+        fe_free(material->variants, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+    }
+    material->variants = NULL;
+    material->variant_count = 0;
+    material->variant_capacity = 0;
+}
+
 // Materyali serbest bırakır
 static void fe_material_editor_free_material(fe_material_t* material) {
     if (!material) return;
 
+    fe_material_editor_free_variants(material);
+    for (uint32_t i = 0; i < material->keyword_count; ++i) {
+        fe_string_destroy(&material->keywords[i]);
+    }
+
     fe_string_destroy(&material->id);
     fe_string_destroy(&material->name);
     fe_string_destroy(&material->shader_path);
@@ -176,6 +203,7 @@ fe_material_editor_error_t fe_material_editor_init() {
     g_material_editor_state.material_count = 0;
     g_material_editor_state.material_capacity = 0;
     g_material_editor_state.current_material_being_edited = NULL;
+    memset(&g_material_editor_state.variant_stats, 0, sizeof(fe_material_variant_stats_t));
 
     g_is_initialized = true;
     FE_LOG_INFO("Material editor initialized.");
@@ -330,6 +358,13 @@ fe_material_editor_error_t fe_material_editor_save_material(fe_material_t* mater
     fprintf(file, "  \"name\": \"%s\",\n", material->name.data);
     fprintf(file, "  \"shader_path\": \"%s\",\n", material->shader_path.data);
     fprintf(file, "  \"description\": \"%s\",\n", material->description.data);
+    fprintf(file, "  \"keywords\": [\n");
+    for (uint32_t i = 0; i < material->keyword_count; ++i) {
+        fprintf(file, "      { \"name\": \"%s\", \"enabled\": %s }%s\n", material->keywords[i].data,
+                (material->keyword_mask & ((fe_material_keyword_mask_t)1 << i)) ? "true" : "false",
+                i + 1 < material->keyword_count ? "," : "");
+    }
+    fprintf(file, "  ],\n");
     fprintf(file, "  \"parameters\": [\n");
 
     for (size_t i = 0; i < material->parameter_count; ++i) {
@@ -503,3 +538,302 @@ fe_material_t* fe_material_editor_get_current_material() {
 void fe_material_editor_set_current_material(fe_material_t* material) {
     g_material_editor_state.current_material_being_edited = material;
 }
+
+// --- Shader Permütasyonları ---
+
+// Tanımlı anahtar kelimelerin bitleri; maskelerdeki diğer bitler yok sayılır
+static fe_material_keyword_mask_t fe_material_editor_valid_keyword_bits(const fe_material_t* material) {
+    if (material->keyword_count >= FE_MATERIAL_MAX_KEYWORDS) return ~(fe_material_keyword_mask_t)0;
+    return ((fe_material_keyword_mask_t)1 << material->keyword_count) - 1;
+}
+
+static int fe_material_editor_find_keyword(const fe_material_t* material, const char* keyword) {
+    for (uint32_t i = 0; i < material->keyword_count; ++i) {
+        if (fe_string_equals_c_str(&material->keywords[i], keyword)) return (int)i;
+    }
+    return -1;
+}
+
+static fe_material_shader_variant_t* fe_material_editor_find_variant(fe_material_t* material, fe_material_keyword_mask_t keyword_mask,
+                                                                     fe_shader_stage_t stage, fe_shader_target_api_t target_api) {
+    for (size_t i = 0; i < material->variant_count; ++i) {
+        fe_material_shader_variant_t* variant = &material->variants[i];
+        if (variant->keyword_mask == keyword_mask && variant->stage == stage && variant->target_api == target_api) {
+            return variant;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bir varyantın derleme isteğini doldurur. Maskedeki her anahtar kelime "AD=1" makrosu olur.
+ * @param macros En az FE_MATERIAL_MAX_KEYWORDS elemanlı dizi; desc çağrı süresince buna işaret eder.
+ */
+static void fe_material_editor_build_variant_desc(const fe_material_t* material, fe_material_keyword_mask_t keyword_mask,
+                                                  fe_shader_stage_t stage, fe_shader_target_api_t target_api,
+                                                  fe_shader_macro_t* macros, fe_shader_compile_desc_t* desc) {
+    uint32_t macro_count = 0;
+    for (uint32_t i = 0; i < material->keyword_count; ++i) {
+        if (keyword_mask & ((fe_material_keyword_mask_t)1 << i)) {
+            macros[macro_count].name = material->keywords[i].data;
+            macros[macro_count].value = "1";
+            macro_count++;
+        }
+    }
+
+    const char* path = material->shader_path.data;
+    size_t length = strlen(path);
+    bool is_hlsl = length >= 5 && strcmp(path + length - 5, ".hlsl") == 0;
+
+    memset(desc, 0, sizeof(fe_shader_compile_desc_t));
+    desc->file_path = path;
+    desc->source_language = is_hlsl ? FE_SHADER_LANG_HLSL : FE_SHADER_LANG_GLSL;
+    desc->entry_point = "main";
+    desc->shader_stage = stage;
+    desc->target_api = target_api;
+    desc->macros = macro_count > 0 ? macros : NULL;
+    desc->macro_count = macro_count;
+    desc->optimize = true;
+}
+
+/**
+ * @brief Sonucun varyant önbelleğinde tutulup tutulmayacağını döndürür. Yalnızca kaynağın kendisinden
+ * gelen hatalar (derleme, yansıma) tutulur; derleyicinin kapalı olması veya dosyanın okunamaması
+ * gibi geçici hatalar bir sonraki istekte yeniden denenir.
+ */
+static bool fe_material_editor_is_cacheable_status(fe_shader_compiler_error_t status) {
+    return status == FE_SHADER_COMPILER_SUCCESS || status == FE_SHADER_COMPILER_COMPILATION_FAILED ||
+           status == FE_SHADER_COMPILER_REFLECTION_FAILED;
+}
+
+/**
+ * @brief Derleme sonucunu varyant önbelleğine ekler; sonuç verilerinin sahipliği önbelleğe geçer.
+ * @return fe_material_shader_variant_t* Eklenen varyant; bellek yetmezse NULL (sonuç serbest bırakılır).
+ */
+static fe_material_shader_variant_t* fe_material_editor_insert_variant(fe_material_t* material, fe_material_keyword_mask_t keyword_mask,
+                                                                       fe_shader_stage_t stage, fe_shader_target_api_t target_api,
+                                                                       fe_shader_compiler_error_t status,
+                                                                       fe_compiled_shader_data_t* compiled,
+                                                                       fe_shader_reflection_data_t* reflection) {
+    if (material->variant_count >= material->variant_capacity) {
+        size_t new_capacity = material->variant_capacity == 0 ? 4 : material->variant_capacity * 2;
+        fe_material_shader_variant_t* new_list = fe_realloc(material->variants,
+                                                            new_capacity * sizeof(fe_material_shader_variant_t),
+                                                            FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+        if (!new_list) {
+            FE_LOG_CRITICAL("Failed to reallocate memory for shader variants.");
+            fe_shader_compiler_free_compiled_shader_data(compiled);
+            fe_shader_compiler_free_reflection_data(reflection);
+            return NULL;
+        }
+        material->variants = new_list;
+        material->variant_capacity = new_capacity;
+    }
+
+    fe_material_shader_variant_t* variant = &material->variants[material->variant_count++];
+    memset(variant, 0, sizeof(fe_material_shader_variant_t));
+    variant->keyword_mask = keyword_mask;
+    variant->stage = stage;
+    variant->target_api = target_api;
+    variant->status = status;
+    if (status == FE_SHADER_COMPILER_SUCCESS) {
+        variant->compiled = *compiled;
+        variant->reflection = *reflection;
+        g_material_editor_state.variant_stats.live_variants++;
+        g_material_editor_state.variant_stats.live_variant_bytes += compiled->size;
+    } else {
+        g_material_editor_state.variant_stats.failed_variants++;
+    }
+    return variant;
+}
+
+fe_material_editor_error_t fe_material_editor_add_keyword(fe_material_t* material, const char* keyword) {
+    if (!material || !keyword || keyword[0] == '\0') {
+        return FE_MATERIAL_EDITOR_INVALID_ARGUMENT;
+    }
+    if (fe_material_editor_find_keyword(material, keyword) >= 0) {
+        return FE_MATERIAL_EDITOR_SUCCESS;
+    }
+    if (material->keyword_count >= FE_MATERIAL_MAX_KEYWORDS) {
+        FE_LOG_ERROR("Material '%s' already has %d shader keywords; cannot add '%s'.",
+                     material->name.data, FE_MATERIAL_MAX_KEYWORDS, keyword);
+        return FE_MATERIAL_EDITOR_TOO_MANY_KEYWORDS;
+    }
+    fe_string_init(&material->keywords[material->keyword_count++], keyword);
+    material->is_dirty = true;
+
+    FE_LOG_DEBUG("Added shader keyword '%s' to material '%s'.", keyword, material->name.data);
+    return FE_MATERIAL_EDITOR_SUCCESS;
+}
+
+fe_material_editor_error_t fe_material_editor_set_keyword(fe_material_t* material, const char* keyword, bool enabled) {
+    if (!material || !keyword) {
+        return FE_MATERIAL_EDITOR_INVALID_ARGUMENT;
+    }
+    int index = fe_material_editor_find_keyword(material, keyword);
+    if (index < 0) {
+        FE_LOG_WARN("Shader keyword '%s' not found in material '%s'.", keyword, material->name.data);
+        return FE_MATERIAL_EDITOR_KEYWORD_NOT_FOUND;
+    }
+    fe_material_keyword_mask_t bit = (fe_material_keyword_mask_t)1 << index;
+    fe_material_keyword_mask_t new_mask = enabled ? (material->keyword_mask | bit) : (material->keyword_mask & ~bit);
+    if (new_mask != material->keyword_mask) {
+        material->keyword_mask = new_mask;
+        material->is_dirty = true;
+    }
+    return FE_MATERIAL_EDITOR_SUCCESS;
+}
+
+fe_material_keyword_mask_t fe_material_editor_get_keyword_bit(const fe_material_t* material, const char* keyword) {
+    if (!material || !keyword) return 0;
+    int index = fe_material_editor_find_keyword(material, keyword);
+    return index >= 0 ? (fe_material_keyword_mask_t)1 << index : 0;
+}
+
+fe_material_editor_error_t fe_material_editor_get_shader_variant(fe_material_t* material, fe_material_keyword_mask_t keyword_mask,
+                                                                 fe_shader_stage_t stage, fe_shader_target_api_t target_api,
+                                                                 const fe_material_shader_variant_t** out_variant) {
+    if (!g_is_initialized) {
+        FE_LOG_ERROR("Material editor not initialized.");
+        return FE_MATERIAL_EDITOR_NOT_INITIALIZED;
+    }
+    if (!material || !out_variant || !material->shader_path.data) {
+        return FE_MATERIAL_EDITOR_INVALID_ARGUMENT;
+    }
+    *out_variant = NULL;
+    keyword_mask &= fe_material_editor_valid_keyword_bits(material);
+
+    fe_material_shader_variant_t* variant = fe_material_editor_find_variant(material, keyword_mask, stage, target_api);
+    if (variant) {
+        g_material_editor_state.variant_stats.cache_hits++;
+    } else {
+        fe_shader_macro_t macros[FE_MATERIAL_MAX_KEYWORDS];
+        fe_shader_compile_desc_t desc;
+        fe_material_editor_build_variant_desc(material, keyword_mask, stage, target_api, macros, &desc);
+
+        fe_compiled_shader_data_t compiled = { NULL, 0 };
+        fe_shader_reflection_data_t reflection;
+        memset(&reflection, 0, sizeof(reflection));
+        g_material_editor_state.variant_stats.compilations++;
+        fe_shader_compiler_error_t status = fe_shader_compiler_compile(&desc, &compiled, &reflection);
+        if (status != FE_SHADER_COMPILER_SUCCESS) {
+            FE_LOG_ERROR("Shader variant 0x%llx of material '%s' failed to compile: %s",
+                         (unsigned long long)keyword_mask, material->name.data, fe_shader_compiler_error_to_string(status));
+        }
+        if (!fe_material_editor_is_cacheable_status(status)) {
+            // Geçici hata: önbelleğe alınmaz, sonraki istek yeniden dener
+            fe_shader_compiler_free_compiled_shader_data(&compiled);
+            fe_shader_compiler_free_reflection_data(&reflection);
+            return FE_MATERIAL_EDITOR_SHADER_COMPILE_FAILED;
+        }
+        variant = fe_material_editor_insert_variant(material, keyword_mask, stage, target_api, status, &compiled, &reflection);
+        if (!variant) return FE_MATERIAL_EDITOR_OUT_OF_MEMORY;
+    }
+
+    if (variant->status != FE_SHADER_COMPILER_SUCCESS) {
+        return FE_MATERIAL_EDITOR_SHADER_COMPILE_FAILED;
+    }
+    *out_variant = variant;
+    return FE_MATERIAL_EDITOR_SUCCESS;
+}
+
+fe_material_editor_error_t fe_material_editor_prepare_shader_variants(fe_material_t* material, const fe_material_keyword_mask_t* masks,
+                                                                      uint32_t count, fe_shader_stage_t stage,
+                                                                      fe_shader_target_api_t target_api) {
+    if (!g_is_initialized) {
+        FE_LOG_ERROR("Material editor not initialized.");
+        return FE_MATERIAL_EDITOR_NOT_INITIALIZED;
+    }
+    if (!material || (count > 0 && !masks) || !material->shader_path.data) {
+        return FE_MATERIAL_EDITOR_INVALID_ARGUMENT;
+    }
+    if (count == 0) return FE_MATERIAL_EDITOR_SUCCESS;
+
+    // Önbellekte olmayan, tekrarsız maskeler
+    fe_material_keyword_mask_t* pending = fe_malloc(count * sizeof(fe_material_keyword_mask_t), FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+    if (!pending) return FE_MATERIAL_EDITOR_OUT_OF_MEMORY;
+    uint32_t pending_count = 0;
+    bool any_failed = false;
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_material_keyword_mask_t mask = masks[i] & fe_material_editor_valid_keyword_bits(material);
+        fe_material_shader_variant_t* cached = fe_material_editor_find_variant(material, mask, stage, target_api);
+        if (cached) {
+            if (cached->status != FE_SHADER_COMPILER_SUCCESS) any_failed = true;
+            continue;
+        }
+        bool duplicate = false;
+        for (uint32_t j = 0; j < pending_count && !duplicate; ++j) duplicate = pending[j] == mask;
+        if (!duplicate) pending[pending_count++] = mask;
+    }
+    if (pending_count == 0) {
+        fe_free(pending, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+        return any_failed ? FE_MATERIAL_EDITOR_SHADER_COMPILE_FAILED : FE_MATERIAL_EDITOR_SUCCESS;
+    }
+
+    fe_shader_compile_desc_t* descs = fe_malloc(pending_count * sizeof(fe_shader_compile_desc_t), FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+    fe_shader_macro_t* macros = fe_malloc((size_t)pending_count * FE_MATERIAL_MAX_KEYWORDS * sizeof(fe_shader_macro_t), FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+    fe_shader_compile_result_t* results = fe_malloc(pending_count * sizeof(fe_shader_compile_result_t), FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+    if (!descs || !macros || !results) {
+        if (descs) fe_free(descs, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+        if (macros) fe_free(macros, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+        if (results) fe_free(results, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+        fe_free(pending, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+        return FE_MATERIAL_EDITOR_OUT_OF_MEMORY;
+    }
+    for (uint32_t i = 0; i < pending_count; ++i) {
+        fe_material_editor_build_variant_desc(material, pending[i], stage, target_api,
+                                              &macros[(size_t)i * FE_MATERIAL_MAX_KEYWORDS], &descs[i]);
+    }
+
+    // Toplu derleme hiç başlamazsa (derleyici kapalı) sonuçlar başarısız kalır
+    memset(results, 0, pending_count * sizeof(fe_shader_compile_result_t));
+    for (uint32_t i = 0; i < pending_count; ++i) results[i].error = FE_SHADER_COMPILER_NOT_INITIALIZED;
+
+    fe_shader_batch_report_t report;
+    g_material_editor_state.variant_stats.compilations += pending_count;
+    fe_shader_compiler_error_t batch_result = fe_shader_compiler_compile_batch(descs, pending_count, results, &report);
+    if (batch_result != FE_SHADER_COMPILER_SUCCESS && report.failed == 0) {
+        FE_LOG_ERROR("Shader variants of material '%s' could not be compiled: %s", material->name.data,
+                     fe_shader_compiler_error_to_string(batch_result));
+        any_failed = true;
+    } else if (report.failed > 0) {
+        FE_LOG_ERROR("%u shader variant(s) of material '%s' failed to compile:\n%s", report.failed,
+                     material->name.data, report.error_log ? report.error_log : "");
+        any_failed = true;
+    }
+    fe_shader_compiler_free_batch_report(&report);
+
+    fe_material_editor_error_t result = any_failed ? FE_MATERIAL_EDITOR_SHADER_COMPILE_FAILED : FE_MATERIAL_EDITOR_SUCCESS;
+    for (uint32_t i = 0; i < pending_count; ++i) {
+        if (!fe_material_editor_is_cacheable_status(results[i].error)) {
+            // Geçici hata (derleyici kapalı, dosya okunamadı...): önbelleğe alınmaz, sonra yeniden denenir
+            fe_shader_compiler_free_batch_results(&results[i], 1);
+            result = FE_MATERIAL_EDITOR_SHADER_COMPILE_FAILED;
+            continue;
+        }
+        if (!fe_material_editor_insert_variant(material, pending[i], stage, target_api, results[i].error,
+                                               &results[i].compiled, &results[i].reflection)) {
+            // Kalan sonuçlar önbelleğe giremez; sahipleri biziz
+            fe_shader_compiler_free_batch_results(&results[i + 1], pending_count - i - 1);
+            result = FE_MATERIAL_EDITOR_OUT_OF_MEMORY;
+            break;
+        }
+    }
+
+    fe_free(results, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+    fe_free(macros, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+    fe_free(descs, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+    fe_free(pending, FE_MEM_TYPE_EDITOR, __FILE__, __LINE__);
+    return result;
+}
+
+void fe_material_editor_invalidate_shader_variants(fe_material_t* material) {
+    if (!material || material->variant_count == 0) return;
+    FE_LOG_DEBUG("Invalidated %zu shader variant(s) of material '%s'.", material->variant_count, material->name.data);
+    fe_material_editor_free_variants(material);
+}
+
+void fe_material_editor_get_variant_stats(fe_material_variant_stats_t* out_stats) {
+    if (!out_stats) return;
+    *out_stats = g_material_editor_state.variant_stats;
+}
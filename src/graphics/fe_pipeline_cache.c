@@ -0,0 +1,216 @@
+#include "graphics/pipeline/fe_pipeline_cache.h"
+#include "core/utils/fe_logger.h"
+#include "core/memory/fe_memory_manager.h"
+#include "core/utils/fe_hash.h" // Anahtar hash'i için
+
+#include <string.h> // memcpy, memcmp
+
+#define FE_PIPELINE_CACHE_INITIAL_BUCKETS 64
+#define FE_PIPELINE_KEY_INITIAL_CAPACITY  256
+
+struct fe_pipeline_cache_entry {
+    fe_pipeline_cache_entry_t* next;      // Aynı kovadaki sonraki kayıt
+    uint64_t                   hash;
+    void*                      pipeline;
+    uint32_t                   ref_count;
+    size_t                     key_size;
+    uint8_t                    key[];     // Anahtar baytları (çakışma kontrolü için)
+};
+
+// --- Anahtar Oluşturma ---
+
+void fe_pipeline_key_init(fe_pipeline_key_t* key) {
+    memset(key, 0, sizeof(fe_pipeline_key_t));
+}
+
+void fe_pipeline_key_destroy(fe_pipeline_key_t* key) {
+    if (key->data) fe_free(key->data, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    memset(key, 0, sizeof(fe_pipeline_key_t));
+}
+
+void fe_pipeline_key_add(fe_pipeline_key_t* key, const void* data, size_t size) {
+    if (key->out_of_memory || size == 0) return;
+    if (key->size + size > key->capacity) {
+        size_t new_capacity = key->capacity ? key->capacity : FE_PIPELINE_KEY_INITIAL_CAPACITY;
+        while (new_capacity < key->size + size) new_capacity *= 2;
+        uint8_t* new_data = fe_realloc(key->data, new_capacity, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+        if (!new_data) {
+            FE_LOG_ERROR("Failed to grow pipeline key to %zu bytes.", new_capacity);
+            key->out_of_memory = true;
+            return;
+        }
+        key->data = new_data;
+        key->capacity = new_capacity;
+    }
+    memcpy(key->data + key->size, data, size);
+    key->size += size;
+}
+
+void fe_pipeline_key_add_u32(fe_pipeline_key_t* key, uint32_t value) {
+    fe_pipeline_key_add(key, &value, sizeof(value));
+}
+
+void fe_pipeline_key_add_u64(fe_pipeline_key_t* key, uint64_t value) {
+    fe_pipeline_key_add(key, &value, sizeof(value));
+}
+
+void fe_pipeline_key_add_float(fe_pipeline_key_t* key, float value) {
+    if (value == 0.0f) value = 0.0f; // -0.0'ı normalleştir
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    fe_pipeline_key_add_u32(key, bits);
+}
+
+void fe_pipeline_key_add_string(fe_pipeline_key_t* key, const char* str) {
+    if (!str) {
+        fe_pipeline_key_add_u32(key, UINT32_MAX);
+        return;
+    }
+    uint32_t length = (uint32_t)strlen(str);
+    fe_pipeline_key_add_u32(key, length);
+    fe_pipeline_key_add(key, str, length);
+}
+
+uint64_t fe_pipeline_key_hash(const fe_pipeline_key_t* key) {
+    return fe_hash64(key->data, key->size, 0);
+}
+
+// --- Önbellek ---
+
+bool fe_pipeline_cache_init(fe_pipeline_cache_t* cache, fe_pipeline_cache_destroy_func destroy_func, void* context) {
+    if (!cache || !destroy_func) {
+        FE_LOG_ERROR("fe_pipeline_cache_init: cache or destroy_func is NULL.");
+        return false;
+    }
+    memset(cache, 0, sizeof(fe_pipeline_cache_t));
+    cache->buckets = fe_malloc(FE_PIPELINE_CACHE_INITIAL_BUCKETS * sizeof(fe_pipeline_cache_entry_t*), FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    if (!cache->buckets) {
+        FE_LOG_ERROR("Failed to allocate pipeline cache buckets.");
+        return false;
+    }
+    memset(cache->buckets, 0, FE_PIPELINE_CACHE_INITIAL_BUCKETS * sizeof(fe_pipeline_cache_entry_t*));
+    cache->bucket_count = FE_PIPELINE_CACHE_INITIAL_BUCKETS;
+    cache->destroy_func = destroy_func;
+    cache->context = context;
+    return true;
+}
+
+void fe_pipeline_cache_shutdown(fe_pipeline_cache_t* cache) {
+    if (!cache || !cache->buckets) return;
+    if (cache->stats.live_pipelines > 0) {
+        FE_LOG_WARN("Pipeline cache shutting down with %u pipeline(s) still referenced; destroying them.",
+                    cache->stats.live_pipelines);
+    }
+    for (uint32_t i = 0; i < cache->bucket_count; ++i) {
+        fe_pipeline_cache_entry_t* entry = cache->buckets[i];
+        while (entry) {
+            fe_pipeline_cache_entry_t* next = entry->next;
+            cache->destroy_func(entry->pipeline, cache->context);
+            fe_free(entry, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+            entry = next;
+        }
+    }
+    fe_free(cache->buckets, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    FE_LOG_INFO("Pipeline cache shut down (hits: %llu, misses: %llu).",
+                (unsigned long long)cache->stats.hits, (unsigned long long)cache->stats.misses);
+    memset(cache, 0, sizeof(fe_pipeline_cache_t));
+}
+
+/**
+ * @brief Doluluk oranı 1'i aşınca kova sayısını ikiye katlar. Başarısızlık yalnızca zincirleri uzatır.
+ */
+static void fe_pipeline_cache_grow(fe_pipeline_cache_t* cache) {
+    uint32_t new_count = cache->bucket_count * 2;
+    fe_pipeline_cache_entry_t** new_buckets = fe_malloc(new_count * sizeof(fe_pipeline_cache_entry_t*), FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    if (!new_buckets) return;
+    memset(new_buckets, 0, new_count * sizeof(fe_pipeline_cache_entry_t*));
+    for (uint32_t i = 0; i < cache->bucket_count; ++i) {
+        fe_pipeline_cache_entry_t* entry = cache->buckets[i];
+        while (entry) {
+            fe_pipeline_cache_entry_t* next = entry->next;
+            uint32_t index = (uint32_t)(entry->hash & (new_count - 1));
+            entry->next = new_buckets[index];
+            new_buckets[index] = entry;
+            entry = next;
+        }
+    }
+    fe_free(cache->buckets, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    cache->buckets = new_buckets;
+    cache->bucket_count = new_count;
+}
+
+void* fe_pipeline_cache_acquire(fe_pipeline_cache_t* cache, const fe_pipeline_key_t* key,
+                                fe_pipeline_cache_create_func create_func, void* user_data, uint64_t* out_hash) {
+    if (!cache || !cache->buckets || !key || !create_func) {
+        FE_LOG_ERROR("fe_pipeline_cache_acquire: Invalid parameters.");
+        return NULL;
+    }
+    if (key->out_of_memory || key->size == 0) {
+        FE_LOG_ERROR("fe_pipeline_cache_acquire: Pipeline key is incomplete.");
+        return NULL;
+    }
+
+    uint64_t hash = fe_pipeline_key_hash(key);
+    if (out_hash) *out_hash = hash;
+    uint32_t index = (uint32_t)(hash & (cache->bucket_count - 1));
+    for (fe_pipeline_cache_entry_t* entry = cache->buckets[index]; entry; entry = entry->next) {
+        if (entry->hash != hash) continue;
+        if (entry->key_size == key->size && memcmp(entry->key, key->data, key->size) == 0) {
+            entry->ref_count++;
+            cache->stats.hits++;
+            return entry->pipeline;
+        }
+        cache->stats.hash_collisions++;
+    }
+
+    cache->stats.misses++;
+    void* pipeline = create_func(key->data, key->size, user_data);
+    if (!pipeline) {
+        cache->stats.create_failures++;
+        return NULL;
+    }
+
+    fe_pipeline_cache_entry_t* entry = fe_malloc(sizeof(fe_pipeline_cache_entry_t) + key->size, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    if (!entry) {
+        // Önbelleğe alınamayan pipeline kimseyle paylaşılamaz ve bırakılamaz; hemen yok et
+        FE_LOG_ERROR("Failed to allocate pipeline cache entry.");
+        cache->destroy_func(pipeline, cache->context);
+        return NULL;
+    }
+    entry->hash = hash;
+    entry->pipeline = pipeline;
+    entry->ref_count = 1;
+    entry->key_size = key->size;
+    memcpy(entry->key, key->data, key->size);
+    entry->next = cache->buckets[index];
+    cache->buckets[index] = entry;
+    cache->stats.live_pipelines++;
+
+    if (cache->stats.live_pipelines > cache->bucket_count) fe_pipeline_cache_grow(cache);
+    return pipeline;
+}
+
+bool fe_pipeline_cache_release(fe_pipeline_cache_t* cache, uint64_t hash, void* pipeline) {
+    if (!cache || !cache->buckets || !pipeline) return false;
+    fe_pipeline_cache_entry_t** link = &cache->buckets[hash & (cache->bucket_count - 1)];
+    while (*link) {
+        fe_pipeline_cache_entry_t* entry = *link;
+        if (entry->hash == hash && entry->pipeline == pipeline) {
+            if (--entry->ref_count == 0) {
+                *link = entry->next;
+                cache->destroy_func(entry->pipeline, cache->context);
+                fe_free(entry, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+                cache->stats.live_pipelines--;
+            }
+            return true;
+        }
+        link = &entry->next;
+    }
+    FE_LOG_WARN("fe_pipeline_cache_release: Pipeline %p is not in the cache.", pipeline);
+    return false;
+}
+
+void fe_pipeline_cache_get_stats(const fe_pipeline_cache_t* cache, fe_pipeline_cache_stats_t* out_stats) {
+    if (!cache || !out_stats) return;
+    *out_stats = cache->stats;
+}
@@ -1,7 +1,10 @@
 #include "graphics/shader/fe_shader_compiler.h"
 #include "core/utils/fe_logger.h"
 #include "core/memory/fe_memory_manager.h"
-#include "core/utils/fe_file_system.h" // Dosya okuma için
+#include "platform/fe_file_cache.h" // Shader kaynaklarını kopyalamadan okumak için
+#include "platform/fe_ddc.h"        // Derlenmiş shader'ları çalıştırmalar arasında saklamak için
+#include "core/utils/fe_atomic.h"   // Sayaçlar için
+#include "core/jobs/fe_job_system.h"  // Toplu derlemeyi işçi thread'lere dağıtmak için
 
 #include <stdio.h>
 #include <string.h>
@@ -25,7 +28,23 @@
 
 // Global shader derleyici durumu (singleton)
 static bool g_is_initialized = false;
-// Harici derleyici kütüphanelerinin tutaçları burada saklanabilir (örn. dxc library, shaderc compiler_t)
+// Süreç boyunca yaşayan Shaderc derleyicileri; her derlemede yeniden oluşturmak glslang'ı baştan
+// hazırlatır. Her iş sistemi thread'inin kendi derleyicisi vardır (fe_job_system_thread_index ile
+// indekslenir): 0 ana thread içindir ve init'te oluşturulur, işçilerinki ilk derlemelerinde o
+// işçinin kendisi tarafından. Bir yuvaya yalnızca sahibi yazdığı için kilit gerekmez. Derleme
+// seçenekleri istek başına oluşturulur (makrolar ve include çözücüsü isteğe özeldir).
+static shaderc_compiler_t g_shaderc_compilers[FE_JOB_SYSTEM_MAX_WORKERS + 1] = { NULL };
+
+// Sayaçlar (fe_shader_compiler_stats_t)
+static volatile uint64_t g_stat_cache_hits = 0;
+static volatile uint64_t g_stat_cache_misses = 0;
+static volatile uint64_t g_stat_compilations = 0;
+static volatile uint64_t g_stat_failures = 0;
+
+#define FE_SHADER_COMPILER_MAX_PATH          512
+#define FE_SHADER_COMPILER_MAX_INCLUDE_DEPTH 32
+#define FE_SHADER_COMPILER_MAX_INCLUDES      128 // Anahtara katılan en fazla farklı include dosyası
+#define FE_SHADER_COMPILER_MAX_ERROR_MESSAGE 1024 // Toplu derleme raporunda shader başına tutulan hata metni
 
 // --- Dahili Yardımcı Fonksiyonlar ---
 
@@ -60,6 +79,21 @@ const char* fe_shader_language_to_string(fe_shader_source_language_t lang) {
     }
 }
 
+// Hata kodunu string'e çevirir
+const char* fe_shader_compiler_error_to_string(fe_shader_compiler_error_t error) {
+    switch (error) {
+        case FE_SHADER_COMPILER_SUCCESS: return "Success";
+        case FE_SHADER_COMPILER_NOT_INITIALIZED: return "Not initialized";
+        case FE_SHADER_COMPILER_INVALID_ARGUMENT: return "Invalid argument";
+        case FE_SHADER_COMPILER_FILE_NOT_FOUND: return "File not found";
+        case FE_SHADER_COMPILER_READ_ERROR: return "Read error";
+        case FE_SHADER_COMPILER_COMPILATION_FAILED: return "Compilation failed";
+        case FE_SHADER_COMPILER_REFLECTION_FAILED: return "Reflection failed";
+        case FE_SHADER_COMPILER_OUT_OF_MEMORY: return "Out of memory";
+        default: return "Unknown error";
+    }
+}
+
 // Hedef API'yi string'e çevirir
 const char* fe_shader_target_api_to_string(fe_shader_target_api_t target) {
     switch (target) {
@@ -71,62 +105,363 @@ const char* fe_shader_target_api_to_string(fe_shader_target_api_t target) {
     }
 }
 
-// --- Derleme ve Yansıma için Placeholder Fonksiyonlar ---
-// Gerçek uygulamada buraya Shaderc, DXC, SPIRV-Reflect entegrasyonu gelir.
+// --- #include Çözümleme ---
+// Derleyicinin include çözücüsü ve önbellek anahtarı aynı kuralı kullanır; böylece anahtara
+// katılan dosyalar derleyicinin okuduğu dosyalarla aynıdır.
+
+/**
+ * @brief İçeren dosyanın dizinini (sondaki ayraç dahil) döndürür; dizin yoksa boş string.
+ */
+static size_t fe_shader_compiler_dir_length(const char* path) {
+    size_t length = 0;
+    for (size_t i = 0; path[i]; ++i) {
+        if (path[i] == '/' || path[i] == '\\') length = i + 1;
+    }
+    return length;
+}
+
+static bool fe_shader_compiler_file_exists(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+    fclose(file);
+    return true;
+}
+
+/**
+ * @brief #include hedefini bir dosya yoluna çözer. Tırnaklı hedefler (#include "x") önce içeren
+ * dosyanın dizininde, sonra arama dizinlerinde; köşeli hedefler (#include <x>) yalnızca arama
+ * dizinlerinde aranır. İlk var olan dosya seçilir.
+ * @return bool Dosya bulunduysa true.
+ */
+static bool fe_shader_compiler_resolve_include(const fe_shader_compile_desc_t* desc, const char* requested,
+                                               size_t requested_length, bool relative, const char* requesting_path,
+                                               char* out_path) {
+    if (relative && requesting_path) {
+        int length = snprintf(out_path, FE_SHADER_COMPILER_MAX_PATH, "%.*s%.*s",
+                              (int)fe_shader_compiler_dir_length(requesting_path), requesting_path,
+                              (int)requested_length, requested);
+        if (length > 0 && length < FE_SHADER_COMPILER_MAX_PATH && fe_shader_compiler_file_exists(out_path)) return true;
+    }
+    for (uint32_t i = 0; i < desc->include_dir_count; ++i) {
+        int length = snprintf(out_path, FE_SHADER_COMPILER_MAX_PATH, "%s/%.*s",
+                              desc->include_dirs[i], (int)requested_length, requested);
+        if (length > 0 && length < FE_SHADER_COMPILER_MAX_PATH && fe_shader_compiler_file_exists(out_path)) return true;
+    }
+    return false;
+}
+
+// Anahtar oluştururken #include ağacını dolaşma durumu
+typedef struct fe_shader_include_scan {
+    const fe_shader_compile_desc_t* desc;
+    fe_ddc_key_builder_t*           builder;
+    uint64_t                        visited[FE_SHADER_COMPILER_MAX_INCLUDES]; // Çözülmüş yolların hash'leri
+    uint32_t                        visited_count;
+    bool                            overflow; // Çok fazla include; sonuç önbelleğe alınmaz
+} fe_shader_include_scan_t;
+
+/**
+ * @brief Kaynaktaki #include satırlarını bulur ve çözülen her dosyanın yolunu ve içeriğini anahtara
+ * ekler (özyinelemeli; her dosya bir kez). #if blokları değerlendirilmez: koşullu bir include da
+ * anahtara girer. Bu gereğinden fazla anahtar farkı üretebilir ama hiçbir zaman bayat sonuç vermez.
+ */
+static void fe_shader_compiler_hash_includes(fe_shader_include_scan_t* scan, const char* source, size_t size,
+                                             const char* source_path, uint32_t depth) {
+    const char* p = source;
+    const char* end = source + size;
+    while (p < end) {
+        // Satır başındaki boşlukları atla; yönerge '#' ile başlamalı
+        while (p < end && (*p == ' ' || *p == '\t')) p++;
+        bool directive = false;
+        if (p < end && *p == '#') {
+            p++;
+            while (p < end && (*p == ' ' || *p == '\t')) p++;
+            if ((size_t)(end - p) > 7 && memcmp(p, "include", 7) == 0) {
+                p += 7;
+                while (p < end && (*p == ' ' || *p == '\t')) p++;
+                directive = p < end && (*p == '"' || *p == '<');
+            }
+        }
+        if (directive) {
+            char close = (*p == '"') ? '"' : '>';
+            bool relative = (*p == '"');
+            const char* name = ++p;
+            while (p < end && *p != close && *p != '\n') p++;
+            size_t name_length = (size_t)(p - name);
+
+            char resolved[FE_SHADER_COMPILER_MAX_PATH];
+            fe_file_view_t view;
+            if (!fe_shader_compiler_resolve_include(scan->desc, name, name_length, relative, source_path, resolved) ||
+                !fe_file_cache_acquire(resolved, FE_FILE_ACCESS_HINT_SEQUENTIAL, &view)) {
+                // Bulunamayan include; derleme büyük olasılıkla başarısız olur ama anahtar yine de farklı olmalı
+                fe_ddc_key_add_string(scan->builder, "<missing>");
+                fe_ddc_key_add(scan->builder, name, name_length);
+            } else {
+                uint64_t path_hash = fe_hash64(resolved, strlen(resolved), 0);
+                bool seen = false;
+                for (uint32_t i = 0; i < scan->visited_count && !seen; ++i) seen = scan->visited[i] == path_hash;
+                if (!seen) {
+                    if (scan->visited_count < FE_SHADER_COMPILER_MAX_INCLUDES) {
+                        scan->visited[scan->visited_count++] = path_hash;
+                    } else {
+                        scan->overflow = true;
+                    }
+                    fe_ddc_key_add_string(scan->builder, resolved);
+                    fe_ddc_key_add(scan->builder, view.data, view.size);
+                    if (depth + 1 < FE_SHADER_COMPILER_MAX_INCLUDE_DEPTH) {
+                        fe_shader_compiler_hash_includes(scan, (const char*)view.data, view.size, resolved, depth + 1);
+                    } else {
+                        scan->overflow = true;
+                    }
+                }
+                fe_file_cache_release(&view);
+            }
+        }
+        while (p < end && *p != '\n') p++;
+        if (p < end) p++;
+    }
+}
+
+// --- Derleme ve Yansıma ---
+// Vulkan hedefi Shaderc + SPIRV-Reflect ile derlenir. DXC ve Metal yolları henüz yer tutucudur.
+
+static shaderc_shader_kind fe_shader_stage_to_shaderc_kind(fe_shader_stage_t stage) {
+    switch (stage) {
+        case FE_SHADER_STAGE_VERTEX: return shaderc_vertex_shader;
+        case FE_SHADER_STAGE_FRAGMENT: return shaderc_fragment_shader;
+        case FE_SHADER_STAGE_COMPUTE: return shaderc_compute_shader;
+        case FE_SHADER_STAGE_GEOMETRY: return shaderc_geometry_shader;
+        case FE_SHADER_STAGE_TESS_CONTROL: return shaderc_tess_control_shader;
+        case FE_SHADER_STAGE_TESS_EVALUATION: return shaderc_tess_evaluation_shader;
+        case FE_SHADER_STAGE_RAYGEN: return shaderc_raygen_shader;
+        case FE_SHADER_STAGE_INTERSECTION: return shaderc_intersection_shader;
+        case FE_SHADER_STAGE_ANY_HIT: return shaderc_anyhit_shader;
+        case FE_SHADER_STAGE_CLOSEST_HIT: return shaderc_closesthit_shader;
+        case FE_SHADER_STAGE_MISS: return shaderc_miss_shader;
+        case FE_SHADER_STAGE_CALLABLE: return shaderc_callable_shader;
+        case FE_SHADER_STAGE_MESH: return shaderc_mesh_shader;
+        case FE_SHADER_STAGE_TASK: return shaderc_task_shader;
+        default: return shaderc_glsl_infer_from_source;
+    }
+}
+
+// Shaderc'nin include isteğine verilen sonuç; dosya önbelleği görünümü release çağrılana kadar tutulur
+typedef struct fe_shader_include_result {
+    shaderc_include_result result;
+    fe_file_view_t         view;
+    bool                   has_view;
+    char                   path[FE_SHADER_COMPILER_MAX_PATH];
+} fe_shader_include_result_t;
 
-// Shaderc (GLSL/HLSL -> SPIR-V) için derleme örneği (yer tutucu)
+static shaderc_include_result* fe_shader_compiler_shaderc_resolve(void* user_data, const char* requested_source, int type,
+                                                                  const char* requesting_source, size_t include_depth) {
+    (void)include_depth;
+    const fe_shader_compile_desc_t* desc = (const fe_shader_compile_desc_t*)user_data;
+    fe_shader_include_result_t* include = fe_malloc(sizeof(fe_shader_include_result_t), FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    if (!include) return NULL;
+    memset(include, 0, sizeof(fe_shader_include_result_t));
+    include->result.user_data = include;
+
+    if (fe_shader_compiler_resolve_include(desc, requested_source, strlen(requested_source),
+                                           type == shaderc_include_type_relative, requesting_source, include->path) &&
+        fe_file_cache_acquire(include->path, FE_FILE_ACCESS_HINT_SEQUENTIAL, &include->view)) {
+        include->has_view = true;
+        include->result.source_name = include->path;
+        include->result.source_name_length = strlen(include->path);
+        include->result.content = (const char*)include->view.data;
+        include->result.content_length = include->view.size;
+    } else {
+        // Shaderc'de hata, boş source_name ve içerikte hata mesajı ile bildirilir
+        snprintf(include->path, sizeof(include->path), "Cannot find include file: %s", requested_source);
+        include->result.source_name = "";
+        include->result.content = include->path;
+        include->result.content_length = strlen(include->path);
+    }
+    return &include->result;
+}
+
+static void fe_shader_compiler_shaderc_release(void* user_data, shaderc_include_result* result) {
+    (void)user_data;
+    fe_shader_include_result_t* include = (fe_shader_include_result_t*)result->user_data;
+    if (include->has_view) fe_file_cache_release(&include->view);
+    fe_free(include, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+}
+
+/**
+ * @brief İsteğe özel Shaderc seçeneklerini oluşturur (dil, hedef, optimizasyon, makrolar, include çözücüsü).
+ */
+static shaderc_compile_options_t fe_shader_compiler_create_shaderc_options(const fe_shader_compile_desc_t* desc) {
+    shaderc_compile_options_t options = shaderc_compile_options_initialize();
+    if (!options) return NULL;
+    shaderc_compile_options_set_source_language(options, desc->source_language == FE_SHADER_LANG_HLSL
+                                                             ? shaderc_source_language_hlsl
+                                                             : shaderc_source_language_glsl);
+    shaderc_compile_options_set_target_env(options, shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
+    shaderc_compile_options_set_optimization_level(options, desc->optimize ? shaderc_optimization_level_performance
+                                                                           : shaderc_optimization_level_zero);
+    if (desc->debug_info) shaderc_compile_options_set_generate_debug_info(options);
+    for (uint32_t i = 0; i < desc->macro_count; ++i) {
+        const fe_shader_macro_t* macro = &desc->macros[i];
+        shaderc_compile_options_add_macro_definition(options, macro->name, strlen(macro->name),
+                                                     macro->value, macro->value ? strlen(macro->value) : 0);
+    }
+    shaderc_compile_options_set_include_callbacks(options, fe_shader_compiler_shaderc_resolve,
+                                                  fe_shader_compiler_shaderc_release, (void*)desc);
+    return options;
+}
+
+/**
+ * @brief Yansıma listesine bir bağlama ekler (dizi önceden count kadar ayrılmıştır).
+ */
+static void fe_shader_compiler_add_binding(fe_shader_resource_binding_t* bindings, size_t* count,
+                                           const SpvReflectDescriptorBinding* binding) {
+    fe_shader_resource_binding_t* out = &bindings[(*count)++];
+    const char* name = binding->name;
+    // Uniform blokların örnek adı boş olabilir; o zaman blok tipinin adı kullanılır
+    if ((!name || name[0] == '\0') && binding->type_description && binding->type_description->type_name) {
+        name = binding->type_description->type_name;
+    }
+    fe_string_init(&out->name, name ? name : "");
+    out->set = binding->set;
+    out->binding = binding->binding;
+    out->count = binding->count;
+}
+
+/**
+ * @brief SPIR-V bytecode'undan tanımlayıcı bağlamalarını çıkarır (SPIRV-Reflect).
+ */
+static fe_shader_compiler_error_t fe_shader_compiler_reflect_spirv(const fe_compiled_shader_data_t* compiled,
+                                                                   fe_shader_reflection_data_t* output_reflection_data) {
+    SpvReflectShaderModule module;
+    if (spvReflectCreateShaderModule(compiled->size, compiled->data, &module) != SPV_REFLECT_RESULT_SUCCESS) {
+        return FE_SHADER_COMPILER_REFLECTION_FAILED;
+    }
+    uint32_t binding_count = 0;
+    SpvReflectDescriptorBinding** bindings = NULL;
+    if (spvReflectEnumerateDescriptorBindings(&module, &binding_count, NULL) != SPV_REFLECT_RESULT_SUCCESS) {
+        spvReflectDestroyShaderModule(&module);
+        return FE_SHADER_COMPILER_REFLECTION_FAILED;
+    }
+    if (binding_count > 0) {
+        bindings = fe_malloc(binding_count * sizeof(SpvReflectDescriptorBinding*), FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+        if (!bindings) {
+            spvReflectDestroyShaderModule(&module);
+            return FE_SHADER_COMPILER_OUT_OF_MEMORY;
+        }
+        spvReflectEnumerateDescriptorBindings(&module, &binding_count, bindings);
+    }
+
+    // Her listeye en fazla binding_count eleman düşer; küçük diziler için ikinci geçiş gerekmez
+    size_t capacity = binding_count ? binding_count : 1;
+    output_reflection_data->uniform_buffers = fe_malloc(capacity * sizeof(fe_shader_resource_binding_t), FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    output_reflection_data->textures = fe_malloc(capacity * sizeof(fe_shader_resource_binding_t), FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    output_reflection_data->samplers = fe_malloc(capacity * sizeof(fe_shader_resource_binding_t), FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    if (!output_reflection_data->uniform_buffers || !output_reflection_data->textures || !output_reflection_data->samplers) {
+        fe_shader_compiler_free_reflection_data(output_reflection_data);
+        if (bindings) fe_free(bindings, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+        spvReflectDestroyShaderModule(&module);
+        return FE_SHADER_COMPILER_OUT_OF_MEMORY;
+    }
+
+    for (uint32_t i = 0; i < binding_count; ++i) {
+        const SpvReflectDescriptorBinding* binding = bindings[i];
+        switch (binding->descriptor_type) {
+            case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                fe_shader_compiler_add_binding(output_reflection_data->uniform_buffers, &output_reflection_data->uniform_buffer_count, binding);
+                break;
+            case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case SPV_REFLECT_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                fe_shader_compiler_add_binding(output_reflection_data->textures, &output_reflection_data->texture_count, binding);
+                break;
+            case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLER:
+                fe_shader_compiler_add_binding(output_reflection_data->samplers, &output_reflection_data->sampler_count, binding);
+                break;
+            default:
+                break; // Storage buffer vb. henüz fe_shader_reflection_data_t'de yok
+        }
+    }
+
+    if (bindings) fe_free(bindings, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    spvReflectDestroyShaderModule(&module);
+    return FE_SHADER_COMPILER_SUCCESS;
+}
+
+/**
+ * @brief Çağıran thread'in Shaderc derleyicisini döndürür, gerekirse oluşturur.
+ * @param out_temporary true yazılırsa derleyici bu çağrıya özeldir; kullanımdan sonra serbest bırakılmalıdır.
+ */
+static shaderc_compiler_t fe_shader_compiler_acquire_shaderc(bool* out_temporary) {
+    *out_temporary = false;
+    int thread_index = fe_job_system_thread_index();
+    if (thread_index < 0) {
+        if (fe_job_system_is_initialized()) {
+            // İş sistemine ait olmayan bir thread; yuvası yok, geçici bir derleyici kullanır
+            *out_temporary = true;
+            return shaderc_compiler_initialize();
+        }
+        thread_index = 0; // İş sistemi yokken çağıran ana thread kabul edilir
+    }
+    if (!g_shaderc_compilers[thread_index]) {
+        g_shaderc_compilers[thread_index] = shaderc_compiler_initialize();
+        if (!g_shaderc_compilers[thread_index]) FE_LOG_ERROR("Failed to initialize Shaderc compiler for thread %d.", thread_index);
+    }
+    return g_shaderc_compilers[thread_index];
+}
+
+/**
+ * @brief GLSL/HLSL kaynağını çağıran thread'in derleyicisiyle SPIR-V'ye derler ve yansımayı çıkarır.
+ * @param error_message Derleme hatasında Shaderc'nin mesajının yazılacağı tampon (NULL olabilir).
+ */
 static fe_shader_compiler_error_t fe_shader_compiler_compile_shaderc(
+    const fe_shader_compile_desc_t* desc,
     const char* source_code, size_t source_size,
-    fe_shader_source_language_t source_language, const char* entry_point,
-    fe_shader_stage_t shader_stage, bool debug_info, bool optimize,
     fe_compiled_shader_data_t* output_compiled_data,
-    fe_shader_reflection_data_t* output_reflection_data)
+    fe_shader_reflection_data_t* output_reflection_data,
+    char* error_message, size_t error_capacity)
 {
-    FE_LOG_DEBUG("Placeholder: Compiling with Shaderc (GLSL/HLSL to SPIR-V)...");
-    // Gerçek entegrasyon:
-     shaderc_compiler_t compiler = shaderc_compiler_initialize();
-     shaderc_compile_options_t options = shaderc_compile_options_initialize();
-    // // Options: optimization_level, target_env, etc.
-     shaderc_compilation_result_t result = shaderc_compile_into_spv(compiler, source_code, source_size,
-         fe_shader_stage_to_shaderc_kind(shader_stage), "shader_file.glsl", entry_point, options);
-    //
-     if (shaderc_result_get_compilation_status(result) != shaderc_compilation_status_success) {
-         FE_LOG_ERROR("Shaderc compilation failed: %s", shaderc_result_get_error_message(result));
-         shaderc_result_release(result);
-         shaderc_compiler_release(compiler);
-         return FE_SHADER_COMPILER_COMPILATION_FAILED;
-     }
-    //
-     output_compiled_data->size = shaderc_result_get_length(result);
-     output_compiled_data->data = fe_malloc(output_compiled_data->size, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
-     memcpy(output_compiled_data->data, shaderc_result_get_bytes(result), output_compiled_data->size);
-    //
-    // // SPIR-V Reflection (using spirv-reflect)
-     if (output_reflection_data) {
-    //    // Implement SPIR-V reflection using spirv_reflect library here
-    //    // This would parse the SPIR-V binary and populate output_reflection_data
-     }
-    
-     shaderc_result_release(result);
-     shaderc_compiler_release(compiler);
+    if (desc->source_language == FE_SHADER_LANG_MSL) {
+        FE_LOG_ERROR("Shaderc cannot compile %s sources.", fe_shader_language_to_string(desc->source_language));
+        return FE_SHADER_COMPILER_INVALID_ARGUMENT;
+    }
+    bool temporary_compiler = false;
+    shaderc_compiler_t compiler = fe_shader_compiler_acquire_shaderc(&temporary_compiler);
+    if (!compiler) return FE_SHADER_COMPILER_UNKNOWN_ERROR;
+    shaderc_compile_options_t options = fe_shader_compiler_create_shaderc_options(desc);
+    if (!options) {
+        if (temporary_compiler) shaderc_compiler_release(compiler);
+        return FE_SHADER_COMPILER_OUT_OF_MEMORY;
+    }
 
-    // Geçici olarak mock veri döndürelim
-    output_compiled_data->size = 100;
-    output_compiled_data->data = fe_malloc(output_compiled_data->size, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
-    memset(output_compiled_data->data, 0xCD, output_compiled_data->size); // Mock data
+    shaderc_compilation_result_t result = shaderc_compile_into_spv(compiler, source_code, source_size,
+        fe_shader_stage_to_shaderc_kind(desc->shader_stage), desc->file_path, desc->entry_point, options);
+    shaderc_compile_options_release(options);
+    if (temporary_compiler) shaderc_compiler_release(compiler);
 
-    if (output_reflection_data) {
-        // Mock reflection data
-        output_reflection_data->uniform_buffer_count = 1;
-        output_reflection_data->uniform_buffers = fe_malloc(sizeof(fe_shader_resource_binding_t), FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
-        fe_string_init(&output_reflection_data->uniform_buffers[0].name, "CameraBuffer");
-        output_reflection_data->uniform_buffers[0].set = 0;
-        output_reflection_data->uniform_buffers[0].binding = 0;
-        output_reflection_data->uniform_buffers[0].count = 1;
-        // Diğerlerini de doldurun
+    if (!result || shaderc_result_get_compilation_status(result) != shaderc_compilation_status_success) {
+        const char* message = result ? shaderc_result_get_error_message(result) : "out of memory";
+        FE_LOG_ERROR("Shaderc compilation failed: %s", message);
+        if (error_message && error_capacity > 0) snprintf(error_message, error_capacity, "%s", message);
+        if (result) shaderc_result_release(result);
+        return FE_SHADER_COMPILER_COMPILATION_FAILED;
+    }
+
+    output_compiled_data->size = shaderc_result_get_length(result);
+    output_compiled_data->data = fe_malloc(output_compiled_data->size, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    if (!output_compiled_data->data) {
+        output_compiled_data->size = 0;
+        shaderc_result_release(result);
+        return FE_SHADER_COMPILER_OUT_OF_MEMORY;
     }
+    memcpy(output_compiled_data->data, shaderc_result_get_bytes(result), output_compiled_data->size);
+    shaderc_result_release(result);
 
-    FE_LOG_DEBUG("Shaderc placeholder compilation successful.");
+    fe_shader_compiler_error_t reflect_result = fe_shader_compiler_reflect_spirv(output_compiled_data, output_reflection_data);
+    if (reflect_result != FE_SHADER_COMPILER_SUCCESS) {
+        FE_LOG_ERROR("SPIR-V reflection failed for '%s'.", desc->file_path);
+        fe_shader_compiler_free_compiled_shader_data(output_compiled_data);
+        return reflect_result;
+    }
     return FE_SHADER_COMPILER_SUCCESS;
 }
 
@@ -183,7 +518,7 @@ static fe_shader_compiler_error_t fe_shader_compiler_compile_msl(
      id<MTLDevice> device = MTLCreateSystemDefaultDevice();
      NSError* error = nil;
     // // Compile from source
-      id<MTLLibrary> library = [device newLibraryWithSource:[NSString stringWithUTF8String:source_code]
+      id<MTLLibrary> library = [device newLibraryWithSource:[[NSString alloc] initWithBytes:source_code length:source_size encoding:NSUTF8StringEncoding]
                                                    options:nil
                                                      error:&error];
      if (!library) {
@@ -214,6 +549,228 @@ static fe_shader_compiler_error_t fe_shader_compiler_compile_msl(
 }
 
 
+// --- Türetilmiş Veri Önbelleği ---
+// Derleme sonucu (bytecode + yansıma) DDC'ye (platform/fe_ddc.h) yazılır. Anahtar kaynak baytları,
+// #include edilen dosyalar (yol + içerik), makrolar ve derleme seçeneklerinden üretilir; bunlardan
+// biri değişmedikçe sonraki çalıştırmalar derleyiciyi hiç çağırmaz.
+// Kayıt düzeni: u64 bytecode boyutu, bytecode; ardından uniform buffer, doku ve örnekleyici
+// listeleri (her biri u32 sayı; bağlama başına u32 set, binding, count, ad uzunluğu ve ad baytları).
+
+// Derleyici çıktısı, anahtar içeriği veya kayıt düzeni değiştiğinde artırılır; eski kayıtlar kendiliğinden ıskalar
+#define FE_SHADER_COMPILER_CACHE_VERSION 3u
+#define FE_SHADER_COMPILER_CACHE_MAX_NAME 256
+
+/**
+ * @brief Derleme isteğinin önbellek anahtarını üretir.
+ * @return bool Anahtar güvenilirse true; include ağacı sınırları aştıysa false (sonuç önbelleğe alınmaz).
+ */
+static bool fe_shader_compiler_cache_key(const fe_shader_compile_desc_t* desc, const char* source_code, size_t source_size,
+                                         fe_ddc_key_t* out_key) {
+    fe_ddc_key_builder_t builder;
+    fe_ddc_key_begin(&builder, "shader_compiler", FE_SHADER_COMPILER_CACHE_VERSION);
+    fe_ddc_key_add(&builder, source_code, source_size);
+    fe_ddc_key_add_string(&builder, desc->entry_point);
+    fe_ddc_key_add_u64(&builder, (uint64_t)desc->source_language);
+    fe_ddc_key_add_u64(&builder, (uint64_t)desc->shader_stage);
+    fe_ddc_key_add_u64(&builder, (uint64_t)desc->target_api);
+    fe_ddc_key_add_u64(&builder, (uint64_t)desc->debug_info);
+    if (desc->debug_info) {
+        // Hata ayıklama bilgisi kaynak dosya adını bytecode'a gömer; aynı içerikli farklı dosyalar paylaşamaz
+        fe_ddc_key_add_string(&builder, desc->file_path);
+    }
+    fe_ddc_key_add_u64(&builder, (uint64_t)desc->optimize);
+    fe_ddc_key_add_u64(&builder, desc->macro_count);
+    for (uint32_t i = 0; i < desc->macro_count; ++i) {
+        fe_ddc_key_add_string(&builder, desc->macros[i].name);
+        fe_ddc_key_add_string(&builder, desc->macros[i].value);
+    }
+
+    // Arama dizinlerinin kendisi değil, çözülen dosyalar anahtara girer
+    fe_shader_include_scan_t scan;
+    memset(&scan, 0, sizeof(scan));
+    scan.desc = desc;
+    scan.builder = &builder;
+    fe_shader_compiler_hash_includes(&scan, source_code, source_size, desc->file_path, 0);
+    if (scan.overflow) {
+        FE_LOG_WARN("Shader '%s' has too many or too deeply nested includes; result will not be cached.", desc->file_path);
+        return false;
+    }
+    *out_key = fe_ddc_key_end(&builder);
+    return true;
+}
+
+/**
+ * @brief Tüm bağlama adlarının kayıttan geri okunabilecek uzunlukta olup olmadığını denetler.
+ */
+static bool fe_shader_compiler_cache_names_fit(const fe_shader_resource_binding_t* bindings, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (bindings[i].name.data && strlen(bindings[i].name.data) >= FE_SHADER_COMPILER_CACHE_MAX_NAME) return false;
+    }
+    return true;
+}
+
+static size_t fe_shader_compiler_cache_bindings_size(const fe_shader_resource_binding_t* bindings, size_t count) {
+    size_t size = sizeof(uint32_t);
+    for (size_t i = 0; i < count; ++i) {
+        size += 4 * sizeof(uint32_t) + (bindings[i].name.data ? strlen(bindings[i].name.data) : 0);
+    }
+    return size;
+}
+
+static uint8_t* fe_shader_compiler_cache_write_u32(uint8_t* p, uint32_t value) {
+    memcpy(p, &value, sizeof(value));
+    return p + sizeof(value);
+}
+
+static uint8_t* fe_shader_compiler_cache_write_bindings(uint8_t* p, const fe_shader_resource_binding_t* bindings, size_t count) {
+    p = fe_shader_compiler_cache_write_u32(p, (uint32_t)count);
+    for (size_t i = 0; i < count; ++i) {
+        const char* name = bindings[i].name.data ? bindings[i].name.data : "";
+        uint32_t name_length = (uint32_t)strlen(name);
+        p = fe_shader_compiler_cache_write_u32(p, bindings[i].set);
+        p = fe_shader_compiler_cache_write_u32(p, bindings[i].binding);
+        p = fe_shader_compiler_cache_write_u32(p, bindings[i].count);
+        p = fe_shader_compiler_cache_write_u32(p, name_length);
+        memcpy(p, name, name_length);
+        p += name_length;
+    }
+    return p;
+}
+
+static bool fe_shader_compiler_cache_read_u32(const uint8_t** p, const uint8_t* end, uint32_t* out_value) {
+    if ((size_t)(end - *p) < sizeof(uint32_t)) return false;
+    memcpy(out_value, *p, sizeof(uint32_t));
+    *p += sizeof(uint32_t);
+    return true;
+}
+
+/**
+ * @brief Bir bağlama listesini kayıttan okur. Başarısızlıkta o ana kadar ayrılanları serbest bırakır.
+ */
+static bool fe_shader_compiler_cache_read_bindings(const uint8_t** p, const uint8_t* end,
+                                                   fe_shader_resource_binding_t** out_bindings, size_t* out_count) {
+    uint32_t count = 0;
+    if (!fe_shader_compiler_cache_read_u32(p, end, &count)) return false;
+    *out_bindings = NULL;
+    *out_count = 0;
+    if (count == 0) return true;
+    if ((size_t)(end - *p) / (4 * sizeof(uint32_t)) < count) return false;
+
+    fe_shader_resource_binding_t* bindings = fe_malloc(count * sizeof(fe_shader_resource_binding_t), FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    if (!bindings) return false;
+    size_t read = 0;
+    for (; read < count; ++read) {
+        fe_shader_resource_binding_t* binding = &bindings[read];
+        uint32_t name_length = 0;
+        char name[FE_SHADER_COMPILER_CACHE_MAX_NAME];
+        if (!fe_shader_compiler_cache_read_u32(p, end, &binding->set) ||
+            !fe_shader_compiler_cache_read_u32(p, end, &binding->binding) ||
+            !fe_shader_compiler_cache_read_u32(p, end, &binding->count) ||
+            !fe_shader_compiler_cache_read_u32(p, end, &name_length) ||
+            name_length >= sizeof(name) || (size_t)(end - *p) < name_length) {
+            break;
+        }
+        memcpy(name, *p, name_length);
+        name[name_length] = '\0';
+        *p += name_length;
+        fe_string_init(&binding->name, name);
+    }
+    if (read < count) {
+        for (size_t i = 0; i < read; ++i) fe_string_destroy(&bindings[i].name);
+        fe_free(bindings, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+        return false;
+    }
+    *out_bindings = bindings;
+    *out_count = count;
+    return true;
+}
+
+/**
+ * @brief Derleme sonucunu önbelleğe yazar. Hata yalnızca loglanır; derleme yine başarılı sayılır.
+ * Okuma tarafının kabul etmeyeceği uzun bağlama adları varsa kayıt hiç yazılmaz.
+ */
+static void fe_shader_compiler_cache_store(const fe_ddc_key_t* key, const fe_compiled_shader_data_t* compiled,
+                                           const fe_shader_reflection_data_t* reflection) {
+    if (!fe_shader_compiler_cache_names_fit(reflection->uniform_buffers, reflection->uniform_buffer_count) ||
+        !fe_shader_compiler_cache_names_fit(reflection->textures, reflection->texture_count) ||
+        !fe_shader_compiler_cache_names_fit(reflection->samplers, reflection->sampler_count)) {
+        FE_LOG_WARN("Shader has a binding name of %d bytes or more; result will not be cached.", FE_SHADER_COMPILER_CACHE_MAX_NAME);
+        return;
+    }
+    size_t size = sizeof(uint64_t) + compiled->size +
+                  fe_shader_compiler_cache_bindings_size(reflection->uniform_buffers, reflection->uniform_buffer_count) +
+                  fe_shader_compiler_cache_bindings_size(reflection->textures, reflection->texture_count) +
+                  fe_shader_compiler_cache_bindings_size(reflection->samplers, reflection->sampler_count);
+    uint8_t* record = fe_malloc(size, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    if (!record) return;
+
+    uint8_t* p = record;
+    uint64_t code_size = (uint64_t)compiled->size;
+    memcpy(p, &code_size, sizeof(code_size));
+    p += sizeof(code_size);
+    if (compiled->size > 0) memcpy(p, compiled->data, compiled->size);
+    p += compiled->size;
+    p = fe_shader_compiler_cache_write_bindings(p, reflection->uniform_buffers, reflection->uniform_buffer_count);
+    p = fe_shader_compiler_cache_write_bindings(p, reflection->textures, reflection->texture_count);
+    fe_shader_compiler_cache_write_bindings(p, reflection->samplers, reflection->sampler_count);
+
+    fe_ddc_put(key, record, size);
+    fe_free(record, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+}
+
+/**
+ * @brief Önbellekten derleme sonucunu okur.
+ * @param output_reflection_data NULL ise kayıttaki yansıma atlanır.
+ * @return bool Geçerli bir kayıt bulunup çıktılar doldurulduysa true.
+ */
+static bool fe_shader_compiler_cache_load(const fe_ddc_key_t* key, fe_compiled_shader_data_t* output_compiled_data,
+                                          fe_shader_reflection_data_t* output_reflection_data) {
+    void* record = NULL;
+    size_t record_size = 0;
+    if (!fe_ddc_get(key, &record, &record_size)) return false;
+
+    const uint8_t* p = (const uint8_t*)record;
+    const uint8_t* end = p + record_size;
+    uint64_t code_size = 0;
+    bool ok = record_size >= sizeof(code_size);
+    if (ok) {
+        memcpy(&code_size, p, sizeof(code_size));
+        p += sizeof(code_size);
+        ok = code_size > 0 && code_size <= (uint64_t)(end - p);
+    }
+
+    fe_compiled_shader_data_t compiled = { NULL, 0 };
+    fe_shader_reflection_data_t reflection;
+    memset(&reflection, 0, sizeof(reflection));
+    if (ok) {
+        compiled.size = (size_t)code_size;
+        compiled.data = fe_malloc(compiled.size, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+        ok = compiled.data != NULL;
+    }
+    if (ok) {
+        memcpy(compiled.data, p, compiled.size);
+        p += compiled.size;
+        ok = fe_shader_compiler_cache_read_bindings(&p, end, &reflection.uniform_buffers, &reflection.uniform_buffer_count) &&
+             fe_shader_compiler_cache_read_bindings(&p, end, &reflection.textures, &reflection.texture_count) &&
+             fe_shader_compiler_cache_read_bindings(&p, end, &reflection.samplers, &reflection.sampler_count);
+    }
+    FE_FREE(record, FE_MEM_TYPE_GENERAL);
+
+    if (!ok) {
+        FE_LOG_WARN("Derived data cache: malformed shader record; recompiling.");
+        fe_shader_compiler_free_compiled_shader_data(&compiled);
+        fe_shader_compiler_free_reflection_data(&reflection);
+        return false;
+    }
+    *output_compiled_data = compiled;
+    if (output_reflection_data) {
+        *output_reflection_data = reflection;
+    } else {
+        fe_shader_compiler_free_reflection_data(&reflection);
+    }
+    return true;
+}
+
 // --- Ana Fonksiyonlar Uygulaması ---
 
 fe_shader_compiler_error_t fe_shader_compiler_init() {
@@ -222,9 +779,13 @@ fe_shader_compiler_error_t fe_shader_compiler_init() {
         return FE_SHADER_COMPILER_SUCCESS;
     }
 
-    // Harici derleyici kütüphanelerini (Shaderc, DXC) başlatma burada yapılır.
-    // Örn: shaderc_compiler_initialize(), DxcCreateInstance() çağrıları.
-    // Bu, dynamic library loading ile de yapılabilir (LoadLibrary / dlopen).
+    // DXC gibi diğer derleyici kütüphaneleri de burada yüklenir (LoadLibrary / dlopen ile de yapılabilir).
+    // İşçi thread'lerin derleyicileri ilk kullanımda oluşturulur.
+    g_shaderc_compilers[0] = shaderc_compiler_initialize();
+    if (!g_shaderc_compilers[0]) {
+        FE_LOG_ERROR("Failed to initialize Shaderc compiler.");
+        return FE_SHADER_COMPILER_UNKNOWN_ERROR;
+    }
 
     g_is_initialized = true;
     FE_LOG_INFO("Shader compiler initialized.");
@@ -237,65 +798,104 @@ void fe_shader_compiler_shutdown() {
         return;
     }
 
-    // Harici derleyici kütüphanelerini kapatma burada yapılır.
-    // Örn: shaderc_compiler_release(), DXC nesnelerinin serbest bırakılması.
+    // Devam eden derleme olmamalıdır (toplu derlemeler dönmeden önce tüm işlerini bekler)
+    for (uint32_t i = 0; i <= FE_JOB_SYSTEM_MAX_WORKERS; ++i) {
+        if (g_shaderc_compilers[i]) {
+            shaderc_compiler_release(g_shaderc_compilers[i]);
+            g_shaderc_compilers[i] = NULL;
+        }
+    }
 
     g_is_initialized = false;
-    FE_LOG_INFO("Shader compiler shutdown complete.");
+    FE_LOG_INFO("Shader compiler shutdown complete (compiled: %llu, cache hits: %llu).",
+                (unsigned long long)g_stat_compilations, (unsigned long long)g_stat_cache_hits);
 }
 
-fe_shader_compiler_error_t fe_shader_compiler_compile_shader(
-    const char* file_path,
-    fe_shader_source_language_t source_language,
-    const char* entry_point,
-    fe_shader_stage_t shader_stage,
-    fe_shader_target_api_t target_api,
-    bool debug_info,
-    bool optimize,
+/**
+ * @brief fe_shader_compiler_compile'ın gövdesi; toplu derleme işleri de bunu çağırır.
+ * @param error_message Hata ayrıntısının yazılacağı tampon (NULL olabilir).
+ * @param out_cache_hit Sonuç önbellekten geldiyse true yazılır (NULL olabilir).
+ */
+static fe_shader_compiler_error_t fe_shader_compiler_compile_internal(
+    const fe_shader_compile_desc_t* desc,
     fe_compiled_shader_data_t* output_compiled_data,
-    fe_shader_reflection_data_t* output_reflection_data)
+    fe_shader_reflection_data_t* output_reflection_data,
+    char* error_message, size_t error_capacity,
+    bool* out_cache_hit)
 {
+    if (out_cache_hit) *out_cache_hit = false;
     if (!g_is_initialized) {
         FE_LOG_ERROR("Shader compiler not initialized.");
         return FE_SHADER_COMPILER_NOT_INITIALIZED;
     }
-    if (!file_path || !entry_point || !output_compiled_data) {
+    if (!desc || !desc->file_path || !desc->entry_point || !output_compiled_data ||
+        (desc->macro_count > 0 && !desc->macros) || (desc->include_dir_count > 0 && !desc->include_dirs)) {
         FE_LOG_ERROR("Invalid arguments for shader compilation.");
         return FE_SHADER_COMPILER_INVALID_ARGUMENT;
     }
+    for (uint32_t i = 0; i < desc->macro_count; ++i) {
+        if (!desc->macros[i].name) {
+            FE_LOG_ERROR("Invalid arguments for shader compilation (macro %u has no name).", i);
+            return FE_SHADER_COMPILER_INVALID_ARGUMENT;
+        }
+    }
+    const char* file_path = desc->file_path;
 
     FE_LOG_INFO("Compiling shader '%s' (%s - %s) for target %s...",
                 file_path,
-                fe_shader_language_to_string(source_language),
-                fe_shader_stage_to_string(shader_stage),
-                fe_shader_target_api_to_string(target_api));
-
-    // Shader kaynak kodunu oku
-    char* source_code = NULL;
-    size_t source_size = 0;
-    fe_fs_read_text_file(file_path, &source_code, &source_size); // fe_file_system.h'den varsayılan fonksiyon
-    if (!source_code) {
+                fe_shader_language_to_string(desc->source_language),
+                fe_shader_stage_to_string(desc->shader_stage),
+                fe_shader_target_api_to_string(desc->target_api));
+
+    // Shader kaynak kodunu belleğe eşle. Derleyiciler kaynağı (işaretçi, uzunluk) olarak alır;
+    // eşlenmiş görünüm NUL ile sonlanmak zorunda değildir.
+    fe_file_view_t source;
+    if (!fe_file_cache_acquire(file_path, FE_FILE_ACCESS_HINT_SEQUENTIAL, &source)) {
         FE_LOG_ERROR("Failed to read shader file: %s", file_path);
-        return FE_SHADER_COMPILER_FILE_READ_ERROR;
+        if (error_message && error_capacity > 0) snprintf(error_message, error_capacity, "cannot open file");
+        return FE_SHADER_COMPILER_READ_ERROR;
     }
+    const char* source_code = (const char*)source.data;
+    size_t source_size = source.size;
+
+    // Aynı kaynak, include'lar ve seçeneklerle daha önce derlendiyse sonucu önbellekten al. Yalnızca
+    // gerçek derleyicisi olan Vulkan (Shaderc) yolu önbelleğe girer; DXC ve Metal yer tutucularının
+    // sahte çıktısı diske yazılırsa gerçek entegrasyon geldiğinde de önbellekten okunmaya devam ederdi.
+    fe_ddc_key_t cache_key = {{0, 0}};
+    bool use_cache = desc->target_api == FE_SHADER_TARGET_VULKAN && fe_ddc_is_initialized() &&
+                     fe_shader_compiler_cache_key(desc, source_code, source_size, &cache_key);
+    if (use_cache) {
+        if (fe_shader_compiler_cache_load(&cache_key, output_compiled_data, output_reflection_data)) {
+            fe_file_cache_release(&source);
+            fe_atomic_fetch_add_u64(&g_stat_cache_hits, 1, FE_ATOMIC_RELAXED);
+            if (out_cache_hit) *out_cache_hit = true;
+            FE_LOG_INFO("Shader '%s' loaded from derived data cache.", file_path);
+            return FE_SHADER_COMPILER_SUCCESS;
+        }
+        fe_atomic_fetch_add_u64(&g_stat_cache_misses, 1, FE_ATOMIC_RELAXED);
+    }
+    fe_atomic_fetch_add_u64(&g_stat_compilations, 1, FE_ATOMIC_RELAXED);
+
+    // Yansıma çağıran istemese de üretilir; önbellek kaydı sonraki her çağrıyı karşılayabilmeli
+    fe_shader_reflection_data_t reflection;
+    memset(&reflection, 0, sizeof(reflection));
 
     fe_shader_compiler_error_t result = FE_SHADER_COMPILER_UNKNOWN_ERROR;
 
     // Hedef API'ye göre derleyici çağrısı
-    switch (target_api) {
+    switch (desc->target_api) {
         case FE_SHADER_TARGET_VULKAN:
-            // Vulkan için genellikle GLSL veya HLSL'den SPIR-V'ye derleme yapılır (Shaderc kullanılır)
+            // Vulkan için GLSL veya HLSL'den SPIR-V'ye derleme yapılır (Shaderc kullanılır)
             result = fe_shader_compiler_compile_shaderc(
-                source_code, source_size, source_language, entry_point, shader_stage,
-                debug_info, optimize, output_compiled_data, output_reflection_data
+                desc, source_code, source_size, output_compiled_data, &reflection, error_message, error_capacity
             );
             break;
         case FE_SHADER_TARGET_DIRECTX11: // DXBC (eski)
         case FE_SHADER_TARGET_DIRECTX12: // DXIL (yeni)
             // DirectX için HLSL'den DXIL/DXBC'ye derleme yapılır (DXC kullanılır)
             result = fe_shader_compiler_compile_dxc(
-                source_code, source_size, entry_point, shader_stage,
-                target_api, debug_info, optimize, output_compiled_data, output_reflection_data
+                source_code, source_size, desc->entry_point, desc->shader_stage,
+                desc->target_api, desc->debug_info, desc->optimize, output_compiled_data, &reflection
             );
             break;
         case FE_SHADER_TARGET_METAL:
@@ -303,27 +903,209 @@ fe_shader_compiler_error_t fe_shader_compiler_compile_shader(
             // Bu genellikle Objective-C/C++ ara katmanı ile ele alınır.
             // Burada sadece MSL kaynak kodu olduğunu varsayıyoruz.
             result = fe_shader_compiler_compile_msl(
-                source_code, source_size, entry_point, shader_stage,
-                debug_info, optimize, output_compiled_data, output_reflection_data
+                source_code, source_size, desc->entry_point, desc->shader_stage,
+                desc->debug_info, desc->optimize, output_compiled_data, &reflection
             );
             break;
         default:
-            FE_LOG_ERROR("Unsupported shader target API: %s", fe_shader_target_api_to_string(target_api));
+            FE_LOG_ERROR("Unsupported shader target API: %s", fe_shader_target_api_to_string(desc->target_api));
             result = FE_SHADER_COMPILER_INVALID_ARGUMENT;
             break;
     }
 
-    fe_free(source_code, FE_MEM_TYPE_GENERAL, __FILE__, __LINE__); // Okunan kaynak kodu serbest bırak
+    fe_file_cache_release(&source); // Eşlenmiş kaynak kodu bırak
 
     if (result != FE_SHADER_COMPILER_SUCCESS) {
         FE_LOG_ERROR("Shader compilation failed for '%s'.", file_path);
+        fe_atomic_fetch_add_u64(&g_stat_failures, 1, FE_ATOMIC_RELAXED);
+        fe_shader_compiler_free_reflection_data(&reflection);
     } else {
-        FE_LOG_INFO("Shader '%s' compiled successfully for %s.", file_path, fe_shader_target_api_to_string(target_api));
+        FE_LOG_INFO("Shader '%s' compiled successfully for %s.", file_path, fe_shader_target_api_to_string(desc->target_api));
+        if (use_cache) fe_shader_compiler_cache_store(&cache_key, output_compiled_data, &reflection);
+        if (output_reflection_data) {
+            *output_reflection_data = reflection;
+        } else {
+            fe_shader_compiler_free_reflection_data(&reflection);
+        }
     }
 
     return result;
 }
 
+fe_shader_compiler_error_t fe_shader_compiler_compile(
+    const fe_shader_compile_desc_t* desc,
+    fe_compiled_shader_data_t* output_compiled_data,
+    fe_shader_reflection_data_t* output_reflection_data)
+{
+    return fe_shader_compiler_compile_internal(desc, output_compiled_data, output_reflection_data, NULL, 0, NULL);
+}
+
+// --- Toplu Derleme ---
+// Her istek ayrı bir iş olarak iş sistemine gönderilir; işler çağıran thread'in kendi derleyicisini
+// (fe_shader_compiler_acquire_shaderc) kullanır ve sonucu isteğin sırasındaki yuvaya yazar.
+// Çağıran thread beklerken işlere yardım eder.
+
+// Bir toplu derleme işinin durumu
+typedef struct fe_shader_batch_job {
+    const fe_shader_compile_desc_t* desc;
+    fe_shader_compile_result_t*     result;
+    bool                            cache_hit;
+    char                            error_message[FE_SHADER_COMPILER_MAX_ERROR_MESSAGE];
+} fe_shader_batch_job_t;
+
+static void fe_shader_compiler_batch_job(void* user_data) {
+    fe_shader_batch_job_t* job = (fe_shader_batch_job_t*)user_data;
+    job->result->error = fe_shader_compiler_compile_internal(job->desc, &job->result->compiled, &job->result->reflection,
+                                                             job->error_message, sizeof(job->error_message), &job->cache_hit);
+}
+
+/**
+ * @brief Başarısız işlerin hatalarını istek sırasıyla tek bir metinde toplar ("yol [aşama, giriş]: hata: ayrıntı").
+ */
+static char* fe_shader_compiler_build_error_log(const fe_shader_batch_job_t* jobs, uint32_t count) {
+    size_t capacity = 1;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (jobs[i].result->error == FE_SHADER_COMPILER_SUCCESS) continue;
+        const fe_shader_compile_desc_t* desc = jobs[i].desc;
+        capacity += strlen(desc->file_path ? desc->file_path : "(null)") +
+                    strlen(desc->entry_point ? desc->entry_point : "(null)") + strlen(jobs[i].error_message) + 96;
+    }
+    char* log = fe_malloc(capacity, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    if (!log) return NULL;
+    size_t length = 0;
+    log[0] = '\0';
+    for (uint32_t i = 0; i < count; ++i) {
+        const fe_shader_batch_job_t* job = &jobs[i];
+        if (job->result->error == FE_SHADER_COMPILER_SUCCESS) continue;
+        int written = snprintf(log + length, capacity - length, "%s [%s, %s]: %s%s%s\n",
+                               job->desc->file_path ? job->desc->file_path : "(null)",
+                               fe_shader_stage_to_string(job->desc->shader_stage),
+                               job->desc->entry_point ? job->desc->entry_point : "(null)", fe_shader_compiler_error_to_string(job->result->error),
+                               job->error_message[0] ? ": " : "", job->error_message);
+        if (written < 0 || (size_t)written >= capacity - length) break;
+        length += (size_t)written;
+    }
+    return log;
+}
+
+fe_shader_compiler_error_t fe_shader_compiler_compile_batch(
+    const fe_shader_compile_desc_t* descs,
+    uint32_t count,
+    fe_shader_compile_result_t* out_results,
+    fe_shader_batch_report_t* out_report)
+{
+    if (out_report) memset(out_report, 0, sizeof(fe_shader_batch_report_t));
+    if (!g_is_initialized) {
+        FE_LOG_ERROR("Shader compiler not initialized.");
+        return FE_SHADER_COMPILER_NOT_INITIALIZED;
+    }
+    if (count > 0 && (!descs || !out_results)) {
+        FE_LOG_ERROR("Invalid arguments for batch shader compilation.");
+        return FE_SHADER_COMPILER_INVALID_ARGUMENT;
+    }
+    if (count == 0) return FE_SHADER_COMPILER_SUCCESS;
+
+    memset(out_results, 0, count * sizeof(fe_shader_compile_result_t));
+    fe_shader_batch_job_t* jobs = fe_malloc(count * sizeof(fe_shader_batch_job_t), FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    fe_job_decl_t* decls = fe_malloc(count * sizeof(fe_job_decl_t), FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    if (!jobs || !decls) {
+        if (jobs) fe_free(jobs, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+        if (decls) fe_free(decls, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+        return FE_SHADER_COMPILER_OUT_OF_MEMORY;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        jobs[i].desc = &descs[i];
+        jobs[i].result = &out_results[i];
+        jobs[i].cache_hit = false;
+        jobs[i].error_message[0] = '\0';
+        out_results[i].error = FE_SHADER_COMPILER_UNKNOWN_ERROR;
+        decls[i].func = fe_shader_compiler_batch_job;
+        decls[i].user_data = &jobs[i];
+        decls[i].main_thread_only = false;
+    }
+
+    FE_LOG_INFO("Compiling %u shader(s) on %u thread(s)...", count,
+                fe_job_system_is_initialized() ? fe_job_system_worker_count() + 1 : 1);
+    fe_job_counter_t counter = FE_JOB_COUNTER_INIT;
+    if (fe_job_system_is_initialized() && fe_job_system_run(decls, count, &counter)) {
+        fe_job_system_wait_for_counter(&counter);
+    } else {
+        for (uint32_t i = 0; i < count; ++i) fe_shader_compiler_batch_job(&jobs[i]);
+    }
+
+    // Sonuçları istek sırasıyla topla
+    fe_shader_compiler_error_t first_error = FE_SHADER_COMPILER_SUCCESS;
+    uint32_t failed = 0;
+    uint32_t cache_hits = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (jobs[i].cache_hit) cache_hits++;
+        if (out_results[i].error != FE_SHADER_COMPILER_SUCCESS) {
+            if (failed++ == 0) first_error = out_results[i].error;
+        }
+    }
+    if (out_report) {
+        out_report->succeeded = count - failed;
+        out_report->failed = failed;
+        out_report->cache_hits = cache_hits;
+        if (failed > 0) out_report->error_log = fe_shader_compiler_build_error_log(jobs, count);
+    }
+    if (failed > 0) {
+        FE_LOG_ERROR("Batch shader compilation: %u of %u shader(s) failed.", failed, count);
+    } else {
+        FE_LOG_INFO("Batch shader compilation: %u shader(s) compiled (%u from cache).", count, cache_hits);
+    }
+
+    fe_free(decls, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    fe_free(jobs, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+    return first_error;
+}
+
+void fe_shader_compiler_free_batch_results(fe_shader_compile_result_t* results, uint32_t count) {
+    if (!results) return;
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_shader_compiler_free_compiled_shader_data(&results[i].compiled);
+        fe_shader_compiler_free_reflection_data(&results[i].reflection);
+    }
+}
+
+void fe_shader_compiler_free_batch_report(fe_shader_batch_report_t* report) {
+    if (report && report->error_log) {
+        fe_free(report->error_log, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
+        report->error_log = NULL;
+    }
+}
+
+fe_shader_compiler_error_t fe_shader_compiler_compile_shader(
+    const char* file_path,
+    fe_shader_source_language_t source_language,
+    const char* entry_point,
+    fe_shader_stage_t shader_stage,
+    fe_shader_target_api_t target_api,
+    bool debug_info,
+    bool optimize,
+    fe_compiled_shader_data_t* output_compiled_data,
+    fe_shader_reflection_data_t* output_reflection_data)
+{
+    fe_shader_compile_desc_t desc;
+    memset(&desc, 0, sizeof(desc));
+    desc.file_path = file_path;
+    desc.source_language = source_language;
+    desc.entry_point = entry_point;
+    desc.shader_stage = shader_stage;
+    desc.target_api = target_api;
+    desc.debug_info = debug_info;
+    desc.optimize = optimize;
+    return fe_shader_compiler_compile(&desc, output_compiled_data, output_reflection_data);
+}
+
+void fe_shader_compiler_get_stats(fe_shader_compiler_stats_t* out_stats) {
+    if (!out_stats) return;
+    out_stats->cache_hits = fe_atomic_load_u64(&g_stat_cache_hits, FE_ATOMIC_RELAXED);
+    out_stats->cache_misses = fe_atomic_load_u64(&g_stat_cache_misses, FE_ATOMIC_RELAXED);
+    out_stats->compilations = fe_atomic_load_u64(&g_stat_compilations, FE_ATOMIC_RELAXED);
+    out_stats->failures = fe_atomic_load_u64(&g_stat_failures, FE_ATOMIC_RELAXED);
+}
+
 void fe_shader_compiler_free_compiled_shader_data(fe_compiled_shader_data_t* data) {
     if (data && data->data) {
         fe_free(data->data, FE_MEM_TYPE_GRAPHICS_SHADER, __FILE__, __LINE__);
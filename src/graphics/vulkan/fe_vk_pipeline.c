@@ -1,59 +1,32 @@
 #include "graphics/vulkan/fe_vk_pipeline.h"
 #include "core/utils/fe_logger.h"
 #include "core/memory/fe_memory_manager.h"
+#include "platform/fe_file_cache.h" // SPIR-V dosyalarını kopyalamadan okumak için
+#include "core/utils/fe_hash.h"     // Sürücü önbelleği verisinin değişip değişmediğini anlamak için
 
 #include <string.h> // memset
-#include <stdio.h>  // fopen, fread, fclose
 #include <stdlib.h> // size_t
 
 // --- Dahili Yardımcı Fonksiyonlar ---
 
-// SPV dosyasını okur
-static size_t fe_vk_pipeline_read_file(const char* filename, char** buffer) {
-    FILE* file = fopen(filename, "rb");
-    if (!file) {
-        FE_LOG_ERROR("Failed to open shader file: %s", filename);
-        return 0;
-    }
-
-    fseek(file, 0, SEEK_END);
-    size_t file_size = ftell(file);
-    rewind(file);
-
-    *buffer = fe_malloc(file_size, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
-    if (!(*buffer)) {
-        FE_LOG_ERROR("Failed to allocate memory for shader file: %s", filename);
-        fclose(file);
-        return 0;
-    }
-
-    size_t bytes_read = fread(*buffer, 1, file_size, file);
-    if (bytes_read != file_size) {
-        FE_LOG_ERROR("Failed to read entire shader file: %s", filename);
-        fe_free(*buffer, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
-        *buffer = NULL;
-        fclose(file);
-        return 0;
-    }
-
-    fclose(file);
-    return file_size;
-}
-
-// Shader modülü oluşturma
+// Shader modülü oluşturma. SPIR-V dosyası belleğe eşlenir ve doğrudan vkCreateShaderModule'e verilir;
+// eşleme sayfa hizalı olduğundan pCode'un 4 bayt hizalama şartı sağlanır.
 VkShaderModule fe_vk_pipeline_create_shader_module(VkDevice logical_device, const char* code_path) {
-    char* code_buffer = NULL;
-    size_t code_size = fe_vk_pipeline_read_file(code_path, &code_buffer);
-
-    if (code_size == 0 || code_buffer == NULL) {
+    fe_file_view_t code;
+    if (!fe_file_cache_acquire(code_path, FE_FILE_ACCESS_HINT_SEQUENTIAL, &code)) {
         FE_LOG_ERROR("Failed to read shader code from file: %s", code_path);
         return VK_NULL_HANDLE;
     }
+    if (code.size % 4 != 0) {
+        FE_LOG_ERROR("Shader file '%s' is not valid SPIR-V (size %zu is not a multiple of 4).", code_path, code.size);
+        fe_file_cache_release(&code);
+        return VK_NULL_HANDLE;
+    }
 
     VkShaderModuleCreateInfo create_info = {
         .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-        .codeSize = code_size,
-        .pCode = (const uint32_t*)code_buffer
+        .codeSize = code.size,
+        .pCode = (const uint32_t*)code.data
     };
 
     VkShaderModule shader_module;
@@ -65,7 +38,7 @@ VkShaderModule fe_vk_pipeline_create_shader_module(VkDevice logical_device, cons
         FE_LOG_DEBUG("Shader module created from: %s", code_path);
     }
 
-    fe_free(code_buffer, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    fe_file_cache_release(&code);
     return shader_module;
 }
 
@@ -156,6 +129,11 @@ void fe_vk_pipeline_default_config(fe_vk_pipeline_config_t* config, uint32_t wid
 
 
 fe_vk_pipeline_t* fe_vk_pipeline_create(VkDevice logical_device, const fe_vk_pipeline_config_t* config) {
+    return fe_vk_pipeline_create_with_cache(logical_device, config, VK_NULL_HANDLE);
+}
+
+fe_vk_pipeline_t* fe_vk_pipeline_create_with_cache(VkDevice logical_device, const fe_vk_pipeline_config_t* config,
+                                                   VkPipelineCache pipeline_cache) {
     if (logical_device == VK_NULL_HANDLE || config == NULL) {
         FE_LOG_ERROR("fe_vk_pipeline_create: logical_device or config is NULL.");
         return NULL;
@@ -330,7 +308,7 @@ fe_vk_pipeline_t* fe_vk_pipeline_create(VkDevice logical_device, const fe_vk_pip
         .basePipelineIndex = -1             // Opsiyonel
     };
 
-    VkResult result = vkCreateGraphicsPipelines(logical_device, VK_NULL_HANDLE, 1, &pipeline_create_info, NULL, &pipeline->graphics_pipeline);
+    VkResult result = vkCreateGraphicsPipelines(logical_device, pipeline_cache, 1, &pipeline_create_info, NULL, &pipeline->graphics_pipeline);
     if (result != VK_SUCCESS) {
         FE_LOG_ERROR("Failed to create graphics pipeline! VkResult: %d", result);
         // Hata durumunda oluşturulan shader modüllerini temizle
@@ -372,3 +350,256 @@ void fe_vk_pipeline_destroy(VkDevice logical_device, fe_vk_pipeline_t* pipeline)
     fe_free(pipeline, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
     FE_LOG_INFO("fe_vk_pipeline_t object freed.");
 }
+
+// --- Pipeline Önbelleği ---
+
+// Sürücü önbelleği verisinin kayıt formatı değişirse artırılır
+#define FE_VK_PIPELINE_CACHE_DATA_VERSION 1u
+
+static bool fe_vk_pipeline_has_dynamic_state(const fe_vk_pipeline_config_t* config, VkDynamicState state) {
+    for (uint32_t i = 0; i < config->dynamic_state_count; ++i) {
+        if (config->dynamic_states[i] == state) return true;
+    }
+    return false;
+}
+
+void fe_vk_pipeline_config_to_key(const fe_vk_pipeline_config_t* config, fe_pipeline_key_t* key) {
+    // Layout ve render pass nesne kimlikleriyle ayırt edilir; bu yüzden kendilerinden önce yok
+    // edilemezler (yeniden kullanılan bir adres eski pipeline'ı eşlerdi)
+    fe_pipeline_key_add(key, &config->pipeline_layout, sizeof(config->pipeline_layout));
+    fe_pipeline_key_add_u64(key, (uint64_t)(uintptr_t)config->render_pass);
+    fe_pipeline_key_add_u32(key, config->subpass_index);
+
+    fe_pipeline_key_add_u32(key, config->shader_stage_count);
+    for (uint32_t i = 0; i < config->shader_stage_count; ++i) {
+        fe_pipeline_key_add_u32(key, (uint32_t)config->shader_stages[i].stage);
+        fe_pipeline_key_add_string(key, config->shader_stages[i].file_path);
+        fe_pipeline_key_add_string(key, config->shader_stages[i].entry_point);
+    }
+
+    fe_pipeline_key_add_u32(key, config->binding_description_count);
+    for (uint32_t i = 0; i < config->binding_description_count; ++i) {
+        const fe_vk_vertex_input_binding_description_t* binding = &config->binding_descriptions[i];
+        fe_pipeline_key_add_u32(key, binding->binding);
+        fe_pipeline_key_add_u32(key, binding->stride);
+        fe_pipeline_key_add_u32(key, (uint32_t)binding->input_rate);
+    }
+    fe_pipeline_key_add_u32(key, config->attribute_description_count);
+    for (uint32_t i = 0; i < config->attribute_description_count; ++i) {
+        const fe_vk_vertex_input_attribute_description_t* attribute = &config->attribute_descriptions[i];
+        fe_pipeline_key_add_u32(key, attribute->location);
+        fe_pipeline_key_add_u32(key, attribute->binding);
+        fe_pipeline_key_add_u32(key, (uint32_t)attribute->format);
+        fe_pipeline_key_add_u32(key, attribute->offset);
+    }
+
+    fe_pipeline_key_add_u32(key, (uint32_t)config->topology);
+    fe_pipeline_key_add_u32(key, config->primitive_restart_enable);
+
+    // Dinamik viewport/scissor değerleri pipeline'a gömülmez
+    if (!fe_vk_pipeline_has_dynamic_state(config, VK_DYNAMIC_STATE_VIEWPORT)) {
+        fe_pipeline_key_add_float(key, config->viewport.x);
+        fe_pipeline_key_add_float(key, config->viewport.y);
+        fe_pipeline_key_add_float(key, config->viewport.width);
+        fe_pipeline_key_add_float(key, config->viewport.height);
+        fe_pipeline_key_add_float(key, config->viewport.minDepth);
+        fe_pipeline_key_add_float(key, config->viewport.maxDepth);
+    }
+    if (!fe_vk_pipeline_has_dynamic_state(config, VK_DYNAMIC_STATE_SCISSOR)) {
+        fe_pipeline_key_add_u32(key, (uint32_t)config->scissor.offset.x);
+        fe_pipeline_key_add_u32(key, (uint32_t)config->scissor.offset.y);
+        fe_pipeline_key_add_u32(key, config->scissor.extent.width);
+        fe_pipeline_key_add_u32(key, config->scissor.extent.height);
+    }
+
+    fe_pipeline_key_add_u32(key, (uint32_t)config->polygon_mode);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->cull_mode);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->front_face);
+    fe_pipeline_key_add_float(key, config->line_width);
+    fe_pipeline_key_add_u32(key, config->depth_bias_enable);
+
+    fe_pipeline_key_add_u32(key, (uint32_t)config->rasterization_samples);
+    fe_pipeline_key_add_u32(key, config->sample_shading_enable);
+    fe_pipeline_key_add_float(key, config->min_sample_shading);
+
+    fe_pipeline_key_add_u32(key, config->depth_test_enable);
+    fe_pipeline_key_add_u32(key, config->depth_write_enable);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->depth_compare_op);
+    fe_pipeline_key_add_u32(key, config->stencil_test_enable);
+
+    fe_pipeline_key_add_u32(key, config->blend_enable);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->src_color_blend_factor);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->dst_color_blend_factor);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->color_blend_op);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->src_alpha_blend_factor);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->dst_alpha_blend_factor);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->alpha_blend_op);
+    fe_pipeline_key_add_u32(key, (uint32_t)config->color_write_mask);
+
+    fe_pipeline_key_add_u32(key, config->dynamic_state_count);
+    for (uint32_t i = 0; i < config->dynamic_state_count; ++i) {
+        fe_pipeline_key_add_u32(key, (uint32_t)config->dynamic_states[i]);
+    }
+}
+
+// Tekilleştirme önbelleğinin oluşturma fonksiyonuna verilen bağlam
+typedef struct fe_vk_pipeline_create_request {
+    fe_vk_pipeline_cache_t*        cache;
+    const fe_vk_pipeline_config_t* config;
+} fe_vk_pipeline_create_request_t;
+
+static void* fe_vk_pipeline_cache_create_pipeline(const void* key, size_t key_size, void* user_data) {
+    (void)key;
+    (void)key_size;
+    fe_vk_pipeline_create_request_t* request = (fe_vk_pipeline_create_request_t*)user_data;
+    return fe_vk_pipeline_create_with_cache(request->cache->logical_device, request->config, request->cache->vk_cache);
+}
+
+static void fe_vk_pipeline_cache_destroy_pipeline(void* pipeline, void* context) {
+    fe_vk_pipeline_cache_t* cache = (fe_vk_pipeline_cache_t*)context;
+    fe_vk_pipeline_destroy(cache->logical_device, (fe_vk_pipeline_t*)pipeline);
+}
+
+/**
+ * @brief Diskten okunan verinin başlığının bu cihaza ait olduğunu doğrular. Anahtar zaten cihaza
+ * özeldir; bu kontrol, hatalı veriyi reddetmeyen sürücülere karşı ek bir güvencedir.
+ */
+static bool fe_vk_pipeline_cache_data_is_valid(const void* data, size_t size, const VkPhysicalDeviceProperties* properties) {
+    VkPipelineCacheHeaderVersionOne header;
+    if (size < sizeof(header)) return false;
+    memcpy(&header, data, sizeof(header));
+    return header.headerSize >= sizeof(header) && header.headerSize <= size &&
+           header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == properties->vendorID && header.deviceID == properties->deviceID &&
+           memcmp(header.pipelineCacheUUID, properties->pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+fe_vk_pipeline_cache_t* fe_vk_pipeline_cache_create(VkDevice logical_device, VkPhysicalDevice physical_device) {
+    if (logical_device == VK_NULL_HANDLE || physical_device == VK_NULL_HANDLE) {
+        FE_LOG_ERROR("fe_vk_pipeline_cache_create: logical_device or physical_device is NULL.");
+        return NULL;
+    }
+    fe_vk_pipeline_cache_t* cache = fe_malloc(sizeof(fe_vk_pipeline_cache_t), FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    if (!cache) {
+        FE_LOG_ERROR("Failed to allocate memory for fe_vk_pipeline_cache_t.");
+        return NULL;
+    }
+    memset(cache, 0, sizeof(fe_vk_pipeline_cache_t));
+    cache->logical_device = logical_device;
+    if (!fe_pipeline_cache_init(&cache->pipelines, fe_vk_pipeline_cache_destroy_pipeline, cache)) {
+        fe_free(cache, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+        return NULL;
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+    fe_ddc_key_builder_t builder;
+    fe_ddc_key_begin(&builder, "vk_pipeline_cache", FE_VK_PIPELINE_CACHE_DATA_VERSION);
+    fe_ddc_key_add_u64(&builder, properties.vendorID);
+    fe_ddc_key_add_u64(&builder, properties.deviceID);
+    fe_ddc_key_add_u64(&builder, properties.driverVersion);
+    fe_ddc_key_add(&builder, properties.pipelineCacheUUID, VK_UUID_SIZE);
+    cache->data_key = fe_ddc_key_end(&builder);
+
+    // Önceki çalıştırmanın verisi (yoksa veya geçersizse boş önbellekle başlanır)
+    void* initial_data = NULL;
+    size_t initial_size = 0;
+    if (fe_ddc_is_initialized() && fe_ddc_get(&cache->data_key, &initial_data, &initial_size)) {
+        if (!fe_vk_pipeline_cache_data_is_valid(initial_data, initial_size, &properties)) {
+            FE_LOG_WARN("Stored Vulkan pipeline cache data does not match this device; starting empty.");
+            FE_FREE(initial_data, FE_MEM_TYPE_GENERAL);
+            initial_data = NULL;
+            initial_size = 0;
+        }
+    }
+
+    VkPipelineCacheCreateInfo create_info = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+        .initialDataSize = initial_size,
+        .pInitialData = initial_data
+    };
+    VkResult result = vkCreatePipelineCache(logical_device, &create_info, NULL, &cache->vk_cache);
+    if (result != VK_SUCCESS && initial_data) {
+        // Sürücü veriyi reddettiyse boş önbellekle yeniden dene
+        FE_LOG_WARN("Driver rejected stored pipeline cache data (VkResult: %d); starting empty.", result);
+        create_info.initialDataSize = 0;
+        create_info.pInitialData = NULL;
+        result = vkCreatePipelineCache(logical_device, &create_info, NULL, &cache->vk_cache);
+    } else if (initial_data) {
+        cache->saved_data_hash = fe_hash64(initial_data, initial_size, 0);
+        FE_LOG_INFO("Vulkan pipeline cache restored (%zu bytes).", initial_size);
+    }
+    if (initial_data) FE_FREE(initial_data, FE_MEM_TYPE_GENERAL);
+
+    if (result != VK_SUCCESS) {
+        FE_LOG_ERROR("Failed to create Vulkan pipeline cache! VkResult: %d", result);
+        fe_pipeline_cache_shutdown(&cache->pipelines);
+        fe_free(cache, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+        return NULL;
+    }
+    return cache;
+}
+
+bool fe_vk_pipeline_cache_save(fe_vk_pipeline_cache_t* cache) {
+    if (!cache || cache->vk_cache == VK_NULL_HANDLE) return false;
+    if (!fe_ddc_is_initialized()) {
+        FE_LOG_DEBUG("Derived data cache is disabled; Vulkan pipeline cache data is not persisted.");
+        return false;
+    }
+
+    size_t size = 0;
+    if (vkGetPipelineCacheData(cache->logical_device, cache->vk_cache, &size, NULL) != VK_SUCCESS || size == 0) {
+        return false;
+    }
+    void* data = fe_malloc(size, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    if (!data) return false;
+    // Boyut sorgusu ile okuma arasında önbellek büyüyebilir; VK_INCOMPLETE ile kesik veri yazılmaz
+    VkResult result = vkGetPipelineCacheData(cache->logical_device, cache->vk_cache, &size, data);
+    bool saved = false;
+    if (result == VK_SUCCESS) {
+        uint64_t data_hash = fe_hash64(data, size, 0);
+        if (data_hash == cache->saved_data_hash) {
+            saved = true; // Değişmedi
+        } else if (fe_ddc_put(&cache->data_key, data, size)) {
+            cache->saved_data_hash = data_hash;
+            saved = true;
+            FE_LOG_INFO("Vulkan pipeline cache saved (%zu bytes).", size);
+        }
+    } else {
+        FE_LOG_WARN("Failed to read Vulkan pipeline cache data (VkResult: %d).", result);
+    }
+    fe_free(data, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+    return saved;
+}
+
+void fe_vk_pipeline_cache_destroy(fe_vk_pipeline_cache_t* cache) {
+    if (!cache) return;
+    fe_vk_pipeline_cache_save(cache);
+    fe_pipeline_cache_shutdown(&cache->pipelines);
+    vkDestroyPipelineCache(cache->logical_device, cache->vk_cache, NULL);
+    fe_free(cache, FE_MEM_TYPE_GRAPHICS, __FILE__, __LINE__);
+}
+
+fe_vk_pipeline_t* fe_vk_pipeline_cache_acquire(fe_vk_pipeline_cache_t* cache, const fe_vk_pipeline_config_t* config) {
+    if (!cache || !config) {
+        FE_LOG_ERROR("fe_vk_pipeline_cache_acquire: cache or config is NULL.");
+        return NULL;
+    }
+    fe_pipeline_key_t key;
+    fe_pipeline_key_init(&key);
+    fe_vk_pipeline_config_to_key(config, &key);
+
+    fe_vk_pipeline_create_request_t request = { cache, config };
+    uint64_t hash = 0;
+    fe_vk_pipeline_t* pipeline = (fe_vk_pipeline_t*)fe_pipeline_cache_acquire(&cache->pipelines, &key,
+                                                                              fe_vk_pipeline_cache_create_pipeline,
+                                                                              &request, &hash);
+    fe_pipeline_key_destroy(&key);
+    if (pipeline) pipeline->config_hash = hash;
+    return pipeline;
+}
+
+void fe_vk_pipeline_cache_release(fe_vk_pipeline_cache_t* cache, fe_vk_pipeline_t* pipeline) {
+    if (!cache || !pipeline) return;
+    fe_pipeline_cache_release(&cache->pipelines, pipeline->config_hash, pipeline);
+}
@@ -0,0 +1,563 @@
+#include "core/jobs/fe_job_system.h"
+#include "core/containers/fe_ring_queue.h" // fe_mpmc_queue_t için
+#include "core/memory/fe_memory_manager.h" // FE_MALLOC, FE_FREE için
+#include "core/utils/fe_logger.h"          // Loglama için
+#include "platform/fe_thread.h"            // fe_thread_t, fe_mutex_t, fe_cond_t için
+#include "core/utils/fe_profiler.h"        // İşçi thread adlarını profilleyiciye bildirmek için
+
+#include <string.h> // memset için
+#include <stdio.h>  // snprintf için
+
+#define FE_JOB_SYSTEM_JOB_MASK (FE_JOB_SYSTEM_MAX_JOBS - 1)
+
+// Bir işçinin uyumadan önce iş arayarak döneceği tur sayısı.
+#define FE_JOB_SYSTEM_IDLE_SPINS 256
+
+// Kaçırılmış bir uyandırma sinyaline karşı işçilerin en fazla uyuyacağı süre (ms).
+#define FE_JOB_SYSTEM_SLEEP_TIMEOUT_MS 2
+
+// --- İç Yapılar ---
+
+/**
+ * @brief Havuzdaki tek bir iş.
+ */
+typedef struct fe_job {
+    fe_job_func       func;
+    void*             user_data;
+    fe_job_counter_t* counter;          // İş bitince azaltılacak sayaç (NULL olabilir)
+    uint32_t          next_waiting;     // Aynı sayacı bekleyen bir sonraki iş (indeks + 1, 0 ise son)
+    bool              main_thread_only;
+} fe_job_t;
+
+/**
+ * @brief Chase-Lev iş çalma deque'si. Sahibi bottom ucunda push/take, diğerleri top ucunda steal yapar.
+ * Toplam canlı iş sayısı FE_JOB_SYSTEM_MAX_JOBS ile sınırlı olduğundan deque asla taşmaz.
+ * İndeksler monoton artar; karşılaştırmalar işaretli yapılır (boş deque'de take bottom'u -1'e indirir).
+ */
+typedef struct fe_job_deque {
+    uint64_t  top;
+    uint8_t   pad0[FE_CACHE_LINE_SIZE - sizeof(uint64_t)];
+    uint64_t  bottom;
+    uint32_t* slots;            // FE_JOB_SYSTEM_MAX_JOBS iş indeksi
+    uint64_t  jobs_executed;    // Bu thread'in çalıştırdığı iş sayısı
+    uint64_t  jobs_stolen;      // Bu thread'in çalarak çalıştırdığı iş sayısı
+    uint32_t  steal_seed;       // Kurban seçimi için xorshift durumu
+    uint8_t   pad1[FE_CACHE_LINE_SIZE];
+} fe_job_deque_t;
+
+/**
+ * @brief İş sisteminin global durumu.
+ */
+typedef struct fe_job_system_state {
+    bool             is_initialized;
+    uint32_t         worker_count;      // Deque'si ayrılan işçi sayısı
+    uint32_t         started_count;     // Gerçekten başlatılan işçi thread sayısı
+    uint32_t         quit;              // İşçilere çıkış sinyali (atomik)
+
+    fe_job_t*        jobs;              // FE_JOB_SYSTEM_MAX_JOBS işlik havuz
+    fe_mpmc_queue_t  free_jobs;         // Boş iş indeksleri
+    fe_mpmc_queue_t  injection_queue;   // İşçi olmayan thread'lerden gelen işler
+    fe_mpmc_queue_t  main_thread_queue; // Yalnızca ana thread'in çalıştırabileceği işler
+
+    fe_job_deque_t*  deques;            // [0] ana thread, [1..worker_count] işçiler
+    fe_thread_t      workers[FE_JOB_SYSTEM_MAX_WORKERS];
+
+    fe_mutex_t       sleep_mutex;
+    fe_cond_t        wake_cond;
+    uint32_t         sleeper_count;     // Uyumakta olan işçi sayısı (atomik)
+} fe_job_system_state_t;
+
+static fe_job_system_state_t g_job_system;
+
+// Çağıran thread'in deque indeksi (ana thread 0, işçiler 1..N, diğerleri -1).
+static FE_THREAD_LOCAL int s_job_thread_index = -1;
+
+// --- Chase-Lev Deque ---
+
+static void fe_job_deque_push(fe_job_deque_t* deque, uint32_t job_index) {
+    uint64_t bottom = fe_atomic_load_u64(&deque->bottom, FE_ATOMIC_RELAXED);
+    fe_atomic_store_u32(&deque->slots[bottom & FE_JOB_SYSTEM_JOB_MASK], job_index, FE_ATOMIC_RELAXED);
+    // Release: işin içeriği ve yuva, bottom'u gören çalıcılara görünür olur.
+    fe_atomic_store_u64(&deque->bottom, bottom + 1, FE_ATOMIC_RELEASE);
+}
+
+static bool fe_job_deque_take(fe_job_deque_t* deque, uint32_t* out_job_index) {
+    uint64_t bottom = fe_atomic_load_u64(&deque->bottom, FE_ATOMIC_RELAXED) - 1;
+    // bottom yazımı ile top okuması arasında tam sıralama gerekir (çalıcılarla yarış).
+    fe_atomic_store_u64(&deque->bottom, bottom, FE_ATOMIC_SEQ_CST);
+    uint64_t top = fe_atomic_load_u64(&deque->top, FE_ATOMIC_SEQ_CST);
+
+    if ((int64_t)top <= (int64_t)bottom) {
+        uint32_t job_index = fe_atomic_load_u32(&deque->slots[bottom & FE_JOB_SYSTEM_JOB_MASK], FE_ATOMIC_RELAXED);
+        if (top != bottom) {
+            *out_job_index = job_index; // Birden fazla eleman vardı, yarış yok
+            return true;
+        }
+        // Son eleman: çalıcılarla top üzerinde yarış
+        bool won = fe_atomic_compare_exchange_u64(&deque->top, &top, top + 1, FE_ATOMIC_SEQ_CST);
+        fe_atomic_store_u64(&deque->bottom, bottom + 1, FE_ATOMIC_RELAXED);
+        if (won) *out_job_index = job_index;
+        return won;
+    }
+
+    // Deque boştu; bottom'u geri al
+    fe_atomic_store_u64(&deque->bottom, bottom + 1, FE_ATOMIC_RELAXED);
+    return false;
+}
+
+static bool fe_job_deque_steal(fe_job_deque_t* deque, uint32_t* out_job_index) {
+    uint64_t top = fe_atomic_load_u64(&deque->top, FE_ATOMIC_SEQ_CST);
+    uint64_t bottom = fe_atomic_load_u64(&deque->bottom, FE_ATOMIC_SEQ_CST);
+    if ((int64_t)top >= (int64_t)bottom) {
+        return false;
+    }
+    uint32_t job_index = fe_atomic_load_u32(&deque->slots[top & FE_JOB_SYSTEM_JOB_MASK], FE_ATOMIC_RELAXED);
+    if (!fe_atomic_compare_exchange_u64(&deque->top, &top, top + 1, FE_ATOMIC_SEQ_CST)) {
+        return false; // Sahibi veya başka bir çalıcı kazandı
+    }
+    *out_job_index = job_index;
+    return true;
+}
+
+static bool fe_job_deque_is_empty(const fe_job_deque_t* deque) {
+    uint64_t top = fe_atomic_load_u64(&deque->top, FE_ATOMIC_SEQ_CST);
+    uint64_t bottom = fe_atomic_load_u64(&deque->bottom, FE_ATOMIC_SEQ_CST);
+    return (int64_t)top >= (int64_t)bottom;
+}
+
+// --- Sayaç Kilidi ---
+
+static void fe_job_counter_lock(fe_job_counter_t* counter) {
+    while (fe_atomic_exchange_u32(&counter->lock, 1, FE_ATOMIC_ACQUIRE) != 0) {
+        while (fe_atomic_load_u32(&counter->lock, FE_ATOMIC_RELAXED) != 0) {
+            fe_atomic_cpu_relax();
+        }
+    }
+}
+
+static void fe_job_counter_unlock(fe_job_counter_t* counter) {
+    fe_atomic_store_u32(&counter->lock, 0, FE_ATOMIC_RELEASE);
+}
+
+// --- Yardımcı Fonksiyonlar ---
+
+static bool fe_job_system_has_pending_work(void) {
+    if (fe_mpmc_queue_size_approx(&g_job_system.injection_queue) > 0) return true;
+    for (uint32_t i = 0; i <= g_job_system.worker_count; ++i) {
+        if (!fe_job_deque_is_empty(&g_job_system.deques[i])) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Uyuyan bir işçi varsa uyandırır.
+ */
+static void fe_job_system_wake_workers(void) {
+    if (g_job_system.worker_count == 0) return;
+    // İşin yayınlanması ile sleeper_count okuması arasında tam bariyer: uyumaya hazırlanan
+    // işçi ya sayacı artırmadan önce işi görür ya da biz onun sayacını görürüz.
+    fe_atomic_thread_fence(FE_ATOMIC_SEQ_CST);
+    if (fe_atomic_load_u32(&g_job_system.sleeper_count, FE_ATOMIC_SEQ_CST) > 0) {
+        fe_mutex_lock(&g_job_system.sleep_mutex);
+        fe_cond_signal(&g_job_system.wake_cond);
+        fe_mutex_unlock(&g_job_system.sleep_mutex);
+    }
+}
+
+/**
+ * @brief Havuzdaki bir işi, çağıran thread'e göre uygun kuyruğa koyar.
+ */
+static void fe_job_system_enqueue(uint32_t job_index) {
+    fe_job_t* job = &g_job_system.jobs[job_index];
+    if (job->main_thread_only) {
+        fe_mpmc_queue_push(&g_job_system.main_thread_queue, &job_index);
+        return; // Ana thread bekleme döngüsünde bu kuyruğu zaten yokluyor
+    }
+    int thread_index = s_job_thread_index;
+    if (thread_index >= 0) {
+        fe_job_deque_push(&g_job_system.deques[thread_index], job_index);
+    } else {
+        fe_mpmc_queue_push(&g_job_system.injection_queue, &job_index);
+    }
+    fe_job_system_wake_workers();
+}
+
+/**
+ * @brief Sayacı bir azaltır; sıfırlanırsa onu bekleyen işleri kuyruğa verir.
+ * Kilit tüm işlem boyunca tutulur: fe_job_counter_is_done kilit bırakılana kadar false döner,
+ * bu sayede bekleyen thread, biz sayaca dokunmayı bitirmeden onu yok edemez.
+ */
+static void fe_job_counter_decrement(fe_job_counter_t* counter) {
+    fe_job_counter_lock(counter);
+    uint32_t previous = fe_atomic_fetch_add_u32(&counter->value, (uint32_t)-1, FE_ATOMIC_ACQ_REL);
+    uint32_t waiting = 0;
+    if (previous == 1) {
+        waiting = counter->waiting_head;
+        counter->waiting_head = 0;
+    }
+    fe_job_counter_unlock(counter);
+
+    while (waiting) {
+        uint32_t job_index = waiting - 1;
+        waiting = g_job_system.jobs[job_index].next_waiting;
+        fe_job_system_enqueue(job_index);
+    }
+}
+
+/**
+ * @brief Bir işi çalıştırır. İş yuvası fonksiyon çağrılmadan önce havuza iade edilir;
+ * böylece işin kendisi yeni işler gönderebilir.
+ */
+static void fe_job_system_execute(uint32_t job_index) {
+    fe_job_t job = g_job_system.jobs[job_index];
+    fe_mpmc_queue_push(&g_job_system.free_jobs, &job_index);
+
+    job.func(job.user_data);
+
+    int thread_index = s_job_thread_index;
+    if (thread_index >= 0) {
+        fe_job_deque_t* deque = &g_job_system.deques[thread_index];
+        fe_atomic_store_u64(&deque->jobs_executed, deque->jobs_executed + 1, FE_ATOMIC_RELAXED);
+    }
+    if (job.counter) {
+        fe_job_counter_decrement(job.counter);
+    }
+}
+
+/**
+ * @brief Çağıran thread için çalıştırılabilir bir iş bulur: önce ana thread kuyruğu (yalnızca ana
+ * thread), sonra kendi deque'si, sonra ortak kuyruk, en son diğer deque'lerden çalma.
+ */
+static bool fe_job_system_find_job(int thread_index, uint32_t* out_job_index) {
+    if (thread_index == 0 && fe_mpmc_queue_pop(&g_job_system.main_thread_queue, out_job_index)) {
+        return true;
+    }
+    if (thread_index >= 0 && fe_job_deque_take(&g_job_system.deques[thread_index], out_job_index)) {
+        return true;
+    }
+    if (fe_mpmc_queue_pop(&g_job_system.injection_queue, out_job_index)) {
+        return true;
+    }
+
+    uint32_t deque_count = g_job_system.worker_count + 1;
+    uint32_t start = 0;
+    if (thread_index >= 0) {
+        fe_job_deque_t* own = &g_job_system.deques[thread_index];
+        uint32_t x = own->steal_seed;
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        own->steal_seed = x;
+        start = x % deque_count;
+    }
+    for (uint32_t i = 0; i < deque_count; ++i) {
+        uint32_t victim = (start + i) % deque_count;
+        if ((int)victim == thread_index) continue;
+        if (fe_job_deque_steal(&g_job_system.deques[victim], out_job_index)) {
+            if (thread_index >= 0) {
+                fe_job_deque_t* own = &g_job_system.deques[thread_index];
+                fe_atomic_store_u64(&own->jobs_stolen, own->jobs_stolen + 1, FE_ATOMIC_RELAXED);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+static void fe_job_system_worker_main(void* user_data) {
+    int thread_index = (int)(uintptr_t)user_data;
+    s_job_thread_index = thread_index;
+
+    char profiler_name[16];
+    snprintf(profiler_name, sizeof(profiler_name), "Worker %d", thread_index);
+    fe_profiler_set_thread_name(profiler_name);
+
+    uint32_t idle_spins = 0;
+    while (!fe_atomic_load_u32(&g_job_system.quit, FE_ATOMIC_ACQUIRE)) {
+        uint32_t job_index;
+        if (fe_job_system_find_job(thread_index, &job_index)) {
+            fe_job_system_execute(job_index);
+            idle_spins = 0;
+            continue;
+        }
+        if (++idle_spins < FE_JOB_SYSTEM_IDLE_SPINS) {
+            fe_atomic_cpu_relax();
+            continue;
+        }
+
+        // Uzun süredir iş yok: koşul değişkeninde uyu
+        fe_mutex_lock(&g_job_system.sleep_mutex);
+        fe_atomic_fetch_add_u32(&g_job_system.sleeper_count, 1, FE_ATOMIC_SEQ_CST);
+        if (!fe_atomic_load_u32(&g_job_system.quit, FE_ATOMIC_ACQUIRE) && !fe_job_system_has_pending_work()) {
+            fe_cond_wait_timeout(&g_job_system.wake_cond, &g_job_system.sleep_mutex, FE_JOB_SYSTEM_SLEEP_TIMEOUT_MS);
+        }
+        fe_atomic_fetch_add_u32(&g_job_system.sleeper_count, (uint32_t)-1, FE_ATOMIC_SEQ_CST);
+        fe_mutex_unlock(&g_job_system.sleep_mutex);
+        idle_spins = 0;
+    }
+}
+
+/**
+ * @brief Havuzdan bir iş yuvası alır ve tanımla doldurur.
+ * @return bool Havuz doluysa false.
+ */
+static bool fe_job_system_allocate(const fe_job_decl_t* decl, fe_job_counter_t* counter, uint32_t* out_job_index) {
+    uint32_t job_index;
+    if (!fe_mpmc_queue_pop(&g_job_system.free_jobs, &job_index)) {
+        return false;
+    }
+    fe_job_t* job = &g_job_system.jobs[job_index];
+    job->func = decl->func;
+    job->user_data = decl->user_data;
+    job->counter = counter;
+    job->next_waiting = 0;
+    job->main_thread_only = decl->main_thread_only;
+    *out_job_index = job_index;
+    return true;
+}
+
+/**
+ * @brief Havuz doluyken bir yuva boşalana kadar çalıştırılabilir işleri çalıştırarak bekler.
+ * Ana thread'e özel işler başka bir thread'de satır içi çalıştırılamayacağı için kullanılır.
+ */
+static void fe_job_system_allocate_blocking(const fe_job_decl_t* decl, fe_job_counter_t* counter, uint32_t* out_job_index) {
+    int thread_index = s_job_thread_index;
+    uint32_t idle_spins = 0;
+    while (!fe_job_system_allocate(decl, counter, out_job_index)) {
+        uint32_t job_index;
+        if (fe_job_system_find_job(thread_index, &job_index)) {
+            fe_job_system_execute(job_index);
+            idle_spins = 0;
+            continue;
+        }
+        if (++idle_spins < FE_JOB_SYSTEM_IDLE_SPINS) {
+            fe_atomic_cpu_relax();
+        } else {
+            fe_thread_yield();
+        }
+    }
+}
+
+// --- İş Sistemi Fonksiyonları Implementasyonları ---
+
+bool fe_job_system_init(uint32_t worker_count) {
+    if (g_job_system.is_initialized) {
+        FE_LOG_WARN("Job system already initialized.");
+        return true;
+    }
+    memset(&g_job_system, 0, sizeof(fe_job_system_state_t));
+
+    if (worker_count == 0) {
+        worker_count = fe_thread_hardware_concurrency() - 1;
+    }
+    if (worker_count > FE_JOB_SYSTEM_MAX_WORKERS) {
+        worker_count = FE_JOB_SYSTEM_MAX_WORKERS;
+    }
+
+    g_job_system.jobs = (fe_job_t*)FE_MALLOC(sizeof(fe_job_t) * FE_JOB_SYSTEM_MAX_JOBS, FE_MEM_TYPE_CONTAINER);
+    g_job_system.deques = (fe_job_deque_t*)FE_MALLOC(sizeof(fe_job_deque_t) * (worker_count + 1), FE_MEM_TYPE_CONTAINER);
+    if (!g_job_system.jobs || !g_job_system.deques) {
+        FE_LOG_ERROR("fe_job_system_init: Failed to allocate job pool.");
+        goto fail;
+    }
+    memset(g_job_system.jobs, 0, sizeof(fe_job_t) * FE_JOB_SYSTEM_MAX_JOBS);
+    memset(g_job_system.deques, 0, sizeof(fe_job_deque_t) * (worker_count + 1));
+
+    for (uint32_t i = 0; i <= worker_count; ++i) {
+        g_job_system.deques[i].slots = (uint32_t*)FE_MALLOC(sizeof(uint32_t) * FE_JOB_SYSTEM_MAX_JOBS, FE_MEM_TYPE_CONTAINER);
+        if (!g_job_system.deques[i].slots) {
+            FE_LOG_ERROR("fe_job_system_init: Failed to allocate deque %u.", i);
+            goto fail;
+        }
+        g_job_system.deques[i].steal_seed = 0x9E3779B9u * (i + 1);
+    }
+
+    if (!fe_mpmc_queue_init(&g_job_system.free_jobs, FE_JOB_SYSTEM_MAX_JOBS, sizeof(uint32_t)) ||
+        !fe_mpmc_queue_init(&g_job_system.injection_queue, FE_JOB_SYSTEM_MAX_JOBS, sizeof(uint32_t)) ||
+        !fe_mpmc_queue_init(&g_job_system.main_thread_queue, FE_JOB_SYSTEM_MAX_JOBS, sizeof(uint32_t))) {
+        goto fail;
+    }
+    for (uint32_t i = 0; i < FE_JOB_SYSTEM_MAX_JOBS; ++i) {
+        fe_mpmc_queue_push(&g_job_system.free_jobs, &i);
+    }
+
+    fe_mutex_init(&g_job_system.sleep_mutex);
+    fe_cond_init(&g_job_system.wake_cond);
+
+    s_job_thread_index = 0; // Çağıran thread ana thread'dir
+    // İşçiler çalışmaya başlamadan önce yazılır; başlatılamayan işçilerin deque'leri boş kalır ve zararsızdır.
+    g_job_system.worker_count = worker_count;
+    g_job_system.is_initialized = true;
+
+    uint32_t started = 0;
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        char name[16];
+        snprintf(name, sizeof(name), "fe_worker_%u", i + 1);
+        if (!fe_thread_create(&g_job_system.workers[i], fe_job_system_worker_main, (void*)(uintptr_t)(i + 1), name)) {
+            FE_LOG_WARN("fe_job_system_init: Could only start %u of %u worker threads.", started, worker_count);
+            break;
+        }
+        started++;
+    }
+    g_job_system.started_count = started;
+
+    FE_LOG_INFO("Job system initialized with %u worker thread(s).", started);
+    return true;
+
+fail:
+    if (g_job_system.deques) {
+        for (uint32_t i = 0; i <= worker_count; ++i) {
+            if (g_job_system.deques[i].slots) FE_FREE(g_job_system.deques[i].slots, FE_MEM_TYPE_CONTAINER);
+        }
+        FE_FREE(g_job_system.deques, FE_MEM_TYPE_CONTAINER);
+    }
+    if (g_job_system.jobs) FE_FREE(g_job_system.jobs, FE_MEM_TYPE_CONTAINER);
+    fe_mpmc_queue_shutdown(&g_job_system.free_jobs);
+    fe_mpmc_queue_shutdown(&g_job_system.injection_queue);
+    fe_mpmc_queue_shutdown(&g_job_system.main_thread_queue);
+    memset(&g_job_system, 0, sizeof(fe_job_system_state_t));
+    return false;
+}
+
+void fe_job_system_shutdown(void) {
+    if (!g_job_system.is_initialized) return;
+
+    fe_atomic_store_u32(&g_job_system.quit, 1, FE_ATOMIC_RELEASE);
+    fe_mutex_lock(&g_job_system.sleep_mutex);
+    fe_cond_broadcast(&g_job_system.wake_cond);
+    fe_mutex_unlock(&g_job_system.sleep_mutex);
+
+    for (uint32_t i = 0; i < g_job_system.started_count; ++i) {
+        fe_thread_join(&g_job_system.workers[i]);
+    }
+
+    fe_cond_destroy(&g_job_system.wake_cond);
+    fe_mutex_destroy(&g_job_system.sleep_mutex);
+    for (uint32_t i = 0; i <= g_job_system.worker_count; ++i) {
+        FE_FREE(g_job_system.deques[i].slots, FE_MEM_TYPE_CONTAINER);
+    }
+    FE_FREE(g_job_system.deques, FE_MEM_TYPE_CONTAINER);
+    FE_FREE(g_job_system.jobs, FE_MEM_TYPE_CONTAINER);
+    fe_mpmc_queue_shutdown(&g_job_system.free_jobs);
+    fe_mpmc_queue_shutdown(&g_job_system.injection_queue);
+    fe_mpmc_queue_shutdown(&g_job_system.main_thread_queue);
+
+    memset(&g_job_system, 0, sizeof(fe_job_system_state_t));
+    s_job_thread_index = -1;
+    FE_LOG_INFO("Job system shut down.");
+}
+
+bool fe_job_system_is_initialized(void) {
+    return g_job_system.is_initialized;
+}
+
+bool fe_job_system_run(const fe_job_decl_t* jobs, uint32_t count, fe_job_counter_t* counter) {
+    if (!g_job_system.is_initialized || (!jobs && count > 0)) {
+        FE_LOG_ERROR("fe_job_system_run: Job system not initialized or invalid jobs.");
+        return false;
+    }
+    if (counter && count > 0) {
+        fe_atomic_fetch_add_u32(&counter->value, count, FE_ATOMIC_ACQ_REL);
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t job_index;
+        if (fe_job_system_allocate(&jobs[i], counter, &job_index)) {
+            fe_job_system_enqueue(job_index);
+            continue;
+        }
+        if (jobs[i].main_thread_only && s_job_thread_index != 0) {
+            // Ana thread'e özel iş burada çalıştırılamaz; yuva boşalana kadar yardım ederek beklenir
+            fe_job_system_allocate_blocking(&jobs[i], counter, &job_index);
+            fe_job_system_enqueue(job_index);
+            continue;
+        }
+        // Havuz dolu: işi çağıran thread'de hemen çalıştır
+        FE_LOG_WARN("fe_job_system_run: Job pool exhausted (%d jobs); running job inline.", FE_JOB_SYSTEM_MAX_JOBS);
+        jobs[i].func(jobs[i].user_data);
+        if (counter) fe_job_counter_decrement(counter);
+    }
+    return true;
+}
+
+bool fe_job_system_run_after(const fe_job_decl_t* jobs, uint32_t count,
+                             fe_job_counter_t* dependency, fe_job_counter_t* counter) {
+    if (!dependency) {
+        return fe_job_system_run(jobs, count, counter);
+    }
+    if (!g_job_system.is_initialized || (!jobs && count > 0)) {
+        FE_LOG_ERROR("fe_job_system_run_after: Job system not initialized or invalid jobs.");
+        return false;
+    }
+    if (counter && count > 0) {
+        fe_atomic_fetch_add_u32(&counter->value, count, FE_ATOMIC_ACQ_REL);
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t job_index;
+        if (!fe_job_system_allocate(&jobs[i], counter, &job_index)) {
+            if (jobs[i].main_thread_only && s_job_thread_index != 0) {
+                fe_job_system_allocate_blocking(&jobs[i], counter, &job_index);
+            } else {
+                FE_LOG_WARN("fe_job_system_run_after: Job pool exhausted (%d jobs); waiting for dependency and running inline.",
+                            FE_JOB_SYSTEM_MAX_JOBS);
+                fe_job_system_wait_for_counter(dependency);
+                jobs[i].func(jobs[i].user_data);
+                if (counter) fe_job_counter_decrement(counter);
+                continue;
+            }
+        }
+
+        // Sayaç kilidi altında kontrol: sıfırlayan thread bekleme listesini aynı kilit altında devralır.
+        fe_job_counter_lock(dependency);
+        bool ready = fe_atomic_load_u32(&dependency->value, FE_ATOMIC_ACQUIRE) == 0;
+        if (!ready) {
+            g_job_system.jobs[job_index].next_waiting = dependency->waiting_head;
+            dependency->waiting_head = job_index + 1;
+        }
+        fe_job_counter_unlock(dependency);
+
+        if (ready) {
+            fe_job_system_enqueue(job_index);
+        }
+    }
+    return true;
+}
+
+void fe_job_system_wait_for_counter(fe_job_counter_t* counter) {
+    if (!counter) return;
+
+    int thread_index = s_job_thread_index;
+    uint32_t idle_spins = 0;
+    while (!fe_job_counter_is_done(counter)) {
+        uint32_t job_index;
+        if (g_job_system.is_initialized && fe_job_system_find_job(thread_index, &job_index)) {
+            fe_job_system_execute(job_index);
+            idle_spins = 0;
+            continue;
+        }
+        if (++idle_spins < FE_JOB_SYSTEM_IDLE_SPINS) {
+            fe_atomic_cpu_relax();
+        } else {
+            fe_thread_yield();
+        }
+    }
+}
+
+int fe_job_system_thread_index(void) {
+    return s_job_thread_index;
+}
+
+uint32_t fe_job_system_worker_count(void) {
+    return g_job_system.started_count;
+}
+
+void fe_job_system_get_stats(fe_job_system_stats_t* out_stats) {
+    if (!out_stats) return;
+    memset(out_stats, 0, sizeof(fe_job_system_stats_t));
+    if (!g_job_system.is_initialized) return;
+
+    out_stats->worker_count = g_job_system.started_count;
+    for (uint32_t i = 0; i <= g_job_system.worker_count; ++i) {
+        out_stats->jobs_executed += fe_atomic_load_u64(&g_job_system.deques[i].jobs_executed, FE_ATOMIC_RELAXED);
+        out_stats->jobs_stolen += fe_atomic_load_u64(&g_job_system.deques[i].jobs_stolen, FE_ATOMIC_RELAXED);
+    }
+}
@@ -72,7 +72,8 @@ fe_application_module_t g_audio_module = {
     .update = audio_update,
     .shutdown = audio_shutdown,
     .on_event = audio_on_event,
-    .is_active = audio_is_active
+    .is_active = audio_is_active,
+    .update_in_parallel = true // Ses güncellemesi ana thread'e bağlı değil; grafikle eşzamanlı çalışabilir
 };
 
 // --- Uygulama Başlangıç Noktası ---
@@ -82,6 +83,7 @@ int main(int argc, char** argv) {
     // çünkü hata ayıklama ve bellek tahsisi için gereklidirler.
     fe_memory_manager_init();
     fe_logger_init();
+    fe_logger_start_async(NULL); // Dosya/konsol yazımı arka plan thread'inde; DEBUG/INFO halka dolunca düşürülür
     FE_LOG_INFO("Fiction Engine Main Entry Point Started.");
 
     // 2. Uygulama Yapılandırmasını Oluşturma
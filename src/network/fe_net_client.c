@@ -4,6 +4,7 @@
 #include "core/containers/fe_buffer.h"
 #include "core/containers/fe_array.h" // For resolved_addresses cleanup
 #include "core/utils/fe_string.h"    // For fe_string_t management
+#include "core/utils/fe_profiler.h"  // Ağ pompası süresini ölçmek için
 
 // --- Dahili Yardımcı Fonksiyonlar ---
 
@@ -136,7 +137,8 @@ fe_net_error_t fe_net_client_disconnect(fe_net_client_t* client) {
 }
 
 
-void fe_net_client_update(fe_net_client_t* client) {
+// Durum makinesinin bir adımı; birden çok erken dönüşü olduğu için ölçüm fe_net_client_update'te yapılır.
+static void fe_net_client_pump(fe_net_client_t* client) {
     if (!client) return;
 
     // Duruma göre işlem yap
@@ -329,6 +331,12 @@ void fe_net_client_update(fe_net_client_t* client) {
     }
 }
 
+void fe_net_client_update(fe_net_client_t* client) {
+    FE_PROFILE_BEGIN("Net.ClientPump");
+    fe_net_client_pump(client);
+    FE_PROFILE_END();
+}
+
 bool fe_net_client_send_data(fe_net_client_t* client, const void* data, size_t size) {
     if (!client || !data || size == 0) {
         FE_LOG_ERROR("Invalid arguments for fe_net_client_send_data.");
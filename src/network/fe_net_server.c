@@ -3,6 +3,7 @@
 #include "core/memory/fe_memory_manager.h"
 #include "core/containers/fe_buffer.h"
 #include "core/containers/fe_array.h" // fe_array_add_element, fe_array_remove_at
+#include "core/utils/fe_profiler.h"   // Ağ pompası süresini ölçmek için
 
 // --- Dahili Yardımcı Fonksiyonlar ---
 
@@ -181,6 +182,7 @@ void fe_net_server_update(fe_net_server_t* server) {
     if (!server || server->state == FE_SERVER_STATE_STOPPED || server->state == FE_SERVER_STATE_ERROR) {
         return;
     }
+    FE_PROFILE_BEGIN("Net.ServerPump");
 
     // 1. Yeni bağlantıları kabul et (Sadece RUNNING durumunda)
     if (server->state == FE_SERVER_STATE_RUNNING && server->listen_socket) {
@@ -305,6 +307,7 @@ void fe_net_server_update(fe_net_server_t* server) {
             server->on_stopped_callback(server->user_data, FE_NET_SUCCESS);
         }
     }
+    FE_PROFILE_END();
 }
 
 bool fe_net_server_send_data(fe_net_server_t* server, fe_client_id_t client_id, const void* data, size_t size) {
@@ -1,4 +1,6 @@
 #include "fe_physics_manager.h"
+#include "core/utils/fe_profiler.h" // Fizik adımı süresini ölçmek için
+#include "core/utils/fe_logger.h"   // Hız sınırlı uyarılar için
 #include <stdio.h>    // printf için
 #include <stdlib.h>   // malloc, free için
 #include <string.h>   // memset için
@@ -109,7 +111,7 @@ static void feBroadPhase() {
                 if (g_PhysicsManager.numCollisionInfos < g_PhysicsManager.maxCollisionInfos) {
                     g_PhysicsManager.collisionInfos[g_PhysicsManager.numCollisionInfos++] = currentCollision;
                 } else {
-                    fprintf(stderr, "Uyarı: Maksimum çarpışma sayısı aşıldı! Bazı çarpışmalar göz ardı edilebilir.\n");
+                    FE_LOG_WARN("Maksimum çarpışma sayısı aşıldı (%u)! Bazı çarpışmalar göz ardı edilebilir.", g_PhysicsManager.maxCollisionInfos);
                 }
             }
         }
@@ -265,17 +267,23 @@ void fePhysicsManagerUpdate(float deltaTime) {
         return;
     }
     if (deltaTime <= 0.0f) return;
+    FE_PROFILE_BEGIN("Physics.Step");
 
     // 1. Rijit cisimleri entegre et (konum ve hızları güncelle)
+    FE_PROFILE_BEGIN("Physics.Integrate");
     feIntegrateRigidbodies(deltaTime);
+    FE_PROFILE_END();
 
     // 2. Geniş Faz Çarpışma Tespiti (Broad-Phase) - Olası çarpışma çiftlerini bul
+    FE_PROFILE_BEGIN("Physics.BroadPhase");
     feBroadPhase();
+    FE_PROFILE_END();
 
     // 3. Dar Faz Çarpışma Tespiti ve Çözümlemesi (Narrow-Phase & Resolution) - Çarpışma bilgilerini oluştur ve çöz
     // Penetrasyonu giderme (Position correction)
     // İteratif bir yaklaşım, daha kararlı sonuçlar verir.
     // Projelerde yaygın olarak birkaç iterasyon kullanılır (örn: 5-10)
+    FE_PROFILE_BEGIN("Physics.Solve");
     const int positionCorrectionIterations = 5;
     for (int iter = 0; iter < positionCorrectionIterations; ++iter) {
         // Sadece penetrasyonu düzeltmek için (çarpışma impulsu uygulanmaz)
@@ -304,6 +312,8 @@ void fePhysicsManagerUpdate(float deltaTime) {
             feResolveCollision(&g_PhysicsManager.collisionInfos[i]);
          }
     }
+    FE_PROFILE_END();
+    FE_PROFILE_END();
 
 
     // TODO: Bir çarpışma dinleyicisi veya geri çağırma (callback) mekanizması ekleyebilirsiniz
@@ -0,0 +1,1013 @@
+#include "platform/fe_async_io.h"
+#include "core/utils/fe_logger.h"           // Loglama için
+#include "core/utils/fe_atomic.h"           // io_uring halka başları/kuyrukları için
+#include "core/memory/fe_memory_manager.h"  // FE_MALLOC, FE_FREE için
+#include "platform/fe_thread.h"             // Thread, muteks ve koşul değişkeni için
+
+#include <string.h> // memset için
+#include <errno.h>  // errno, EINTR, EAGAIN için
+
+#ifdef _WIN32
+#include <windows.h> // CreateFileW, ReadFile, GetFileSizeEx için
+#else
+#include <fcntl.h>     // open için
+#include <unistd.h>    // pread, close için
+#include <sys/stat.h>  // fstat için
+#include <sys/uio.h>   // struct iovec için
+#endif
+
+// io_uring yalnızca Linux'ta ve çekirdek başlıkları IORING_OP_OPENAT'ı (5.6) tanıyorsa derlenir;
+// aynı sürümde gelen IORING_FEAT_RW_CUR_POS bayrağıyla denetlenir
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h> // struct io_uring_sqe/cqe/params için
+#ifdef IORING_FEAT_RW_CUR_POS
+#define FE_ASYNC_IO_HAS_IO_URING 1
+#include <sys/mman.h>       // Halka eşlemeleri için
+#include <sys/syscall.h>    // __NR_io_uring_setup/enter/register için
+#include <sys/eventfd.h>    // Tamamlanma bildirimi için
+#endif
+#endif
+#endif
+
+#ifndef FE_ASYNC_IO_HAS_IO_URING
+#define FE_ASYNC_IO_HAS_IO_URING 0
+#endif
+
+// Tek bir okuma çağrısında istenecek en fazla bayt. Linux read/pread zaten ~2 GB'ta keser;
+// daha büyük istekler parça parça okunur.
+#define FE_ASYNC_IO_MAX_CHUNK ((uint64_t)1 << 30)
+
+#define FE_ASYNC_IO_DEFAULT_MAX_REQUESTS     256
+#define FE_ASYNC_IO_DEFAULT_QUEUE_DEPTH      64
+#define FE_ASYNC_IO_DEFAULT_FALLBACK_THREADS 4
+
+// --- Dahili Yapılar ---
+
+/**
+ * @brief Bir isteğin arka planda hangi adımda olduğu.
+ */
+typedef enum fe_async_io_stage {
+    FE_ASYNC_IO_STAGE_OPEN = 0, // Dosya henüz açılmadı
+    FE_ASYNC_IO_STAGE_READ      // Açıldı, boyut ve tampon hazır; okunuyor
+} fe_async_io_stage_t;
+
+/**
+ * @brief İstek tablosundaki bir giriş. status dışındaki sonuç alanlarına, istek PENDING iken
+ * yalnızca onu işleyen arka plan thread'i dokunur; tamamlanma g_async_io.lock altında yayınlanır.
+ */
+typedef struct fe_async_io_request {
+    uint32_t               generation;     // Tanıtıcının üst 32 biti; her geri dönüşümde artar
+    fe_async_io_status_t   status;         // INVALID ise giriş boştadır
+    fe_async_io_stage_t    stage;
+    bool                   released;       // Çağıran bıraktı; sonuç gelince atılacak
+    bool                   delivered;      // Sonuç (ve tamponun sahipliği) çağırana teslim edildi
+    bool                   in_dispatch;    // Callback kuyruğunda bekliyor
+    bool                   owns_buffer;    // Tampon sistem tarafından ayrıldı
+    bool                   size_from_file; // size istekte verilmedi; dosya açılınca belirlenir
+    bool                   in_ring;        // En az bir kez io_uring'e gönderildi (submit_lock altında yazılır)
+    char*                  path;           // İsteğin kopyası; dosya açılıp istek tamamlanınca serbest bırakılır
+    uint8_t*               buffer;
+    uint64_t               offset;
+    uint64_t               size;
+    uint64_t               bytes_read;
+    int                    error;
+    fe_async_io_callback_t callback;
+    void*                  user_data;
+#ifdef _WIN32
+    HANDLE                 file;
+#else
+    int                    fd;
+    struct iovec           iov;            // io_uring READV için; istek yaşadıkça geçerli kalmalı
+#endif
+    struct fe_async_io_request* next;      // Boş liste, iş kuyruğu veya callback kuyruğu
+} fe_async_io_request_t;
+
+#if FE_ASYNC_IO_HAS_IO_URING
+/**
+ * @brief Paylaşılan io_uring halkaları. SQ'ya yalnızca submit_lock altında, CQ'ya yalnızca
+ * tamamlanma thread'inden dokunulur. Tamamlanma thread'i io_uring_enter yerine halkaya kayıtlı
+ * eventfd'de bekler: böylece gönderim yolu bozulsa bile kapatma onu uyandırabilir.
+ */
+typedef struct fe_async_io_uring {
+    int                  fd;
+    int                  event_fd;      // Her CQE'de çekirdek tarafından sayılır
+    uint32_t             stop;          // Atomik; 1 ise tamamlanma thread'i CQ boşalınca çıkar
+    uint32_t             sq_entries;
+    uint32_t*            sq_head;
+    uint32_t*            sq_tail;
+    uint32_t*            sq_mask;
+    uint32_t*            sq_array;
+    uint32_t*            cq_head;
+    uint32_t*            cq_tail;
+    uint32_t*            cq_mask;
+    struct io_uring_sqe* sqes;
+    struct io_uring_cqe* cqes;
+    void*                sq_ring_ptr;
+    size_t               sq_ring_size;
+    void*                cq_ring_ptr;
+    size_t               cq_ring_size;
+    size_t               sqes_size;
+    fe_mutex_t           submit_lock;
+    fe_thread_t          reaper;
+    int                  broken_error;  // submit_lock altında; 0 değilse halka kullanılamaz, istekler bu hatayla biter
+} fe_async_io_uring_t;
+#endif
+
+static struct {
+    bool                   initialized;
+    bool                   shutting_down;   // Yeni istek kabul edilmez
+    bool                   using_io_uring;
+    fe_mutex_t             lock;            // İstek tablosu, kuyruklar ve sayaçlar
+    fe_cond_t              done_cond;       // Bir istek tamamlandı
+    fe_async_io_request_t* requests;
+    uint32_t               max_requests;
+    fe_async_io_request_t* free_list;
+    fe_async_io_request_t* dispatch_head;   // Callback'i bekleyen tamamlanmış istekler (FIFO)
+    fe_async_io_request_t* dispatch_tail;
+    uint32_t               in_flight;
+    uint64_t               submitted;
+    uint64_t               completed;
+    uint64_t               bytes_read;
+
+    // Thread havuzu yedeği
+    fe_cond_t              work_cond;
+    fe_async_io_request_t* work_head;
+    fe_async_io_request_t* work_tail;
+    bool                   workers_stop;
+    fe_thread_t*           workers;
+    uint32_t               worker_count;
+
+#if FE_ASYNC_IO_HAS_IO_URING
+    fe_async_io_uring_t    ring;
+#endif
+} g_async_io;
+
+// --- Tanıtıcılar ---
+
+static fe_async_io_handle_t fe_async_io_make_handle(const fe_async_io_request_t* req) {
+    uint32_t index = (uint32_t)(req - g_async_io.requests);
+    return ((uint64_t)req->generation << 32) | (uint64_t)(index + 1);
+}
+
+/**
+ * @brief Tanıtıcıyı çözer. g_async_io.lock tutulmalıdır.
+ * @return Geçerli, boş olmayan ve bırakılmamış istek; aksi halde NULL.
+ */
+static fe_async_io_request_t* fe_async_io_lookup(fe_async_io_handle_t handle) {
+    uint32_t index = (uint32_t)(handle & 0xFFFFFFFFu);
+    uint32_t generation = (uint32_t)(handle >> 32);
+    if (index == 0 || index > g_async_io.max_requests) return NULL;
+    fe_async_io_request_t* req = &g_async_io.requests[index - 1];
+    if (req->generation != generation || req->status == FE_ASYNC_IO_STATUS_INVALID || req->released) return NULL;
+    return req;
+}
+
+/**
+ * @brief İsteği boş listeye döndürür. g_async_io.lock tutulmalıdır.
+ */
+static void fe_async_io_recycle(fe_async_io_request_t* req) {
+    if (req->owns_buffer && !req->delivered && req->buffer) {
+        FE_FREE(req->buffer, FE_MEM_TYPE_GENERAL);
+    }
+    if (req->path) {
+        FE_FREE(req->path, FE_MEM_TYPE_GENERAL);
+    }
+    uint32_t generation = req->generation + 1;
+    memset(req, 0, sizeof(fe_async_io_request_t));
+    req->generation = generation ? generation : 1;
+#ifdef _WIN32
+    req->file = INVALID_HANDLE_VALUE;
+#else
+    req->fd = -1;
+#endif
+    req->next = g_async_io.free_list;
+    g_async_io.free_list = req;
+}
+
+static void fe_async_io_fill_result(const fe_async_io_request_t* req, fe_async_io_result_t* out_result) {
+    out_result->status = req->status;
+    out_result->buffer = req->buffer;
+    out_result->bytes_read = req->bytes_read;
+    out_result->error = req->error;
+}
+
+/**
+ * @brief Yoklama ile sonucu teslim eder. Callback'li isteklerin sonucu (ve tamponu) yalnızca
+ * callback'e verilir; yoklama bunlar için sadece durumu döndürür. g_async_io.lock tutulmalıdır.
+ */
+static void fe_async_io_deliver(fe_async_io_request_t* req, fe_async_io_result_t* out_result) {
+    if (req->callback) {
+        out_result->status = req->status;
+        return;
+    }
+    fe_async_io_fill_result(req, out_result);
+    req->delivered = true;
+}
+
+// --- Platform Dosya Yardımcıları ---
+
+/**
+ * @brief Dosyayı bloklayarak açar (thread havuzu yolu; io_uring'de IORING_OP_OPENAT kullanılır).
+ * @return int 0 veya platform hata kodu.
+ */
+static int fe_async_io_open(fe_async_io_request_t* req) {
+#ifdef _WIN32
+    wchar_t wide_path[1024];
+    if (MultiByteToWideChar(CP_UTF8, 0, req->path, -1, wide_path, (int)(sizeof(wide_path) / sizeof(wide_path[0]))) == 0) {
+        return (int)GetLastError();
+    }
+    req->file = CreateFileW(wide_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (req->file == INVALID_HANDLE_VALUE) return (int)GetLastError();
+    return 0;
+#else
+    req->fd = open(req->path, O_RDONLY | O_CLOEXEC);
+    if (req->fd == -1) return errno;
+    return 0;
+#endif
+}
+
+/**
+ * @brief Açılmış dosya için okunacak boyutu belirler ve gerekirse tamponu ayırır. Arka plan
+ * thread'inde çağrılır; boyut açık tanıtıcıdan okunduğu için yol yeniden çözülmez.
+ * @return int 0 veya platform hata kodu.
+ */
+static int fe_async_io_begin_read(fe_async_io_request_t* req) {
+    req->stage = FE_ASYNC_IO_STAGE_READ;
+    if (req->size_from_file) {
+        uint64_t file_size;
+#ifdef _WIN32
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(req->file, &size)) return (int)GetLastError();
+        file_size = (uint64_t)size.QuadPart;
+#else
+        struct stat st;
+        if (fstat(req->fd, &st) != 0) return errno;
+        file_size = (uint64_t)st.st_size;
+#endif
+        req->size = req->offset < file_size ? file_size - req->offset : 0;
+    }
+    if (!req->buffer && req->size > 0) {
+        if (req->size > (uint64_t)SIZE_MAX) return EFBIG;
+        req->buffer = (uint8_t*)FE_MALLOC((size_t)req->size, FE_MEM_TYPE_GENERAL);
+        if (!req->buffer) return ENOMEM;
+        req->owns_buffer = true;
+    }
+    return 0;
+}
+
+static void fe_async_io_close(fe_async_io_request_t* req) {
+#ifdef _WIN32
+    if (req->file != INVALID_HANDLE_VALUE) {
+        CloseHandle(req->file);
+        req->file = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (req->fd != -1) {
+        close(req->fd);
+        req->fd = -1;
+    }
+#endif
+}
+
+/**
+ * @brief Kalan baytları bloklayarak okur (thread havuzu yolu).
+ * @return int 0 veya platform hata kodu. Dosya sonu hata değildir.
+ */
+static int fe_async_io_read_blocking(fe_async_io_request_t* req) {
+    while (req->bytes_read < req->size) {
+        uint64_t chunk = req->size - req->bytes_read;
+        if (chunk > FE_ASYNC_IO_MAX_CHUNK) chunk = FE_ASYNC_IO_MAX_CHUNK;
+        uint64_t position = req->offset + req->bytes_read;
+#ifdef _WIN32
+        OVERLAPPED overlapped;
+        memset(&overlapped, 0, sizeof(overlapped));
+        overlapped.Offset = (DWORD)(position & 0xFFFFFFFFu);
+        overlapped.OffsetHigh = (DWORD)(position >> 32);
+        DWORD got = 0;
+        if (!ReadFile(req->file, req->buffer + req->bytes_read, (DWORD)chunk, &got, &overlapped)) {
+            DWORD error = GetLastError();
+            if (error == ERROR_HANDLE_EOF) return 0;
+            return (int)error;
+        }
+#else
+        ssize_t got = pread(req->fd, req->buffer + req->bytes_read, (size_t)chunk, (off_t)position);
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            return errno;
+        }
+#endif
+        if (got == 0) return 0; // Dosya sonu
+        req->bytes_read += (uint64_t)got;
+    }
+    return 0;
+}
+
+// --- Tamamlanma ---
+
+/**
+ * @brief Arka plan thread'inden çağrılır: sonucu yayınlar, bekleyenleri uyandırır ve
+ * callback'li istekleri dağıtım kuyruğuna ekler.
+ */
+static void fe_async_io_complete(fe_async_io_request_t* req, int error) {
+    fe_async_io_close(req);
+    if (error != 0) {
+        FE_LOG_ERROR("fe_async_io: Reading '%s' failed (error %d).", req->path, error);
+    }
+    FE_FREE(req->path, FE_MEM_TYPE_GENERAL);
+    req->path = NULL;
+
+    fe_mutex_lock(&g_async_io.lock);
+    req->error = error;
+    req->status = error ? FE_ASYNC_IO_STATUS_FAILED : FE_ASYNC_IO_STATUS_COMPLETE;
+    g_async_io.in_flight--;
+    g_async_io.completed++;
+    g_async_io.bytes_read += req->bytes_read;
+
+    if (req->released) {
+        fe_async_io_recycle(req);
+    } else if (req->callback) {
+        req->in_dispatch = true;
+        req->next = NULL;
+        if (g_async_io.dispatch_tail) g_async_io.dispatch_tail->next = req;
+        else g_async_io.dispatch_head = req;
+        g_async_io.dispatch_tail = req;
+    }
+    fe_cond_broadcast(&g_async_io.done_cond);
+    fe_mutex_unlock(&g_async_io.lock);
+}
+
+// --- Thread Havuzu Yedeği ---
+
+static void fe_async_io_worker_main(void* user_data) {
+    (void)user_data;
+    for (;;) {
+        fe_mutex_lock(&g_async_io.lock);
+        while (!g_async_io.work_head && !g_async_io.workers_stop) {
+            fe_cond_wait(&g_async_io.work_cond, &g_async_io.lock);
+        }
+        fe_async_io_request_t* req = g_async_io.work_head;
+        if (!req) { // Durdurma istendi ve kuyruk boş
+            fe_mutex_unlock(&g_async_io.lock);
+            return;
+        }
+        g_async_io.work_head = req->next;
+        if (!g_async_io.work_head) g_async_io.work_tail = NULL;
+        req->next = NULL;
+        fe_mutex_unlock(&g_async_io.lock);
+
+        int error = fe_async_io_open(req);
+        if (error == 0) error = fe_async_io_begin_read(req);
+        if (error == 0) error = fe_async_io_read_blocking(req);
+        fe_async_io_complete(req, error);
+    }
+}
+
+static bool fe_async_io_workers_start(uint32_t count) {
+    g_async_io.workers = (fe_thread_t*)FE_MALLOC(sizeof(fe_thread_t) * count, FE_MEM_TYPE_GENERAL);
+    if (!g_async_io.workers) return false;
+    memset(g_async_io.workers, 0, sizeof(fe_thread_t) * count);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!fe_thread_create(&g_async_io.workers[i], fe_async_io_worker_main, NULL, "fe_async_io")) {
+            FE_LOG_ERROR("fe_async_io: Failed to create I/O worker thread %u.", i);
+            break;
+        }
+        g_async_io.worker_count++;
+    }
+    return g_async_io.worker_count > 0;
+}
+
+static void fe_async_io_workers_stop(void) {
+    fe_mutex_lock(&g_async_io.lock);
+    g_async_io.workers_stop = true;
+    fe_cond_broadcast(&g_async_io.work_cond);
+    fe_mutex_unlock(&g_async_io.lock);
+    for (uint32_t i = 0; i < g_async_io.worker_count; ++i) {
+        fe_thread_join(&g_async_io.workers[i]);
+    }
+    if (g_async_io.workers) FE_FREE(g_async_io.workers, FE_MEM_TYPE_GENERAL);
+    g_async_io.workers = NULL;
+    g_async_io.worker_count = 0;
+}
+
+// --- io_uring ---
+
+#if FE_ASYNC_IO_HAS_IO_URING
+
+static int fe_async_io_uring_enter(uint32_t to_submit, uint32_t min_complete, uint32_t flags) {
+    return (int)syscall(__NR_io_uring_enter, g_async_io.ring.fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static void fe_async_io_uring_destroy(void) {
+    fe_async_io_uring_t* ring = &g_async_io.ring;
+    if (ring->sqes) munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring_ptr && ring->cq_ring_ptr != ring->sq_ring_ptr) munmap(ring->cq_ring_ptr, ring->cq_ring_size);
+    if (ring->sq_ring_ptr) munmap(ring->sq_ring_ptr, ring->sq_ring_size);
+    if (ring->fd >= 0) close(ring->fd);
+    if (ring->event_fd >= 0) close(ring->event_fd);
+    memset(ring, 0, sizeof(fe_async_io_uring_t));
+    ring->fd = -1;
+    ring->event_fd = -1;
+}
+
+/**
+ * @brief Halkaları kurar. CQ, tüm istek tablosunu alacak kadar büyük seçilir ki tamamlanmalar
+ * hiçbir zaman taşmasın.
+ */
+static bool fe_async_io_uring_setup(uint32_t queue_depth, uint32_t max_requests) {
+    fe_async_io_uring_t* ring = &g_async_io.ring;
+    memset(ring, 0, sizeof(fe_async_io_uring_t));
+    ring->fd = -1;
+    ring->event_fd = -1;
+
+    uint32_t cq_entries = queue_depth * 2;
+    while (cq_entries < max_requests + 1) cq_entries <<= 1; // +1: kapatma NOP'u için
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = cq_entries;
+
+    ring->fd = (int)syscall(__NR_io_uring_setup, queue_depth, &params);
+    if (ring->fd < 0) {
+        FE_LOG_INFO("fe_async_io: io_uring unavailable (errno %d); using thread pool.", errno);
+        ring->fd = -1;
+        return false;
+    }
+    if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+        // 5.6 öncesi çekirdeklerde IORING_OP_OPENAT yok; açma çağıranı bloklamasın diye havuz kullanılır
+        FE_LOG_INFO("fe_async_io: io_uring lacks OPENAT (kernel < 5.6); using thread pool.");
+        fe_async_io_uring_destroy();
+        return false;
+    }
+
+    ring->sq_entries = params.sq_entries;
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        if (ring->cq_ring_size > ring->sq_ring_size) ring->sq_ring_size = ring->cq_ring_size;
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+
+    ring->sq_ring_ptr = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                             ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring_ptr == MAP_FAILED) {
+        ring->sq_ring_ptr = NULL;
+        goto fail;
+    }
+    if (single_mmap) {
+        ring->cq_ring_ptr = ring->sq_ring_ptr;
+    } else {
+        ring->cq_ring_ptr = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                 ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring_ptr == MAP_FAILED) {
+            ring->cq_ring_ptr = NULL;
+            goto fail;
+        }
+    }
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                            ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        goto fail;
+    }
+
+    uint8_t* sq = (uint8_t*)ring->sq_ring_ptr;
+    ring->sq_head = (uint32_t*)(sq + params.sq_off.head);
+    ring->sq_tail = (uint32_t*)(sq + params.sq_off.tail);
+    ring->sq_mask = (uint32_t*)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (uint32_t*)(sq + params.sq_off.array);
+    uint8_t* cq = (uint8_t*)ring->cq_ring_ptr;
+    ring->cq_head = (uint32_t*)(cq + params.cq_off.head);
+    ring->cq_tail = (uint32_t*)(cq + params.cq_off.tail);
+    ring->cq_mask = (uint32_t*)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+    ring->event_fd = eventfd(0, EFD_CLOEXEC);
+    if (ring->event_fd < 0 ||
+        syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_EVENTFD, &ring->event_fd, 1) != 0) {
+        goto fail;
+    }
+
+    fe_mutex_init(&ring->submit_lock);
+    FE_LOG_INFO("fe_async_io: io_uring ready (%u SQ / %u CQ entries).", params.sq_entries, params.cq_entries);
+    return true;
+
+fail:
+    FE_LOG_WARN("fe_async_io: io_uring ring setup failed (errno %d); using thread pool.", errno);
+    fe_async_io_uring_destroy();
+    return false;
+}
+
+/**
+ * @brief SQ'ya isteğin adımına göre bir OPENAT veya READV girişi yazar.
+ * Gönderim için fe_async_io_uring_flush çağrılmalıdır. submit_lock tutulmalıdır.
+ * @return bool SQ doluysa false.
+ */
+static bool fe_async_io_uring_push(fe_async_io_request_t* req) {
+    fe_async_io_uring_t* ring = &g_async_io.ring;
+    uint32_t tail = *ring->sq_tail; // Kuyruğu yalnızca biz yazarız
+    uint32_t head = fe_atomic_load_u32(ring->sq_head, FE_ATOMIC_ACQUIRE);
+    if (tail - head >= ring->sq_entries) return false;
+
+    uint32_t index = tail & *ring->sq_mask;
+    struct io_uring_sqe* sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->user_data = (uint64_t)(uintptr_t)req;
+    req->in_ring = true;
+    if (req->stage == FE_ASYNC_IO_STAGE_OPEN) {
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = (uint64_t)(uintptr_t)req->path;
+        sqe->open_flags = O_RDONLY | O_CLOEXEC;
+    } else {
+        sqe->opcode = IORING_OP_READV;
+        uint64_t chunk = req->size - req->bytes_read;
+        if (chunk > FE_ASYNC_IO_MAX_CHUNK) chunk = FE_ASYNC_IO_MAX_CHUNK;
+        req->iov.iov_base = req->buffer + req->bytes_read;
+        req->iov.iov_len = (size_t)chunk;
+        sqe->fd = req->fd;
+        sqe->addr = (uint64_t)(uintptr_t)&req->iov;
+        sqe->len = 1;
+        sqe->off = req->offset + req->bytes_read;
+    }
+    ring->sq_array[index] = index;
+    fe_atomic_store_u32(ring->sq_tail, tail + 1, FE_ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief SQ'da bekleyen tüm girişleri io_uring_enter ile çekirdeğe gönderir. Geçici hatalarda
+ * (EINTR, EAGAIN, EBUSY) yeniden dener. submit_lock tutulmalıdır.
+ * @return int 0 veya kalıcı hatanın errno değeri.
+ */
+static int fe_async_io_uring_flush(void) {
+    fe_async_io_uring_t* ring = &g_async_io.ring;
+    for (;;) {
+        uint32_t pending = *ring->sq_tail - fe_atomic_load_u32(ring->sq_head, FE_ATOMIC_ACQUIRE);
+        if (pending == 0) return 0;
+        if (fe_async_io_uring_enter(pending, 0, 0) < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                fe_thread_yield();
+                continue;
+            }
+            return errno;
+        }
+    }
+}
+
+/**
+ * @brief Kalıcı bir gönderim hatasından sonra halkayı kullanılamaz işaretler; SQ'da çekirdeğin
+ * henüz almadığı girişleri geri alır ve isteklerini hatayla tamamlar. submit_lock tutulmalıdır.
+ */
+static void fe_async_io_uring_fail_unsubmitted(int error) {
+    fe_async_io_uring_t* ring = &g_async_io.ring;
+    if (ring->broken_error == 0) {
+        FE_LOG_ERROR("fe_async_io: io_uring_enter submit failed (errno %d); failing new reads.", error);
+        ring->broken_error = error;
+    }
+    // SQPOLL kullanılmadığından çekirdek SQ'yu yalnızca io_uring_enter içinde okur
+    uint32_t head = fe_atomic_load_u32(ring->sq_head, FE_ATOMIC_ACQUIRE);
+    for (uint32_t tail = head; tail != *ring->sq_tail; ++tail) {
+        struct io_uring_sqe* sqe = &ring->sqes[ring->sq_array[tail & *ring->sq_mask]];
+        fe_async_io_complete((fe_async_io_request_t*)(uintptr_t)sqe->user_data, error);
+    }
+    fe_atomic_store_u32(ring->sq_tail, head, FE_ATOMIC_RELEASE);
+}
+
+/**
+ * @brief İstekleri SQ'ya yazar ve toplu olarak gönderir; SQ dolarsa ara gönderim yapılır.
+ * Halka kalıcı bir hatayla kullanılamaz hale geldiyse istekler o hatayla tamamlanır.
+ */
+static void fe_async_io_uring_submit(fe_async_io_request_t** reqs, uint32_t count) {
+    fe_mutex_lock(&g_async_io.ring.submit_lock);
+    int error = g_async_io.ring.broken_error;
+    uint32_t pushed = 0;
+    while (error == 0 && pushed < count) {
+        if (fe_async_io_uring_push(reqs[pushed])) {
+            pushed++;
+        } else {
+            error = fe_async_io_uring_flush(); // SQ dolu; yer aç
+        }
+    }
+    if (error == 0) error = fe_async_io_uring_flush();
+    if (error != 0) {
+        fe_async_io_uring_fail_unsubmitted(error);
+        for (uint32_t i = pushed; i < count; ++i) {
+            fe_async_io_complete(reqs[i], error);
+        }
+    }
+    fe_mutex_unlock(&g_async_io.ring.submit_lock);
+}
+
+/**
+ * @brief Tamamlanma thread'i kalıcı bir hatayla durmadan önce çağrılır: çekirdekte bekleyen
+ * isteklerin tamamlanmaları artık toplanamayacağı için hepsini hatayla bitirir.
+ */
+static void fe_async_io_uring_fail_in_flight(int error) {
+    fe_mutex_lock(&g_async_io.ring.submit_lock);
+    if (g_async_io.ring.broken_error == 0) g_async_io.ring.broken_error = error;
+
+    fe_async_io_request_t* failed = NULL;
+    fe_mutex_lock(&g_async_io.lock);
+    for (uint32_t i = 0; i < g_async_io.max_requests; ++i) {
+        fe_async_io_request_t* req = &g_async_io.requests[i];
+        // Henüz gönderilmemiş istekler, gönderen thread tarafından broken_error ile bitirilir
+        if (req->status == FE_ASYNC_IO_STATUS_PENDING && req->in_ring) {
+            req->next = failed;
+            failed = req;
+        }
+    }
+    fe_mutex_unlock(&g_async_io.lock);
+
+    while (failed) {
+        fe_async_io_request_t* next = failed->next;
+        failed->next = NULL;
+        fe_async_io_complete(failed, error);
+        failed = next;
+    }
+    fe_mutex_unlock(&g_async_io.ring.submit_lock);
+}
+
+static void fe_async_io_uring_handle_cqe(fe_async_io_request_t* req, int32_t res) {
+    if (req->stage == FE_ASYNC_IO_STAGE_OPEN) {
+        if (res == -EINTR || res == -EAGAIN) {
+            fe_async_io_uring_submit(&req, 1);
+            return;
+        }
+        if (res < 0) {
+            fe_async_io_complete(req, -res);
+            return;
+        }
+        req->fd = res;
+        int error = fe_async_io_begin_read(req);
+        if (error != 0 || req->size == 0) {
+            fe_async_io_complete(req, error); // Hata veya okunacak bir şey yok
+            return;
+        }
+        fe_async_io_uring_submit(&req, 1);
+        return;
+    }
+    if (res < 0) {
+        if (res == -EINTR || res == -EAGAIN) {
+            fe_async_io_uring_submit(&req, 1);
+            return;
+        }
+        fe_async_io_complete(req, -res);
+        return;
+    }
+    if (res == 0) { // Dosya sonu
+        fe_async_io_complete(req, 0);
+        return;
+    }
+    req->bytes_read += (uint64_t)res;
+    if (req->bytes_read < req->size) {
+        fe_async_io_uring_submit(&req, 1); // Kısa okuma; kalanı iste
+    } else {
+        fe_async_io_complete(req, 0);
+    }
+}
+
+static void fe_async_io_uring_reaper_main(void* user_data) {
+    (void)user_data;
+    fe_async_io_uring_t* ring = &g_async_io.ring;
+    for (;;) {
+        uint32_t head = *ring->cq_head; // Başı yalnızca bu thread yazar
+        uint32_t tail = fe_atomic_load_u32(ring->cq_tail, FE_ATOMIC_ACQUIRE);
+        if (head == tail) {
+            if (fe_atomic_load_u32(&ring->stop, FE_ATOMIC_ACQUIRE)) return;
+            // eventfd sayacı CQ boşaltıldıktan sonra gelen her CQE'de artar; uyandırma kaybolmaz
+            uint64_t count;
+            if (read(ring->event_fd, &count, sizeof(count)) < 0) {
+                int error = errno;
+                if (error == EINTR || error == EAGAIN) continue;
+                FE_LOG_ERROR("fe_async_io: Waiting for io_uring completions failed (errno %d); stopping completion thread.", error);
+                fe_async_io_uring_fail_in_flight(error);
+                return;
+            }
+            continue;
+        }
+        while (head != tail) {
+            struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cq_mask];
+            fe_async_io_request_t* req = (fe_async_io_request_t*)(uintptr_t)cqe->user_data;
+            int32_t res = cqe->res;
+            fe_atomic_store_u32(ring->cq_head, ++head, FE_ATOMIC_RELEASE);
+            fe_async_io_uring_handle_cqe(req, res);
+        }
+    }
+}
+
+static void fe_async_io_uring_stop(void) {
+    // Kapatmadan önce uçuştaki istekler beklendi; eventfd'ye yazmak tamamlanma thread'ini
+    // io_uring_enter'a ihtiyaç duymadan uyandırır
+    fe_atomic_store_u32(&g_async_io.ring.stop, 1, FE_ATOMIC_RELEASE);
+    uint64_t one = 1;
+    while (write(g_async_io.ring.event_fd, &one, sizeof(one)) < 0 && errno == EINTR) {}
+
+    fe_thread_join(&g_async_io.ring.reaper);
+    fe_mutex_destroy(&g_async_io.ring.submit_lock);
+    fe_async_io_uring_destroy();
+}
+
+#endif // FE_ASYNC_IO_HAS_IO_URING
+
+// --- Genel Fonksiyonlar ---
+
+bool fe_async_io_init(const fe_async_io_config_t* config) {
+    if (g_async_io.initialized) {
+        FE_LOG_WARN("Async I/O already initialized.");
+        return true;
+    }
+    fe_async_io_config_t cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    if (config) cfg = *config;
+    if (cfg.max_requests == 0) cfg.max_requests = FE_ASYNC_IO_DEFAULT_MAX_REQUESTS;
+    if (cfg.queue_depth == 0) cfg.queue_depth = FE_ASYNC_IO_DEFAULT_QUEUE_DEPTH;
+    if (cfg.fallback_threads == 0) cfg.fallback_threads = FE_ASYNC_IO_DEFAULT_FALLBACK_THREADS;
+    uint32_t depth = 1;
+    while (depth < cfg.queue_depth && depth < 4096) depth <<= 1;
+    cfg.queue_depth = depth;
+
+    memset(&g_async_io, 0, sizeof(g_async_io));
+    g_async_io.requests = (fe_async_io_request_t*)FE_MALLOC(sizeof(fe_async_io_request_t) * cfg.max_requests, FE_MEM_TYPE_GENERAL);
+    if (!g_async_io.requests) {
+        FE_LOG_ERROR("Failed to allocate async I/O request table (%u entries).", cfg.max_requests);
+        return false;
+    }
+    memset(g_async_io.requests, 0, sizeof(fe_async_io_request_t) * cfg.max_requests);
+    g_async_io.max_requests = cfg.max_requests;
+    for (uint32_t i = cfg.max_requests; i-- > 0;) {
+        fe_async_io_recycle(&g_async_io.requests[i]); // Nesil 1'den başlar, boş listeye eklenir
+    }
+
+    fe_mutex_init(&g_async_io.lock);
+    fe_cond_init(&g_async_io.done_cond);
+    fe_cond_init(&g_async_io.work_cond);
+
+#if FE_ASYNC_IO_HAS_IO_URING
+    g_async_io.ring.fd = -1;
+    g_async_io.ring.event_fd = -1;
+    if (!cfg.force_fallback && fe_async_io_uring_setup(cfg.queue_depth, cfg.max_requests)) {
+        if (fe_thread_create(&g_async_io.ring.reaper, fe_async_io_uring_reaper_main, NULL, "fe_async_io_uring")) {
+            g_async_io.using_io_uring = true;
+        } else {
+            FE_LOG_ERROR("fe_async_io: Failed to create io_uring completion thread; using thread pool.");
+            fe_mutex_destroy(&g_async_io.ring.submit_lock);
+            fe_async_io_uring_destroy();
+        }
+    }
+#endif
+
+    if (!g_async_io.using_io_uring && !fe_async_io_workers_start(cfg.fallback_threads)) {
+        FE_LOG_ERROR("Failed to start async I/O worker threads.");
+        fe_async_io_workers_stop();
+        fe_cond_destroy(&g_async_io.work_cond);
+        fe_cond_destroy(&g_async_io.done_cond);
+        fe_mutex_destroy(&g_async_io.lock);
+        FE_FREE(g_async_io.requests, FE_MEM_TYPE_GENERAL);
+        memset(&g_async_io, 0, sizeof(g_async_io));
+        return false;
+    }
+
+    g_async_io.initialized = true;
+    FE_LOG_INFO("Async I/O initialized (%s, %u request slots).",
+                g_async_io.using_io_uring ? "io_uring" : "thread pool", cfg.max_requests);
+    return true;
+}
+
+void fe_async_io_shutdown(void) {
+    if (!g_async_io.initialized) return;
+
+    fe_mutex_lock(&g_async_io.lock);
+    g_async_io.shutting_down = true;
+    while (g_async_io.in_flight > 0) {
+        fe_cond_wait(&g_async_io.done_cond, &g_async_io.lock);
+    }
+    fe_mutex_unlock(&g_async_io.lock);
+
+#if FE_ASYNC_IO_HAS_IO_URING
+    if (g_async_io.using_io_uring) fe_async_io_uring_stop();
+#endif
+    if (!g_async_io.using_io_uring) fe_async_io_workers_stop();
+
+    uint32_t leaked = 0;
+    for (uint32_t i = 0; i < g_async_io.max_requests; ++i) {
+        fe_async_io_request_t* req = &g_async_io.requests[i];
+        if (req->status == FE_ASYNC_IO_STATUS_INVALID) continue;
+        leaked++;
+        if (req->owns_buffer && !req->delivered && req->buffer) {
+            FE_FREE(req->buffer, FE_MEM_TYPE_GENERAL);
+        }
+    }
+    if (leaked > 0) {
+        FE_LOG_WARN("Async I/O shutdown: %u request(s) were never released.", leaked);
+    }
+    FE_LOG_INFO("Async I/O shut down (%llu read(s), %llu byte(s)).",
+                (unsigned long long)g_async_io.completed, (unsigned long long)g_async_io.bytes_read);
+
+    FE_FREE(g_async_io.requests, FE_MEM_TYPE_GENERAL);
+    fe_cond_destroy(&g_async_io.work_cond);
+    fe_cond_destroy(&g_async_io.done_cond);
+    fe_mutex_destroy(&g_async_io.lock);
+    memset(&g_async_io, 0, sizeof(g_async_io));
+}
+
+bool fe_async_io_is_initialized(void) {
+    return g_async_io.initialized;
+}
+
+/**
+ * @brief Bir isteği arka plana vermeden önce hazırlar: giriş ayırır ve yolu kopyalar. Dosyayı
+ * açma, boyutu belirleme ve tampon ayırma arka planda yapılır; çağıran thread dosya sistemine
+ * dokunmaz.
+ * @return fe_async_io_request_t* Gönderilmesi gereken istek; hata varsa NULL (*out_handle geçersiz kalır).
+ */
+static fe_async_io_request_t* fe_async_io_prepare(const fe_async_io_read_desc_t* desc, fe_async_io_handle_t* out_handle) {
+    *out_handle = FE_ASYNC_IO_INVALID_HANDLE;
+    if (!desc || !desc->path) {
+        FE_LOG_ERROR("fe_async_io_read: Invalid parameters.");
+        return NULL;
+    }
+    if (desc->buffer && desc->size == 0) {
+        // Dosya sonuna kadar okumanın boyutu önceden bilinmez; çağıranın tamponu taşabilir
+        FE_LOG_ERROR("fe_async_io_read: A caller buffer requires an explicit size ('%s').", desc->path);
+        return NULL;
+    }
+
+    fe_mutex_lock(&g_async_io.lock);
+    fe_async_io_request_t* req = g_async_io.shutting_down ? NULL : g_async_io.free_list;
+    if (req) {
+        g_async_io.free_list = req->next;
+        req->next = NULL;
+        req->status = FE_ASYNC_IO_STATUS_PENDING;
+    }
+    fe_mutex_unlock(&g_async_io.lock);
+    if (!req) {
+        FE_LOG_WARN("fe_async_io_read: No free request slot for '%s' (%u in use).", desc->path, g_async_io.max_requests);
+        return NULL;
+    }
+
+    size_t path_length = strlen(desc->path);
+    req->path = (char*)FE_MALLOC(path_length + 1, FE_MEM_TYPE_GENERAL);
+    if (!req->path) {
+        FE_LOG_ERROR("fe_async_io_read: Failed to allocate request for '%s'.", desc->path);
+        fe_mutex_lock(&g_async_io.lock);
+        fe_async_io_recycle(req);
+        fe_mutex_unlock(&g_async_io.lock);
+        return NULL;
+    }
+    memcpy(req->path, desc->path, path_length + 1);
+    req->stage = FE_ASYNC_IO_STAGE_OPEN;
+    req->offset = desc->offset;
+    req->size = desc->size;
+    req->size_from_file = desc->size == 0;
+    req->callback = desc->callback;
+    req->user_data = desc->user_data;
+    req->buffer = (uint8_t*)desc->buffer;
+
+    fe_mutex_lock(&g_async_io.lock);
+    *out_handle = fe_async_io_make_handle(req);
+    g_async_io.in_flight++;
+    g_async_io.submitted++;
+    fe_mutex_unlock(&g_async_io.lock);
+    return req;
+}
+
+uint32_t fe_async_io_read_batch(const fe_async_io_read_desc_t* descs, uint32_t count, fe_async_io_handle_t* out_handles) {
+    if (!g_async_io.initialized || !descs || !out_handles) {
+        FE_LOG_ERROR("fe_async_io_read_batch: Async I/O not initialized or invalid parameters.");
+        if (out_handles) memset(out_handles, 0, sizeof(fe_async_io_handle_t) * count);
+        return 0;
+    }
+
+    fe_async_io_request_t* pending[32];
+    uint32_t pending_count = 0;
+    uint32_t queued = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_async_io_request_t* req = fe_async_io_prepare(&descs[i], &out_handles[i]);
+        if (out_handles[i] != FE_ASYNC_IO_INVALID_HANDLE) queued++;
+        if (req) pending[pending_count++] = req;
+        if (pending_count == sizeof(pending) / sizeof(pending[0]) || (i + 1 == count && pending_count > 0)) {
+#if FE_ASYNC_IO_HAS_IO_URING
+            if (g_async_io.using_io_uring) {
+                fe_async_io_uring_submit(pending, pending_count);
+                pending_count = 0;
+                continue;
+            }
+#endif
+            fe_mutex_lock(&g_async_io.lock);
+            for (uint32_t j = 0; j < pending_count; ++j) {
+                if (g_async_io.work_tail) g_async_io.work_tail->next = pending[j];
+                else g_async_io.work_head = pending[j];
+                g_async_io.work_tail = pending[j];
+            }
+            fe_cond_broadcast(&g_async_io.work_cond);
+            fe_mutex_unlock(&g_async_io.lock);
+            pending_count = 0;
+        }
+    }
+    return queued;
+}
+
+fe_async_io_handle_t fe_async_io_read(const fe_async_io_read_desc_t* desc) {
+    fe_async_io_handle_t handle = FE_ASYNC_IO_INVALID_HANDLE;
+    fe_async_io_read_batch(desc, 1, &handle);
+    return handle;
+}
+
+fe_async_io_status_t fe_async_io_poll(fe_async_io_handle_t handle, fe_async_io_result_t* out_result) {
+    if (out_result) memset(out_result, 0, sizeof(fe_async_io_result_t));
+    if (!g_async_io.initialized) return FE_ASYNC_IO_STATUS_INVALID;
+
+    fe_mutex_lock(&g_async_io.lock);
+    fe_async_io_request_t* req = fe_async_io_lookup(handle);
+    fe_async_io_status_t status = req ? req->status : FE_ASYNC_IO_STATUS_INVALID;
+    if (req && status != FE_ASYNC_IO_STATUS_PENDING && out_result) {
+        fe_async_io_deliver(req, out_result);
+    }
+    fe_mutex_unlock(&g_async_io.lock);
+    return status;
+}
+
+fe_async_io_status_t fe_async_io_wait(fe_async_io_handle_t handle, fe_async_io_result_t* out_result) {
+    if (out_result) memset(out_result, 0, sizeof(fe_async_io_result_t));
+    if (!g_async_io.initialized) return FE_ASYNC_IO_STATUS_INVALID;
+
+    fe_mutex_lock(&g_async_io.lock);
+    fe_async_io_request_t* req = fe_async_io_lookup(handle);
+    while (req && req->status == FE_ASYNC_IO_STATUS_PENDING) {
+        fe_cond_wait(&g_async_io.done_cond, &g_async_io.lock);
+        req = fe_async_io_lookup(handle); // Beklerken başka bir thread bırakmış olabilir
+    }
+    fe_async_io_status_t status = req ? req->status : FE_ASYNC_IO_STATUS_INVALID;
+    if (req && out_result) {
+        fe_async_io_deliver(req, out_result);
+    }
+    fe_mutex_unlock(&g_async_io.lock);
+    return status;
+}
+
+void fe_async_io_release(fe_async_io_handle_t handle) {
+    if (!g_async_io.initialized) return;
+    fe_mutex_lock(&g_async_io.lock);
+    fe_async_io_request_t* req = fe_async_io_lookup(handle);
+    if (req) {
+        if (req->status == FE_ASYNC_IO_STATUS_PENDING || req->in_dispatch) {
+            req->released = true; // Tamamlanma veya dağıtım sırasında geri dönüştürülür
+        } else {
+            fe_async_io_recycle(req);
+        }
+    }
+    fe_mutex_unlock(&g_async_io.lock);
+}
+
+uint32_t fe_async_io_dispatch_completions(uint32_t max_count) {
+    if (!g_async_io.initialized) return 0;
+    uint32_t dispatched = 0;
+    while (max_count == 0 || dispatched < max_count) {
+        fe_mutex_lock(&g_async_io.lock);
+        fe_async_io_request_t* req = g_async_io.dispatch_head;
+        if (!req) {
+            fe_mutex_unlock(&g_async_io.lock);
+            break;
+        }
+        g_async_io.dispatch_head = req->next;
+        if (!g_async_io.dispatch_head) g_async_io.dispatch_tail = NULL;
+        req->next = NULL;
+        req->in_dispatch = false;
+        if (req->released) {
+            fe_async_io_recycle(req);
+            fe_mutex_unlock(&g_async_io.lock);
+            continue;
+        }
+        fe_async_io_result_t result;
+        fe_async_io_fill_result(req, &result);
+        req->delivered = true;
+        fe_async_io_handle_t handle = fe_async_io_make_handle(req);
+        fe_async_io_callback_t callback = req->callback;
+        void* user_data = req->user_data;
+        fe_mutex_unlock(&g_async_io.lock);
+
+        callback(handle, &result, user_data);
+        dispatched++;
+
+        fe_async_io_release(handle);
+    }
+    return dispatched;
+}
+
+void fe_async_io_get_stats(fe_async_io_stats_t* out_stats) {
+    if (!out_stats) return;
+    memset(out_stats, 0, sizeof(fe_async_io_stats_t));
+    if (!g_async_io.initialized) return;
+    fe_mutex_lock(&g_async_io.lock);
+    out_stats->using_io_uring = g_async_io.using_io_uring;
+    out_stats->in_flight = g_async_io.in_flight;
+    out_stats->submitted = g_async_io.submitted;
+    out_stats->completed = g_async_io.completed;
+    out_stats->bytes_read = g_async_io.bytes_read;
+    fe_mutex_unlock(&g_async_io.lock);
+}
@@ -0,0 +1,438 @@
+#include "platform/fe_ddc.h"
+#include "core/utils/fe_logger.h"           // Loglama için
+#include "core/utils/fe_atomic.h"           // Sayaçlar ve geçici dosya numarası için
+#include "core/memory/fe_memory_manager.h"  // FE_MALLOC, FE_FREE için
+
+#include <string.h> // memcmp, memcpy, strlen için
+#include <stdio.h>  // snprintf için
+#include <errno.h>  // errno, EEXIST, EINTR için
+
+#ifdef _WIN32
+#include <windows.h> // CreateFileW, MoveFileExW, CreateDirectoryW için
+typedef HANDLE fe_ddc_file_t;
+#define FE_DDC_INVALID_FILE INVALID_HANDLE_VALUE
+#else
+#include <fcntl.h>     // open için
+#include <unistd.h>    // read, write, close, unlink, getpid için
+#include <sys/stat.h>  // mkdir, fstat için
+typedef int fe_ddc_file_t;
+#define FE_DDC_INVALID_FILE (-1)
+#endif
+
+#define FE_DDC_MAGIC          "FDDC"
+#define FE_DDC_FORMAT_VERSION 1u
+#define FE_DDC_MAX_PATH       1024
+#define FE_DDC_MAX_CHUNK      (1u << 30) // Tek read/write çağrısında aktarılan en fazla bayt
+
+// Anahtar şeritlerinin tohumları; sabit kalmalıdır, değişirse tüm önbellek geçersiz olur
+#define FE_DDC_SEED_LO 0x6665646463303031ull
+#define FE_DDC_SEED_HI 0x9E3779B97F4A7C15ull
+
+/**
+ * @brief Her kaydın başındaki başlık (48 bayt, küçük uçlu).
+ */
+typedef struct fe_ddc_record_header {
+    char     magic[4];      // FE_DDC_MAGIC
+    uint32_t version;       // FE_DDC_FORMAT_VERSION
+    uint64_t key[2];        // Dosya adıyla aynı olmalı (yanlış yere taşınmış kayıtları reddeder)
+    uint64_t payload_size;
+    uint64_t payload_hash;  // fe_hash64(yük, 0)
+    uint64_t reserved;
+} fe_ddc_record_header_t;
+
+typedef struct fe_ddc_state {
+    bool              is_initialized;
+    char              root[FE_DDC_MAX_PATH - 64]; // Kayıt ve geçici dosya yollarına yer kalsın
+    volatile uint32_t temp_counter;
+    volatile uint64_t hits;
+    volatile uint64_t misses;
+    volatile uint64_t puts;
+    volatile uint64_t corrupt;
+    volatile uint64_t bytes_read;
+    volatile uint64_t bytes_written;
+} fe_ddc_state_t;
+
+static fe_ddc_state_t g_ddc;
+
+// --- Anahtar Oluşturma ---
+
+void fe_ddc_key_begin(fe_ddc_key_builder_t* builder, const char* processor_name, uint32_t processor_version) {
+    fe_hash64_init(&builder->lanes[0], FE_DDC_SEED_LO);
+    fe_hash64_init(&builder->lanes[1], FE_DDC_SEED_HI);
+    fe_ddc_key_add_string(builder, processor_name);
+    fe_ddc_key_add_u64(builder, processor_version);
+}
+
+void fe_ddc_key_add(fe_ddc_key_builder_t* builder, const void* data, size_t size) {
+    uint64_t length = (uint64_t)size;
+    for (int i = 0; i < 2; ++i) {
+        fe_hash64_update(&builder->lanes[i], &length, sizeof(length));
+        fe_hash64_update(&builder->lanes[i], data, size);
+    }
+}
+
+void fe_ddc_key_add_string(fe_ddc_key_builder_t* builder, const char* str) {
+    if (!str) {
+        fe_ddc_key_add_u64(builder, UINT64_MAX); // Hiçbir string uzunluğu bu değeri alamaz
+        return;
+    }
+    fe_ddc_key_add(builder, str, strlen(str));
+}
+
+void fe_ddc_key_add_u64(fe_ddc_key_builder_t* builder, uint64_t value) {
+    for (int i = 0; i < 2; ++i) {
+        fe_hash64_update(&builder->lanes[i], &value, sizeof(value));
+    }
+}
+
+fe_ddc_key_t fe_ddc_key_end(const fe_ddc_key_builder_t* builder) {
+    fe_ddc_key_t key;
+    key.hash[0] = fe_hash64_digest(&builder->lanes[0]);
+    key.hash[1] = fe_hash64_digest(&builder->lanes[1]);
+    return key;
+}
+
+void fe_ddc_key_to_string(const fe_ddc_key_t* key, char* out_str) {
+    snprintf(out_str, 33, "%016llx%016llx", (unsigned long long)key->hash[0], (unsigned long long)key->hash[1]);
+}
+
+// --- Platform Dosya Yardımcıları ---
+
+#ifdef _WIN32
+static bool fe_ddc_widen(const char* path, wchar_t* out_wide, int count) {
+    return MultiByteToWideChar(CP_UTF8, 0, path, -1, out_wide, count) != 0;
+}
+#endif
+
+/**
+ * @brief Tek bir dizin oluşturur; zaten varsa başarılı sayılır.
+ */
+static bool fe_ddc_make_dir(const char* path) {
+#ifdef _WIN32
+    wchar_t wide_path[FE_DDC_MAX_PATH];
+    if (!fe_ddc_widen(path, wide_path, FE_DDC_MAX_PATH)) return false;
+    return CreateDirectoryW(wide_path, NULL) || GetLastError() == ERROR_ALREADY_EXISTS;
+#else
+    return mkdir(path, 0755) == 0 || errno == EEXIST;
+#endif
+}
+
+/**
+ * @brief Yoldaki tüm ara dizinleri oluşturur (mkdir -p).
+ */
+static bool fe_ddc_make_dirs(const char* path) {
+    char partial[FE_DDC_MAX_PATH];
+    size_t length = strlen(path);
+    if (length == 0 || length >= sizeof(partial)) return false;
+    memcpy(partial, path, length + 1);
+    for (size_t i = 1; i < length; ++i) {
+        if (partial[i] != '/' && partial[i] != '\\') continue;
+        if (partial[i - 1] == ':') continue; // Windows sürücü kökü ("C:\")
+        char separator = partial[i];
+        partial[i] = '\0';
+        bool ok = fe_ddc_make_dir(partial);
+        partial[i] = separator;
+        if (!ok) return false;
+    }
+    return fe_ddc_make_dir(partial);
+}
+
+static bool fe_ddc_open_read(const char* path, fe_ddc_file_t* out_file, uint64_t* out_size) {
+#ifdef _WIN32
+    wchar_t wide_path[FE_DDC_MAX_PATH];
+    if (!fe_ddc_widen(path, wide_path, FE_DDC_MAX_PATH)) return false;
+    // FILE_SHARE_DELETE: okurken başka bir yazar kaydı MoveFileEx ile değiştirebilir
+    HANDLE file = CreateFileW(wide_path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    *out_file = file;
+    *out_size = (uint64_t)size.QuadPart;
+    return true;
+#else
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    *out_file = fd;
+    *out_size = (uint64_t)st.st_size;
+    return true;
+#endif
+}
+
+/**
+ * @brief Yeni bir dosyayı yazmak için oluşturur; dosya zaten varsa başarısız olur.
+ */
+static bool fe_ddc_open_write(const char* path, fe_ddc_file_t* out_file) {
+#ifdef _WIN32
+    wchar_t wide_path[FE_DDC_MAX_PATH];
+    if (!fe_ddc_widen(path, wide_path, FE_DDC_MAX_PATH)) return false;
+    HANDLE file = CreateFileW(wide_path, GENERIC_WRITE, 0, NULL, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    *out_file = file;
+    return true;
+#else
+    int fd = open(path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd == -1) return false;
+    *out_file = fd;
+    return true;
+#endif
+}
+
+static void fe_ddc_close(fe_ddc_file_t file) {
+#ifdef _WIN32
+    CloseHandle(file);
+#else
+    close(file);
+#endif
+}
+
+static bool fe_ddc_read_all(fe_ddc_file_t file, void* buffer, uint64_t size) {
+    uint8_t* p = (uint8_t*)buffer;
+    while (size > 0) {
+        uint32_t chunk = size > FE_DDC_MAX_CHUNK ? FE_DDC_MAX_CHUNK : (uint32_t)size;
+#ifdef _WIN32
+        DWORD got = 0;
+        if (!ReadFile(file, p, (DWORD)chunk, &got, NULL) || got == 0) return false;
+#else
+        ssize_t got = read(file, p, chunk);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) return false;
+#endif
+        p += got;
+        size -= (uint64_t)got;
+    }
+    return true;
+}
+
+static bool fe_ddc_write_all(fe_ddc_file_t file, const void* buffer, uint64_t size) {
+    const uint8_t* p = (const uint8_t*)buffer;
+    while (size > 0) {
+        uint32_t chunk = size > FE_DDC_MAX_CHUNK ? FE_DDC_MAX_CHUNK : (uint32_t)size;
+#ifdef _WIN32
+        DWORD written = 0;
+        if (!WriteFile(file, p, (DWORD)chunk, &written, NULL) || written == 0) return false;
+#else
+        ssize_t written = write(file, p, chunk);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) return false;
+#endif
+        p += written;
+        size -= (uint64_t)written;
+    }
+    return true;
+}
+
+static void fe_ddc_remove(const char* path) {
+#ifdef _WIN32
+    wchar_t wide_path[FE_DDC_MAX_PATH];
+    if (fe_ddc_widen(path, wide_path, FE_DDC_MAX_PATH)) DeleteFileW(wide_path);
+#else
+    unlink(path);
+#endif
+}
+
+/**
+ * @brief Dosyayı hedefe atomik olarak taşır; hedef varsa yerine geçer.
+ */
+static bool fe_ddc_move(const char* from, const char* to) {
+#ifdef _WIN32
+    wchar_t wide_from[FE_DDC_MAX_PATH];
+    wchar_t wide_to[FE_DDC_MAX_PATH];
+    if (!fe_ddc_widen(from, wide_from, FE_DDC_MAX_PATH) || !fe_ddc_widen(to, wide_to, FE_DDC_MAX_PATH)) return false;
+    return MoveFileExW(wide_from, wide_to, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return rename(from, to) == 0;
+#endif
+}
+
+static uint32_t fe_ddc_process_id(void) {
+#ifdef _WIN32
+    return (uint32_t)GetCurrentProcessId();
+#else
+    return (uint32_t)getpid();
+#endif
+}
+
+// --- Yol Oluşturma ---
+
+/**
+ * @brief Kaydın shard dizinini ("kök/ab/cd") ve dosya yolunu ("kök/ab/cd/<anahtar>.ddc") üretir.
+ */
+static bool fe_ddc_record_path(const fe_ddc_key_t* key, char* out_dir, char* out_path) {
+    char key_str[33];
+    fe_ddc_key_to_string(key, key_str);
+    int dir_length = snprintf(out_dir, FE_DDC_MAX_PATH, "%s/%.2s/%.2s", g_ddc.root, key_str, key_str + 2);
+    if (dir_length < 0 || dir_length >= FE_DDC_MAX_PATH) return false;
+    int path_length = snprintf(out_path, FE_DDC_MAX_PATH, "%s/%s.ddc", out_dir, key_str);
+    return path_length > 0 && path_length < FE_DDC_MAX_PATH;
+}
+
+// --- Genel Fonksiyonlar ---
+
+bool fe_ddc_init(const char* root_dir) {
+    if (g_ddc.is_initialized) {
+        FE_LOG_WARN("Derived data cache already initialized.");
+        return true;
+    }
+    if (!root_dir || root_dir[0] == '\0') {
+        FE_LOG_ERROR("fe_ddc_init: Invalid root directory.");
+        return false;
+    }
+    memset(&g_ddc, 0, sizeof(g_ddc));
+
+    size_t length = strlen(root_dir);
+    while (length > 1 && (root_dir[length - 1] == '/' || root_dir[length - 1] == '\\')) length--;
+    // Kayıt yolu kök + "/ab/cd/" + 32 karakter + ".ddc" kadar uzar
+    if (length + 48 >= sizeof(g_ddc.root)) {
+        FE_LOG_ERROR("fe_ddc_init: Root directory path too long: %s", root_dir);
+        return false;
+    }
+    memcpy(g_ddc.root, root_dir, length);
+    g_ddc.root[length] = '\0';
+
+    char temp_dir[FE_DDC_MAX_PATH];
+    snprintf(temp_dir, sizeof(temp_dir), "%s/tmp", g_ddc.root);
+    if (!fe_ddc_make_dirs(temp_dir)) {
+        FE_LOG_ERROR("fe_ddc_init: Failed to create cache directory: %s", temp_dir);
+        return false;
+    }
+
+    g_ddc.is_initialized = true;
+    FE_LOG_INFO("Derived data cache initialized: %s", g_ddc.root);
+    return true;
+}
+
+void fe_ddc_shutdown(void) {
+    if (!g_ddc.is_initialized) return;
+    FE_LOG_INFO("Derived data cache shut down (hits: %llu, misses: %llu, puts: %llu, corrupt: %llu).",
+                (unsigned long long)g_ddc.hits, (unsigned long long)g_ddc.misses,
+                (unsigned long long)g_ddc.puts, (unsigned long long)g_ddc.corrupt);
+    g_ddc.is_initialized = false;
+}
+
+bool fe_ddc_is_initialized(void) {
+    return g_ddc.is_initialized;
+}
+
+bool fe_ddc_get(const fe_ddc_key_t* key, void** out_data, size_t* out_size) {
+    if (!key || !out_data || !out_size) {
+        FE_LOG_ERROR("fe_ddc_get: Invalid parameters.");
+        return false;
+    }
+    *out_data = NULL;
+    *out_size = 0;
+    if (!g_ddc.is_initialized) return false;
+
+    char dir[FE_DDC_MAX_PATH];
+    char path[FE_DDC_MAX_PATH];
+    fe_ddc_file_t file = FE_DDC_INVALID_FILE;
+    uint64_t file_size = 0;
+    if (!fe_ddc_record_path(key, dir, path) || !fe_ddc_open_read(path, &file, &file_size)) {
+        fe_atomic_fetch_add_u64(&g_ddc.misses, 1, FE_ATOMIC_RELAXED);
+        return false;
+    }
+
+    fe_ddc_record_header_t header;
+    bool valid = file_size >= sizeof(header) && fe_ddc_read_all(file, &header, sizeof(header)) &&
+                 memcmp(header.magic, FE_DDC_MAGIC, sizeof(header.magic)) == 0 &&
+                 header.version == FE_DDC_FORMAT_VERSION &&
+                 header.key[0] == key->hash[0] && header.key[1] == key->hash[1] &&
+                 header.payload_size == file_size - sizeof(header) &&
+                 header.payload_size <= (uint64_t)SIZE_MAX;
+
+    uint8_t* payload = NULL;
+    if (valid) {
+        payload = (uint8_t*)FE_MALLOC(header.payload_size ? (size_t)header.payload_size : 1, FE_MEM_TYPE_GENERAL);
+        if (!payload) {
+            FE_LOG_ERROR("fe_ddc_get: Out of memory reading %llu byte record.", (unsigned long long)header.payload_size);
+            fe_ddc_close(file);
+            fe_atomic_fetch_add_u64(&g_ddc.misses, 1, FE_ATOMIC_RELAXED);
+            return false;
+        }
+        valid = fe_ddc_read_all(file, payload, header.payload_size) &&
+                fe_hash64(payload, (size_t)header.payload_size, 0) == header.payload_hash;
+    }
+    fe_ddc_close(file);
+
+    if (!valid) {
+        // Kesilmiş yazma, disk hatası veya eski format; kaydı sil ki bir sonraki put yenisini koysun
+        FE_LOG_WARN("Derived data cache: discarding corrupt record %s", path);
+        if (payload) FE_FREE(payload, FE_MEM_TYPE_GENERAL);
+        fe_ddc_remove(path);
+        fe_atomic_fetch_add_u64(&g_ddc.corrupt, 1, FE_ATOMIC_RELAXED);
+        fe_atomic_fetch_add_u64(&g_ddc.misses, 1, FE_ATOMIC_RELAXED);
+        return false;
+    }
+
+    *out_data = payload;
+    *out_size = (size_t)header.payload_size;
+    fe_atomic_fetch_add_u64(&g_ddc.hits, 1, FE_ATOMIC_RELAXED);
+    fe_atomic_fetch_add_u64(&g_ddc.bytes_read, header.payload_size, FE_ATOMIC_RELAXED);
+    return true;
+}
+
+bool fe_ddc_put(const fe_ddc_key_t* key, const void* data, size_t size) {
+    if (!key || (!data && size > 0)) {
+        FE_LOG_ERROR("fe_ddc_put: Invalid parameters.");
+        return false;
+    }
+    if (!g_ddc.is_initialized) return false;
+
+    char dir[FE_DDC_MAX_PATH];
+    char path[FE_DDC_MAX_PATH];
+    if (!fe_ddc_record_path(key, dir, path)) return false;
+    if (!fe_ddc_make_dirs(dir)) {
+        FE_LOG_WARN("Derived data cache: failed to create directory %s", dir);
+        return false;
+    }
+
+    // Süreç kimliği + sayaç: aynı kökü paylaşan süreçler ve thread'ler aynı geçici dosyayı seçmez
+    char temp_path[FE_DDC_MAX_PATH];
+    uint32_t serial = fe_atomic_fetch_add_u32(&g_ddc.temp_counter, 1, FE_ATOMIC_RELAXED);
+    snprintf(temp_path, sizeof(temp_path), "%s/tmp/%u-%u.tmp", g_ddc.root, fe_ddc_process_id(), serial);
+
+    fe_ddc_file_t file = FE_DDC_INVALID_FILE;
+    if (!fe_ddc_open_write(temp_path, &file)) {
+        FE_LOG_WARN("Derived data cache: failed to create %s", temp_path);
+        return false;
+    }
+
+    fe_ddc_record_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FE_DDC_MAGIC, sizeof(header.magic));
+    header.version = FE_DDC_FORMAT_VERSION;
+    header.key[0] = key->hash[0];
+    header.key[1] = key->hash[1];
+    header.payload_size = (uint64_t)size;
+    header.payload_hash = fe_hash64(size ? data : "", size, 0);
+
+    bool written = fe_ddc_write_all(file, &header, sizeof(header)) && fe_ddc_write_all(file, data, size);
+    fe_ddc_close(file);
+    if (!written || !fe_ddc_move(temp_path, path)) {
+        FE_LOG_WARN("Derived data cache: failed to store record %s", path);
+        fe_ddc_remove(temp_path);
+        return false;
+    }
+
+    fe_atomic_fetch_add_u64(&g_ddc.puts, 1, FE_ATOMIC_RELAXED);
+    fe_atomic_fetch_add_u64(&g_ddc.bytes_written, (uint64_t)size, FE_ATOMIC_RELAXED);
+    return true;
+}
+
+void fe_ddc_get_stats(fe_ddc_stats_t* out_stats) {
+    if (!out_stats) return;
+    out_stats->hits = fe_atomic_load_u64(&g_ddc.hits, FE_ATOMIC_RELAXED);
+    out_stats->misses = fe_atomic_load_u64(&g_ddc.misses, FE_ATOMIC_RELAXED);
+    out_stats->puts = fe_atomic_load_u64(&g_ddc.puts, FE_ATOMIC_RELAXED);
+    out_stats->corrupt = fe_atomic_load_u64(&g_ddc.corrupt, FE_ATOMIC_RELAXED);
+    out_stats->bytes_read = fe_atomic_load_u64(&g_ddc.bytes_read, FE_ATOMIC_RELAXED);
+    out_stats->bytes_written = fe_atomic_load_u64(&g_ddc.bytes_written, FE_ATOMIC_RELAXED);
+}
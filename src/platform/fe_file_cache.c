@@ -0,0 +1,322 @@
+#include "platform/fe_file_cache.h"
+#include "core/utils/fe_logger.h"              // Loglama için
+#include "core/memory/fe_memory_manager.h"     // FE_MALLOC, FE_FREE için
+#include "core/containers/fe_hash_map.g.h"     // Yol -> giriş haritası için
+#include "core/containers/fe_string_intern.h"  // Yol tanıtıcıları için
+#include "platform/fe_thread.h"                // fe_mutex_t için
+#include "platform/fe_pak.h"                   // Bağlanmış arşivlerden okumak için
+
+#include <string.h> // memset için
+
+#ifdef _WIN32
+#include "platform/windows/fe_windows_io.h" // fe_winio_map_file için
+typedef fe_windows_memory_mapped_file_t fe_file_cache_mapping_t;
+#else
+#include "platform/unix/fe_unix_io.h"       // fe_unixio_map_file için
+#include <sys/mman.h>                      // madvise için
+typedef fe_unix_memory_mapped_file_t fe_file_cache_mapping_t;
+#endif
+
+// --- Dahili Yapılar ---
+
+/**
+ * @brief Tek bir eşlenmiş dosya. Aynı yolu isteyen tüm görünümler bu girişi paylaşır.
+ */
+typedef struct fe_file_cache_entry {
+    fe_string_id_t          path_id;
+    uint32_t                ref_count; // g_file_cache.lock altında değişir
+    bool                    cached;    // false ise haritada değildir (önbellek kapalıyken açıldı)
+    bool                    from_pak;  // true ise veri bağlı bir arşivden gelir, mapping kullanılmaz
+    const uint8_t*          data;
+    size_t                  size;
+    fe_file_cache_mapping_t mapping;
+    fe_pak_data_t           pak_data;
+} fe_file_cache_entry_t;
+
+FE_HASH_MAP_DECLARE(fe_file_cache_map, fe_string_id_t, fe_file_cache_entry_t*, fe_string_id_hash, fe_string_id_eq)
+
+static struct {
+    bool                initialized;
+    fe_mutex_t          lock;
+    fe_file_cache_map_t entries;
+    uint64_t            mapped_bytes;
+    uint64_t            hits;
+    uint64_t            misses;
+    uint64_t            pak_hits;
+    fe_pak_t*           paks[FE_FILE_CACHE_MAX_PAKS]; // Bağlanma sırasıyla; sondan başa aranır
+    uint32_t            pak_count;
+} g_file_cache;
+
+// --- Platform Yardımcıları ---
+
+/**
+ * @brief Yolu ilk pak_count bağlı arşivde arar (son bağlanan önce). Kilit gerektirmez: arşivler
+ * yalnızca sona eklenir ve kapatılana kadar değişmez; pak_count kilit altında okunmuş olmalıdır.
+ * out_resolved true ise sonuç kesindir ve diske bakılmaz: boş girdi, boş disk dosyası gibi başarısız
+ * olur ama diskteki kopyayı gölgelemeye devam eder.
+ */
+static bool fe_file_cache_map_from_pak(fe_file_cache_entry_t* entry, const char* path, uint32_t pak_count, bool* out_resolved) {
+    *out_resolved = false;
+    for (uint32_t i = pak_count; i-- > 0;) {
+        const fe_pak_entry_t* pak_entry = fe_pak_find(g_file_cache.paks[i], path);
+        if (!pak_entry) continue;
+        if (pak_entry->size == 0) {
+            FE_LOG_WARN("fe_file_cache: Attempted to map an empty archive entry: '%s'", path);
+            *out_resolved = true;
+            return false;
+        }
+        if (!fe_pak_read(g_file_cache.paks[i], pak_entry, &entry->pak_data)) return false;
+        entry->from_pak = true;
+        entry->data = entry->pak_data.data;
+        entry->size = entry->pak_data.size;
+        *out_resolved = true;
+        return true;
+    }
+    return false;
+}
+
+static bool fe_file_cache_map(fe_file_cache_entry_t* entry, const char* path, uint32_t pak_count) {
+    bool resolved = false;
+    bool mapped = fe_file_cache_map_from_pak(entry, path, pak_count, &resolved);
+    if (resolved) return mapped;
+#ifdef _WIN32
+    wchar_t wide_path[1024];
+    if (MultiByteToWideChar(CP_UTF8, 0, path, -1, wide_path, (int)(sizeof(wide_path) / sizeof(wide_path[0]))) == 0) {
+        FE_LOG_ERROR("fe_file_cache: Path could not be converted to UTF-16: %s", path);
+        return false;
+    }
+    if (!fe_winio_map_file(&entry->mapping, wide_path, FE_FILE_ACCESS_READ_ONLY)) return false;
+#else
+    if (!fe_unixio_map_file(&entry->mapping, path, FE_FILE_ACCESS_READ_ONLY)) return false;
+#endif
+    entry->data = (const uint8_t*)entry->mapping.view_ptr;
+    entry->size = (size_t)entry->mapping.size;
+    return true;
+}
+
+static void fe_file_cache_unmap(fe_file_cache_entry_t* entry) {
+    if (entry->from_pak) {
+        fe_pak_data_release(&entry->pak_data);
+        return;
+    }
+#ifdef _WIN32
+    fe_winio_unmap_file(&entry->mapping);
+#else
+    fe_unixio_unmap_file(&entry->mapping);
+#endif
+}
+
+/**
+ * @brief Erişim ipucunu çekirdeğe iletir. Windows'ta eşdeğer bir çağrı kullanılmaz; sayfa
+ * hataları zaten dosya önbelleğinden karşılanır.
+ */
+static void fe_file_cache_advise(fe_file_cache_entry_t* entry, fe_file_access_hint_t hint) {
+#ifdef _WIN32
+    (void)entry;
+    (void)hint;
+#else
+    // Arşiv girdileri sayfa hizalıdır; çözülmüş (sıkıştırılmış) girdiler ise yığında durur
+    if (entry->from_pak && entry->pak_data.owned) return;
+    int advice;
+    switch (hint) {
+        case FE_FILE_ACCESS_HINT_SEQUENTIAL: advice = MADV_SEQUENTIAL; break;
+        case FE_FILE_ACCESS_HINT_RANDOM:     advice = MADV_RANDOM;     break;
+        case FE_FILE_ACCESS_HINT_WILLNEED:   advice = MADV_WILLNEED;   break;
+        default: return;
+    }
+    if (madvise((void*)entry->data, entry->size, advice) != 0) {
+        FE_LOG_DEBUG("fe_file_cache: madvise(%d) failed for '%s'.", advice, fe_string_intern_c_str(entry->path_id));
+    }
+    if (hint == FE_FILE_ACCESS_HINT_SEQUENTIAL) {
+        // Sıralı okunan dosyalar da hemen tüketilir; önden okumayı ilk sayfa hatasını beklemeden başlat
+        madvise((void*)entry->data, entry->size, MADV_WILLNEED);
+    }
+#endif
+}
+
+static void fe_file_cache_fill_view(fe_file_cache_entry_t* entry, fe_file_view_t* out_view) {
+    out_view->data = entry->data;
+    out_view->size = entry->size;
+    out_view->entry = entry;
+}
+
+// --- Genel Fonksiyonlar ---
+
+bool fe_file_cache_init(void) {
+    if (g_file_cache.initialized) {
+        FE_LOG_WARN("File cache already initialized.");
+        return true;
+    }
+    memset(&g_file_cache, 0, sizeof(g_file_cache));
+    if (!fe_file_cache_map_init(&g_file_cache.entries, 64)) {
+        FE_LOG_ERROR("Failed to initialize file cache map.");
+        return false;
+    }
+    fe_mutex_init(&g_file_cache.lock);
+    g_file_cache.initialized = true;
+    FE_LOG_INFO("File cache initialized.");
+    return true;
+}
+
+void fe_file_cache_shutdown(void) {
+    if (!g_file_cache.initialized) return;
+
+    fe_mutex_lock(&g_file_cache.lock);
+    FE_HASH_MAP_FOREACH(&g_file_cache.entries, fe_string_id_t, path_id, fe_file_cache_entry_t*, entry) {
+        FE_LOG_WARN("File cache shutdown: '%s' still has %u view(s); unmapping.",
+                    fe_string_intern_c_str(path_id), entry->ref_count);
+        fe_file_cache_unmap(entry);
+        FE_FREE(entry, FE_MEM_TYPE_GENERAL);
+    }
+    fe_file_cache_map_shutdown(&g_file_cache.entries);
+    for (uint32_t i = 0; i < g_file_cache.pak_count; ++i) {
+        fe_pak_close(g_file_cache.paks[i]);
+    }
+    FE_LOG_INFO("File cache shut down (%llu hit(s), %llu miss(es), %llu served from pak).",
+                (unsigned long long)g_file_cache.hits, (unsigned long long)g_file_cache.misses,
+                (unsigned long long)g_file_cache.pak_hits);
+    g_file_cache.initialized = false;
+    fe_mutex_unlock(&g_file_cache.lock);
+    fe_mutex_destroy(&g_file_cache.lock);
+}
+
+bool fe_file_cache_acquire(const char* path, fe_file_access_hint_t hint, fe_file_view_t* out_view) {
+    if (!path || !out_view) {
+        FE_LOG_ERROR("fe_file_cache_acquire: Invalid parameters.");
+        return false;
+    }
+    memset(out_view, 0, sizeof(fe_file_view_t));
+
+    fe_string_id_t path_id = fe_string_intern(path);
+    if (path_id == FE_STRING_ID_INVALID) {
+        FE_LOG_ERROR("fe_file_cache_acquire: Failed to intern path: %s", path);
+        return false;
+    }
+
+    bool cached = g_file_cache.initialized;
+    uint32_t pak_count = 0;
+    if (cached) {
+        fe_mutex_lock(&g_file_cache.lock);
+        fe_file_cache_entry_t** existing = fe_file_cache_map_get(&g_file_cache.entries, path_id);
+        if (existing) {
+            fe_file_cache_entry_t* entry = *existing;
+            entry->ref_count++;
+            g_file_cache.hits++;
+            fe_mutex_unlock(&g_file_cache.lock);
+            // Referans alındıktan sonra giriş kilitsiz kullanılabilir
+            fe_file_cache_advise(entry, hint);
+            fe_file_cache_fill_view(entry, out_view);
+            return true;
+        }
+        pak_count = g_file_cache.pak_count;
+        fe_mutex_unlock(&g_file_cache.lock);
+    }
+
+    // Yeni eşleme kilit dışında yapılır: open/mmap ve arşivden çözme diğer thread'lerin
+    // önbellek isabetlerini bekletmez. Aynı yolu eşleyen iki thread yarışırsa ilk yayımlanan kalır.
+    fe_file_cache_entry_t* entry = (fe_file_cache_entry_t*)FE_MALLOC(sizeof(fe_file_cache_entry_t), FE_MEM_TYPE_GENERAL);
+    if (!entry) return false;
+    memset(entry, 0, sizeof(fe_file_cache_entry_t));
+    if (!fe_file_cache_map(entry, path, pak_count)) {
+        FE_FREE(entry, FE_MEM_TYPE_GENERAL);
+        return false;
+    }
+    entry->path_id = path_id;
+    entry->ref_count = 1;
+    entry->cached = cached;
+
+    if (cached) {
+        fe_mutex_lock(&g_file_cache.lock);
+        fe_file_cache_entry_t** existing = fe_file_cache_map_get(&g_file_cache.entries, path_id);
+        if (existing) {
+            // Başka bir thread aynı dosyayı bizden önce yayımladı; onunkini paylaş
+            fe_file_cache_entry_t* winner = *existing;
+            winner->ref_count++;
+            g_file_cache.hits++;
+            fe_mutex_unlock(&g_file_cache.lock);
+            fe_file_cache_unmap(entry);
+            FE_FREE(entry, FE_MEM_TYPE_GENERAL);
+            entry = winner;
+        } else {
+            if (fe_file_cache_map_insert(&g_file_cache.entries, path_id, entry)) {
+                g_file_cache.mapped_bytes += entry->size;
+            } else {
+                entry->cached = false; // Paylaşılamaz ama görünüm yine geçerli
+            }
+            g_file_cache.misses++;
+            if (entry->from_pak) g_file_cache.pak_hits++;
+            fe_mutex_unlock(&g_file_cache.lock);
+        }
+    }
+    fe_file_cache_advise(entry, hint);
+    fe_file_cache_fill_view(entry, out_view);
+    return true;
+}
+
+void fe_file_cache_release(fe_file_view_t* view) {
+    if (!view || !view->entry) return;
+    fe_file_cache_entry_t* entry = (fe_file_cache_entry_t*)view->entry;
+    memset(view, 0, sizeof(fe_file_view_t));
+
+    if (!entry->cached) {
+        fe_file_cache_unmap(entry);
+        FE_FREE(entry, FE_MEM_TYPE_GENERAL);
+        return;
+    }
+
+    fe_mutex_lock(&g_file_cache.lock);
+    if (--entry->ref_count == 0) {
+        fe_file_cache_map_remove(&g_file_cache.entries, entry->path_id);
+        g_file_cache.mapped_bytes -= entry->size;
+        fe_file_cache_unmap(entry);
+        FE_FREE(entry, FE_MEM_TYPE_GENERAL);
+    }
+    fe_mutex_unlock(&g_file_cache.lock);
+}
+
+void fe_file_cache_get_stats(fe_file_cache_stats_t* out_stats) {
+    if (!out_stats) return;
+    memset(out_stats, 0, sizeof(fe_file_cache_stats_t));
+    if (!g_file_cache.initialized) return;
+    fe_mutex_lock(&g_file_cache.lock);
+    out_stats->mapped_files = (uint32_t)fe_file_cache_map_size(&g_file_cache.entries);
+    out_stats->mapped_bytes = g_file_cache.mapped_bytes;
+    out_stats->hits = g_file_cache.hits;
+    out_stats->misses = g_file_cache.misses;
+    out_stats->pak_hits = g_file_cache.pak_hits;
+    out_stats->mounted_paks = g_file_cache.pak_count;
+    fe_mutex_unlock(&g_file_cache.lock);
+}
+
+bool fe_file_cache_mount_pak(const char* pak_path) {
+    if (!g_file_cache.initialized) {
+        FE_LOG_ERROR("fe_file_cache_mount_pak: File cache is not initialized.");
+        return false;
+    }
+    fe_pak_t* pak = fe_pak_open(pak_path);
+    if (!pak) return false;
+
+    fe_mutex_lock(&g_file_cache.lock);
+    bool mounted = g_file_cache.pak_count < FE_FILE_CACHE_MAX_PAKS;
+    if (mounted) {
+        g_file_cache.paks[g_file_cache.pak_count++] = pak;
+    }
+    fe_mutex_unlock(&g_file_cache.lock);
+
+    if (!mounted) {
+        FE_LOG_ERROR("fe_file_cache_mount_pak: Cannot mount '%s'; %u archives already mounted.", pak_path, FE_FILE_CACHE_MAX_PAKS);
+        fe_pak_close(pak);
+    }
+    return mounted;
+}
+
+bool fe_file_cache_is_packed(const char* path) {
+    if (!path || !g_file_cache.initialized) return false;
+    bool found = false;
+    fe_mutex_lock(&g_file_cache.lock);
+    for (uint32_t i = 0; i < g_file_cache.pak_count && !found; ++i) {
+        found = fe_pak_find(g_file_cache.paks[i], path) != NULL;
+    }
+    fe_mutex_unlock(&g_file_cache.lock);
+    return found;
+}
@@ -0,0 +1,227 @@
+#include "platform/fe_pak.h"
+#include "core/utils/fe_logger.h"           // Loglama için
+#include "core/utils/fe_lz4.h"              // LZ4 girdilerini çözmek için
+#include "core/memory/fe_memory_manager.h"  // FE_MALLOC, FE_FREE için
+
+#include <string.h> // memcmp, memset, strncpy için
+
+#ifdef _WIN32
+#include "platform/windows/fe_windows_io.h" // fe_winio_map_file için
+typedef fe_windows_memory_mapped_file_t fe_pak_mapping_t;
+#else
+#include "platform/unix/fe_unix_io.h"       // fe_unixio_map_file için
+#include <sys/mman.h>                      // madvise için
+typedef fe_unix_memory_mapped_file_t fe_pak_mapping_t;
+#endif
+
+#ifdef FE_WITH_ZSTD
+#include <zstd.h> // ZSTD_decompress için
+#endif
+
+struct fe_pak {
+    fe_pak_mapping_t      mapping;
+    const uint8_t*        base;
+    const fe_pak_entry_t* entries;     // TOC, eşlemenin içinde
+    const char*           names;       // Yol tablosu, eşlemenin içinde
+    uint32_t              entry_count;
+    char                  path[256];   // Loglar için
+};
+
+// --- Yardımcılar ---
+
+static bool fe_pak_map(fe_pak_t* pak, const char* pak_path) {
+#ifdef _WIN32
+    wchar_t wide_path[1024];
+    if (MultiByteToWideChar(CP_UTF8, 0, pak_path, -1, wide_path, (int)(sizeof(wide_path) / sizeof(wide_path[0]))) == 0) {
+        FE_LOG_ERROR("fe_pak_open: Path could not be converted to UTF-16: %s", pak_path);
+        return false;
+    }
+    return fe_winio_map_file(&pak->mapping, wide_path, FE_FILE_ACCESS_READ_ONLY);
+#else
+    if (!fe_unixio_map_file(&pak->mapping, pak_path, FE_FILE_ACCESS_READ_ONLY)) return false;
+    // Varlıklar arşivde dağınık sırayla istenir; geniş önden okuma boşa sayfa getirir
+    madvise(pak->mapping.view_ptr, (size_t)pak->mapping.size, MADV_RANDOM);
+    return true;
+#endif
+}
+
+static void fe_pak_unmap(fe_pak_t* pak) {
+#ifdef _WIN32
+    fe_winio_unmap_file(&pak->mapping);
+#else
+    fe_unixio_unmap_file(&pak->mapping);
+#endif
+}
+
+/**
+ * @brief Başlığı, TOC sınırlarını, sıralamayı ve her girdinin konumunu doğrular. Bozuk bir arşiv
+ * açılışta reddedilir; böylece okuma sırasında sınır denetimi gerekmez.
+ */
+static bool fe_pak_validate(fe_pak_t* pak) {
+    uint64_t file_size = pak->mapping.size;
+    if (file_size < sizeof(fe_pak_header_t)) return false;
+    const fe_pak_header_t* header = (const fe_pak_header_t*)pak->base;
+    if (memcmp(header->magic, FE_PAK_MAGIC, sizeof(header->magic)) != 0) return false;
+    if (header->version != FE_PAK_VERSION) {
+        FE_LOG_ERROR("fe_pak_open: '%s' has unsupported version %u (expected %u).", pak->path, header->version, FE_PAK_VERSION);
+        return false;
+    }
+    uint64_t toc_size = (uint64_t)header->entry_count * sizeof(fe_pak_entry_t);
+    if (header->toc_offset % 8 != 0 || header->toc_offset > file_size || toc_size > file_size - header->toc_offset) return false;
+    if (header->names_offset > file_size || header->names_size > file_size - header->names_offset) return false;
+    if (header->names_size > UINT32_MAX) return false;
+
+    pak->entries = (const fe_pak_entry_t*)(pak->base + header->toc_offset);
+    pak->names = (const char*)(pak->base + header->names_offset);
+    pak->entry_count = header->entry_count;
+
+    for (uint32_t i = 0; i < pak->entry_count; ++i) {
+        const fe_pak_entry_t* entry = &pak->entries[i];
+        if (entry->offset > file_size || entry->stored_size > file_size - entry->offset) return false;
+        if ((uint64_t)entry->name_offset + entry->name_length >= header->names_size) return false;
+        if (pak->names[entry->name_offset + entry->name_length] != '\0') return false;
+        if (entry->compression == FE_PAK_COMPRESSION_NONE && entry->stored_size != entry->size) return false;
+        if (i > 0 && pak->entries[i - 1].path_hash > entry->path_hash) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Arşiv yolunu sorgu yoluyla karşılaştırır; sorgudaki '\\' ayraçları '/' sayılır.
+ */
+static bool fe_pak_path_equals(const char* stored, uint16_t stored_length, const char* query) {
+    for (uint16_t i = 0; i < stored_length; ++i) {
+        char c = query[i];
+        if (c == '\0') return false;
+        if (c == '\\') c = '/';
+        if (c != stored[i]) return false;
+    }
+    return query[stored_length] == '\0';
+}
+
+// --- Genel Fonksiyonlar ---
+
+fe_pak_t* fe_pak_open(const char* pak_path) {
+    if (!pak_path) {
+        FE_LOG_ERROR("fe_pak_open: Invalid parameters.");
+        return NULL;
+    }
+    fe_pak_t* pak = (fe_pak_t*)FE_MALLOC(sizeof(fe_pak_t), FE_MEM_TYPE_GENERAL);
+    if (!pak) return NULL;
+    memset(pak, 0, sizeof(fe_pak_t));
+    strncpy(pak->path, pak_path, sizeof(pak->path) - 1);
+
+    if (!fe_pak_map(pak, pak_path)) {
+        FE_FREE(pak, FE_MEM_TYPE_GENERAL);
+        return NULL;
+    }
+    pak->base = (const uint8_t*)pak->mapping.view_ptr;
+    if (!fe_pak_validate(pak)) {
+        FE_LOG_ERROR("fe_pak_open: '%s' is not a valid pak archive.", pak_path);
+        fe_pak_unmap(pak);
+        FE_FREE(pak, FE_MEM_TYPE_GENERAL);
+        return NULL;
+    }
+
+    FE_LOG_INFO("Pak archive opened: %s (%u entries, %llu bytes).",
+                pak_path, pak->entry_count, (unsigned long long)pak->mapping.size);
+    return pak;
+}
+
+void fe_pak_close(fe_pak_t* pak) {
+    if (!pak) return;
+    fe_pak_unmap(pak);
+    FE_FREE(pak, FE_MEM_TYPE_GENERAL);
+}
+
+const fe_pak_entry_t* fe_pak_find(const fe_pak_t* pak, const char* path) {
+    if (!pak || !path) return NULL;
+    uint64_t hash = fe_pak_hash_path(path);
+
+    // Hash'e göre alt sınır; aynı hash'e sahip (çakışan) girdiler ardışıktır
+    uint32_t lo = 0;
+    uint32_t hi = pak->entry_count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (pak->entries[mid].path_hash < hash) lo = mid + 1;
+        else hi = mid;
+    }
+    for (uint32_t i = lo; i < pak->entry_count && pak->entries[i].path_hash == hash; ++i) {
+        const fe_pak_entry_t* entry = &pak->entries[i];
+        if (fe_pak_path_equals(pak->names + entry->name_offset, entry->name_length, path)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+bool fe_pak_read(const fe_pak_t* pak, const fe_pak_entry_t* entry, fe_pak_data_t* out_data) {
+    if (!pak || !entry || !out_data) {
+        FE_LOG_ERROR("fe_pak_read: Invalid parameters.");
+        return false;
+    }
+    memset(out_data, 0, sizeof(fe_pak_data_t));
+    const uint8_t* stored = pak->base + entry->offset;
+
+    if (entry->compression == FE_PAK_COMPRESSION_NONE) {
+        out_data->data = stored;
+        out_data->size = (size_t)entry->size;
+        return true;
+    }
+
+    if (entry->size > (uint64_t)SIZE_MAX) return false;
+    uint8_t* buffer = (uint8_t*)FE_MALLOC(entry->size ? (size_t)entry->size : 1, FE_MEM_TYPE_GENERAL);
+    if (!buffer) {
+        FE_LOG_ERROR("fe_pak_read: Out of memory decompressing '%s' (%llu bytes).",
+                     fe_pak_entry_path(pak, entry), (unsigned long long)entry->size);
+        return false;
+    }
+
+    bool ok = false;
+    switch (entry->compression) {
+        case FE_PAK_COMPRESSION_LZ4:
+            ok = fe_lz4_decompress(stored, (size_t)entry->stored_size, buffer, (size_t)entry->size);
+            break;
+#ifdef FE_WITH_ZSTD
+        case FE_PAK_COMPRESSION_ZSTD: {
+            size_t result = ZSTD_decompress(buffer, (size_t)entry->size, stored, (size_t)entry->stored_size);
+            ok = !ZSTD_isError(result) && result == entry->size;
+            break;
+        }
+#endif
+        default:
+            FE_LOG_ERROR("fe_pak_read: '%s' uses unsupported compression %u.",
+                         fe_pak_entry_path(pak, entry), entry->compression);
+            FE_FREE(buffer, FE_MEM_TYPE_GENERAL);
+            return false;
+    }
+    if (!ok) {
+        FE_LOG_ERROR("fe_pak_read: Corrupt compressed entry '%s' in '%s'.", fe_pak_entry_path(pak, entry), pak->path);
+        FE_FREE(buffer, FE_MEM_TYPE_GENERAL);
+        return false;
+    }
+    out_data->data = buffer;
+    out_data->size = (size_t)entry->size;
+    out_data->owned = buffer;
+    return true;
+}
+
+void fe_pak_data_release(fe_pak_data_t* data) {
+    if (!data) return;
+    if (data->owned) FE_FREE(data->owned, FE_MEM_TYPE_GENERAL);
+    memset(data, 0, sizeof(fe_pak_data_t));
+}
+
+uint32_t fe_pak_entry_count(const fe_pak_t* pak) {
+    return pak ? pak->entry_count : 0;
+}
+
+const fe_pak_entry_t* fe_pak_entry_at(const fe_pak_t* pak, uint32_t index) {
+    if (!pak || index >= pak->entry_count) return NULL;
+    return &pak->entries[index];
+}
+
+const char* fe_pak_entry_path(const fe_pak_t* pak, const fe_pak_entry_t* entry) {
+    if (!pak || !entry) return NULL;
+    return pak->names + entry->name_offset;
+}
@@ -0,0 +1,210 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // pthread_setname_np için
+#endif
+
+#include "platform/fe_thread.h"
+#include "core/utils/fe_logger.h"
+#include "core/memory/fe_memory_manager.h" // FE_MALLOC, FE_FREE için
+
+#include <string.h> // memset, strncpy için
+#include <errno.h>  // ETIMEDOUT için
+
+#ifndef _WIN32
+#include <sched.h>   // sched_yield için
+#include <time.h>    // clock_gettime için
+#include <unistd.h>  // sysconf için
+#endif
+
+// --- Thread Başlatma ---
+
+// Thread fonksiyonu ve verisi, yeni thread'e tek bir işaretçiyle aktarılır.
+typedef struct fe_thread_start {
+    fe_thread_func func;
+    void*          user_data;
+    char           name[16]; // pthread_setname_np sınırı (15 karakter + null)
+} fe_thread_start_t;
+
+#ifdef _WIN32
+static DWORD WINAPI fe_thread_entry(LPVOID param) {
+#else
+static void* fe_thread_entry(void* param) {
+#endif
+    fe_thread_start_t start = *(fe_thread_start_t*)param;
+    FE_FREE(param, FE_MEM_TYPE_TEMP);
+
+#if defined(__linux__)
+    if (start.name[0]) pthread_setname_np(pthread_self(), start.name);
+#elif defined(__APPLE__)
+    if (start.name[0]) pthread_setname_np(start.name);
+#endif
+
+    start.func(start.user_data);
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+bool fe_thread_create(fe_thread_t* thread, fe_thread_func func, void* user_data, const char* name) {
+    if (!thread || !func) {
+        FE_LOG_ERROR("fe_thread_create: Invalid parameters.");
+        return false;
+    }
+    memset(thread, 0, sizeof(fe_thread_t));
+
+    fe_thread_start_t* start = (fe_thread_start_t*)FE_MALLOC(sizeof(fe_thread_start_t), FE_MEM_TYPE_TEMP);
+    if (!start) {
+        FE_LOG_ERROR("fe_thread_create: Failed to allocate thread start data.");
+        return false;
+    }
+    memset(start, 0, sizeof(fe_thread_start_t));
+    start->func = func;
+    start->user_data = user_data;
+    if (name) {
+        strncpy(start->name, name, sizeof(start->name) - 1);
+    }
+
+#ifdef _WIN32
+    thread->handle = CreateThread(NULL, 0, fe_thread_entry, start, 0, NULL);
+    if (!thread->handle) {
+        FE_LOG_ERROR("fe_thread_create: CreateThread failed (error %lu).", GetLastError());
+        FE_FREE(start, FE_MEM_TYPE_TEMP);
+        return false;
+    }
+#else
+    int result = pthread_create(&thread->handle, NULL, fe_thread_entry, start);
+    if (result != 0) {
+        FE_LOG_ERROR("fe_thread_create: pthread_create failed (%s).", strerror(result));
+        FE_FREE(start, FE_MEM_TYPE_TEMP);
+        return false;
+    }
+#endif
+    thread->started = true;
+    return true;
+}
+
+void fe_thread_join(fe_thread_t* thread) {
+    if (!thread || !thread->started) return;
+#ifdef _WIN32
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+    thread->started = false;
+}
+
+void fe_thread_yield(void) {
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+uint32_t fe_thread_hardware_concurrency(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (uint32_t)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (uint32_t)count : 1;
+#endif
+}
+
+// --- Muteks ---
+
+bool fe_mutex_init(fe_mutex_t* mutex) {
+    if (!mutex) return false;
+#ifdef _WIN32
+    InitializeSRWLock(&mutex->lock);
+    return true;
+#else
+    return pthread_mutex_init(&mutex->lock, NULL) == 0;
+#endif
+}
+
+void fe_mutex_destroy(fe_mutex_t* mutex) {
+    if (!mutex) return;
+#ifndef _WIN32
+    pthread_mutex_destroy(&mutex->lock);
+#endif
+}
+
+void fe_mutex_lock(fe_mutex_t* mutex) {
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_lock(&mutex->lock);
+#endif
+}
+
+void fe_mutex_unlock(fe_mutex_t* mutex) {
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_unlock(&mutex->lock);
+#endif
+}
+
+// --- Koşul Değişkeni ---
+
+bool fe_cond_init(fe_cond_t* cond) {
+    if (!cond) return false;
+#ifdef _WIN32
+    InitializeConditionVariable(&cond->cond);
+    return true;
+#else
+    return pthread_cond_init(&cond->cond, NULL) == 0;
+#endif
+}
+
+void fe_cond_destroy(fe_cond_t* cond) {
+    if (!cond) return;
+#ifndef _WIN32
+    pthread_cond_destroy(&cond->cond);
+#endif
+}
+
+void fe_cond_wait(fe_cond_t* cond, fe_mutex_t* mutex) {
+#ifdef _WIN32
+    SleepConditionVariableSRW(&cond->cond, &mutex->lock, INFINITE, 0);
+#else
+    pthread_cond_wait(&cond->cond, &mutex->lock);
+#endif
+}
+
+bool fe_cond_wait_timeout(fe_cond_t* cond, fe_mutex_t* mutex, uint32_t timeout_ms) {
+#ifdef _WIN32
+    return SleepConditionVariableSRW(&cond->cond, &mutex->lock, timeout_ms, 0) != 0;
+#else
+    // pthread_cond_timedwait mutlak CLOCK_REALTIME zamanı bekler.
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    return pthread_cond_timedwait(&cond->cond, &mutex->lock, &deadline) != ETIMEDOUT;
+#endif
+}
+
+void fe_cond_signal(fe_cond_t* cond) {
+#ifdef _WIN32
+    WakeConditionVariable(&cond->cond);
+#else
+    pthread_cond_signal(&cond->cond);
+#endif
+}
+
+void fe_cond_broadcast(fe_cond_t* cond) {
+#ifdef _WIN32
+    WakeAllConditionVariable(&cond->cond);
+#else
+    pthread_cond_broadcast(&cond->cond);
+#endif
+}
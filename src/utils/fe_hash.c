@@ -0,0 +1,150 @@
+#include "core/utils/fe_hash.h"
+
+#include <string.h> // memcpy için
+
+#define FE_HASH64_PRIME1 0x9E3779B185EBCA87ull
+#define FE_HASH64_PRIME2 0xC2B2AE3D27D4EB4Full
+#define FE_HASH64_PRIME3 0x165667B19E3779F9ull
+#define FE_HASH64_PRIME4 0x85EBCA77C2B2AE63ull
+#define FE_HASH64_PRIME5 0x27D4EB2F165667C5ull
+
+// Okumalar küçük uçlu varsayılır (desteklenen tüm platformlar little-endian)
+static inline uint64_t fe_hash_read64(const uint8_t* p) {
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint32_t fe_hash_read32(const uint8_t* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint64_t fe_hash_rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t fe_hash64_round(uint64_t acc, uint64_t input) {
+    acc += input * FE_HASH64_PRIME2;
+    acc = fe_hash_rotl64(acc, 31);
+    return acc * FE_HASH64_PRIME1;
+}
+
+static inline uint64_t fe_hash64_merge_round(uint64_t acc, uint64_t value) {
+    acc ^= fe_hash64_round(0, value);
+    return acc * FE_HASH64_PRIME1 + FE_HASH64_PRIME4;
+}
+
+/**
+ * @brief 32 baytlık şeritleri dört akümülatöre işler.
+ * @return const uint8_t* İşlenmemiş ilk bayt.
+ */
+static const uint8_t* fe_hash64_consume(uint64_t acc[4], const uint8_t* p, const uint8_t* end) {
+    while ((size_t)(end - p) >= 32) {
+        acc[0] = fe_hash64_round(acc[0], fe_hash_read64(p));
+        acc[1] = fe_hash64_round(acc[1], fe_hash_read64(p + 8));
+        acc[2] = fe_hash64_round(acc[2], fe_hash_read64(p + 16));
+        acc[3] = fe_hash64_round(acc[3], fe_hash_read64(p + 24));
+        p += 32;
+    }
+    return p;
+}
+
+/**
+ * @brief Akümülatörleri birleştirir, kalan (< 32) baytları işler ve son karıştırmayı yapar.
+ */
+static uint64_t fe_hash64_finalize(const uint64_t acc[4], bool long_input, uint64_t seed, uint64_t total_length,
+                                   const uint8_t* p, size_t remaining) {
+    uint64_t h;
+    if (long_input) {
+        h = fe_hash_rotl64(acc[0], 1) + fe_hash_rotl64(acc[1], 7) + fe_hash_rotl64(acc[2], 12) + fe_hash_rotl64(acc[3], 18);
+        h = fe_hash64_merge_round(h, acc[0]);
+        h = fe_hash64_merge_round(h, acc[1]);
+        h = fe_hash64_merge_round(h, acc[2]);
+        h = fe_hash64_merge_round(h, acc[3]);
+    } else {
+        h = seed + FE_HASH64_PRIME5;
+    }
+    h += total_length;
+
+    while (remaining >= 8) {
+        h ^= fe_hash64_round(0, fe_hash_read64(p));
+        h = fe_hash_rotl64(h, 27) * FE_HASH64_PRIME1 + FE_HASH64_PRIME4;
+        p += 8;
+        remaining -= 8;
+    }
+    if (remaining >= 4) {
+        h ^= (uint64_t)fe_hash_read32(p) * FE_HASH64_PRIME1;
+        h = fe_hash_rotl64(h, 23) * FE_HASH64_PRIME2 + FE_HASH64_PRIME3;
+        p += 4;
+        remaining -= 4;
+    }
+    while (remaining > 0) {
+        h ^= (*p) * FE_HASH64_PRIME5;
+        h = fe_hash_rotl64(h, 11) * FE_HASH64_PRIME1;
+        p++;
+        remaining--;
+    }
+
+    h ^= h >> 33;
+    h *= FE_HASH64_PRIME2;
+    h ^= h >> 29;
+    h *= FE_HASH64_PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+static void fe_hash64_reset_acc(uint64_t acc[4], uint64_t seed) {
+    acc[0] = seed + FE_HASH64_PRIME1 + FE_HASH64_PRIME2;
+    acc[1] = seed + FE_HASH64_PRIME2;
+    acc[2] = seed;
+    acc[3] = seed - FE_HASH64_PRIME1;
+}
+
+uint64_t fe_hash64(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* p = (const uint8_t*)data;
+    const uint8_t* end = p + size;
+    uint64_t acc[4];
+    fe_hash64_reset_acc(acc, seed);
+    if (size >= 32) p = fe_hash64_consume(acc, p, end);
+    return fe_hash64_finalize(acc, size >= 32, seed, (uint64_t)size, p, (size_t)(end - p));
+}
+
+void fe_hash64_init(fe_hash64_state_t* state, uint64_t seed) {
+    memset(state, 0, sizeof(fe_hash64_state_t));
+    state->seed = seed;
+    fe_hash64_reset_acc(state->acc, seed);
+}
+
+void fe_hash64_update(fe_hash64_state_t* state, const void* data, size_t size) {
+    if (!data || size == 0) return;
+    const uint8_t* p = (const uint8_t*)data;
+    const uint8_t* end = p + size;
+    state->total_length += size;
+
+    // Önce yarım kalan şeridi tamamla
+    if (state->buffer_size > 0) {
+        size_t fill = 32 - state->buffer_size;
+        if (size < fill) {
+            memcpy(state->buffer + state->buffer_size, p, size);
+            state->buffer_size += (uint32_t)size;
+            return;
+        }
+        memcpy(state->buffer + state->buffer_size, p, fill);
+        fe_hash64_consume(state->acc, state->buffer, state->buffer + 32);
+        p += fill;
+        state->buffer_size = 0;
+    }
+
+    p = fe_hash64_consume(state->acc, p, end);
+    if (p < end) {
+        memcpy(state->buffer, p, (size_t)(end - p));
+        state->buffer_size = (uint32_t)(end - p);
+    }
+}
+
+uint64_t fe_hash64_digest(const fe_hash64_state_t* state) {
+    return fe_hash64_finalize(state->acc, state->total_length >= 32, state->seed, state->total_length,
+                              state->buffer, state->buffer_size);
+}
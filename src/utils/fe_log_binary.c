@@ -0,0 +1,271 @@
+#include "core/utils/fe_log_binary.h"
+#include "core/utils/fe_atomic.h" // fe_atomic_load_u32 için
+#include "core/utils/fe_timer.h"  // fe_timer_now_ns için
+#include "platform/fe_thread.h"   // fe_mutex_t için
+
+#include <stdio.h>  // FILE, fopen, fwrite için
+#include <string.h> // memset, memcpy, strlen için
+#include <stddef.h> // ptrdiff_t için
+#include <time.h>   // timespec_get için
+
+// --- Dahili Yapılar ---
+
+// Çağrı noktası tablosu boyutu (2'nin kuvveti). Dolarsa yeni çağrı noktaları ikili dosyaya yazılmaz.
+#define FE_LOG_BINARY_SITE_TABLE_SIZE FE_LOG_BINARY_MAX_SITES
+
+
+/**
+ * @brief Dosyada tanımlanmış bir çağrı noktası ve önbelleğe alınmış argüman tipleri.
+ */
+typedef struct fe_log_binary_site {
+    const char* format; // NULL ise boş slot
+    const char* file;
+    int         line;
+    uint32_t    id;
+    uint32_t    arg_count;
+    uint8_t     arg_types[FE_LOG_BINARY_MAX_ARGS];
+} fe_log_binary_site_t;
+
+/**
+ * @brief Tekrarlanan string argümanlar için bir yuva (çözücüdeki tablonun aynısı).
+ */
+typedef struct fe_log_binary_cached_string {
+    uint8_t length; // 0 ise boş yuva
+    char    text[FE_LOG_BINARY_CACHED_STRING_MAX];
+} fe_log_binary_cached_string_t;
+
+// Durum yapısının dışında tutulur; fe_log_binary_open yapıyı sıfırlarken içeride kalmış bir
+// yazıcının sayacını silmemek için
+static uint32_t g_log_binary_open;  // Atomik; 1 ise dosya açık ve yeni yazıcılar kabul edilir
+static uint32_t g_log_binary_users; // Atomik; dosyaya yazmak için içeri girmiş thread sayısı
+
+static struct {
+    uint32_t             min_level;     // Atomik; fe_log_level_t
+    FILE*                file;
+    uint64_t             open_ns;       // Açılıştaki monotonik saat
+    uint64_t             last_ns;       // Son mesajın monotonik saati (zaman farkları buna göre yazılır)
+    uint32_t             next_site_id;
+    uint64_t             dropped;       // Tablo dolduğu için yazılamayan mesajlar
+    fe_mutex_t           lock;          // Dosyaya ve site tablosuna erişimi korur
+    fe_log_binary_site_t sites[FE_LOG_BINARY_SITE_TABLE_SIZE];
+    fe_log_binary_cached_string_t strings[FE_LOG_BINARY_STRING_SLOTS];
+} g_log_binary;
+
+// --- Küçük Uçlu Yazma Yardımcıları ---
+
+static inline uint8_t* fe_log_binary_put_u16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8);
+    return p + 2;
+}
+
+static inline uint8_t* fe_log_binary_put_u32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; ++i) p[i] = (uint8_t)(v >> (8 * i));
+    return p + 4;
+}
+
+static inline uint8_t* fe_log_binary_put_u64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; ++i) p[i] = (uint8_t)(v >> (8 * i));
+    return p + 8;
+}
+
+/**
+ * @brief Bir string argüman yazar; yuvasında aynı string varsa yalnızca yuva numarasını yazar.
+ */
+static uint8_t* fe_log_binary_put_string(uint8_t* p, const char* s) {
+    size_t length = strlen(s);
+    if (length > FE_LOG_BINARY_MAX_STRING) length = FE_LOG_BINARY_MAX_STRING;
+    if (length > 0 && length <= FE_LOG_BINARY_CACHED_STRING_MAX) {
+        uint32_t slot = fe_log_string_slot(s, length);
+        fe_log_binary_cached_string_t* cached = &g_log_binary.strings[slot];
+        if (cached->length == length && memcmp(cached->text, s, length) == 0) {
+            return fe_log_varint_put(p, ((uint64_t)slot << 1) | 1u);
+        }
+        cached->length = (uint8_t)length;
+        memcpy(cached->text, s, length);
+    }
+    p = fe_log_varint_put(p, (uint64_t)length << 1);
+    memcpy(p, s, length);
+    return p + length;
+}
+
+// --- Çağrı Noktaları ---
+
+/**
+ * @brief Çağrı noktasını bulur; dosyada ilk kez görülüyorsa argüman tiplerini çıkarır, ID verir
+ * ve tanım kaydını yazar. Kilit tutulurken çağrılır. Tablo doluysa NULL döner.
+ */
+static fe_log_binary_site_t* fe_log_binary_get_site(fe_log_level_t level, const char* file, int line, const char* format) {
+    uintptr_t key = (uintptr_t)format ^ ((uintptr_t)file >> 3) ^ ((uintptr_t)line * 0x9E3779B1u);
+    key ^= key >> 15;
+    uint32_t mask = FE_LOG_BINARY_SITE_TABLE_SIZE - 1;
+    for (uint32_t probe = 0; probe < FE_LOG_BINARY_SITE_TABLE_SIZE; ++probe) {
+        fe_log_binary_site_t* site = &g_log_binary.sites[(key + probe) & mask];
+        if (site->format == format && site->file == file && site->line == line) {
+            return site;
+        }
+        if (site->format != NULL) continue;
+
+        // Yeni çağrı noktası: tipleri çıkar
+        site->format = format;
+        site->file = file;
+        site->line = line;
+        site->id = g_log_binary.next_site_id++;
+        site->arg_count = fe_log_format_arg_types(format, site->arg_types);
+
+        // Tanım kaydı
+        uint8_t header[1 + 4 + 1 + 4];
+        uint8_t* h = header;
+        *h++ = FE_LOG_BINARY_RECORD_SITE;
+        h = fe_log_binary_put_u32(h, site->id);
+        *h++ = (uint8_t)level;
+        h = fe_log_binary_put_u32(h, (uint32_t)line);
+        fwrite(header, 1, sizeof(header), g_log_binary.file);
+
+        uint8_t length[2];
+        size_t file_length = strlen(file) > 0xFFFF ? 0xFFFF : strlen(file);
+        fe_log_binary_put_u16(length, (uint16_t)file_length);
+        fwrite(length, 1, 2, g_log_binary.file);
+        fwrite(file, 1, file_length, g_log_binary.file);
+        size_t format_length = strlen(format) > 0xFFFF ? 0xFFFF : strlen(format);
+        fe_log_binary_put_u16(length, (uint16_t)format_length);
+        fwrite(length, 1, 2, g_log_binary.file);
+        fwrite(format, 1, format_length, g_log_binary.file);
+        return site;
+    }
+    return NULL;
+}
+
+// --- Yazıcı Kapısı ---
+
+/**
+ * @brief Yazıcıyı içeri alır. Kapatma önce open'ı sıfırlayıp sonra users'ın sıfırlanmasını beklediği
+ * için, true dönen bir yazıcı çıkana kadar kilit ve dosya yok edilmez.
+ */
+static bool fe_log_binary_enter(void) {
+    if (!fe_atomic_load_u32(&g_log_binary_open, FE_ATOMIC_ACQUIRE)) return false;
+    fe_atomic_fetch_add_u32(&g_log_binary_users, 1, FE_ATOMIC_SEQ_CST);
+    if (fe_atomic_load_u32(&g_log_binary_open, FE_ATOMIC_SEQ_CST)) return true;
+    fe_atomic_fetch_add_u32(&g_log_binary_users, (uint32_t)-1, FE_ATOMIC_RELEASE);
+    return false;
+}
+
+static void fe_log_binary_leave(void) {
+    fe_atomic_fetch_add_u32(&g_log_binary_users, (uint32_t)-1, FE_ATOMIC_RELEASE);
+}
+
+// --- Genel Fonksiyonlar ---
+
+bool fe_log_binary_open(const char* path, fe_log_level_t min_level) {
+    if (fe_atomic_load_u32(&g_log_binary_open, FE_ATOMIC_ACQUIRE)) {
+        FE_LOG_WARN("Binary log already open; close it before opening '%s'.", path ? path : "(null)");
+        return false;
+    }
+    FILE* file = path ? fopen(path, "wb") : NULL;
+    if (!file) {
+        FE_LOG_ERROR("Failed to open binary log file: %s", path ? path : "(null)");
+        return false;
+    }
+    setvbuf(file, NULL, _IOFBF, 1 << 16); // Kayıtlar küçük; yazmalar 64 KB'lık bloklar halinde yapılır
+
+    memset(&g_log_binary, 0, sizeof(g_log_binary));
+    fe_mutex_init(&g_log_binary.lock);
+    g_log_binary.file = file;
+    g_log_binary.open_ns = fe_timer_now_ns();
+    g_log_binary.last_ns = g_log_binary.open_ns;
+    g_log_binary.min_level = (uint32_t)min_level;
+
+    struct timespec wall;
+    timespec_get(&wall, TIME_UTC);
+    uint8_t header[8 + 4 + 4 + 8];
+    uint8_t* h = header;
+    memcpy(h, FE_LOG_BINARY_MAGIC, 8); h += 8;
+    h = fe_log_binary_put_u32(h, FE_LOG_BINARY_VERSION);
+    h = fe_log_binary_put_u32(h, 0);
+    fe_log_binary_put_u64(h, (uint64_t)wall.tv_sec * 1000000000ULL + (uint64_t)wall.tv_nsec);
+    fwrite(header, 1, sizeof(header), file);
+
+    fe_atomic_store_u32(&g_log_binary_open, 1, FE_ATOMIC_RELEASE);
+    FE_LOG_INFO("Binary log opened: %s", path);
+    return true;
+}
+
+void fe_log_binary_close(void) {
+    if (!fe_atomic_exchange_u32(&g_log_binary_open, 0, FE_ATOMIC_SEQ_CST)) return;
+    // İçeri girmiş yazıcılar çıkana kadar kilit ve dosya yok edilemez; yenileri open'ı 0 görür
+    while (fe_atomic_load_u32(&g_log_binary_users, FE_ATOMIC_ACQUIRE) != 0) {
+        fe_thread_yield();
+    }
+
+    fclose(g_log_binary.file);
+    g_log_binary.file = NULL;
+    uint64_t dropped = g_log_binary.dropped;
+    uint32_t sites = g_log_binary.next_site_id;
+    fe_mutex_destroy(&g_log_binary.lock);
+
+    FE_LOG_INFO("Binary log closed (%u call sites, %llu message(s) dropped).", sites, (unsigned long long)dropped);
+}
+
+void fe_log_binary_flush(void) {
+    if (!fe_log_binary_enter()) return;
+    fe_mutex_lock(&g_log_binary.lock);
+    fflush(g_log_binary.file);
+    fe_mutex_unlock(&g_log_binary.lock);
+    fe_log_binary_leave();
+}
+
+bool fe_log_binary_accepts(fe_log_level_t level) {
+    return fe_atomic_load_u32(&g_log_binary_open, FE_ATOMIC_ACQUIRE) &&
+           (uint32_t)level >= fe_atomic_load_u32(&g_log_binary.min_level, FE_ATOMIC_RELAXED);
+}
+
+void fe_log_binary_write(fe_log_level_t level, const char* file, int line, const char* format, va_list args) {
+    if (!fe_log_binary_accepts(level) || !format || !fe_log_binary_enter()) return;
+
+    fe_mutex_lock(&g_log_binary.lock);
+    // Saat kilit içinde okunur; böylece dosyadaki zaman farkları hiç negatif olmaz
+    uint64_t now = fe_timer_now_ns();
+    uint64_t delta = now > g_log_binary.last_ns ? now - g_log_binary.last_ns : 0;
+    fe_log_binary_site_t* site = fe_log_binary_get_site(level, file ? file : "", line, format);
+    if (!site) {
+        g_log_binary.dropped++;
+        fe_mutex_unlock(&g_log_binary.lock);
+        fe_log_binary_leave();
+        return;
+    }
+
+    uint8_t record[2 * FE_LOG_BINARY_MAX_VARINT + FE_LOG_BINARY_MAX_PAYLOAD];
+    uint8_t* p = record;
+    p = fe_log_varint_put(p, FE_LOG_BINARY_RECORD_MESSAGE + (uint64_t)site->id);
+    p = fe_log_varint_put(p, delta);
+
+    // Argümanlar, format string'in gerektirdiği tam C tipleriyle okunur
+    for (uint32_t i = 0; i < site->arg_count; ++i) {
+        switch ((fe_log_arg_type_t)site->arg_types[i]) {
+            case FE_LOG_ARG_INT:     p = fe_log_varint_put(p, fe_log_zigzag_encode(va_arg(args, int))); break;
+            case FE_LOG_ARG_LONG:    p = fe_log_varint_put(p, fe_log_zigzag_encode(va_arg(args, long))); break;
+            case FE_LOG_ARG_LLONG:   p = fe_log_varint_put(p, fe_log_zigzag_encode(va_arg(args, long long))); break;
+            case FE_LOG_ARG_SIZE:    p = fe_log_varint_put(p, (uint64_t)va_arg(args, size_t)); break;
+            case FE_LOG_ARG_INTMAX:  p = fe_log_varint_put(p, fe_log_zigzag_encode(va_arg(args, intmax_t))); break;
+            case FE_LOG_ARG_PTRDIFF: p = fe_log_varint_put(p, fe_log_zigzag_encode(va_arg(args, ptrdiff_t))); break;
+            case FE_LOG_ARG_POINTER: p = fe_log_varint_put(p, (uint64_t)(uintptr_t)va_arg(args, void*)); break;
+            case FE_LOG_ARG_DOUBLE:
+            case FE_LOG_ARG_LDOUBLE: {
+                double value = site->arg_types[i] == FE_LOG_ARG_LDOUBLE ? (double)va_arg(args, long double) : va_arg(args, double);
+                uint64_t bits;
+                memcpy(&bits, &value, sizeof(bits));
+                p = fe_log_varint_put(p, fe_log_reverse_bytes(bits));
+                break;
+            }
+            case FE_LOG_ARG_STRING: {
+                const char* s = va_arg(args, const char*);
+                p = fe_log_binary_put_string(p, s ? s : "(null)");
+                break;
+            }
+            default: break;
+        }
+    }
+    fwrite(record, 1, (size_t)(p - record), g_log_binary.file);
+    g_log_binary.last_ns = now;
+    fe_mutex_unlock(&g_log_binary.lock);
+    fe_log_binary_leave();
+}
@@ -1,10 +1,20 @@
 #include "include/utils/fe_logger.h"
+#include "core/utils/fe_log_binary.h"      // İkili log sink'i için
+#include "core/utils/fe_atomic.h"          // fe_atomic_* için
+#include "core/utils/fe_timer.h"           // Hız sınırı pencereleri için fe_timer_now_ns
+#include "core/containers/fe_ring_queue.h" // Thread başına asenkron log halkası için
+#include "platform/fe_thread.h"            // Arka plan yazma thread'i için
 #include <stdarg.h> // Değişken argümanlar için
 #include <string.h> // strlen, strcpy için
+#include <stdlib.h> // calloc, free için
 #include <time.h>   // Zaman damgası için
 
 #ifdef _WIN32
 #include <windows.h> // Windows konsol renkleri için
+#else
+#include <sys/uio.h> // writev için
+#include <unistd.h>  // STDOUT_FILENO için
+#include <errno.h>   // EINTR için
 #endif
 
 // --- Dahili Logger Durumu ---
@@ -22,6 +32,69 @@ static struct {
 #endif
 } fe_logger_state;
 
+// --- Çağrı Noktası Hız Sınırı Durumu ---
+
+#define FE_LOG_RATE_DEFAULT_BURST     20
+#define FE_LOG_RATE_DEFAULT_WINDOW_MS 1000
+
+// Logger init/shutdown'dan bağımsızdır; fe_logger_set_rate_limit ile değiştirilir.
+static struct {
+    uint32_t       burst;         // Atomik; 0 ise sınır kapalı
+    uint64_t       window_ns;     // Atomik
+    fe_log_site_t* pending;       // Atomik; bastırılmış mesajı olan noktalar (yalnızca eklenir, topluca alınır)
+    uint64_t       next_sweep_ns; // Atomik; bekleyen özetlerin bir sonraki taranma zamanı
+} g_log_rate = { FE_LOG_RATE_DEFAULT_BURST, FE_LOG_RATE_DEFAULT_WINDOW_MS * 1000000ULL, NULL, 0 };
+
+// --- Asenkron Logger Durumu ---
+
+// Tek bir asenkron log kaydı. Zaman damgası hariç biçimlendirilmiş mesajı taşır.
+#define FE_LOG_ASYNC_RECORD_SIZE 512
+#define FE_LOG_ASYNC_MAX_THREADS 64
+#define FE_LOG_ASYNC_BATCH       64 // Tek writev çağrısında yazılacak en fazla kayıt
+
+typedef struct fe_log_record {
+    uint64_t seconds; // time_t değeri (önbelleğe alınmış saat)
+    uint16_t length;  // text içindeki bayt sayısı
+    uint8_t  level;   // fe_log_level_t
+    char     text[FE_LOG_ASYNC_RECORD_SIZE - 11];
+} fe_log_record_t;
+
+// Bir üretici thread'in halkası. Kuyruğa yalnızca sahibi yazar, yalnızca tüketici kilidini tutan okur.
+typedef struct fe_log_async_thread {
+    fe_spsc_queue_t queue;
+    uint64_t        dropped; // Atomik; halka dolu olduğu için düşürülen kayıtlar
+} fe_log_async_thread_t;
+
+static struct {
+    uint32_t               generation;    // Her başlatmada artar; eski thread-local işaretçileri geçersiz kılar
+    uint32_t               thread_count;  // Atomik; kayıtlı halka sayısı
+    fe_log_async_thread_t* threads[FE_LOG_ASYNC_MAX_THREADS];
+    uint64_t               now_seconds;   // Atomik; arka plan thread'inin güncellediği kaba saat
+    fe_logger_async_config_t config;
+
+    fe_thread_t            thread;
+    fe_mutex_t             consumer_lock; // Aynı anda tek tüketici (arka plan thread'i veya fe_logger_flush)
+    fe_mutex_t             wake_lock;
+    fe_cond_t              wake_cond;
+    uint32_t               quit;          // Atomik
+
+    // Yalnızca tüketici kilidi altında kullanılır
+    fe_log_record_t        batch[FE_LOG_ASYNC_BATCH];
+    uint64_t               cached_seconds;
+    char                   cached_time[32];
+    uint64_t               reported_dropped;
+    uint64_t               written;       // Atomik
+} g_log_async;
+
+// Üreticilerin her an okuyabildiği durum, başlatmadaki memset'ten etkilenmemesi için g_log_async dışındadır.
+// users: asenkron yolun içindeki (halkaya yazan veya tüketen) thread sayısı; durdurma, halkaları ve
+// senkronizasyon nesnelerini bu sayı sıfıra inmeden yok etmez.
+static uint32_t g_log_async_running; // Atomik; 1 ise fe_log_message kuyruğa yazar
+static uint32_t g_log_async_users;   // Atomik
+
+static FE_THREAD_LOCAL fe_log_async_thread_t* t_log_async_thread;
+static FE_THREAD_LOCAL uint32_t               t_log_async_generation;
+
 // --- Dahili Yardımcı Fonksiyonlar ---
 
 // Log seviyesini string olarak döndürür
@@ -77,6 +150,376 @@ static void fe_log_reset_console_color() {
 }
 
 
+// --- Asenkron Loglama: Üretici Tarafı ---
+
+/**
+ * @brief Asenkron yola girer. true dönerse fe_log_async_leave çağrılana kadar halkalar ve
+ * senkronizasyon nesneleri geçerli kalır.
+ */
+static bool fe_log_async_enter(void) {
+    if (!fe_atomic_load_u32(&g_log_async_running, FE_ATOMIC_ACQUIRE)) return false;
+    fe_atomic_fetch_add_u32(&g_log_async_users, 1, FE_ATOMIC_SEQ_CST);
+    // Sayaç artırıldıktan sonra yeniden bakılır: durdurma ya bu artışı görür ya da biz running'in düştüğünü
+    if (fe_atomic_load_u32(&g_log_async_running, FE_ATOMIC_SEQ_CST)) return true;
+    fe_atomic_fetch_add_u32(&g_log_async_users, (uint32_t)-1, FE_ATOMIC_RELEASE);
+    return false;
+}
+
+static void fe_log_async_leave(void) {
+    fe_atomic_fetch_add_u32(&g_log_async_users, (uint32_t)-1, FE_ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Çağıran thread'in log halkasını döndürür; ilk kullanımda oluşturup kaydeder.
+ * Thread sınırı aşıldıysa veya tahsis başarısızsa NULL döner.
+ */
+static fe_log_async_thread_t* fe_log_async_get_thread(void) {
+    uint32_t generation = fe_atomic_load_u32(&g_log_async.generation, FE_ATOMIC_ACQUIRE);
+    if (t_log_async_generation == generation) {
+        return t_log_async_thread;
+    }
+    t_log_async_generation = generation;
+    t_log_async_thread = NULL;
+
+    uint32_t slot = fe_atomic_fetch_add_u32(&g_log_async.thread_count, 1, FE_ATOMIC_ACQ_REL);
+    if (slot >= FE_LOG_ASYNC_MAX_THREADS) {
+        fe_atomic_fetch_add_u32(&g_log_async.thread_count, (uint32_t)-1, FE_ATOMIC_ACQ_REL);
+        return NULL;
+    }
+    // Logger bellek yöneticisinin altındaki katmandır (o da loglar); kayıt doğrudan calloc ile tahsis edilir
+    fe_log_async_thread_t* thread = (fe_log_async_thread_t*)calloc(1, sizeof(fe_log_async_thread_t));
+    if (thread && !fe_spsc_queue_init(&thread->queue, g_log_async.config.ring_capacity, sizeof(fe_log_record_t))) {
+        free(thread);
+        thread = NULL;
+    }
+    fe_atomic_store_ptr((void**)&g_log_async.threads[slot], thread, FE_ATOMIC_RELEASE);
+    t_log_async_thread = thread;
+    return thread;
+}
+
+/**
+ * @brief Mesajı biçimlendirip çağıran thread'in halkasına koyar.
+ * @return bool Kayıt kuyruğa girdiyse veya politika gereği düşürüldüyse true; eşzamanlı
+ * yazılması gerekiyorsa false.
+ */
+static bool fe_log_async_enqueue(fe_log_level_t level, const char* file, int line, const char* format, va_list args) {
+    fe_log_async_thread_t* thread = fe_log_async_get_thread();
+    if (!thread) return false;
+
+    fe_log_record_t record;
+    record.seconds = fe_atomic_load_u64(&g_log_async.now_seconds, FE_ATOMIC_RELAXED);
+    record.level = (uint8_t)level;
+
+    int offset = snprintf(record.text, sizeof(record.text), "[%s]", fe_log_level_to_string(level));
+#ifdef FE_DEBUG_BUILD
+    if (level <= FE_LOG_LEVEL_DEBUG || level >= FE_LOG_LEVEL_ERROR) {
+#else
+    if (level >= FE_LOG_LEVEL_ERROR) {
+#endif
+        offset += snprintf(record.text + offset, sizeof(record.text) - offset, " (%s:%d)", file, line);
+    }
+    offset += snprintf(record.text + offset, sizeof(record.text) - offset, ": ");
+    if (offset < (int)sizeof(record.text)) {
+        int written = vsnprintf(record.text + offset, sizeof(record.text) - offset, format, args);
+        if (written > 0) offset += written;
+    }
+    if (offset >= (int)sizeof(record.text)) offset = (int)sizeof(record.text) - 1; // Kırpıldı
+    record.length = (uint16_t)offset;
+
+    // Halka doluysa: düşük seviyeler düşürülür, yüksek seviyeler yer açılmasını bekler. Asenkron
+    // loglama bu sırada durdurulursa kayıt eşzamanlı yoldan yazılır
+    while (!fe_spsc_queue_push(&thread->queue, &record)) {
+        if (level < g_log_async.config.block_min_level) {
+            fe_atomic_fetch_add_u64(&thread->dropped, 1, FE_ATOMIC_RELAXED);
+            return true;
+        }
+        if (!fe_atomic_load_u32(&g_log_async_running, FE_ATOMIC_ACQUIRE)) return false;
+        fe_cond_signal(&g_log_async.wake_cond);
+        fe_thread_yield();
+    }
+    return true;
+}
+
+// --- Asenkron Loglama: Tüketici Tarafı ---
+
+/**
+ * @brief Kaydın zaman damgası önekini (önbellekten) döndürür; saniye değişince yeniden üretir.
+ */
+static const char* fe_log_async_time_string(uint64_t seconds) {
+    if (seconds != g_log_async.cached_seconds || g_log_async.cached_time[0] == '\0') {
+        time_t now = (time_t)seconds;
+        struct tm tm_info;
+#ifdef _WIN32
+        localtime_s(&tm_info, &now);
+#else
+        localtime_r(&now, &tm_info);
+#endif
+        strftime(g_log_async.cached_time, sizeof(g_log_async.cached_time), "[%Y-%m-%d %H:%M:%S] ", &tm_info);
+        g_log_async.cached_seconds = seconds;
+    }
+    return g_log_async.cached_time;
+}
+
+#ifndef _WIN32
+/**
+ * @brief Tüm iovec'leri yazar; kısmi yazma ve EINTR durumunda kaldığı yerden devam eder.
+ */
+static void fe_log_async_writev_all(int fd, struct iovec* iov, int count) {
+    while (count > 0) {
+        ssize_t written = writev(fd, iov, count);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return; // Yazılamayan log için yapılabilecek bir şey yok
+        }
+        while (count > 0 && (size_t)written >= iov->iov_len) {
+            written -= (ssize_t)iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0) {
+            iov->iov_base = (char*)iov->iov_base + written;
+            iov->iov_len -= (size_t)written;
+        }
+    }
+}
+
+static const char* fe_log_level_color(fe_log_level_t level) {
+    switch (level) {
+        case FE_LOG_LEVEL_DEBUG:    return FE_LOG_COLOR_CYAN;
+        case FE_LOG_LEVEL_INFO:     return FE_LOG_COLOR_WHITE;
+        case FE_LOG_LEVEL_WARN:     return FE_LOG_COLOR_YELLOW;
+        case FE_LOG_LEVEL_ERROR:    return FE_LOG_COLOR_RED;
+        case FE_LOG_LEVEL_CRITICAL: return FE_LOG_COLOR_BRIGHT_RED;
+        default:                    return "";
+    }
+}
+#endif
+
+/**
+ * @brief batch içindeki count kaydı konsola ve dosyaya yazar (konsol/dosya seviye filtreleriyle).
+ */
+static void fe_log_async_write_batch(uint32_t count) {
+    bool console = fe_logger_state.console_output_enabled;
+    FILE* log_file = fe_logger_state.file_output_enabled ? fe_logger_state.log_file : NULL;
+
+#ifdef _WIN32
+    // Windows'ta writev yok ve konsol rengi API çağrısıyla ayarlanır; kayıtlar tek tek yazılır
+    for (uint32_t i = 0; i < count; ++i) {
+        const fe_log_record_t* record = &g_log_async.batch[i];
+        const char* time_str = fe_log_async_time_string(record->seconds);
+        if (console && record->level >= fe_logger_state.console_min_level) {
+            fe_log_set_console_color((fe_log_level_t)record->level);
+            fprintf(stdout, "%s%.*s\n", time_str, (int)record->length, record->text);
+            fe_log_reset_console_color();
+        }
+        if (log_file && record->level >= fe_logger_state.file_min_level) {
+            fprintf(log_file, "%s%.*s\n", time_str, (int)record->length, record->text);
+        }
+    }
+    if (log_file) fflush(log_file);
+#else
+    // Her kayıt için: [renk] zaman, metin, [sıfırlama]+satır sonu
+    struct iovec console_iov[FE_LOG_ASYNC_BATCH * 4];
+    struct iovec file_iov[FE_LOG_ASYNC_BATCH * 3];
+    char time_prefix[FE_LOG_ASYNC_BATCH][32];
+    int console_count = 0, file_count = 0;
+    static char newline[] = "\n";
+    static char reset_newline[] = FE_LOG_COLOR_RESET "\n";
+
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_log_record_t* record = &g_log_async.batch[i];
+        size_t prefix_length = strlen(fe_log_async_time_string(record->seconds));
+        memcpy(time_prefix[i], g_log_async.cached_time, prefix_length);
+
+        if (console && record->level >= fe_logger_state.console_min_level) {
+            const char* color = fe_log_level_color((fe_log_level_t)record->level);
+            console_iov[console_count].iov_base = (void*)color;
+            console_iov[console_count++].iov_len = strlen(color);
+            console_iov[console_count].iov_base = time_prefix[i];
+            console_iov[console_count++].iov_len = prefix_length;
+            console_iov[console_count].iov_base = record->text;
+            console_iov[console_count++].iov_len = record->length;
+            console_iov[console_count].iov_base = reset_newline;
+            console_iov[console_count++].iov_len = sizeof(reset_newline) - 1;
+        }
+        if (log_file && record->level >= fe_logger_state.file_min_level) {
+            file_iov[file_count].iov_base = time_prefix[i];
+            file_iov[file_count++].iov_len = prefix_length;
+            file_iov[file_count].iov_base = record->text;
+            file_iov[file_count++].iov_len = record->length;
+            file_iov[file_count].iov_base = newline;
+            file_iov[file_count++].iov_len = 1;
+        }
+    }
+    if (console_count > 0) fe_log_async_writev_all(STDOUT_FILENO, console_iov, console_count);
+    if (file_count > 0) fe_log_async_writev_all(fileno(log_file), file_iov, file_count);
+#endif
+}
+
+/**
+ * @brief Tüm halkaları boşaltır ve yazar. Tüketici kilidi tutulurken çağrılmalıdır.
+ * @return uint32_t Yazılan kayıt sayısı.
+ */
+static uint32_t fe_log_async_drain(void) {
+    uint32_t total = 0;
+    uint32_t count = 0;
+    uint64_t dropped = 0;
+    uint32_t thread_count = fe_atomic_load_u32(&g_log_async.thread_count, FE_ATOMIC_ACQUIRE);
+    if (thread_count > FE_LOG_ASYNC_MAX_THREADS) thread_count = FE_LOG_ASYNC_MAX_THREADS;
+
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        fe_log_async_thread_t* thread = (fe_log_async_thread_t*)fe_atomic_load_ptr((void**)&g_log_async.threads[t], FE_ATOMIC_ACQUIRE);
+        if (!thread) continue;
+        dropped += fe_atomic_load_u64(&thread->dropped, FE_ATOMIC_RELAXED);
+        while (fe_spsc_queue_pop(&thread->queue, &g_log_async.batch[count])) {
+            if (++count == FE_LOG_ASYNC_BATCH) {
+                fe_log_async_write_batch(count);
+                total += count;
+                count = 0;
+            }
+        }
+    }
+
+    // Yeni düşürülen kayıtlar varsa bunu da bir log satırı olarak bildir
+    if (dropped > g_log_async.reported_dropped && count < FE_LOG_ASYNC_BATCH) {
+        fe_log_record_t* record = &g_log_async.batch[count++];
+        record->seconds = fe_atomic_load_u64(&g_log_async.now_seconds, FE_ATOMIC_RELAXED);
+        record->level = FE_LOG_LEVEL_WARN;
+        int length = snprintf(record->text, sizeof(record->text), "[%s]: Async logger dropped %llu message(s) (ring full).",
+                              fe_log_level_to_string(FE_LOG_LEVEL_WARN),
+                              (unsigned long long)(dropped - g_log_async.reported_dropped));
+        record->length = (uint16_t)(length < (int)sizeof(record->text) ? length : (int)sizeof(record->text) - 1);
+        g_log_async.reported_dropped = dropped;
+    }
+    if (count > 0) {
+        fe_log_async_write_batch(count);
+        total += count;
+    }
+    if (total > 0) {
+        fe_atomic_fetch_add_u64(&g_log_async.written, total, FE_ATOMIC_RELAXED);
+    }
+    return total;
+}
+
+static void fe_log_async_thread_main(void* user_data) {
+    (void)user_data;
+    while (!fe_atomic_load_u32(&g_log_async.quit, FE_ATOMIC_ACQUIRE)) {
+        fe_atomic_store_u64(&g_log_async.now_seconds, (uint64_t)time(NULL), FE_ATOMIC_RELAXED);
+
+        fe_mutex_lock(&g_log_async.consumer_lock);
+        uint32_t written = fe_log_async_drain();
+        fe_mutex_unlock(&g_log_async.consumer_lock);
+
+        if (written == 0) {
+            fe_mutex_lock(&g_log_async.wake_lock);
+            if (!fe_atomic_load_u32(&g_log_async.quit, FE_ATOMIC_ACQUIRE)) {
+                fe_cond_wait_timeout(&g_log_async.wake_cond, &g_log_async.wake_lock, g_log_async.config.flush_interval_ms);
+            }
+            fe_mutex_unlock(&g_log_async.wake_lock);
+        }
+    }
+}
+
+// --- Çağrı Noktası Hız Sınırı ---
+
+/**
+ * @brief Seviyenin herhangi bir çıktıya (konsol, dosya, ikili sink) ulaşıp ulaşmayacağını döndürür.
+ */
+static bool fe_log_level_enabled(fe_log_level_t level) {
+    if (!fe_logger_state.is_initialized) return true; // fe_log_message bunu kendisi bildirir
+    return level >= fe_logger_state.console_min_level || level >= fe_logger_state.file_min_level ||
+           fe_log_binary_accepts(level);
+}
+
+static void fe_log_site_push_pending(fe_log_site_t* site) {
+    void* head = fe_atomic_load_ptr((void* const volatile*)&g_log_rate.pending, FE_ATOMIC_RELAXED);
+    do {
+        site->next_pending = (fe_log_site_t*)head;
+    } while (!fe_atomic_compare_exchange_ptr((void* volatile*)&g_log_rate.pending, &head, site, FE_ATOMIC_RELEASE));
+}
+
+/**
+ * @brief Penceresi bitmiş (force ise tüm) bekleyen noktaların bastırma özetlerini yazar.
+ * Penceresi sürenler listeye geri eklenir.
+ */
+static void fe_log_flush_suppressed(uint64_t now, bool force) {
+    uint64_t window_ns = fe_atomic_load_u64(&g_log_rate.window_ns, FE_ATOMIC_RELAXED);
+    fe_log_site_t* site = (fe_log_site_t*)fe_atomic_exchange_ptr((void* volatile*)&g_log_rate.pending, NULL, FE_ATOMIC_ACQUIRE);
+    while (site) {
+        // pending temizlendiği anda nokta başka bir thread tarafından yeniden eklenebilir;
+        // ondan önce gereken alanlar kopyalanır
+        fe_log_site_t* next = site->next_pending;
+        fe_log_level_t level = site->level;
+        const char* file = site->file;
+        int line = site->line;
+        fe_atomic_store_u32(&site->pending, 0, FE_ATOMIC_RELEASE);
+
+        uint64_t start = fe_atomic_load_u64(&site->window_start_ns, FE_ATOMIC_ACQUIRE);
+        if (force || now - start >= window_ns) {
+            // Pencerenin kendisi noktanın bir sonraki mesajıyla yenilenir; özet beklemeden yazılır
+            uint32_t suppressed = fe_atomic_exchange_u32(&site->suppressed, 0, FE_ATOMIC_ACQ_REL);
+            if (suppressed > 0) {
+                fe_log_message(level, file, line, "(%u similar message(s) suppressed in the last %.1f s)",
+                               suppressed, (double)(now - start) / 1000000000.0);
+            }
+        } else if (fe_atomic_load_u32(&site->suppressed, FE_ATOMIC_RELAXED) > 0 &&
+                   fe_atomic_exchange_u32(&site->pending, 1, FE_ATOMIC_ACQ_REL) == 0) {
+            fe_log_site_push_pending(site);
+        }
+        site = next;
+    }
+}
+
+bool fe_log_site_allow(fe_log_site_t* site, fe_log_level_t level, const char* file, int line) {
+    // Filtrelenen seviyeler saat okumaz ve pencere hakkı harcamaz
+    if (!fe_log_level_enabled(level)) return false;
+
+    uint32_t burst = fe_atomic_load_u32(&g_log_rate.burst, FE_ATOMIC_RELAXED);
+    if (burst == 0) return true;
+
+    uint64_t now = fe_timer_now_ns();
+    uint64_t window_ns = fe_atomic_load_u64(&g_log_rate.window_ns, FE_ATOMIC_RELAXED);
+
+    // Susan noktaların özetleri pencere başına bir kez, tek bir thread tarafından taranır
+    uint64_t next_sweep = fe_atomic_load_u64(&g_log_rate.next_sweep_ns, FE_ATOMIC_RELAXED);
+    if (now >= next_sweep && fe_atomic_load_ptr((void* const volatile*)&g_log_rate.pending, FE_ATOMIC_RELAXED) &&
+        fe_atomic_compare_exchange_u64(&g_log_rate.next_sweep_ns, &next_sweep, now + window_ns, FE_ATOMIC_RELAXED)) {
+        fe_log_flush_suppressed(now, false);
+    }
+
+    uint64_t start = fe_atomic_load_u64(&site->window_start_ns, FE_ATOMIC_ACQUIRE);
+    if (start == 0 || now - start >= window_ns) {
+        // Pencereyi yalnızca bir thread yeniler; yarışı kaybedenler yeni pencerede sayılır
+        if (fe_atomic_compare_exchange_u64(&site->window_start_ns, &start, now, FE_ATOMIC_ACQ_REL)) {
+            uint32_t suppressed = fe_atomic_exchange_u32(&site->suppressed, 0, FE_ATOMIC_ACQ_REL);
+            fe_atomic_store_u32(&site->count, 0, FE_ATOMIC_RELEASE);
+            if (suppressed > 0) {
+                fe_log_message(level, file, line, "(%u similar message(s) suppressed in the last %.1f s)",
+                               suppressed, (double)(now - start) / 1000000000.0);
+            }
+        }
+    }
+
+    if (fe_atomic_fetch_add_u32(&site->count, 1, FE_ATOMIC_RELAXED) < burst) {
+        return true;
+    }
+    fe_atomic_fetch_add_u32(&site->suppressed, 1, FE_ATOMIC_RELAXED);
+    if (fe_atomic_load_u32(&site->pending, FE_ATOMIC_RELAXED) == 0 &&
+        fe_atomic_exchange_u32(&site->pending, 1, FE_ATOMIC_ACQ_REL) == 0) {
+        site->level = level;
+        site->file = file;
+        site->line = line;
+        fe_log_site_push_pending(site);
+    }
+    return false;
+}
+
+void fe_logger_set_rate_limit(uint32_t burst, uint32_t window_ms) {
+    if (window_ms == 0) window_ms = FE_LOG_RATE_DEFAULT_WINDOW_MS;
+    fe_atomic_store_u64(&g_log_rate.window_ns, (uint64_t)window_ms * 1000000ULL, FE_ATOMIC_RELAXED);
+    fe_atomic_store_u32(&g_log_rate.burst, burst, FE_ATOMIC_RELAXED);
+}
+
 // --- Genel Loglama Fonksiyonu ---
 void fe_log_message(fe_log_level_t level, const char* file, int line, const char* format, ...) {
     if (!fe_logger_state.is_initialized) {
@@ -85,11 +528,29 @@ void fe_log_message(fe_log_level_t level, const char* file, int line, const char
         return;
     }
 
+    // İkili sink açıksa mesaj biçimlendirilmeden oraya da yazılır
+    if (fe_log_binary_accepts(level)) {
+        va_list args;
+        va_start(args, format);
+        fe_log_binary_write(level, file, line, format, args);
+        va_end(args);
+    }
+
     // Mesajın geçerli seviye eşiğinin altında olup olmadığını kontrol et
     if (level < fe_logger_state.console_min_level && level < fe_logger_state.file_min_level) {
         return; // Hem konsol hem de dosya için ilgili log seviyesi eşiğinin altında
     }
 
+    if (fe_log_async_enter()) {
+        va_list args;
+        va_start(args, format);
+        bool queued = fe_log_async_enqueue(level, file, line, format, args);
+        va_end(args);
+        fe_log_async_leave();
+        if (queued) return;
+        // Halka alınamadıysa (thread sınırı veya durdurma) eşzamanlı yola düşülür
+    }
+
     char time_str[32];
     time_t now = time(NULL);
     struct tm* tm_info = localtime(&now);
@@ -186,7 +647,10 @@ void fe_logger_shutdown() {
         return;
     }
 
+    fe_log_flush_suppressed(fe_timer_now_ns(), true);
     FE_LOG_INFO("Logger shutting down.");
+    fe_logger_stop_async();
+    fe_log_binary_close();
 
     if (fe_logger_state.log_file) {
         fprintf(fe_logger_state.log_file, "--- Fiction Engine Log Ended ---\n");
@@ -241,3 +705,107 @@ void fe_logger_set_file_min_level(fe_log_level_t level) {
     fe_logger_state.file_min_level = level;
     FE_LOG_INFO("File minimum log level set to: %s", fe_log_level_to_string(level));
 }
+
+// --- Asenkron Loglama Kontrol Fonksiyonları ---
+
+bool fe_logger_start_async(const fe_logger_async_config_t* config) {
+    if (!fe_logger_state.is_initialized) {
+        fprintf(stderr, "[WARN] Logger not initialized, cannot start async logging.\n");
+        return false;
+    }
+    if (fe_atomic_load_u32(&g_log_async_running, FE_ATOMIC_ACQUIRE)) {
+        FE_LOG_WARN("Async logging already running.");
+        return true;
+    }
+
+    uint32_t generation = g_log_async.generation;
+    memset(&g_log_async, 0, sizeof(g_log_async));
+    g_log_async.generation = generation + 1; // Önceki oturumdan kalan thread-local halkalar geçersiz
+    if (config) {
+        g_log_async.config = *config;
+    } else {
+        g_log_async.config.block_min_level = FE_LOG_LEVEL_WARN;
+    }
+    if (g_log_async.config.ring_capacity == 0) g_log_async.config.ring_capacity = 1024;
+    if (g_log_async.config.flush_interval_ms == 0) g_log_async.config.flush_interval_ms = 10;
+    g_log_async.now_seconds = (uint64_t)time(NULL);
+
+    fe_mutex_init(&g_log_async.consumer_lock);
+    fe_mutex_init(&g_log_async.wake_lock);
+    fe_cond_init(&g_log_async.wake_cond);
+
+    // Eşzamanlı moddan kalan tamponlu çıktı, writev'den önce yazılmalı
+    fflush(stdout);
+    if (fe_logger_state.log_file) fflush(fe_logger_state.log_file);
+
+    if (!fe_thread_create(&g_log_async.thread, fe_log_async_thread_main, NULL, "fe_logger")) {
+        fe_cond_destroy(&g_log_async.wake_cond);
+        fe_mutex_destroy(&g_log_async.wake_lock);
+        fe_mutex_destroy(&g_log_async.consumer_lock);
+        return false;
+    }
+    fe_atomic_store_u32(&g_log_async_running, 1, FE_ATOMIC_RELEASE);
+    FE_LOG_INFO("Async logging started (ring %u records/thread, flush interval %u ms).",
+                g_log_async.config.ring_capacity, g_log_async.config.flush_interval_ms);
+    return true;
+}
+
+void fe_logger_stop_async(void) {
+    if (!fe_atomic_load_u32(&g_log_async_running, FE_ATOMIC_ACQUIRE)) return;
+
+    fe_atomic_store_u32(&g_log_async_running, 0, FE_ATOMIC_SEQ_CST);
+    // Yeni üreticiler artık girmez; içeridekiler (dolu halkada bekleyenler dahil) çıkana kadar
+    // tüketici çalışmaya devam eder ki yer açılsın
+    while (fe_atomic_load_u32(&g_log_async_users, FE_ATOMIC_SEQ_CST) != 0) {
+        fe_cond_signal(&g_log_async.wake_cond);
+        fe_thread_yield();
+    }
+    fe_mutex_lock(&g_log_async.wake_lock);
+    fe_atomic_store_u32(&g_log_async.quit, 1, FE_ATOMIC_RELEASE);
+    fe_cond_signal(&g_log_async.wake_cond);
+    fe_mutex_unlock(&g_log_async.wake_lock);
+    fe_thread_join(&g_log_async.thread);
+
+    // Thread durdu; kalanları bu thread yazar
+    fe_log_async_drain();
+
+    uint32_t thread_count = fe_atomic_load_u32(&g_log_async.thread_count, FE_ATOMIC_ACQUIRE);
+    if (thread_count > FE_LOG_ASYNC_MAX_THREADS) thread_count = FE_LOG_ASYNC_MAX_THREADS;
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        if (g_log_async.threads[t]) {
+            fe_spsc_queue_shutdown(&g_log_async.threads[t]->queue);
+            free(g_log_async.threads[t]);
+            g_log_async.threads[t] = NULL;
+        }
+    }
+    g_log_async.thread_count = 0;
+    fe_cond_destroy(&g_log_async.wake_cond);
+    fe_mutex_destroy(&g_log_async.wake_lock);
+    fe_mutex_destroy(&g_log_async.consumer_lock);
+}
+
+void fe_logger_flush(void) {
+    fe_log_binary_flush();
+    if (fe_log_async_enter()) {
+        fe_mutex_lock(&g_log_async.consumer_lock);
+        fe_log_async_drain();
+        fe_mutex_unlock(&g_log_async.consumer_lock);
+        fe_log_async_leave();
+        return;
+    }
+    fflush(stdout);
+    if (fe_logger_state.log_file) fflush(fe_logger_state.log_file);
+}
+
+void fe_logger_get_async_stats(fe_logger_async_stats_t* out_stats) {
+    if (!out_stats) return;
+    memset(out_stats, 0, sizeof(fe_logger_async_stats_t));
+    out_stats->written = fe_atomic_load_u64(&g_log_async.written, FE_ATOMIC_RELAXED);
+    uint32_t thread_count = fe_atomic_load_u32(&g_log_async.thread_count, FE_ATOMIC_ACQUIRE);
+    if (thread_count > FE_LOG_ASYNC_MAX_THREADS) thread_count = FE_LOG_ASYNC_MAX_THREADS;
+    out_stats->thread_count = thread_count;
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        fe_log_async_thread_t* thread = (fe_log_async_thread_t*)fe_atomic_load_ptr((void**)&g_log_async.threads[t], FE_ATOMIC_ACQUIRE);
+        if (thread) out_stats->dropped += fe_atomic_load_u64(&thread->dropped, FE_ATOMIC_RELAXED);
+    }
+}
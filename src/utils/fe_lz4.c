@@ -0,0 +1,163 @@
+#include "core/utils/fe_lz4.h"
+
+#include <string.h> // memcpy, memset için
+
+// Blok formatı kısıtları: eşleşmeler en az 4 bayttır, son 5 bayt her zaman literaldir ve son
+// eşleşme bloğun bitiminden en az 12 bayt önce başlamalıdır.
+#define FE_LZ4_MIN_MATCH     4
+#define FE_LZ4_LAST_LITERALS 5
+#define FE_LZ4_MF_LIMIT      12
+#define FE_LZ4_MAX_OFFSET    65535
+#define FE_LZ4_HASH_LOG      12
+
+static inline uint32_t fe_lz4_read32(const uint8_t* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint32_t fe_lz4_hash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - FE_LZ4_HASH_LOG);
+}
+
+/**
+ * @brief 15'i aşan uzunluk kısmını 255'lik baytlar halinde yazar.
+ */
+static uint8_t* fe_lz4_write_length(uint8_t* op, const uint8_t* oend, size_t length) {
+    while (length >= 255) {
+        if (op >= oend) return NULL;
+        *op++ = 255;
+        length -= 255;
+    }
+    if (op >= oend) return NULL;
+    *op++ = (uint8_t)length;
+    return op;
+}
+
+/**
+ * @brief Bir dizi (literaller + isteğe bağlı eşleşme) yazar. match_length 0 ise son dizidir.
+ */
+static uint8_t* fe_lz4_write_sequence(uint8_t* op, const uint8_t* oend, const uint8_t* literals, size_t literal_length,
+                                      size_t offset, size_t match_length) {
+    if (op >= oend) return NULL;
+    uint8_t* token = op++;
+    size_t match_code = match_length ? match_length - FE_LZ4_MIN_MATCH : 0;
+    *token = (uint8_t)(((literal_length >= 15 ? 15 : literal_length) << 4) | (match_code >= 15 ? 15 : match_code));
+
+    if (literal_length >= 15 && !(op = fe_lz4_write_length(op, oend, literal_length - 15))) return NULL;
+    if ((size_t)(oend - op) < literal_length) return NULL;
+    memcpy(op, literals, literal_length);
+    op += literal_length;
+
+    if (match_length == 0) return op;
+    if (oend - op < 2) return NULL;
+    *op++ = (uint8_t)(offset & 0xFF);
+    *op++ = (uint8_t)(offset >> 8);
+    if (match_code >= 15 && !(op = fe_lz4_write_length(op, oend, match_code - 15))) return NULL;
+    return op;
+}
+
+size_t fe_lz4_compress(const void* src, size_t src_size, void* dst, size_t dst_capacity) {
+    const uint8_t* base = (const uint8_t*)src;
+    const uint8_t* ip = base;
+    const uint8_t* anchor = base;
+    const uint8_t* iend = base + src_size;
+    uint8_t* op = (uint8_t*)dst;
+    const uint8_t* oend = op + dst_capacity;
+
+    if (src_size > FE_LZ4_MF_LIMIT) {
+        const uint8_t* mf_limit = iend - FE_LZ4_MF_LIMIT;
+        const uint8_t* match_limit = iend - FE_LZ4_LAST_LITERALS;
+        uint32_t table[1u << FE_LZ4_HASH_LOG]; // Konumlar base'e göre; 16 KB yığın
+        memset(table, 0, sizeof(table));
+
+        while (ip < mf_limit) {
+            uint32_t sequence = fe_lz4_read32(ip);
+            uint32_t h = fe_lz4_hash(sequence);
+            const uint8_t* ref = base + table[h];
+            table[h] = (uint32_t)(ip - base);
+
+            if (ref >= ip || (size_t)(ip - ref) > FE_LZ4_MAX_OFFSET || fe_lz4_read32(ref) != sequence) {
+                ip++;
+                continue;
+            }
+
+            // Eşleşmeyi geriye (literallerin içine) ve ileriye doğru uzat
+            while (ip > anchor && ref > base && ip[-1] == ref[-1]) {
+                ip--;
+                ref--;
+            }
+            const uint8_t* match_end = ip + FE_LZ4_MIN_MATCH;
+            const uint8_t* ref_end = ref + FE_LZ4_MIN_MATCH;
+            while (match_end < match_limit && *match_end == *ref_end) {
+                match_end++;
+                ref_end++;
+            }
+
+            op = fe_lz4_write_sequence(op, oend, anchor, (size_t)(ip - anchor), (size_t)(ip - ref), (size_t)(match_end - ip));
+            if (!op) return 0;
+            ip = match_end;
+            anchor = ip;
+            if (ip < mf_limit) {
+                table[fe_lz4_hash(fe_lz4_read32(ip - 2))] = (uint32_t)(ip - 2 - base);
+            }
+        }
+    }
+
+    op = fe_lz4_write_sequence(op, oend, anchor, (size_t)(iend - anchor), 0, 0);
+    return op ? (size_t)(op - (uint8_t*)dst) : 0;
+}
+
+bool fe_lz4_decompress(const void* src, size_t src_size, void* dst, size_t dst_size) {
+    const uint8_t* ip = (const uint8_t*)src;
+    const uint8_t* iend = ip + src_size;
+    uint8_t* op = (uint8_t*)dst;
+    uint8_t* const ostart = op;
+    const uint8_t* oend = op + dst_size;
+
+    while (ip < iend) {
+        uint8_t token = *ip++;
+
+        size_t literal_length = token >> 4;
+        if (literal_length == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) return false;
+                b = *ip++;
+                literal_length += b;
+            } while (b == 255);
+        }
+        if (literal_length > (size_t)(iend - ip) || literal_length > (size_t)(oend - op)) return false;
+        memcpy(op, ip, literal_length);
+        op += literal_length;
+        ip += literal_length;
+        if (ip == iend) break; // Son dizi yalnızca literal içerir
+
+        if (iend - ip < 2) return false;
+        size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - ostart)) return false;
+
+        size_t match_length = token & 15;
+        if (match_length == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) return false;
+                b = *ip++;
+                match_length += b;
+            } while (b == 255);
+        }
+        match_length += FE_LZ4_MIN_MATCH;
+        if (match_length > (size_t)(oend - op)) return false;
+
+        const uint8_t* match = op - offset;
+        if (offset >= match_length) {
+            memcpy(op, match, match_length);
+        } else {
+            // Örtüşen kopya (tekrarlanan desen); bayt bayt ilerlemek gerekir
+            for (size_t i = 0; i < match_length; ++i) op[i] = match[i];
+        }
+        op += match_length;
+    }
+    return op == oend;
+}
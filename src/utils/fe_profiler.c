@@ -0,0 +1,443 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // CLOCK_MONOTONIC_RAW için
+#endif
+
+#include "core/utils/fe_profiler.h"
+#include "core/utils/fe_logger.h"          // Loglama için
+#include "core/utils/fe_atomic.h"          // fe_atomic_* için
+#include "core/utils/fe_timer.h"           // fe_timer_now_ns için (rdtsc kalibrasyonu)
+#include "core/memory/fe_memory_manager.h" // FE_MALLOC, FE_FREE için
+#include "platform/fe_thread.h"            // FE_THREAD_LOCAL için
+
+#include <stdio.h>  // FILE, fprintf, snprintf için
+#include <string.h> // memset, strncpy için
+#include <stdlib.h> // qsort için
+
+#ifdef _WIN32
+#include <windows.h> // QueryPerformanceCounter için
+#else
+#include <time.h>    // clock_gettime için
+#endif
+
+#if defined(FE_PROFILER_USE_RDTSC) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define FE_PROFILER_RDTSC 1
+#ifdef _MSC_VER
+#include <intrin.h>    // __rdtsc için
+#else
+#include <x86intrin.h> // __rdtsc için
+#endif
+#else
+#define FE_PROFILER_RDTSC 0
+#endif
+
+// --- Zaman Damgası ---
+
+static inline uint64_t fe_profiler_now(void) {
+#if FE_PROFILER_RDTSC
+    return (uint64_t)__rdtsc();
+#elif defined(_WIN32)
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)counter.QuadPart;
+#elif defined(CLOCK_MONOTONIC_RAW)
+    // NTP ayarlarından etkilenmeyen ham saat; kısa aralık ölçümü için daha kararlıdır
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+    return fe_timer_now_ns();
+#endif
+}
+
+// --- Dahili Yapılar ---
+
+/**
+ * @brief Biten tek bir bölgenin kaydı.
+ */
+typedef struct fe_profiler_zone_record {
+    const char* name;
+    uint64_t    start;       // Tick
+    uint64_t    end;         // Tick
+    uint64_t    child_ticks; // Doğrudan alt bölgelerde geçen süre
+    uint32_t    depth;       // İç içelik derinliği (0 en dış)
+    uint32_t    thread;      // Thread slot indeksi (yalnızca yakalama kayıtlarında)
+} fe_profiler_zone_record_t;
+
+/**
+ * @brief Açık (henüz bitmemiş) bir bölge.
+ */
+typedef struct fe_profiler_open_zone {
+    const char* name;
+    uint64_t    start;
+    uint64_t    child_ticks;
+} fe_profiler_open_zone_t;
+
+/**
+ * @brief Thread başına profil durumu. Halka arabelleğine yalnızca sahibi yazar,
+ * yalnızca frame_mark'ı çağıran ana thread okur. Halka doluysa sahibi okunmamış
+ * kayıtların üzerine yazmaz; yeni bölgeyi düşürüp sayar.
+ */
+typedef struct fe_profiler_thread {
+    uint64_t write_pos;   // Yazılan toplam kayıt sayısı (sahibi release ile yayınlar)
+    uint64_t dropped;     // Halka dolu olduğu için düşürülen bölgeler (sahibi artırır)
+    uint8_t  pad0[FE_CACHE_LINE_SIZE - 2 * sizeof(uint64_t)];
+    uint64_t read_pos;    // Okunan toplam kayıt sayısı (okuyucu kopyaladıktan sonra release ile yayınlar)
+    uint64_t dropped_seen; // İstatistiğe eklenmiş düşürülen bölge sayısı (yalnızca okuyucu)
+    uint32_t depth;       // Açık bölge sayısı (yalnızca sahibi)
+    uint32_t index;       // g_profiler.threads içindeki slot
+    fe_profiler_open_zone_t   stack[FE_PROFILER_MAX_DEPTH];
+    fe_profiler_zone_record_t ring[FE_PROFILER_RING_SIZE];
+    char     name[32];
+} fe_profiler_thread_t;
+
+static struct {
+    uint32_t              initialized;   // Atomik; bölge fonksiyonları bunu kontrol eder
+    uint32_t              generation;    // Her init'te artar; eski thread-local işaretçileri geçersiz kılar
+    uint32_t              thread_count;  // Atomik; kayıtlı thread slot sayısı
+    fe_profiler_thread_t* threads[FE_PROFILER_MAX_THREADS];
+    double                ns_per_tick;
+    uint64_t              last_frame_tick;
+    uint64_t              dropped_zones;
+
+    fe_profiler_frame_stats_t frame_stats;
+
+    // Chrome trace yakalaması
+    bool                       capturing;
+    fe_profiler_zone_record_t* capture;
+    uint32_t                   capture_count;
+    uint32_t                   capture_capacity;
+    uint64_t                   capture_start_tick;
+} g_profiler;
+
+static FE_THREAD_LOCAL fe_profiler_thread_t* t_profiler_thread;
+static FE_THREAD_LOCAL uint32_t              t_profiler_generation;
+
+// --- Thread Kaydı ---
+
+/**
+ * @brief Çağıran thread'in profil durumunu döndürür; ilk kullanımda oluşturup kaydeder.
+ * Slotlar dolduysa NULL döner (o thread'in bölgeleri yok sayılır).
+ */
+static fe_profiler_thread_t* fe_profiler_get_thread(void) {
+    uint32_t generation = fe_atomic_load_u32(&g_profiler.generation, FE_ATOMIC_ACQUIRE);
+    if (t_profiler_thread && t_profiler_generation == generation) {
+        return t_profiler_thread;
+    }
+    t_profiler_thread = NULL;
+    t_profiler_generation = generation;
+
+    uint32_t slot = fe_atomic_fetch_add_u32(&g_profiler.thread_count, 1, FE_ATOMIC_ACQ_REL);
+    if (slot >= FE_PROFILER_MAX_THREADS) {
+        fe_atomic_fetch_add_u32(&g_profiler.thread_count, (uint32_t)-1, FE_ATOMIC_ACQ_REL);
+        return NULL;
+    }
+
+    fe_profiler_thread_t* thread = (fe_profiler_thread_t*)FE_MALLOC(sizeof(fe_profiler_thread_t), FE_MEM_TYPE_GENERAL);
+    if (thread) {
+        memset(thread, 0, sizeof(fe_profiler_thread_t));
+        thread->index = slot;
+        snprintf(thread->name, sizeof(thread->name), "Thread %u", slot);
+    }
+    // Slot NULL kalsa bile yayınlanır; okuyucu NULL slotları atlar
+    fe_atomic_store_ptr((void**)&g_profiler.threads[slot], thread, FE_ATOMIC_RELEASE);
+    t_profiler_thread = thread;
+    return thread;
+}
+
+void fe_profiler_set_thread_name(const char* name) {
+    if (!name || !fe_atomic_load_u32(&g_profiler.initialized, FE_ATOMIC_ACQUIRE)) return;
+    fe_profiler_thread_t* thread = fe_profiler_get_thread();
+    if (thread) {
+        strncpy(thread->name, name, sizeof(thread->name) - 1);
+        thread->name[sizeof(thread->name) - 1] = '\0';
+    }
+}
+
+// --- Bölgeler ---
+
+void fe_profiler_zone_begin(const char* name) {
+    if (!fe_atomic_load_u32(&g_profiler.initialized, FE_ATOMIC_RELAXED)) return;
+    fe_profiler_thread_t* thread = fe_profiler_get_thread();
+    if (!thread) return;
+
+    // Derinlik aşılırsa bölge açılmış sayılır ama kaydedilmez; END çiftleri yine dengelenir
+    if (thread->depth < FE_PROFILER_MAX_DEPTH) {
+        fe_profiler_open_zone_t* zone = &thread->stack[thread->depth];
+        zone->name = name;
+        zone->child_ticks = 0;
+        zone->start = fe_profiler_now();
+    }
+    thread->depth++;
+}
+
+void fe_profiler_zone_end(void) {
+    uint64_t end = fe_profiler_now();
+    if (!fe_atomic_load_u32(&g_profiler.initialized, FE_ATOMIC_RELAXED)) return;
+    fe_profiler_thread_t* thread = fe_profiler_get_thread();
+    if (!thread || thread->depth == 0) return;
+
+    uint32_t depth = --thread->depth;
+    if (depth >= FE_PROFILER_MAX_DEPTH) return;
+
+    fe_profiler_open_zone_t* zone = &thread->stack[depth];
+    if (depth > 0) {
+        thread->stack[depth - 1].child_ticks += end - zone->start;
+    }
+
+    uint64_t pos = thread->write_pos; // Yalnızca sahibi yazar
+    if (pos - fe_atomic_load_u64(&thread->read_pos, FE_ATOMIC_ACQUIRE) >= FE_PROFILER_RING_SIZE) {
+        // Okuyucu henüz kopyalamadı; üzerine yazmak yerine bölge düşürülür
+        fe_atomic_store_u64(&thread->dropped, thread->dropped + 1, FE_ATOMIC_RELAXED);
+        return;
+    }
+    fe_profiler_zone_record_t* record = &thread->ring[pos & (FE_PROFILER_RING_SIZE - 1)];
+    record->name = zone->name;
+    record->start = zone->start;
+    record->end = end;
+    record->child_ticks = zone->child_ticks;
+    record->depth = depth;
+    record->thread = thread->index;
+    fe_atomic_store_u64(&thread->write_pos, pos + 1, FE_ATOMIC_RELEASE);
+}
+
+// --- Kare Toplama ---
+
+/**
+ * @brief Bir bölge kaydını kare istatistiğine ekler.
+ */
+static void fe_profiler_accumulate(const fe_profiler_zone_record_t* record) {
+    fe_profiler_frame_stats_t* stats = &g_profiler.frame_stats;
+    fe_profiler_zone_stats_t* entry = NULL;
+    for (uint32_t i = 0; i < stats->zone_count; ++i) {
+        if (stats->zones[i].name == record->name) {
+            entry = &stats->zones[i];
+            break;
+        }
+    }
+    if (!entry) {
+        if (stats->zone_count >= FE_PROFILER_MAX_ZONE_NAMES) {
+            g_profiler.dropped_zones++;
+            return;
+        }
+        entry = &stats->zones[stats->zone_count++];
+        memset(entry, 0, sizeof(fe_profiler_zone_stats_t));
+        entry->name = record->name;
+    }
+
+    double total_ms = (double)(record->end - record->start) * g_profiler.ns_per_tick / 1000000.0;
+    double child_ms = (double)record->child_ticks * g_profiler.ns_per_tick / 1000000.0;
+    entry->call_count++;
+    entry->total_ms += total_ms;
+    entry->self_ms += total_ms - child_ms;
+    if (total_ms > entry->max_ms) entry->max_ms = total_ms;
+}
+
+static int fe_profiler_compare_zone_total(const void* a, const void* b) {
+    double ta = ((const fe_profiler_zone_stats_t*)a)->total_ms;
+    double tb = ((const fe_profiler_zone_stats_t*)b)->total_ms;
+    return (ta < tb) - (ta > tb);
+}
+
+void fe_profiler_frame_mark(void) {
+    if (!fe_atomic_load_u32(&g_profiler.initialized, FE_ATOMIC_ACQUIRE)) return;
+
+    uint64_t now = fe_profiler_now();
+    fe_profiler_frame_stats_t* stats = &g_profiler.frame_stats;
+    stats->frame++;
+    stats->frame_ms = (double)(now - g_profiler.last_frame_tick) * g_profiler.ns_per_tick / 1000000.0;
+    stats->zone_count = 0;
+    g_profiler.last_frame_tick = now;
+
+    uint32_t thread_count = fe_atomic_load_u32(&g_profiler.thread_count, FE_ATOMIC_ACQUIRE);
+    if (thread_count > FE_PROFILER_MAX_THREADS) thread_count = FE_PROFILER_MAX_THREADS;
+
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        fe_profiler_thread_t* thread = (fe_profiler_thread_t*)fe_atomic_load_ptr((void**)&g_profiler.threads[t], FE_ATOMIC_ACQUIRE);
+        if (!thread) continue;
+
+        uint64_t write_pos = fe_atomic_load_u64(&thread->write_pos, FE_ATOMIC_ACQUIRE);
+        uint64_t read_pos = thread->read_pos;
+        uint64_t dropped = fe_atomic_load_u64(&thread->dropped, FE_ATOMIC_RELAXED);
+        g_profiler.dropped_zones += dropped - thread->dropped_seen;
+        thread->dropped_seen = dropped;
+
+        for (; read_pos < write_pos; ++read_pos) {
+            fe_profiler_zone_record_t record = thread->ring[read_pos & (FE_PROFILER_RING_SIZE - 1)];
+            fe_profiler_accumulate(&record);
+            if (g_profiler.capturing) {
+                if (g_profiler.capture_count < g_profiler.capture_capacity) {
+                    g_profiler.capture[g_profiler.capture_count++] = record;
+                } else {
+                    g_profiler.dropped_zones++;
+                }
+            }
+        }
+        // Kayıtlar kopyalandıktan sonra yayınlanır; yazıcı ancak bunu görünce slotları yeniden kullanır
+        fe_atomic_store_u64(&thread->read_pos, read_pos, FE_ATOMIC_RELEASE);
+    }
+
+    qsort(stats->zones, stats->zone_count, sizeof(fe_profiler_zone_stats_t), fe_profiler_compare_zone_total);
+    stats->dropped_zones = g_profiler.dropped_zones;
+}
+
+const fe_profiler_frame_stats_t* fe_profiler_get_frame_stats(void) {
+    return &g_profiler.frame_stats;
+}
+
+// --- Chrome Trace Yakalaması ---
+
+bool fe_profiler_capture_begin(uint32_t max_zones) {
+    if (!fe_atomic_load_u32(&g_profiler.initialized, FE_ATOMIC_ACQUIRE) || max_zones == 0) return false;
+    if (g_profiler.capturing) {
+        FE_LOG_WARN("fe_profiler_capture_begin: A capture is already in progress.");
+        return false;
+    }
+    g_profiler.capture = (fe_profiler_zone_record_t*)FE_MALLOC(sizeof(fe_profiler_zone_record_t) * max_zones, FE_MEM_TYPE_GENERAL);
+    if (!g_profiler.capture) {
+        FE_LOG_ERROR("fe_profiler_capture_begin: Failed to allocate capture buffer (%u zones).", max_zones);
+        return false;
+    }
+    g_profiler.capture_count = 0;
+    g_profiler.capture_capacity = max_zones;
+    g_profiler.capture_start_tick = fe_profiler_now();
+    g_profiler.capturing = true;
+    return true;
+}
+
+bool fe_profiler_is_capturing(void) {
+    return g_profiler.capturing;
+}
+
+/**
+ * @brief JSON string'i içinde kaçış gerektiren karakterleri kaçırarak yazar.
+ */
+static void fe_profiler_write_json_string(FILE* file, const char* text) {
+    fputc('"', file);
+    for (const char* c = text ? text : "?"; *c; ++c) {
+        if (*c == '"' || *c == '\\') fputc('\\', file);
+        if ((unsigned char)*c < 0x20) continue;
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+bool fe_profiler_capture_end_to_file(const char* path) {
+    if (!g_profiler.capturing) {
+        FE_LOG_WARN("fe_profiler_capture_end_to_file: No capture in progress.");
+        return false;
+    }
+    // Son kareye ait bitmiş bölgeleri de topla
+    fe_profiler_frame_mark();
+    g_profiler.capturing = false;
+
+    bool success = false;
+    FILE* file = path ? fopen(path, "w") : NULL;
+    if (!file) {
+        FE_LOG_ERROR("fe_profiler_capture_end_to_file: Could not open '%s' for writing.", path ? path : "(null)");
+    } else {
+        fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        bool first = true;
+
+        // Thread adları (meta veri olayları)
+        uint32_t thread_count = fe_atomic_load_u32(&g_profiler.thread_count, FE_ATOMIC_ACQUIRE);
+        if (thread_count > FE_PROFILER_MAX_THREADS) thread_count = FE_PROFILER_MAX_THREADS;
+        for (uint32_t t = 0; t < thread_count; ++t) {
+            fe_profiler_thread_t* thread = (fe_profiler_thread_t*)fe_atomic_load_ptr((void**)&g_profiler.threads[t], FE_ATOMIC_ACQUIRE);
+            if (!thread) continue;
+            fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                    first ? "" : ",\n", t);
+            fe_profiler_write_json_string(file, thread->name);
+            fprintf(file, "}}");
+            first = false;
+        }
+
+        // Tamamlanmış bölgeler ("X" olayları, mikrosaniye)
+        for (uint32_t i = 0; i < g_profiler.capture_count; ++i) {
+            const fe_profiler_zone_record_t* record = &g_profiler.capture[i];
+            double ts_us = (double)(int64_t)(record->start - g_profiler.capture_start_tick) * g_profiler.ns_per_tick / 1000.0;
+            double dur_us = (double)(record->end - record->start) * g_profiler.ns_per_tick / 1000.0;
+            fprintf(file, "%s{\"name\":", first ? "" : ",\n");
+            fe_profiler_write_json_string(file, record->name);
+            fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", record->thread, ts_us, dur_us);
+            first = false;
+        }
+        fprintf(file, "\n]}\n");
+        success = fclose(file) == 0;
+        if (success) {
+            FE_LOG_INFO("Profiler trace written to '%s' (%u zones).", path, g_profiler.capture_count);
+        }
+    }
+
+    FE_FREE(g_profiler.capture, FE_MEM_TYPE_GENERAL);
+    g_profiler.capture = NULL;
+    g_profiler.capture_count = 0;
+    g_profiler.capture_capacity = 0;
+    return success;
+}
+
+// --- Başlatma / Kapatma ---
+
+/**
+ * @brief Tick'in kaç nanosaniye olduğunu belirler.
+ */
+static double fe_profiler_calibrate(void) {
+#if FE_PROFILER_RDTSC
+    // rdtsc frekansı platformdan okunamaz; kısa bir aralıkta monotonik saatle karşılaştırılır
+    uint64_t ns_start = fe_timer_now_ns();
+    uint64_t tick_start = fe_profiler_now();
+    while (fe_timer_now_ns() - ns_start < 10000000ULL) { // 10 ms
+        fe_atomic_cpu_relax();
+    }
+    uint64_t ns_elapsed = fe_timer_now_ns() - ns_start;
+    uint64_t tick_elapsed = fe_profiler_now() - tick_start;
+    return tick_elapsed > 0 ? (double)ns_elapsed / (double)tick_elapsed : 1.0;
+#elif defined(_WIN32)
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    return 1000000000.0 / (double)frequency.QuadPart;
+#else
+    return 1.0;
+#endif
+}
+
+bool fe_profiler_init(void) {
+    if (fe_atomic_load_u32(&g_profiler.initialized, FE_ATOMIC_ACQUIRE)) {
+        FE_LOG_WARN("Profiler already initialized.");
+        return true;
+    }
+    uint32_t generation = g_profiler.generation;
+    memset(&g_profiler, 0, sizeof(g_profiler));
+    g_profiler.generation = generation;
+    g_profiler.ns_per_tick = fe_profiler_calibrate();
+    g_profiler.last_frame_tick = fe_profiler_now();
+
+    fe_atomic_fetch_add_u32(&g_profiler.generation, 1, FE_ATOMIC_RELEASE);
+    fe_atomic_store_u32(&g_profiler.initialized, 1, FE_ATOMIC_RELEASE);
+    fe_profiler_set_thread_name("Main");
+
+    FE_LOG_INFO("Profiler initialized (%.3f ns per tick).", g_profiler.ns_per_tick);
+    return true;
+}
+
+void fe_profiler_shutdown(void) {
+    if (!fe_atomic_load_u32(&g_profiler.initialized, FE_ATOMIC_ACQUIRE)) return;
+    fe_atomic_store_u32(&g_profiler.initialized, 0, FE_ATOMIC_RELEASE);
+
+    if (g_profiler.capturing) {
+        FE_LOG_WARN("Profiler shut down during a capture; trace discarded.");
+        FE_FREE(g_profiler.capture, FE_MEM_TYPE_GENERAL);
+        g_profiler.capture = NULL;
+        g_profiler.capturing = false;
+    }
+
+    uint32_t thread_count = fe_atomic_load_u32(&g_profiler.thread_count, FE_ATOMIC_ACQUIRE);
+    if (thread_count > FE_PROFILER_MAX_THREADS) thread_count = FE_PROFILER_MAX_THREADS;
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        if (g_profiler.threads[t]) {
+            FE_FREE(g_profiler.threads[t], FE_MEM_TYPE_GENERAL);
+            g_profiler.threads[t] = NULL;
+        }
+    }
+    g_profiler.thread_count = 0;
+    FE_LOG_INFO("Profiler shut down.");
+}
@@ -1,6 +1,14 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // clock_nanosleep için
+#endif
+
 #include "core/utils/fe_timer.h"
 #include "core/utils/fe_logger.h" // Loglama için
+#include "core/utils/fe_atomic.h" // fe_atomic_cpu_relax için
 #include <stdio.h> // printf için (debug/test amaçlı)
+#include <string.h> // memset için
+#include <errno.h>  // EINTR için
+#include <float.h>  // DBL_MAX için
 
 // Platforma özgü zamanlama başlıkları
 #ifdef _WIN32
@@ -152,3 +160,180 @@ double fe_timer_get_total_time() {
 long long fe_timer_get_frequency() {
     return fe_timer_state.frequency;
 }
+
+// --- Yüksek Çözünürlüklü Zaman Uygulaması ---
+
+#define FE_NS_PER_SECOND 1000000000ULL
+
+uint64_t fe_timer_now_ns() {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency; // Sistem açıkken değişmez; ilk çağrıda okunur
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    // Taşmayı önlemek için saniye ve kalan kısım ayrı ölçeklenir
+    uint64_t ticks = (uint64_t)counter.QuadPart;
+    uint64_t freq = (uint64_t)frequency.QuadPart;
+    return (ticks / freq) * FE_NS_PER_SECOND + ((ticks % freq) * FE_NS_PER_SECOND) / freq;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * FE_NS_PER_SECOND + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief İşletim sistemi uykusuyla mutlak bir zamana kadar bekler (meşgul bekleme yapmaz).
+ * Uyku hedefi aşabilir; ne kadar aştığı çağıran tarafından ölçülür.
+ */
+static void fe_timer_os_sleep_until_ns(uint64_t target_ns) {
+#ifdef _WIN32
+    uint64_t now = fe_timer_now_ns();
+    if (target_ns > now) {
+        DWORD ms = (DWORD)((target_ns - now) / 1000000ULL);
+        if (ms > 0) Sleep(ms); // Milisaniye altı kısım spin payına kalır
+    }
+#elif defined(__APPLE__)
+    // macOS'ta clock_nanosleep yok; göreli nanosleep kullanılır
+    uint64_t now = fe_timer_now_ns();
+    if (target_ns > now) {
+        uint64_t remaining = target_ns - now;
+        struct timespec ts;
+        ts.tv_sec = (time_t)(remaining / FE_NS_PER_SECOND);
+        ts.tv_nsec = (long)(remaining % FE_NS_PER_SECOND);
+        nanosleep(&ts, NULL);
+    }
+#else
+    // Mutlak son tarih: sinyalle bölünen uyku kaldığı yerden değil, aynı hedefle yeniden başlar.
+    struct timespec ts;
+    ts.tv_sec = (time_t)(target_ns / FE_NS_PER_SECOND);
+    ts.tv_nsec = (long)(target_ns % FE_NS_PER_SECOND);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+#endif
+}
+
+/**
+ * @brief Mutlak bir zamana kadar meşgul bekler.
+ */
+static void fe_timer_spin_until_ns(uint64_t deadline_ns) {
+    while (fe_timer_now_ns() < deadline_ns) {
+        fe_atomic_cpu_relax();
+    }
+}
+
+uint64_t fe_timer_sleep_until_ns(uint64_t deadline_ns, uint64_t spin_ns) {
+    uint64_t oversleep_ns = 0;
+    if (deadline_ns > spin_ns && fe_timer_now_ns() < deadline_ns - spin_ns) {
+        uint64_t sleep_target = deadline_ns - spin_ns;
+        fe_timer_os_sleep_until_ns(sleep_target);
+        uint64_t woke = fe_timer_now_ns();
+        oversleep_ns = woke > sleep_target ? woke - sleep_target : 0;
+    }
+    fe_timer_spin_until_ns(deadline_ns);
+    return oversleep_ns;
+}
+
+// --- Kare Hızı Ayarlayıcı Uygulaması ---
+
+// Spin payı sınırları. Alt sınır, uyku hiç geç kalmasa bile bırakılan güvenlik payıdır;
+// üst sınır, payın periyodu aşmamasını sağlayan periyot sınırından önce uygulanır.
+#define FE_FRAME_PACER_MIN_SPIN_NS     50000ULL   // 50 us
+#define FE_FRAME_PACER_MAX_SPIN_NS     4000000ULL // 4 ms
+#define FE_FRAME_PACER_INITIAL_SPIN_NS 1000000ULL // 1 ms (ilk ölçümlere kadar)
+
+// Fazla uyuma ortalaması: artışlar hızlı, düşüşler yavaş izlenir; tek bir geç uyanma
+// payı hemen büyütür, pay ancak uzun süre erken uyanıldığında küçülür.
+#define FE_FRAME_PACER_EMA_RISE  0.5
+#define FE_FRAME_PACER_EMA_DECAY 0.05
+
+void fe_frame_pacer_init(fe_frame_pacer_t* pacer, double target_frame_rate) {
+    if (!pacer) return;
+    memset(pacer, 0, sizeof(fe_frame_pacer_t));
+    pacer->spin_margin_ns = FE_FRAME_PACER_INITIAL_SPIN_NS;
+    pacer->oversleep_ema_ns = 0.0;
+    fe_frame_pacer_set_target(pacer, target_frame_rate);
+    fe_frame_pacer_reset_stats(pacer);
+}
+
+void fe_frame_pacer_set_target(fe_frame_pacer_t* pacer, double target_frame_rate) {
+    if (!pacer) return;
+    pacer->period_ns = target_frame_rate > 0.0 ? (uint64_t)((double)FE_NS_PER_SECOND / target_frame_rate) : 0;
+    pacer->next_deadline_ns = 0;
+    pacer->stats.target_frame_ms = (double)pacer->period_ns / 1000000.0;
+}
+
+/**
+ * @brief Gözlenen fazla uyuma miktarına göre spin payını günceller.
+ */
+static void fe_frame_pacer_adapt(fe_frame_pacer_t* pacer, double oversleep_ns) {
+    double alpha = oversleep_ns > pacer->oversleep_ema_ns ? FE_FRAME_PACER_EMA_RISE : FE_FRAME_PACER_EMA_DECAY;
+    pacer->oversleep_ema_ns += alpha * (oversleep_ns - pacer->oversleep_ema_ns);
+
+    uint64_t margin = (uint64_t)(pacer->oversleep_ema_ns * 1.5) + FE_FRAME_PACER_MIN_SPIN_NS;
+    if (margin > FE_FRAME_PACER_MAX_SPIN_NS) margin = FE_FRAME_PACER_MAX_SPIN_NS;
+    if (margin > pacer->period_ns) margin = pacer->period_ns;
+    pacer->spin_margin_ns = margin;
+}
+
+uint64_t fe_frame_pacer_wait(fe_frame_pacer_t* pacer) {
+    uint64_t now = fe_timer_now_ns();
+
+    if (pacer->period_ns > 0) {
+        if (pacer->next_deadline_ns == 0) {
+            // İlk kare (veya hedef değişti): zamanlama şimdiden başlar
+            pacer->next_deadline_ns = now;
+        } else if (now > pacer->next_deadline_ns) {
+            // Kare periyodu aşıldı; kaybedilen süreyi kısa karelerle telafi etmek yerine yeniden hizala
+            pacer->stats.missed_deadlines++;
+            pacer->next_deadline_ns = now;
+        } else {
+            uint64_t deadline = pacer->next_deadline_ns;
+            bool will_sleep = deadline - now > pacer->spin_margin_ns; // Yalnızca gerçek uykular payı uyarlar
+            uint64_t oversleep_ns = fe_timer_sleep_until_ns(deadline, pacer->spin_margin_ns);
+            if (will_sleep) fe_frame_pacer_adapt(pacer, (double)oversleep_ns);
+            now = fe_timer_now_ns();
+            pacer->wake_error_sum_us += (double)(now - deadline) / 1000.0;
+            pacer->wake_error_count++;
+        }
+        pacer->next_deadline_ns += pacer->period_ns;
+    }
+
+    // Kare süresi istatistikleri (Welford çevrimiçi varyans)
+    if (pacer->last_frame_start_ns != 0) {
+        fe_frame_pacer_stats_t* stats = &pacer->stats;
+        double frame_ms = (double)(now - pacer->last_frame_start_ns) / 1000000.0;
+        stats->frame_count++;
+        stats->last_frame_ms = frame_ms;
+        double delta = frame_ms - stats->mean_frame_ms;
+        stats->mean_frame_ms += delta / (double)stats->frame_count;
+        pacer->frame_m2 += delta * (frame_ms - stats->mean_frame_ms);
+        stats->frame_variance_ms2 = stats->frame_count > 1 ? pacer->frame_m2 / (double)(stats->frame_count - 1) : 0.0;
+        if (frame_ms < stats->min_frame_ms) stats->min_frame_ms = frame_ms;
+        if (frame_ms > stats->max_frame_ms) stats->max_frame_ms = frame_ms;
+    }
+    pacer->last_frame_start_ns = now;
+    return now;
+}
+
+void fe_frame_pacer_get_stats(const fe_frame_pacer_t* pacer, fe_frame_pacer_stats_t* out_stats) {
+    if (!pacer || !out_stats) return;
+    *out_stats = pacer->stats;
+    out_stats->mean_wake_error_us = pacer->wake_error_count > 0
+        ? pacer->wake_error_sum_us / (double)pacer->wake_error_count : 0.0;
+    out_stats->spin_margin_us = (double)pacer->spin_margin_ns / 1000.0;
+    if (out_stats->frame_count == 0) out_stats->min_frame_ms = 0.0;
+}
+
+void fe_frame_pacer_reset_stats(fe_frame_pacer_t* pacer) {
+    if (!pacer) return;
+    double target_frame_ms = pacer->stats.target_frame_ms;
+    memset(&pacer->stats, 0, sizeof(fe_frame_pacer_stats_t));
+    pacer->stats.target_frame_ms = target_frame_ms;
+    pacer->stats.min_frame_ms = DBL_MAX;
+    pacer->frame_m2 = 0.0;
+    pacer->wake_error_sum_us = 0.0;
+    pacer->wake_error_count = 0;
+}
@@ -0,0 +1,181 @@
+// fe_asset_manager_check: Varlık yöneticisinin (core/assets/fe_asset_manager.h) aynı yola farklı
+// tiplerle yapılan yüklemelerde varlıkları sızdırmadığını ve tutulan referansları bozmadığını denetler.
+//
+// Kullanım:
+//   fe_asset_manager_check
+//
+// - Çalışma dizininde birkaç küçük dosya oluşturur ve sonunda siler.
+// - Eşzamanlı ve asenkron yüklemeler aynı yolu farklı tiplerle ister: tutulan eski varlık geçerli
+//   kalmalı, yeni varlık yolu almalı, eski varlık son referansla (veya zorla boşaltmada) bir kez
+//   boşaltılmalıdır.
+// - Bağımlılık olarak tutulan bir varlığın yerinden edilmesi ve kapanışta hâlâ tutulan ayrılmış
+//   varlıklar da sınanır; kapanıştan sonra çözülen her varlık tam bir kez boşaltılmış olmalıdır.
+// - Hata bulunursa çıkış kodu 1'dir.
+//
+// Derleme: src/editor/fe_asset_manager.c ve bağımlılıklarıyla (src/platform/fe_file_cache.c,
+// src/platform/fe_ddc.c, src/data_structures/fe_string_intern.c vb.) birlikte derlenir. Sızıntıları
+// yakalamak için GCC/Clang'da -fsanitize=address ile çalıştırılmalıdır.
+
+#include "core/assets/fe_asset_manager.h" // Sınanan yönetici
+#include "platform/fe_file_cache.h"       // Yöneticinin dosya okuması için
+
+#include <stdio.h>  // printf, fopen için
+#include <stdlib.h> // malloc, free için
+#include <string.h> // memcpy, strcmp için
+
+static const char* const s_check_files[] = { "fe_asset_check_mixed.bin", "fe_asset_check_parent.bin" };
+
+static int      g_live;     // Çözülmüş ama henüz boşaltılmamış veri sayısı
+static uint32_t g_failures;
+
+#define FE_ASSET_CHECK(condition)                                                     \
+    do {                                                                              \
+        if (!(condition)) {                                                           \
+            fprintf(stderr, "FAIL: %s (line %d)\n", #condition, __LINE__);            \
+            g_failures++;                                                             \
+        }                                                                             \
+    } while (0)
+
+static bool fe_asset_check_decode(const char* file_path, const uint8_t* file_data, size_t file_size,
+                                  void** asset_out, size_t* data_size_out) {
+    (void)file_path;
+    char* copy = (char*)malloc(file_size + 1);
+    if (!copy) return false;
+    memcpy(copy, file_data, file_size);
+    copy[file_size] = '\0';
+    *asset_out = copy;
+    *data_size_out = file_size;
+    g_live++;
+    return true;
+}
+
+static void fe_asset_check_unload(void* asset_data, size_t data_size) {
+    (void)data_size;
+    free(asset_data);
+    g_live--;
+}
+
+static bool fe_asset_check_write_files(void) {
+    for (size_t i = 0; i < sizeof(s_check_files) / sizeof(s_check_files[0]); ++i) {
+        FILE* file = fopen(s_check_files[i], "wb");
+        if (!file) return false;
+        fprintf(file, "%s", s_check_files[i]);
+        fclose(file);
+    }
+    return true;
+}
+
+static fe_asset_t* fe_asset_check_load_async(fe_asset_manager_t* manager, const char* path, fe_asset_type_t type) {
+    fe_asset_load_handle_t handle = fe_asset_manager_load_asset_async(manager, path, type, FE_ASSET_LOAD_PRIORITY_NORMAL);
+    return handle != FE_ASSET_LOAD_INVALID_HANDLE ? fe_asset_manager_wait_load(manager, handle) : NULL;
+}
+
+/**
+ * @brief Tutulan bir varlık, aynı yolun başka tipte yüklenmesinden sonra geçerli kalmalı ve bir kez boşaltılmalı.
+ * @param async_first true ise yeni tip asenkron, eski tip eşzamanlı yüklenir; false ise tersi.
+ */
+static void fe_asset_check_held_mismatch(fe_asset_manager_t* manager, bool async_first) {
+    const char* path = s_check_files[0];
+    fe_asset_t* old_asset = async_first ? fe_asset_manager_load_asset(manager, path, FE_ASSET_TYPE_SOUND)
+                                        : fe_asset_check_load_async(manager, path, FE_ASSET_TYPE_SOUND);
+    FE_ASSET_CHECK(old_asset != NULL);
+    if (!old_asset) return;
+    fe_asset_t* new_asset = async_first ? fe_asset_check_load_async(manager, path, FE_ASSET_TYPE_TEXTURE)
+                                        : fe_asset_manager_load_asset(manager, path, FE_ASSET_TYPE_TEXTURE);
+    FE_ASSET_CHECK(new_asset != NULL && new_asset != old_asset);
+    FE_ASSET_CHECK(old_asset->ref_count == 1 && old_asset->detached);
+    FE_ASSET_CHECK(strcmp((const char*)old_asset->data_ptr, path) == 0);
+    FE_ASSET_CHECK(g_live == 2);
+
+    // Yol artık yeni varlığındır
+    fe_asset_t* again = fe_asset_manager_load_asset(manager, path, FE_ASSET_TYPE_TEXTURE);
+    FE_ASSET_CHECK(again == new_asset);
+    fe_asset_manager_release_asset(manager, again);
+
+    fe_asset_manager_release_asset(manager, old_asset);
+    FE_ASSET_CHECK(g_live == 1); // Ayrılmış varlık LRU'ya girmeden boşaltılır
+    fe_asset_manager_release_asset(manager, new_asset);
+    fe_asset_manager_purge_unused(manager, FE_ASSET_TYPE_UNKNOWN);
+    FE_ASSET_CHECK(g_live == 0);
+}
+
+/**
+ * @brief Kullanılmayan (LRU'daki) varlık başka tipte asenkron yüklemede hemen boşaltılmalı.
+ */
+static void fe_asset_check_unused_mismatch(fe_asset_manager_t* manager) {
+    const char* path = s_check_files[0];
+    fe_asset_manager_release_asset(manager, fe_asset_manager_load_asset(manager, path, FE_ASSET_TYPE_SOUND));
+    FE_ASSET_CHECK(g_live == 1);
+    fe_asset_t* asset = fe_asset_check_load_async(manager, path, FE_ASSET_TYPE_TEXTURE);
+    FE_ASSET_CHECK(asset != NULL && g_live == 1);
+    fe_asset_manager_release_asset(manager, asset);
+    fe_asset_manager_purge_unused(manager, FE_ASSET_TYPE_UNKNOWN);
+    FE_ASSET_CHECK(g_live == 0);
+}
+
+/**
+ * @brief Bağımlılık olarak tutulan varlık yerinden edilince ebeveyni bırakıldığında boşaltılmalı.
+ */
+static void fe_asset_check_detached_dependency(fe_asset_manager_t* manager) {
+    FE_ASSET_CHECK(fe_asset_manager_add_dependency(manager, s_check_files[1], s_check_files[0], FE_ASSET_TYPE_SOUND));
+    fe_asset_t* parent = fe_asset_check_load_async(manager, s_check_files[1], FE_ASSET_TYPE_MODEL);
+    FE_ASSET_CHECK(parent != NULL && parent->dependency_count == 1);
+    fe_asset_t* other = fe_asset_check_load_async(manager, s_check_files[0], FE_ASSET_TYPE_TEXTURE);
+    FE_ASSET_CHECK(other != NULL && g_live == 3);
+    fe_asset_manager_release_asset(manager, parent);
+    fe_asset_manager_purge_unused(manager, FE_ASSET_TYPE_MODEL);
+    FE_ASSET_CHECK(g_live == 1); // Ebeveyn ve ayrılmış bağımlılığı
+    fe_asset_manager_release_asset(manager, other);
+    fe_asset_manager_purge_unused(manager, FE_ASSET_TYPE_UNKNOWN);
+    FE_ASSET_CHECK(g_live == 0);
+    fe_asset_manager_clear_dependencies(manager, s_check_files[1]);
+}
+
+/**
+ * @brief Zorla boşaltma ayrılmış varlıkları da kapsamalı.
+ */
+static void fe_asset_check_unload_all(fe_asset_manager_t* manager) {
+    const char* path = s_check_files[0];
+    fe_asset_t* held = fe_asset_manager_load_asset(manager, path, FE_ASSET_TYPE_SOUND);
+    fe_asset_t* other = fe_asset_check_load_async(manager, path, FE_ASSET_TYPE_TEXTURE);
+    FE_ASSET_CHECK(held != NULL && other != NULL && g_live == 2);
+    fe_asset_manager_unload_all_assets_of_type(manager, FE_ASSET_TYPE_SOUND);
+    FE_ASSET_CHECK(g_live == 1);
+    fe_asset_manager_release_asset(manager, other);
+}
+
+int main(void) {
+    if (!fe_asset_check_write_files()) {
+        fprintf(stderr, "Cannot create test files in the working directory.\n");
+        return 1;
+    }
+    fe_file_cache_init();
+    fe_asset_manager_t manager;
+    if (!fe_asset_manager_init(&manager)) {
+        fprintf(stderr, "fe_asset_manager_init failed.\n");
+        return 1;
+    }
+    const fe_asset_type_t types[] = { FE_ASSET_TYPE_SOUND, FE_ASSET_TYPE_TEXTURE, FE_ASSET_TYPE_MODEL };
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); ++i) {
+        fe_asset_manager_register_staged_loader(types[i], fe_asset_check_decode, NULL, fe_asset_check_unload);
+        fe_asset_manager_set_type_budget(&manager, types[i], 1u << 20); // Kullanılmayanlar LRU'da kalsın
+    }
+
+    fe_asset_check_held_mismatch(&manager, true);
+    fe_asset_check_held_mismatch(&manager, false);
+    fe_asset_check_unused_mismatch(&manager);
+    fe_asset_check_detached_dependency(&manager);
+    fe_asset_check_unload_all(&manager);
+
+    // Kapanışta hâlâ tutulan ayrılmış varlık da boşaltılmalı
+    fe_asset_t* held = fe_asset_manager_load_asset(&manager, s_check_files[0], FE_ASSET_TYPE_SOUND);
+    FE_ASSET_CHECK(fe_asset_check_load_async(&manager, s_check_files[0], FE_ASSET_TYPE_TEXTURE) != NULL);
+    FE_ASSET_CHECK(held != NULL && held->detached);
+    fe_asset_manager_shutdown(&manager);
+    FE_ASSET_CHECK(g_live == 0);
+    fe_file_cache_shutdown();
+
+    for (size_t i = 0; i < sizeof(s_check_files) / sizeof(s_check_files[0]); ++i) remove(s_check_files[i]);
+    printf("%s (%u failure(s))\n", g_failures == 0 ? "OK" : "FAILED", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
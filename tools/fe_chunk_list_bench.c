@@ -0,0 +1,257 @@
+// fe_chunk_list_bench: core/containers/fe_chunk_list.h'yi fe_list ve FE_DYNAMIC_ARRAY ile karşılaştırır
+// ve sonuçlarını doğrular.
+//
+// Kullanım:
+//   fe_chunk_list_bench [eleman_sayısı] [tekrar] [ara_işlem_sayısı]
+//
+// - Varsayılanlar: 100000 eleman, 5 tekrar, 256 ara işlem.
+// - Her tekrar üç kabı aynı 16 baytlık elemanlarla doldurur, baştan sona gezerek toplar, ortaya
+//   ara_işlem_sayısı kadar eleman ekler ve baştan o kadar eleman siler; her aşamanın en iyi ve
+//   ortanca süresi yazılır.
+// - fe_list_append listenin sonunu her seferinde aradığından fe_list başa ekleyerek doldurulur.
+// - Gezinme toplamları ve son eleman sayıları beklenen değerlerle karşılaştırılır; uyuşmazlıkta
+//   çıkış kodu 1'dir.
+//
+// Derleme: src/data_structures/fe_chunk_list.c, src/data_structures/fe_list.c,
+// src/data_structures/fe_dynamic_array.c, src/utils/fe_timer.c ve bunların bağımlılıklarıyla
+// birlikte -O2 ile derlenir.
+
+#include "core/containers/fe_chunk_list.h"    // Ölçülen kap
+#include "core/containers/fe_list.h"          // Karşılaştırılan bağlantılı liste
+#include "core/containers/fe_dynamic_array.h" // Karşılaştırılan dinamik dizi
+#include "core/utils/fe_timer.h"              // fe_timer_now_ns için
+
+#include <stdio.h>  // printf için
+#include <stdlib.h> // malloc, free, qsort, atoi için
+#include <string.h> // memmove için
+
+#define FE_CHUNK_BENCH_MAX_REPEATS 64
+
+/**
+ * @brief Ölçümlerde kullanılan eleman; küçük bir oyun bileşenine benzer boyuttadır.
+ */
+typedef struct fe_chunk_bench_item {
+    uint64_t key;
+    uint64_t payload;
+} fe_chunk_bench_item_t;
+
+typedef enum fe_chunk_bench_kind {
+    FE_CHUNK_BENCH_LIST = 0,
+    FE_CHUNK_BENCH_CHUNK_LIST,
+    FE_CHUNK_BENCH_DYNAMIC_ARRAY,
+    FE_CHUNK_BENCH_COUNT
+} fe_chunk_bench_kind_t;
+
+typedef enum fe_chunk_bench_phase {
+    FE_CHUNK_BENCH_PHASE_FILL = 0,
+    FE_CHUNK_BENCH_PHASE_ITERATE,
+    FE_CHUNK_BENCH_PHASE_INSERT_MIDDLE,
+    FE_CHUNK_BENCH_PHASE_REMOVE_HEAD,
+    FE_CHUNK_BENCH_PHASE_COUNT
+} fe_chunk_bench_phase_t;
+
+static const char* s_bench_names[FE_CHUNK_BENCH_COUNT] = {
+    "fe_list",
+    "fe_chunk_list",
+    "FE_DYNAMIC_ARRAY"
+};
+
+static const char* s_phase_names[FE_CHUNK_BENCH_PHASE_COUNT] = {
+    "fill",
+    "iterate",
+    "insert middle",
+    "remove head"
+};
+
+// xorshift32: platformdan bağımsız, tekrarlanabilir girdi için
+static uint32_t fe_chunk_bench_next(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static int fe_chunk_bench_compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Bir kabı tüm aşamalardan bir kez geçirir ve aşama sürelerini yazar.
+ * Ortaya eklenen elemanların anahtarı 0'dır; böylece toplamlar yalnızca silinen elemanlara bağlıdır.
+ *
+ * @param head_sum Baştan silinecek ilk ara_işlem_sayısı elemanın anahtar toplamı (doldurma sırasına göre).
+ * @param tail_sum Sondaki ara_işlem_sayısı elemanın anahtar toplamı (başa ekleyerek doldurulan fe_list için).
+ * @return bool Toplamlar ve eleman sayıları doğruysa true.
+ */
+static bool fe_chunk_bench_run(fe_chunk_bench_kind_t kind, const fe_chunk_bench_item_t* input, size_t count,
+                               size_t operations, uint64_t total, uint64_t head_sum, uint64_t tail_sum,
+                               uint64_t times[FE_CHUNK_BENCH_PHASE_COUNT]) {
+    const fe_chunk_bench_item_t inserted = { 0, 0 };
+    uint64_t sum = 0;
+    uint64_t final_sum = 0;
+    size_t final_size = 0;
+    bool ok = true;
+    uint64_t start;
+
+    if (kind == FE_CHUNK_BENCH_LIST) {
+        fe_list_t list;
+        if (!fe_list_init(&list, NULL, NULL, NULL)) return false;
+        start = fe_timer_now_ns();
+        for (size_t i = 0; i < count; ++i) ok = fe_list_prepend(&list, &input[i], sizeof(fe_chunk_bench_item_t)) && ok;
+        times[FE_CHUNK_BENCH_PHASE_FILL] = fe_timer_now_ns() - start;
+
+        start = fe_timer_now_ns();
+        for (fe_list_node_t* node = fe_list_get_iterator(&list); node; node = node->next) {
+            sum += ((const fe_chunk_bench_item_t*)node->data)->key;
+        }
+        times[FE_CHUNK_BENCH_PHASE_ITERATE] = fe_timer_now_ns() - start;
+
+        start = fe_timer_now_ns();
+        for (size_t i = 0; i < operations; ++i) {
+            ok = fe_list_insert_at(&list, fe_list_size(&list) / 2, &inserted, sizeof(inserted)) && ok;
+        }
+        times[FE_CHUNK_BENCH_PHASE_INSERT_MIDDLE] = fe_timer_now_ns() - start;
+
+        start = fe_timer_now_ns();
+        for (size_t i = 0; i < operations; ++i) ok = fe_list_remove_head(&list) && ok;
+        times[FE_CHUNK_BENCH_PHASE_REMOVE_HEAD] = fe_timer_now_ns() - start;
+
+        for (fe_list_node_t* node = fe_list_get_iterator(&list); node; node = node->next) {
+            final_sum += ((const fe_chunk_bench_item_t*)node->data)->key;
+        }
+        final_size = fe_list_size(&list);
+        fe_list_shutdown(&list);
+        return ok && sum == total && final_sum == total - tail_sum && final_size == count;
+    }
+
+    if (kind == FE_CHUNK_BENCH_CHUNK_LIST) {
+        fe_chunk_list_t list;
+        if (!fe_chunk_list_init(&list, sizeof(fe_chunk_bench_item_t), NULL, NULL, NULL)) return false;
+        start = fe_timer_now_ns();
+        for (size_t i = 0; i < count; ++i) ok = fe_chunk_list_append(&list, &input[i]) && ok;
+        times[FE_CHUNK_BENCH_PHASE_FILL] = fe_timer_now_ns() - start;
+
+        start = fe_timer_now_ns();
+        fe_chunk_list_iter_t it = fe_chunk_list_begin(&list);
+        for (const fe_chunk_bench_item_t* item; (item = (const fe_chunk_bench_item_t*)fe_chunk_list_iter_next(&it)) != NULL;) {
+            sum += item->key;
+        }
+        times[FE_CHUNK_BENCH_PHASE_ITERATE] = fe_timer_now_ns() - start;
+
+        start = fe_timer_now_ns();
+        for (size_t i = 0; i < operations; ++i) {
+            ok = fe_chunk_list_insert_at(&list, fe_chunk_list_size(&list) / 2, &inserted) && ok;
+        }
+        times[FE_CHUNK_BENCH_PHASE_INSERT_MIDDLE] = fe_timer_now_ns() - start;
+
+        start = fe_timer_now_ns();
+        for (size_t i = 0; i < operations; ++i) ok = fe_chunk_list_remove_head(&list) && ok;
+        times[FE_CHUNK_BENCH_PHASE_REMOVE_HEAD] = fe_timer_now_ns() - start;
+
+        it = fe_chunk_list_begin(&list);
+        for (const fe_chunk_bench_item_t* item; (item = (const fe_chunk_bench_item_t*)fe_chunk_list_iter_next(&it)) != NULL;) {
+            final_sum += item->key;
+        }
+        final_size = fe_chunk_list_size(&list);
+        fe_chunk_list_shutdown(&list);
+        return ok && sum == total && final_sum == total - head_sum && final_size == count;
+    }
+
+    FE_DYNAMIC_ARRAY(fe_chunk_bench_item_t) array;
+    if (!FE_DYNAMIC_ARRAY_INIT(&array, 16)) return false;
+    start = fe_timer_now_ns();
+    for (size_t i = 0; i < count; ++i) ok = FE_DYNAMIC_ARRAY_ADD(&array, input[i]) && ok;
+    times[FE_CHUNK_BENCH_PHASE_FILL] = fe_timer_now_ns() - start;
+
+    start = fe_timer_now_ns();
+    FE_DYNAMIC_ARRAY_FOREACH(&array, fe_chunk_bench_item_t, item) {
+        sum += item->key;
+    }
+    times[FE_CHUNK_BENCH_PHASE_ITERATE] = fe_timer_now_ns() - start;
+
+    start = fe_timer_now_ns();
+    for (size_t i = 0; i < operations; ++i) {
+        if (!FE_DYNAMIC_ARRAY_RESERVE(&array, array.size + 1)) {
+            ok = false;
+            break;
+        }
+        size_t index = array.size / 2;
+        memmove(&array.data[index + 1], &array.data[index], (array.size - index) * sizeof(fe_chunk_bench_item_t));
+        array.data[index] = inserted;
+        array.size++;
+    }
+    times[FE_CHUNK_BENCH_PHASE_INSERT_MIDDLE] = fe_timer_now_ns() - start;
+
+    start = fe_timer_now_ns();
+    for (size_t i = 0; i < operations; ++i) FE_DYNAMIC_ARRAY_REMOVE_AT(&array, 0);
+    times[FE_CHUNK_BENCH_PHASE_REMOVE_HEAD] = fe_timer_now_ns() - start;
+
+    FE_DYNAMIC_ARRAY_FOREACH(&array, fe_chunk_bench_item_t, item) {
+        final_sum += item->key;
+    }
+    final_size = array.size;
+    FE_DYNAMIC_ARRAY_SHUTDOWN(&array);
+    return ok && sum == total && final_sum == total - head_sum && final_size == count;
+}
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 100000;
+    int repeats = argc > 2 ? atoi(argv[2]) : 5;
+    size_t operations = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : 256;
+    if (count == 0 || repeats <= 0 || repeats > FE_CHUNK_BENCH_MAX_REPEATS || operations > count / 2) {
+        fprintf(stderr, "Usage: %s [element_count] [repeats (1-%d)] [operations (<= element_count / 2)]\n",
+                argv[0], FE_CHUNK_BENCH_MAX_REPEATS);
+        return 1;
+    }
+
+    fe_chunk_bench_item_t* input = (fe_chunk_bench_item_t*)malloc(count * sizeof(fe_chunk_bench_item_t));
+    if (!input) {
+        fprintf(stderr, "Out of memory for %zu elements.\n", count);
+        return 1;
+    }
+    uint32_t state = 0x9E3779B9u;
+    uint64_t total = 0;
+    uint64_t head_sum = 0;
+    uint64_t tail_sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        input[i].key = fe_chunk_bench_next(&state) | 1u; // Ortaya eklenen 0 anahtarlarından ayırt edilir
+        input[i].payload = i;
+        total += input[i].key;
+        if (i < operations) head_sum += input[i].key;
+        if (i >= count - operations) tail_sum += input[i].key;
+    }
+
+    printf("%zu elements of %zu bytes, %d repeat(s), %zu middle insert(s) / head removal(s)\n",
+           count, sizeof(fe_chunk_bench_item_t), repeats, operations);
+    printf("%-18s %-14s %10s %10s\n", "", "", "best ms", "median ms");
+
+    int exit_code = 0;
+    for (int kind = 0; kind < FE_CHUNK_BENCH_COUNT; ++kind) {
+        uint64_t times[FE_CHUNK_BENCH_PHASE_COUNT][FE_CHUNK_BENCH_MAX_REPEATS];
+        bool failed = false;
+        for (int r = 0; r < repeats; ++r) {
+            uint64_t run_times[FE_CHUNK_BENCH_PHASE_COUNT] = { 0 };
+            if (!fe_chunk_bench_run((fe_chunk_bench_kind_t)kind, input, count, operations, total, head_sum, tail_sum, run_times)) {
+                failed = true;
+            }
+            for (int p = 0; p < FE_CHUNK_BENCH_PHASE_COUNT; ++p) times[p][r] = run_times[p];
+        }
+        if (failed) {
+            printf("%-18s %-14s %10s\n", s_bench_names[kind], "", "FAILED");
+            exit_code = 1;
+            continue;
+        }
+        for (int p = 0; p < FE_CHUNK_BENCH_PHASE_COUNT; ++p) {
+            qsort(times[p], (size_t)repeats, sizeof(uint64_t), fe_chunk_bench_compare_u64);
+            printf("%-18s %-14s %10.3f %10.3f\n", p == 0 ? s_bench_names[kind] : "", s_phase_names[p],
+                   times[p][0] / 1e6, times[p][repeats / 2] / 1e6);
+        }
+    }
+
+    free(input);
+    return exit_code;
+}
@@ -0,0 +1,183 @@
+// fe_job_system_check: İş sistemini (core/jobs/fe_job_system.h) çok thread'li olarak çalıştırır ve
+// zamanlayıcının sözleşmelerini denetler.
+//
+// Kullanım:
+//   fe_job_system_check [işçi_sayısı] [tur_sayısı]
+//
+// - Varsayılanlar: 3 işçi, 20 tur.
+// - Paralel işler: her iş bir kez çalışmalı, sayaç yalnızca hepsi bitince sıfırlanmalıdır.
+// - Bağımlılıklar: run_after ile gönderilen işler, bağımlı oldukları sayacın tüm işleri bittikten
+//   sonra başlamalıdır.
+// - Ana thread'e özel işler: iş sistemine ait olmayan bir thread'den gönderildiğinde de, havuz dolu
+//   olsa bile yalnızca ana thread'de çalışmalıdır.
+// - Havuz taşması: FE_JOB_SYSTEM_MAX_JOBS'tan fazla iş gönderildiğinde hiçbir iş kaybolmamalıdır.
+// - Hata bulunursa çıkış kodu 1'dir.
+//
+// Derleme: src/jobs/fe_job_system.c, src/data_structures/fe_ring_queue.c ve src/platform/fe_thread.c
+// ile birlikte derlenir. Sıralama hatalarını yakalamak için GCC/Clang'da -fsanitize=thread ile
+// çalıştırılmalıdır.
+
+#include "core/jobs/fe_job_system.h" // Sınanan iş sistemi
+#include "core/utils/fe_atomic.h"    // Paylaşılan sayaçlar için
+#include "platform/fe_thread.h"      // fe_thread_create, fe_thread_join için
+
+#include <stdio.h>  // printf için
+#include <stdlib.h> // atoi için
+
+#define FE_JOB_CHECK_PARALLEL_JOBS 1000
+#define FE_JOB_CHECK_OVERFLOW_JOBS (FE_JOB_SYSTEM_MAX_JOBS + 256)
+
+static uint32_t g_failures;
+
+#define FE_JOB_CHECK(condition)                                                       \
+    do {                                                                              \
+        if (!(condition)) {                                                           \
+            fprintf(stderr, "FAIL: %s (line %d)\n", #condition, __LINE__);            \
+            fe_atomic_fetch_add_u32(&g_failures, 1, FE_ATOMIC_RELAXED);               \
+        }                                                                             \
+    } while (0)
+
+static fe_job_decl_t s_decls[FE_JOB_CHECK_OVERFLOW_JOBS];
+static uint32_t      s_hits[FE_JOB_CHECK_OVERFLOW_JOBS]; // Atomik; her işin kaç kez çalıştığı
+static uint32_t      s_stage_done;                      // Atomik; ilk aşamada biten iş sayısı
+static uint32_t      s_wrong_thread;                    // Atomik; ana thread dışında çalışan özel işler
+
+static void fe_job_check_hit(void* user_data) {
+    uint32_t index = (uint32_t)(uintptr_t)user_data;
+    fe_atomic_fetch_add_u32(&s_hits[index], 1, FE_ATOMIC_RELAXED);
+    int thread_index = fe_job_system_thread_index();
+    FE_JOB_CHECK(thread_index >= 0 && thread_index <= (int)fe_job_system_worker_count());
+}
+
+static void fe_job_check_main_only(void* user_data) {
+    uint32_t index = (uint32_t)(uintptr_t)user_data;
+    fe_atomic_fetch_add_u32(&s_hits[index], 1, FE_ATOMIC_RELAXED);
+    if (fe_job_system_thread_index() != 0) fe_atomic_fetch_add_u32(&s_wrong_thread, 1, FE_ATOMIC_RELAXED);
+}
+
+static void fe_job_check_stage_a(void* user_data) {
+    (void)user_data;
+    for (volatile uint32_t i = 0; i < 2000; ++i) {} // Aşamaların üst üste binme şansını artırır
+    fe_atomic_fetch_add_u32(&s_stage_done, 1, FE_ATOMIC_RELEASE);
+}
+
+static void fe_job_check_stage_b(void* user_data) {
+    uint32_t expected = (uint32_t)(uintptr_t)user_data;
+    FE_JOB_CHECK(fe_atomic_load_u32(&s_stage_done, FE_ATOMIC_ACQUIRE) == expected);
+}
+
+static fe_job_counter_t s_overflow_counter = FE_JOB_COUNTER_INIT;
+static uint32_t         s_submitted; // Atomik; gönderen thread işini bitirince 1
+
+/**
+ * @brief Ana thread dışından, havuzu taşıracak kadar ana thread'e özel iş gönderir.
+ */
+static void fe_job_check_submit_main_only(void* user_data) {
+    (void)user_data;
+    FE_JOB_CHECK(fe_job_system_thread_index() == -1);
+    for (uint32_t i = 0; i < FE_JOB_CHECK_OVERFLOW_JOBS; ++i) {
+        s_decls[i].func = fe_job_check_main_only;
+        s_decls[i].user_data = (void*)(uintptr_t)i;
+        s_decls[i].main_thread_only = true;
+    }
+    FE_JOB_CHECK(fe_job_system_run(s_decls, FE_JOB_CHECK_OVERFLOW_JOBS, &s_overflow_counter));
+    fe_atomic_store_u32(&s_submitted, 1, FE_ATOMIC_RELEASE);
+}
+
+static void fe_job_check_reset_hits(void) {
+    for (uint32_t i = 0; i < FE_JOB_CHECK_OVERFLOW_JOBS; ++i) fe_atomic_store_u32(&s_hits[i], 0, FE_ATOMIC_RELAXED);
+}
+
+static void fe_job_check_expect_hits(uint32_t count) {
+    uint32_t wrong = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (fe_atomic_load_u32(&s_hits[i], FE_ATOMIC_RELAXED) != 1) wrong++;
+    }
+    FE_JOB_CHECK(wrong == 0);
+}
+
+static void fe_job_check_parallel(void) {
+    fe_job_check_reset_hits();
+    for (uint32_t i = 0; i < FE_JOB_CHECK_PARALLEL_JOBS; ++i) {
+        s_decls[i] = (fe_job_decl_t){ fe_job_check_hit, (void*)(uintptr_t)i, false };
+    }
+    fe_job_counter_t counter = FE_JOB_COUNTER_INIT;
+    FE_JOB_CHECK(fe_job_system_run(s_decls, FE_JOB_CHECK_PARALLEL_JOBS, &counter));
+    fe_job_system_wait_for_counter(&counter);
+    fe_job_check_expect_hits(FE_JOB_CHECK_PARALLEL_JOBS);
+}
+
+static void fe_job_check_dependencies(void) {
+    const uint32_t stage_count = 64;
+    fe_atomic_store_u32(&s_stage_done, 0, FE_ATOMIC_RELAXED);
+    fe_job_decl_t stage_a[64];
+    fe_job_decl_t stage_b[64];
+    for (uint32_t i = 0; i < stage_count; ++i) {
+        stage_a[i] = (fe_job_decl_t){ fe_job_check_stage_a, NULL, false };
+        stage_b[i] = (fe_job_decl_t){ fe_job_check_stage_b, (void*)(uintptr_t)stage_count, false };
+    }
+    fe_job_counter_t a = FE_JOB_COUNTER_INIT;
+    fe_job_counter_t b = FE_JOB_COUNTER_INIT;
+    FE_JOB_CHECK(fe_job_system_run(stage_a, stage_count, &a));
+    FE_JOB_CHECK(fe_job_system_run_after(stage_b, stage_count, &a, &b));
+    fe_job_system_wait_for_counter(&b);
+    FE_JOB_CHECK(fe_job_counter_is_done(&a));
+}
+
+static void fe_job_check_main_only_overflow(void) {
+    fe_job_check_reset_hits();
+    fe_atomic_store_u32(&s_wrong_thread, 0, FE_ATOMIC_RELAXED);
+    fe_atomic_store_u32(&s_submitted, 0, FE_ATOMIC_RELAXED);
+    fe_thread_t submitter;
+    if (!fe_thread_create(&submitter, fe_job_check_submit_main_only, NULL, "fe_job_check")) {
+        FE_JOB_CHECK(!"fe_thread_create failed");
+        return;
+    }
+    // Ana thread beklerken özel kuyruğu boşaltır; gönderen thread böylece yuva bulur
+    while (!fe_atomic_load_u32(&s_submitted, FE_ATOMIC_ACQUIRE)) {
+        fe_job_system_wait_for_counter(&s_overflow_counter);
+    }
+    fe_job_system_wait_for_counter(&s_overflow_counter);
+    fe_thread_join(&submitter);
+    fe_job_check_expect_hits(FE_JOB_CHECK_OVERFLOW_JOBS);
+    FE_JOB_CHECK(fe_atomic_load_u32(&s_wrong_thread, FE_ATOMIC_RELAXED) == 0);
+}
+
+static void fe_job_check_overflow(void) {
+    fe_job_check_reset_hits();
+    for (uint32_t i = 0; i < FE_JOB_CHECK_OVERFLOW_JOBS; ++i) {
+        s_decls[i] = (fe_job_decl_t){ fe_job_check_hit, (void*)(uintptr_t)i, false };
+    }
+    fe_job_counter_t counter = FE_JOB_COUNTER_INIT;
+    FE_JOB_CHECK(fe_job_system_run(s_decls, FE_JOB_CHECK_OVERFLOW_JOBS, &counter));
+    fe_job_system_wait_for_counter(&counter);
+    fe_job_check_expect_hits(FE_JOB_CHECK_OVERFLOW_JOBS);
+}
+
+int main(int argc, char** argv) {
+    uint32_t worker_count = argc > 1 ? (uint32_t)atoi(argv[1]) : 3;
+    uint32_t rounds = argc > 2 ? (uint32_t)atoi(argv[2]) : 20;
+    if (!fe_job_system_init(worker_count)) {
+        fprintf(stderr, "fe_job_system_init failed.\n");
+        return 1;
+    }
+    FE_JOB_CHECK(worker_count == 0 || fe_job_system_worker_count() <= worker_count); // 0: donanıma göre seçilir
+    FE_JOB_CHECK(fe_job_system_thread_index() == 0);
+
+    for (uint32_t round = 0; round < rounds; ++round) {
+        fe_job_check_parallel();
+        fe_job_check_dependencies();
+        fe_job_check_main_only_overflow();
+        fe_job_check_overflow();
+    }
+
+    fe_job_system_stats_t stats;
+    fe_job_system_get_stats(&stats);
+    FE_JOB_CHECK(stats.worker_count == fe_job_system_worker_count());
+    printf("workers=%u executed=%llu stolen=%llu\n", stats.worker_count,
+           (unsigned long long)stats.jobs_executed, (unsigned long long)stats.jobs_stolen);
+    fe_job_system_shutdown();
+
+    printf("%s (%u failure(s))\n", g_failures == 0 ? "OK" : "FAILED", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,455 @@
+// fe_log_decode: fe_log_binary_open ile yazılmış ikili log dosyasını metne veya JSON satırlarına çevirir.
+//
+// Kullanım:
+//   fe_log_decode [--json] <dosya.feblog>
+//
+// Metin çıktısı fe_logger'ın satır biçimine yakındır:
+//   [2025-01-01 12:00:00.123] [WARN ] (src/physics/fe_physics_manager.c:42): mesaj
+// JSON çıktısı satır başına bir nesnedir: {"ts":..., "level":..., "file":..., "line":..., "msg":...}
+
+#include "core/utils/fe_log_binary.h" // Dosya düzeni ve format ayrıştırıcısı için
+
+#include <stdio.h>  // FILE, fread, snprintf için
+#include <stdlib.h> // malloc, realloc, free için
+#include <string.h> // memcmp, memcpy, strcmp için
+#include <time.h>   // gmtime/localtime, strftime için
+
+/**
+ * @brief Dosyadan okunmuş bir çağrı noktası tanımı.
+ */
+typedef struct fe_log_decode_site {
+    bool     defined;
+    uint8_t  level;
+    uint32_t line;
+    char*    file;
+    char*    format;
+    uint32_t arg_count;
+    uint8_t  arg_types[FE_LOG_BINARY_MAX_ARGS]; // fe_log_arg_type_t, kodlayıcıdakiyle aynı sırada
+} fe_log_decode_site_t;
+
+/**
+ * @brief Tekrarlanan string argümanların yuvası (kodlayıcıdaki tablonun aynısı).
+ */
+typedef struct fe_log_decode_cached_string {
+    uint8_t length; // 0 ise boş yuva
+    char    text[FE_LOG_BINARY_CACHED_STRING_MAX];
+} fe_log_decode_cached_string_t;
+
+static fe_log_decode_site_t*         g_sites;
+static uint32_t                      g_site_capacity;
+static fe_log_decode_cached_string_t g_strings[FE_LOG_BINARY_STRING_SLOTS];
+
+// --- Okuma Yardımcıları ---
+
+static bool fe_log_decode_read(FILE* file, void* out, size_t size) {
+    return fread(out, 1, size, file) == size;
+}
+
+static inline uint16_t fe_log_decode_u16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t fe_log_decode_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint64_t fe_log_decode_u64(const uint8_t* p) {
+    return (uint64_t)fe_log_decode_u32(p) | ((uint64_t)fe_log_decode_u32(p + 4) << 32);
+}
+
+/**
+ * @brief Dosyadan bir varint okur.
+ * @return bool Dosya bitmeden ve 64 biti aşmadan okunduysa true.
+ */
+static bool fe_log_decode_read_varint(FILE* file, uint64_t* out_value) {
+    uint8_t bytes[FE_LOG_BINARY_MAX_VARINT];
+    for (size_t i = 0; i < sizeof(bytes); ++i) {
+        if (!fe_log_decode_read(file, &bytes[i], 1)) return false;
+        if (!(bytes[i] & 0x80)) {
+            return fe_log_varint_get(bytes, bytes + i + 1, out_value) != NULL;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief u16 uzunluk önekli bir string okur ve NUL ile sonlandırılmış kopyasını döndürür.
+ */
+static char* fe_log_decode_read_string(FILE* file) {
+    uint8_t length_bytes[2];
+    if (!fe_log_decode_read(file, length_bytes, 2)) return NULL;
+    uint16_t length = fe_log_decode_u16(length_bytes);
+    char* text = (char*)malloc((size_t)length + 1);
+    if (!text) return NULL;
+    if (!fe_log_decode_read(file, text, length)) {
+        free(text);
+        return NULL;
+    }
+    text[length] = '\0';
+    return text;
+}
+
+/**
+ * @brief Bir mesajın argümanlarını site'ın tiplerine göre dosyadan okur.
+ * String yuva referansları çözülür; çıktıda her string varint uzunluk + baytlar olarak yer alır.
+ *
+ * @param payload En az FE_LOG_BINARY_MAX_PAYLOAD bayt.
+ * @return bool Argümanlar eksiksiz ve geçerliyse true.
+ */
+static bool fe_log_decode_read_args(FILE* file, const fe_log_decode_site_t* site, uint8_t* payload, size_t* out_size) {
+    uint8_t* p = payload;
+    for (uint32_t i = 0; i < site->arg_count; ++i) {
+        uint64_t value;
+        if (!fe_log_decode_read_varint(file, &value)) return false;
+        if (site->arg_types[i] != FE_LOG_ARG_STRING) {
+            p = fe_log_varint_put(p, value);
+            continue;
+        }
+        if (value & 1u) {
+            // Daha önce yazılmış bir string'in yuvası
+            if (value >> 1 >= FE_LOG_BINARY_STRING_SLOTS) return false;
+            const fe_log_decode_cached_string_t* cached = &g_strings[value >> 1];
+            if (cached->length == 0) return false;
+            p = fe_log_varint_put(p, cached->length);
+            memcpy(p, cached->text, cached->length);
+            p += cached->length;
+            continue;
+        }
+        uint64_t length = value >> 1;
+        if (length > FE_LOG_BINARY_MAX_STRING) return false;
+        uint8_t* text = fe_log_varint_put(p, length);
+        if (!fe_log_decode_read(file, text, (size_t)length)) return false;
+        if (length > 0 && length <= FE_LOG_BINARY_CACHED_STRING_MAX) {
+            fe_log_decode_cached_string_t* cached = &g_strings[fe_log_string_slot((const char*)text, (size_t)length)];
+            cached->length = (uint8_t)length;
+            memcpy(cached->text, text, (size_t)length);
+        }
+        p = text + length;
+    }
+    *out_size = (size_t)(p - payload);
+    return true;
+}
+
+static const char* fe_log_decode_level_name(uint8_t level) {
+    switch (level) {
+        case FE_LOG_LEVEL_DEBUG:    return "DEBUG";
+        case FE_LOG_LEVEL_INFO:     return "INFO";
+        case FE_LOG_LEVEL_WARN:     return "WARN";
+        case FE_LOG_LEVEL_ERROR:    return "ERROR";
+        case FE_LOG_LEVEL_CRITICAL: return "CRIT";
+        default:                    return "UNKNOWN";
+    }
+}
+
+// --- Mesaj Oluşturma ---
+
+/**
+ * @brief Çıktı arabelleğine ekleme yapan küçük yardımcı; taşmada keser.
+ */
+typedef struct fe_log_decode_buffer {
+    char   data[8192];
+    size_t length;
+} fe_log_decode_buffer_t;
+
+static void fe_log_decode_append(fe_log_decode_buffer_t* buffer, const char* text, size_t length) {
+    size_t space = sizeof(buffer->data) - 1 - buffer->length;
+    if (length > space) length = space;
+    memcpy(buffer->data + buffer->length, text, length);
+    buffer->length += length;
+    buffer->data[buffer->length] = '\0';
+}
+
+/**
+ * @brief Tek bir belirteci, yazıldığı C tipine geri çevrilen değerle snprintf'e verir.
+ * '*' genişlik/hassasiyet argümanları belirtecin önünde ayrı int'ler olarak gelir.
+ */
+static int fe_log_decode_format_value(char* out, size_t size, const char* spec, const fe_log_format_spec_t* parsed,
+                                      const int* stars, uint32_t star_count, uint64_t value, const char* string) {
+#define FE_LOG_DECODE_CALL(arg) \
+    (star_count == 2 ? snprintf(out, size, spec, stars[0], stars[1], arg) : \
+     star_count == 1 ? snprintf(out, size, spec, stars[0], arg) : \
+                       snprintf(out, size, spec, arg))
+
+    switch (parsed->value_arg) {
+        case FE_LOG_ARG_INT:     return FE_LOG_DECODE_CALL((int)(int64_t)value);
+        case FE_LOG_ARG_LONG:    return FE_LOG_DECODE_CALL((long)(int64_t)value);
+        case FE_LOG_ARG_LLONG:   return FE_LOG_DECODE_CALL((long long)value);
+        case FE_LOG_ARG_SIZE:    return FE_LOG_DECODE_CALL((size_t)value);
+        case FE_LOG_ARG_INTMAX:  return FE_LOG_DECODE_CALL((intmax_t)value);
+        case FE_LOG_ARG_PTRDIFF: return FE_LOG_DECODE_CALL((ptrdiff_t)(int64_t)value);
+        case FE_LOG_ARG_POINTER: return FE_LOG_DECODE_CALL((void*)(uintptr_t)value);
+        case FE_LOG_ARG_STRING:  return FE_LOG_DECODE_CALL(string);
+        case FE_LOG_ARG_DOUBLE: {
+            double d;
+            memcpy(&d, &value, sizeof(d));
+            return FE_LOG_DECODE_CALL(d);
+        }
+        case FE_LOG_ARG_LDOUBLE: {
+            double d;
+            memcpy(&d, &value, sizeof(d));
+            return FE_LOG_DECODE_CALL((long double)d);
+        }
+        default: return snprintf(out, size, "%s", spec);
+    }
+#undef FE_LOG_DECODE_CALL
+}
+
+/**
+ * @brief Site'nin format string'ini, mesajın argüman baytlarıyla yeniden biçimlendirir.
+ * @return bool Argüman baytları format ile tutarlıysa true.
+ */
+static bool fe_log_decode_render(const fe_log_decode_site_t* site, const uint8_t* payload, size_t payload_size,
+                                 fe_log_decode_buffer_t* out) {
+    out->length = 0;
+    out->data[0] = '\0';
+    const uint8_t* p = payload;
+    const uint8_t* end = payload + payload_size;
+    uint32_t arg_index = 0;
+
+    const char* text = site->format;
+    fe_log_format_spec_t spec;
+    while (fe_log_format_next_spec(text, &spec)) {
+        // Belirteçten önceki düz metin ("%%" -> "%")
+        for (const char* c = text; c < spec.start; ++c) {
+            if (c[0] == '%' && c[1] == '%') ++c;
+            fe_log_decode_append(out, c, 1);
+        }
+        text = spec.end;
+
+        if (spec.value_arg == FE_LOG_ARG_NONE) {
+            fe_log_decode_append(out, spec.start, (size_t)(spec.end - spec.start));
+            continue;
+        }
+
+        int stars[2];
+        uint32_t star_count = 0;
+        fe_log_arg_type_t star_types[2] = { spec.width_arg, spec.precision_arg };
+        for (int s = 0; s < 2; ++s) {
+            if (star_types[s] == FE_LOG_ARG_NONE) continue;
+            uint64_t star;
+            if (arg_index++ >= FE_LOG_BINARY_MAX_ARGS || !(p = fe_log_varint_get(p, end, &star))) return false;
+            stars[star_count++] = (int)fe_log_zigzag_decode(star);
+        }
+        if (arg_index++ >= FE_LOG_BINARY_MAX_ARGS) {
+            // Kodlayıcı fazla argümanları yazmaz; belirteç olduğu gibi bırakılır
+            fe_log_decode_append(out, spec.start, (size_t)(spec.end - spec.start));
+            continue;
+        }
+
+        uint64_t value = 0;
+        char string[FE_LOG_BINARY_MAX_STRING + 1];
+        string[0] = '\0';
+        if (spec.value_arg == FE_LOG_ARG_STRING) {
+            uint64_t length;
+            if (!(p = fe_log_varint_get(p, end, &length))) return false;
+            if (length > FE_LOG_BINARY_MAX_STRING || (uint64_t)(end - p) < length) return false;
+            memcpy(string, p, (size_t)length);
+            string[length] = '\0';
+            p += length;
+        } else {
+            if (!(p = fe_log_varint_get(p, end, &value))) return false;
+            switch (spec.value_arg) {
+                case FE_LOG_ARG_SIZE:
+                case FE_LOG_ARG_POINTER:
+                    break; // İşaretsiz
+                case FE_LOG_ARG_DOUBLE:
+                case FE_LOG_ARG_LDOUBLE:
+                    value = fe_log_reverse_bytes(value);
+                    break;
+                default:
+                    value = (uint64_t)fe_log_zigzag_decode(value);
+                    break;
+            }
+        }
+
+        char spec_text[64];
+        size_t spec_length = (size_t)(spec.end - spec.start);
+        if (spec_length >= sizeof(spec_text) || (spec.value_arg == FE_LOG_ARG_POINTER && spec.end[-1] == 'n')) {
+            continue; // %n yalnızca tüketilir; aşırı uzun belirteçler yazılmaz
+        }
+        memcpy(spec_text, spec.start, spec_length);
+        spec_text[spec_length] = '\0';
+
+        char formatted[FE_LOG_BINARY_MAX_STRING + 256];
+        int written = fe_log_decode_format_value(formatted, sizeof(formatted), spec_text, &spec, stars, star_count, value, string);
+        if (written > 0) {
+            fe_log_decode_append(out, formatted, (size_t)written < sizeof(formatted) ? (size_t)written : sizeof(formatted) - 1);
+        }
+    }
+    for (const char* c = text; *c; ++c) {
+        if (c[0] == '%' && c[1] == '%') ++c;
+        fe_log_decode_append(out, c, 1);
+    }
+    return p == end;
+}
+
+// --- Çıktı ---
+
+static void fe_log_decode_print_json_string(const char* text) {
+    fputc('"', stdout);
+    for (const unsigned char* c = (const unsigned char*)text; *c; ++c) {
+        switch (*c) {
+            case '"':  fputs("\\\"", stdout); break;
+            case '\\': fputs("\\\\", stdout); break;
+            case '\n': fputs("\\n", stdout); break;
+            case '\r': fputs("\\r", stdout); break;
+            case '\t': fputs("\\t", stdout); break;
+            default:
+                if (*c < 0x20) printf("\\u%04x", *c);
+                else fputc(*c, stdout);
+                break;
+        }
+    }
+    fputc('"', stdout);
+}
+
+static void fe_log_decode_print(bool json, uint64_t open_wall_ns, uint64_t offset_ns,
+                                const fe_log_decode_site_t* site, const char* message) {
+    uint64_t wall_ns = open_wall_ns + offset_ns;
+    if (json) {
+        printf("{\"ts\":%llu.%09llu,\"level\":\"%s\",\"file\":",
+               (unsigned long long)(wall_ns / 1000000000ULL), (unsigned long long)(wall_ns % 1000000000ULL),
+               fe_log_decode_level_name(site->level));
+        fe_log_decode_print_json_string(site->file);
+        printf(",\"line\":%u,\"msg\":", site->line);
+        fe_log_decode_print_json_string(message);
+        fputs("}\n", stdout);
+        return;
+    }
+
+    time_t seconds = (time_t)(wall_ns / 1000000000ULL);
+    struct tm* tm_info = localtime(&seconds);
+    char time_str[32] = "?";
+    if (tm_info) strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S", tm_info);
+    printf("[%s.%03u] [%-5s] (%s:%u): %s\n", time_str, (unsigned)((wall_ns / 1000000ULL) % 1000ULL),
+           fe_log_decode_level_name(site->level), site->file, site->line, message);
+}
+
+// --- Ana Döngü ---
+
+static int fe_log_decode_file(const char* path, bool json) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "fe_log_decode: cannot open '%s'\n", path);
+        return 1;
+    }
+
+    uint8_t header[8 + 4 + 4 + 8];
+    if (!fe_log_decode_read(file, header, sizeof(header)) || memcmp(header, FE_LOG_BINARY_MAGIC, 8) != 0) {
+        fprintf(stderr, "fe_log_decode: '%s' is not a binary log file\n", path);
+        fclose(file);
+        return 1;
+    }
+    uint32_t version = fe_log_decode_u32(header + 8);
+    if (version != FE_LOG_BINARY_VERSION) {
+        fprintf(stderr, "fe_log_decode: unsupported version %u (expected %u)\n", version, FE_LOG_BINARY_VERSION);
+        fclose(file);
+        return 1;
+    }
+    uint64_t open_wall_ns = fe_log_decode_u64(header + 16);
+
+    int result = 0;
+    uint64_t message_count = 0;
+    uint64_t offset_ns = 0; // Açılıştan beri geçen süre (mesajlarda fark olarak saklanır)
+    static uint8_t payload[FE_LOG_BINARY_MAX_PAYLOAD];
+    memset(g_strings, 0, sizeof(g_strings));
+    fe_log_decode_buffer_t message;
+    uint8_t first;
+    while (fe_log_decode_read(file, &first, 1)) {
+        // Etiket varint'inin kalanı; tek baytlık etiketler (site kaydı, ilk 127 site) için okuma yapılmaz
+        uint64_t tag = first & 0x7F;
+        if (first & 0x80) {
+            uint64_t rest;
+            if (!fe_log_decode_read_varint(file, &rest) || rest > (UINT64_MAX >> 7)) { result = 2; break; }
+            tag |= rest << 7;
+        }
+        if (tag == FE_LOG_BINARY_RECORD_SITE) {
+            uint8_t fields[4 + 1 + 4];
+            if (!fe_log_decode_read(file, fields, sizeof(fields))) { result = 2; break; }
+            uint32_t id = fe_log_decode_u32(fields);
+            if (id >= FE_LOG_BINARY_MAX_SITES) {
+                fprintf(stderr, "fe_log_decode: site id %u is out of range (corrupt file?)\n", id);
+                result = 2;
+                break;
+            }
+            char* site_file = fe_log_decode_read_string(file);
+            char* site_format = site_file ? fe_log_decode_read_string(file) : NULL;
+            if (!site_format) { free(site_file); result = 2; break; }
+
+            if (id >= g_site_capacity) {
+                // id < FE_LOG_BINARY_MAX_SITES olduğundan kapasite taşmaz
+                uint32_t capacity = g_site_capacity ? g_site_capacity : 256;
+                while (capacity <= id) capacity *= 2;
+                fe_log_decode_site_t* sites = (fe_log_decode_site_t*)realloc(g_sites, sizeof(fe_log_decode_site_t) * capacity);
+                if (!sites) { free(site_file); free(site_format); result = 2; break; }
+                memset(sites + g_site_capacity, 0, sizeof(fe_log_decode_site_t) * (capacity - g_site_capacity));
+                g_sites = sites;
+                g_site_capacity = capacity;
+            }
+            fe_log_decode_site_t* site = &g_sites[id];
+            free(site->file);
+            free(site->format);
+            site->defined = true;
+            site->level = fields[4];
+            site->line = fe_log_decode_u32(fields + 5);
+            site->file = site_file;
+            site->format = site_format;
+            site->arg_count = fe_log_format_arg_types(site_format, site->arg_types);
+        } else {
+            // Argümanların uzunluğu yazılmadığından bilinmeyen bir site'tan sonra devam edilemez
+            uint64_t id = tag - FE_LOG_BINARY_RECORD_MESSAGE;
+            if (id >= g_site_capacity || !g_sites[id].defined) {
+                fprintf(stderr, "fe_log_decode: message references unknown site %llu at offset %ld\n",
+                        (unsigned long long)id, ftell(file));
+                result = 2;
+                break;
+            }
+            uint64_t delta_ns;
+            size_t payload_size;
+            if (!fe_log_decode_read_varint(file, &delta_ns) ||
+                !fe_log_decode_read_args(file, &g_sites[id], payload, &payload_size)) {
+                fprintf(stderr, "fe_log_decode: invalid arguments for site %llu at offset %ld\n",
+                        (unsigned long long)id, ftell(file));
+                result = 2;
+                break;
+            }
+            offset_ns += delta_ns;
+            if (!fe_log_decode_render(&g_sites[id], payload, payload_size, &message)) {
+                fprintf(stderr, "fe_log_decode: argument bytes do not match format of site %llu\n", (unsigned long long)id);
+                result = 2;
+            }
+            fe_log_decode_print(json, open_wall_ns, offset_ns, &g_sites[id], message.data);
+            message_count++;
+        }
+    }
+    if (result == 2 && !feof(file)) {
+        fprintf(stderr, "fe_log_decode: stopped after %llu message(s)\n", (unsigned long long)message_count);
+    } else if (result == 2) {
+        fprintf(stderr, "fe_log_decode: file is truncated (%llu message(s) decoded)\n", (unsigned long long)message_count);
+    }
+
+    fclose(file);
+    for (uint32_t i = 0; i < g_site_capacity; ++i) {
+        free(g_sites[i].file);
+        free(g_sites[i].format);
+    }
+    free(g_sites);
+    g_sites = NULL;
+    g_site_capacity = 0;
+    return result;
+}
+
+int main(int argc, char** argv) {
+    bool json = false;
+    const char* path = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (!path) path = argv[i];
+        else { path = NULL; break; } // Fazla argüman
+    }
+    if (!path) {
+        fprintf(stderr, "Usage: %s [--json] <file>\n", argc > 0 ? argv[0] : "fe_log_decode");
+        return 1;
+    }
+    return fe_log_decode_file(path, json);
+}
@@ -0,0 +1,398 @@
+// fe_pak_build: Bir dizindeki tüm dosyaları tek bir pak arşivinde toplar (bkz. platform/fe_pak.h).
+//
+// Kullanım:
+//   fe_pak_build [--lz4 | --zstd] [--list] <çıktı.pak> <girdi_dizini>
+//
+// - Yollar girdi dizinine göreli ve '/' ayraçlı saklanır: assets/tex/a.png -> "tex/a.png".
+// - --lz4 / --zstd ile her dosya ayrı sıkıştırılır; en az %10 kazanç sağlamayan dosyalar
+//   sıkıştırılmadan (sıfır kopyalı okunabilir) saklanır. --zstd yalnızca FE_WITH_ZSTD ile
+//   derlenmiş araçta kullanılabilir.
+// - Çıktı arşivi girdi dizininin içindeyse kendisi pakete eklenmez.
+// - --list mevcut bir arşivin içeriğini listeler: fe_pak_build --list <arşiv.pak>
+//
+// Derleme: src/utils/fe_lz4.c ile birlikte derlenir (--list için src/platform/fe_pak.c ve bağımlılıkları).
+
+#include "platform/fe_pak.h"     // Dosya düzeni ve yol hash'i için
+#include "core/utils/fe_lz4.h"   // LZ4 sıkıştırma için
+
+#include <stdio.h>  // FILE, fopen, fwrite için
+#include <stdlib.h> // malloc, realloc, free, qsort için
+#include <string.h> // strcmp, strlen, memcpy için
+
+#ifdef _WIN32
+#include <windows.h> // FindFirstFileA, FindNextFileA için
+#else
+#include <dirent.h>   // opendir, readdir için
+#include <sys/stat.h> // stat için
+#endif
+
+#ifdef FE_WITH_ZSTD
+#include <zstd.h> // ZSTD_compress için
+#endif
+
+// Sıkıştırmanın tutulması için saklanan boyutun orijinale en fazla oranı
+#define FE_PAK_BUILD_MIN_SAVING 0.9
+
+/**
+ * @brief Arşive eklenecek bir dosya.
+ */
+typedef struct fe_pak_build_file {
+    char*    path;         // Diskteki yol
+    char*    name;         // Arşiv içi yol
+    uint64_t hash;
+    uint64_t size;
+    uint64_t stored_size;
+    uint64_t offset;
+    uint8_t  compression;
+} fe_pak_build_file_t;
+
+static fe_pak_build_file_t* g_files;
+static uint32_t             g_file_count;
+static uint32_t             g_file_capacity;
+
+// Çıktı arşivi girdi dizinindeyse (önceki bir çalıştırmadan) kendisini paketlememek için kimliği
+#ifdef _WIN32
+static char  g_output_full_path[MAX_PATH];
+#else
+static bool  g_output_exists;
+static dev_t g_output_device;
+static ino_t g_output_inode;
+#endif
+
+// --- Dizin Gezintisi ---
+
+/**
+ * @brief Çıktı dosyasının kimliğini taramadan önce kaydeder. Dosya henüz yoksa taramada da
+ * bulunamaz; yazma ancak taramadan sonra başlar.
+ */
+static void fe_pak_build_remember_output(const char* output_path) {
+#ifdef _WIN32
+    DWORD length = GetFullPathNameA(output_path, MAX_PATH, g_output_full_path, NULL);
+    if (length == 0 || length >= MAX_PATH) g_output_full_path[0] = '\0';
+#else
+    struct stat st;
+    g_output_exists = stat(output_path, &st) == 0;
+    if (g_output_exists) {
+        g_output_device = st.st_dev;
+        g_output_inode = st.st_ino;
+    }
+#endif
+}
+
+static char* fe_pak_build_strdup(const char* s) {
+    size_t length = strlen(s) + 1;
+    char* copy = (char*)malloc(length);
+    if (copy) memcpy(copy, s, length);
+    return copy;
+}
+
+static bool fe_pak_build_add(const char* disk_path, const char* name) {
+    if (g_file_count == g_file_capacity) {
+        uint32_t capacity = g_file_capacity ? g_file_capacity * 2 : 256;
+        fe_pak_build_file_t* files = (fe_pak_build_file_t*)realloc(g_files, capacity * sizeof(fe_pak_build_file_t));
+        if (!files) return false;
+        g_files = files;
+        g_file_capacity = capacity;
+    }
+    if (strlen(name) > UINT16_MAX) {
+        fprintf(stderr, "fe_pak_build: path too long: %s\n", name);
+        return false;
+    }
+    fe_pak_build_file_t* file = &g_files[g_file_count];
+    memset(file, 0, sizeof(*file));
+    file->path = fe_pak_build_strdup(disk_path);
+    file->name = fe_pak_build_strdup(name);
+    if (!file->path || !file->name) return false;
+    file->hash = fe_pak_hash_path(name);
+    g_file_count++;
+    return true;
+}
+
+/**
+ * @brief dir_path altındaki dosyaları özyinelemeli ekler. prefix arşiv içi yol önekidir ("" veya "a/b/").
+ */
+static bool fe_pak_build_scan(const char* dir_path, const char* prefix) {
+    char disk_path[4096];
+    char name[4096];
+#ifdef _WIN32
+    char pattern[4096];
+    snprintf(pattern, sizeof(pattern), "%s\\*", dir_path);
+    WIN32_FIND_DATAA data;
+    HANDLE find = FindFirstFileA(pattern, &data);
+    if (find == INVALID_HANDLE_VALUE) {
+        fprintf(stderr, "fe_pak_build: cannot open directory %s\n", dir_path);
+        return false;
+    }
+    bool ok = true;
+    do {
+        if (strcmp(data.cFileName, ".") == 0 || strcmp(data.cFileName, "..") == 0) continue;
+        snprintf(disk_path, sizeof(disk_path), "%s\\%s", dir_path, data.cFileName);
+        snprintf(name, sizeof(name), "%s%s", prefix, data.cFileName);
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            strncat(name, "/", sizeof(name) - strlen(name) - 1);
+            ok = fe_pak_build_scan(disk_path, name);
+        } else {
+            char full_path[MAX_PATH];
+            DWORD length = GetFullPathNameA(disk_path, MAX_PATH, full_path, NULL);
+            if (g_output_full_path[0] != '\0' && length > 0 && length < MAX_PATH &&
+                _stricmp(full_path, g_output_full_path) == 0) {
+                continue; // Çıktı arşivinin kendisi
+            }
+            ok = fe_pak_build_add(disk_path, name);
+        }
+    } while (ok && FindNextFileA(find, &data));
+    FindClose(find);
+    return ok;
+#else
+    DIR* dir = opendir(dir_path);
+    if (!dir) {
+        fprintf(stderr, "fe_pak_build: cannot open directory %s\n", dir_path);
+        return false;
+    }
+    bool ok = true;
+    struct dirent* item;
+    while (ok && (item = readdir(dir)) != NULL) {
+        if (strcmp(item->d_name, ".") == 0 || strcmp(item->d_name, "..") == 0) continue;
+        snprintf(disk_path, sizeof(disk_path), "%s/%s", dir_path, item->d_name);
+        snprintf(name, sizeof(name), "%s%s", prefix, item->d_name);
+        struct stat st;
+        if (stat(disk_path, &st) != 0) {
+            fprintf(stderr, "fe_pak_build: cannot stat %s\n", disk_path);
+            ok = false;
+        } else if (S_ISDIR(st.st_mode)) {
+            strncat(name, "/", sizeof(name) - strlen(name) - 1);
+            ok = fe_pak_build_scan(disk_path, name);
+        } else if (S_ISREG(st.st_mode)) {
+            if (g_output_exists && st.st_dev == g_output_device && st.st_ino == g_output_inode) continue; // Çıktı arşivinin kendisi
+            ok = fe_pak_build_add(disk_path, name);
+        }
+    }
+    closedir(dir);
+    return ok;
+#endif
+}
+
+static int fe_pak_build_compare(const void* a, const void* b) {
+    const fe_pak_build_file_t* fa = (const fe_pak_build_file_t*)a;
+    const fe_pak_build_file_t* fb = (const fe_pak_build_file_t*)b;
+    if (fa->hash != fb->hash) return fa->hash < fb->hash ? -1 : 1;
+    return strcmp(fa->name, fb->name);
+}
+
+// --- Yazma ---
+
+static uint8_t* fe_pak_build_read_file(const char* path, uint64_t* out_size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+    uint8_t* data = NULL;
+    size_t size = 0;
+    size_t capacity = 0;
+    for (;;) {
+        if (size == capacity) {
+            capacity = capacity ? capacity * 2 : 65536;
+            uint8_t* grown = (uint8_t*)realloc(data, capacity);
+            if (!grown) {
+                free(data);
+                fclose(file);
+                return NULL;
+            }
+            data = grown;
+        }
+        size_t got = fread(data + size, 1, capacity - size, file);
+        size += got;
+        if (got == 0) break;
+    }
+    bool failed = ferror(file) != 0;
+    fclose(file);
+    if (failed) {
+        free(data);
+        return NULL;
+    }
+    *out_size = size;
+    return data;
+}
+
+/**
+ * @brief Girdiyi istenen yöntemle sıkıştırır. Kazanç yetersizse NONE'a döner.
+ * @return const uint8_t* Saklanacak veri (data veya scratch).
+ */
+static const uint8_t* fe_pak_build_compress(fe_pak_build_file_t* file, const uint8_t* data, fe_pak_compression_t method,
+                                            uint8_t** scratch, size_t* scratch_capacity) {
+    file->compression = FE_PAK_COMPRESSION_NONE;
+    file->stored_size = file->size;
+    if (method == FE_PAK_COMPRESSION_NONE || file->size < 64) return data;
+
+    size_t bound = fe_lz4_compress_bound((size_t)file->size);
+#ifdef FE_WITH_ZSTD
+    if (method == FE_PAK_COMPRESSION_ZSTD) bound = ZSTD_compressBound((size_t)file->size);
+#endif
+    if (bound > *scratch_capacity) {
+        uint8_t* grown = (uint8_t*)realloc(*scratch, bound);
+        if (!grown) return data;
+        *scratch = grown;
+        *scratch_capacity = bound;
+    }
+
+    size_t compressed = 0;
+    if (method == FE_PAK_COMPRESSION_LZ4) {
+        compressed = fe_lz4_compress(data, (size_t)file->size, *scratch, bound);
+    }
+#ifdef FE_WITH_ZSTD
+    else if (method == FE_PAK_COMPRESSION_ZSTD) {
+        compressed = ZSTD_compress(*scratch, bound, data, (size_t)file->size, 19);
+        if (ZSTD_isError(compressed)) compressed = 0;
+    }
+#endif
+    if (compressed == 0 || (double)compressed > (double)file->size * FE_PAK_BUILD_MIN_SAVING) return data;
+    file->compression = (uint8_t)method;
+    file->stored_size = compressed;
+    return *scratch;
+}
+
+static bool fe_pak_build_pad(FILE* out, uint64_t* position, uint64_t alignment) {
+    static const uint8_t zeros[FE_PAK_ALIGNMENT];
+    uint64_t padding = (alignment - (*position % alignment)) % alignment;
+    if (padding && fwrite(zeros, 1, (size_t)padding, out) != padding) return false;
+    *position += padding;
+    return true;
+}
+
+static int fe_pak_build_write(const char* output_path, fe_pak_compression_t method) {
+    qsort(g_files, g_file_count, sizeof(fe_pak_build_file_t), fe_pak_build_compare);
+
+    FILE* out = fopen(output_path, "wb");
+    if (!out) {
+        fprintf(stderr, "fe_pak_build: cannot create %s\n", output_path);
+        return 1;
+    }
+
+    fe_pak_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FE_PAK_MAGIC, sizeof(header.magic));
+    header.version = FE_PAK_VERSION;
+    header.entry_count = g_file_count;
+    bool ok = fwrite(&header, sizeof(header), 1, out) == 1;
+    uint64_t position = sizeof(header);
+
+    uint8_t* scratch = NULL;
+    size_t scratch_capacity = 0;
+    uint64_t total_size = 0;
+    uint64_t total_stored = 0;
+    for (uint32_t i = 0; ok && i < g_file_count; ++i) {
+        fe_pak_build_file_t* file = &g_files[i];
+        uint8_t* data = fe_pak_build_read_file(file->path, &file->size);
+        if (!data) {
+            fprintf(stderr, "fe_pak_build: cannot read %s\n", file->path);
+            ok = false;
+            break;
+        }
+        const uint8_t* stored = fe_pak_build_compress(file, data, method, &scratch, &scratch_capacity);
+        ok = fe_pak_build_pad(out, &position, FE_PAK_ALIGNMENT);
+        file->offset = position;
+        if (ok && file->stored_size && fwrite(stored, 1, (size_t)file->stored_size, out) != file->stored_size) ok = false;
+        position += file->stored_size;
+        total_size += file->size;
+        total_stored += file->stored_size;
+        free(data);
+    }
+    free(scratch);
+
+    // TOC ve yol tablosu
+    uint32_t name_offset = 0;
+    if (ok) ok = fe_pak_build_pad(out, &position, 8);
+    header.toc_offset = position;
+    for (uint32_t i = 0; ok && i < g_file_count; ++i) {
+        const fe_pak_build_file_t* file = &g_files[i];
+        fe_pak_entry_t entry;
+        memset(&entry, 0, sizeof(entry));
+        entry.path_hash = file->hash;
+        entry.offset = file->offset;
+        entry.stored_size = file->stored_size;
+        entry.size = file->size;
+        entry.name_offset = name_offset;
+        entry.name_length = (uint16_t)strlen(file->name);
+        entry.compression = file->compression;
+        ok = fwrite(&entry, sizeof(entry), 1, out) == 1;
+        position += sizeof(entry);
+        name_offset += entry.name_length + 1u;
+    }
+    header.names_offset = position;
+    header.names_size = name_offset;
+    for (uint32_t i = 0; ok && i < g_file_count; ++i) {
+        size_t length = strlen(g_files[i].name) + 1;
+        ok = fwrite(g_files[i].name, 1, length, out) == length;
+        position += length;
+    }
+
+    // Başlığı gerçek konumlarla yeniden yaz
+    if (ok) ok = fseek(out, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, out) == 1;
+    if (fclose(out) != 0) ok = false;
+    if (!ok) {
+        fprintf(stderr, "fe_pak_build: failed writing %s\n", output_path);
+        remove(output_path);
+        return 1;
+    }
+
+    printf("%s: %u file(s), %llu byte(s) -> %llu stored, archive %llu byte(s)\n", output_path, g_file_count,
+           (unsigned long long)total_size, (unsigned long long)total_stored, (unsigned long long)position);
+    return 0;
+}
+
+// --- Listeleme ---
+
+static int fe_pak_build_list(const char* pak_path) {
+    fe_pak_t* pak = fe_pak_open(pak_path);
+    if (!pak) {
+        fprintf(stderr, "fe_pak_build: cannot open %s\n", pak_path);
+        return 1;
+    }
+    static const char* compression_names[] = { "none", "lz4", "zstd" };
+    for (uint32_t i = 0; i < fe_pak_entry_count(pak); ++i) {
+        const fe_pak_entry_t* entry = fe_pak_entry_at(pak, i);
+        printf("%016llx %10llu %10llu %-4s %s\n", (unsigned long long)entry->path_hash,
+               (unsigned long long)entry->size, (unsigned long long)entry->stored_size,
+               entry->compression <= FE_PAK_COMPRESSION_ZSTD ? compression_names[entry->compression] : "?",
+               fe_pak_entry_path(pak, entry));
+    }
+    fe_pak_close(pak);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    fe_pak_compression_t method = FE_PAK_COMPRESSION_NONE;
+    bool list = false;
+    int arg = 1;
+    for (; arg < argc && argv[arg][0] == '-'; ++arg) {
+        if (strcmp(argv[arg], "--lz4") == 0) {
+            method = FE_PAK_COMPRESSION_LZ4;
+        } else if (strcmp(argv[arg], "--zstd") == 0) {
+#ifdef FE_WITH_ZSTD
+            method = FE_PAK_COMPRESSION_ZSTD;
+#else
+            fprintf(stderr, "fe_pak_build: built without zstd support (define FE_WITH_ZSTD)\n");
+            return 2;
+#endif
+        } else if (strcmp(argv[arg], "--list") == 0) {
+            list = true;
+        } else {
+            break;
+        }
+    }
+    if (list && argc - arg == 1) return fe_pak_build_list(argv[arg]);
+    if (list || argc - arg != 2) {
+        fprintf(stderr, "usage: %s [--lz4 | --zstd] <output.pak> <input_dir>\n"
+                        "       %s --list <archive.pak>\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    fe_pak_build_remember_output(argv[arg]);
+    if (!fe_pak_build_scan(argv[arg + 1], "")) return 1;
+    int result = fe_pak_build_write(argv[arg], method);
+
+    for (uint32_t i = 0; i < g_file_count; ++i) {
+        free(g_files[i].path);
+        free(g_files[i].name);
+    }
+    free(g_files);
+    return result;
+}
@@ -0,0 +1,178 @@
+// fe_pipeline_cache_check: Pipeline tekilleştirme önbelleğini (graphics/pipeline/fe_pipeline_cache.h)
+// sahte pipeline'larla çalıştırır ve sözleşmelerini denetler.
+//
+// Kullanım:
+//   fe_pipeline_cache_check [pipeline_sayısı]
+//
+// - Varsayılan: 1000 farklı pipeline (kova tablosunun birkaç kez büyümesi için yeterli).
+// - Tekilleştirme: eşit anahtarlar aynı pipeline'ı ve hash'i döndürmeli, oluşturma yalnızca bir kez
+//   çağrılmalıdır. -0.0 ile 0.0 aynı, NULL string ile boş string farklı anahtar olmalıdır.
+// - Büyüme: tablo büyüdükten sonra da tüm pipeline'lar kendi anahtarlarıyla bulunmalıdır.
+// - Bırakma: pipeline son referansta tam bir kez yok edilmeli, önbellekte olmayan pipeline'ın
+//   bırakılması reddedilmeli, kapanış kalan pipeline'ları yok etmelidir.
+// - Hata bulunursa çıkış kodu 1'dir.
+//
+// Derleme: src/graphics/fe_pipeline_cache.c, src/utils/fe_hash.c ve bağımlılıklarıyla birlikte
+// derlenir; grafik API'si gerekmez. Sızıntıları yakalamak için GCC/Clang'da -fsanitize=address ile
+// çalıştırılmalıdır.
+
+#include "graphics/pipeline/fe_pipeline_cache.h" // Sınanan önbellek
+
+#include <stdio.h>  // printf için
+#include <stdlib.h> // malloc, free, strtoul için
+
+#define FE_PIPELINE_CHECK_CONTEXT ((void*)0x1234)
+
+static int      g_created;
+static int      g_destroyed;
+static uint32_t g_failures;
+
+#define FE_PIPELINE_CHECK(condition)                                                  \
+    do {                                                                              \
+        if (!(condition)) {                                                           \
+            fprintf(stderr, "FAIL: %s (line %d)\n", #condition, __LINE__);            \
+            g_failures++;                                                             \
+        }                                                                             \
+    } while (0)
+
+/**
+ * @brief Sahte pipeline oluşturur; user_data NULL değilse oluşturma başarısız sayılır.
+ */
+static void* fe_pipeline_check_create(const void* key, size_t key_size, void* user_data) {
+    (void)key;
+    (void)key_size;
+    if (user_data) return NULL;
+    g_created++;
+    return malloc(16);
+}
+
+static void fe_pipeline_check_destroy(void* pipeline, void* context) {
+    FE_PIPELINE_CHECK(context == FE_PIPELINE_CHECK_CONTEXT);
+    g_destroyed++;
+    free(pipeline);
+}
+
+static void fe_pipeline_check_make_key(fe_pipeline_key_t* key, uint32_t id, float value, const char* path) {
+    fe_pipeline_key_init(key);
+    fe_pipeline_key_add_u32(key, id);
+    fe_pipeline_key_add_float(key, value);
+    fe_pipeline_key_add_string(key, path);
+}
+
+static void fe_pipeline_check_dedup(fe_pipeline_cache_t* cache) {
+    fe_pipeline_key_t positive, negative, null_path, empty_path;
+    fe_pipeline_check_make_key(&positive, 1, 0.0f, "a.spv");
+    fe_pipeline_check_make_key(&negative, 1, -0.0f, "a.spv");
+    fe_pipeline_check_make_key(&null_path, 1, 0.0f, NULL);
+    fe_pipeline_check_make_key(&empty_path, 1, 0.0f, "");
+
+    int created = g_created;
+    int destroyed = g_destroyed;
+    uint64_t h1 = 0, h2 = 0, h3 = 0, h4 = 0;
+    void* p1 = fe_pipeline_cache_acquire(cache, &positive, fe_pipeline_check_create, NULL, &h1);
+    void* p2 = fe_pipeline_cache_acquire(cache, &negative, fe_pipeline_check_create, NULL, &h2);
+    void* p3 = fe_pipeline_cache_acquire(cache, &null_path, fe_pipeline_check_create, NULL, &h3);
+    void* p4 = fe_pipeline_cache_acquire(cache, &empty_path, fe_pipeline_check_create, NULL, &h4);
+    FE_PIPELINE_CHECK(p1 != NULL && p1 == p2 && h1 == h2);
+    FE_PIPELINE_CHECK(p3 != NULL && p4 != NULL && p3 != p1 && p4 != p1 && p3 != p4);
+    FE_PIPELINE_CHECK(g_created == created + 3);
+
+    // Başarısız oluşturma önbelleğe girmez; aynı anahtar sonra yeniden denenebilir
+    fe_pipeline_key_t failing;
+    fe_pipeline_check_make_key(&failing, 9, 1.0f, "x.spv");
+    FE_PIPELINE_CHECK(fe_pipeline_cache_acquire(cache, &failing, fe_pipeline_check_create, (void*)1, NULL) == NULL);
+    uint64_t hf = 0;
+    void* pf = fe_pipeline_cache_acquire(cache, &failing, fe_pipeline_check_create, NULL, &hf);
+    FE_PIPELINE_CHECK(pf != NULL);
+
+    // İki referanslı pipeline ikinci bırakmada yok edilir
+    FE_PIPELINE_CHECK(fe_pipeline_cache_release(cache, h1, p1));
+    FE_PIPELINE_CHECK(g_destroyed == destroyed);
+    FE_PIPELINE_CHECK(fe_pipeline_cache_release(cache, h2, p2));
+    FE_PIPELINE_CHECK(g_destroyed == destroyed + 1);
+    FE_PIPELINE_CHECK(!fe_pipeline_cache_release(cache, h2, p2));
+
+    FE_PIPELINE_CHECK(fe_pipeline_cache_release(cache, h3, p3));
+    FE_PIPELINE_CHECK(fe_pipeline_cache_release(cache, h4, p4));
+    FE_PIPELINE_CHECK(fe_pipeline_cache_release(cache, hf, pf));
+    FE_PIPELINE_CHECK(g_destroyed == destroyed + 4);
+
+    fe_pipeline_key_destroy(&positive);
+    fe_pipeline_key_destroy(&negative);
+    fe_pipeline_key_destroy(&null_path);
+    fe_pipeline_key_destroy(&empty_path);
+    fe_pipeline_key_destroy(&failing);
+}
+
+static void fe_pipeline_check_growth(fe_pipeline_cache_t* cache, uint32_t count) {
+    void** pipelines = (void**)malloc(count * sizeof(void*));
+    uint64_t* hashes = (uint64_t*)malloc(count * sizeof(uint64_t));
+    if (!pipelines || !hashes) {
+        FE_PIPELINE_CHECK(!"out of memory");
+        free(pipelines);
+        free(hashes);
+        return;
+    }
+    uint32_t initial_buckets = cache->bucket_count;
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_pipeline_key_t key;
+        fe_pipeline_check_make_key(&key, 100 + i, 1.5f, "g.spv");
+        pipelines[i] = fe_pipeline_cache_acquire(cache, &key, fe_pipeline_check_create, NULL, &hashes[i]);
+        fe_pipeline_key_destroy(&key);
+    }
+    FE_PIPELINE_CHECK(count <= initial_buckets || cache->bucket_count > initial_buckets);
+
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_pipeline_key_t key;
+        fe_pipeline_check_make_key(&key, 100 + i, 1.5f, "g.spv");
+        if (pipelines[i] == NULL || fe_pipeline_cache_acquire(cache, &key, fe_pipeline_check_create, NULL, NULL) != pipelines[i]) {
+            mismatches++;
+        }
+        fe_pipeline_key_destroy(&key);
+    }
+    FE_PIPELINE_CHECK(mismatches == 0);
+
+    fe_pipeline_cache_stats_t stats;
+    fe_pipeline_cache_get_stats(cache, &stats);
+    FE_PIPELINE_CHECK(stats.live_pipelines == count);
+
+    // İlk yarı tamamen bırakılır, ikinci yarıda birer referans kapanışa kalır
+    int destroyed = g_destroyed;
+    for (uint32_t i = 0; i < count; ++i) {
+        fe_pipeline_cache_release(cache, hashes[i], pipelines[i]);
+        if (i < count / 2) fe_pipeline_cache_release(cache, hashes[i], pipelines[i]);
+    }
+    FE_PIPELINE_CHECK(g_destroyed == destroyed + (int)(count / 2));
+    fe_pipeline_cache_get_stats(cache, &stats);
+    FE_PIPELINE_CHECK(stats.live_pipelines == count - count / 2);
+
+    free(pipelines);
+    free(hashes);
+}
+
+int main(int argc, char** argv) {
+    uint32_t count = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 1000;
+    if (count == 0) {
+        fprintf(stderr, "Usage: %s [pipeline_count]\n", argv[0]);
+        return 1;
+    }
+
+    fe_pipeline_cache_t cache;
+    if (!fe_pipeline_cache_init(&cache, fe_pipeline_check_destroy, FE_PIPELINE_CHECK_CONTEXT)) {
+        fprintf(stderr, "fe_pipeline_cache_init failed.\n");
+        return 1;
+    }
+    fe_pipeline_check_dedup(&cache);
+    fe_pipeline_check_growth(&cache, count);
+
+    fe_pipeline_cache_stats_t stats;
+    fe_pipeline_cache_get_stats(&cache, &stats);
+    printf("buckets=%u live=%u hits=%llu misses=%llu create_failures=%llu\n", cache.bucket_count, stats.live_pipelines,
+           (unsigned long long)stats.hits, (unsigned long long)stats.misses, (unsigned long long)stats.create_failures);
+    fe_pipeline_cache_shutdown(&cache);
+    FE_PIPELINE_CHECK(g_destroyed == g_created);
+
+    printf("%s (%u failure(s))\n", g_failures == 0 ? "OK" : "FAILED", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
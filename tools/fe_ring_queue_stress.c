@@ -0,0 +1,214 @@
+// fe_ring_queue_stress: SPSC ve MPMC kuyruklarını (core/containers/fe_ring_queue.h) çok thread'li
+// olarak zorlar ve veri bütünlüğünü doğrular.
+//
+// Kullanım:
+//   fe_ring_queue_stress [mesaj_sayısı] [üretici_tüketici_sayısı]
+//
+// - Varsayılanlar: 2000000 mesaj, 4 üretici + 4 tüketici.
+// - SPSC: tek üretici sıralı mesajlar yazar; tüketici sırayı ve içeriği denetler.
+// - MPMC: her üretici kendi kimliğiyle sıralı mesajlar yazar; tüketiciler içeriği, her üreticinin
+//   mesajlarının kendi aralarında sıralı geldiğini ve toplamın eksiksiz olduğunu denetler.
+// - Kuyruklar küçük tutulur; böylece dolu/boş sınırları sürekli zorlanır.
+// - Hata bulunursa çıkış kodu 1'dir.
+//
+// Derleme: src/data_structures/fe_ring_queue.c ve src/platform/fe_thread.c ile birlikte derlenir.
+// Sıralama hatalarını yakalamak için GCC/Clang'da -fsanitize=thread ile çalıştırılmalıdır; MSVC
+// ARM64'te fe_atomic.h'nin bariyerlerini doğrulamak için de kullanılır.
+
+#include "core/containers/fe_ring_queue.h" // Sınanan kuyruklar
+#include "core/utils/fe_atomic.h"          // Paylaşılan sayaçlar için
+#include "platform/fe_thread.h"            // fe_thread_create, fe_thread_join için
+
+#include <stdio.h>  // printf için
+#include <stdlib.h> // strtoull, atoi için
+#include <string.h> // memset için
+
+#define FE_RING_STRESS_MAX_THREADS 16
+#define FE_RING_STRESS_SPSC_CAPACITY 1000 // 2'nin kuvveti değil: yuvarlamayı da sınar
+#define FE_RING_STRESS_MPMC_CAPACITY 256
+
+/**
+ * @brief Kuyruktan geçen mesaj. check, yırtık (kısmen yazılmış) okumaları yakalar.
+ */
+typedef struct fe_ring_stress_msg {
+    uint64_t producer;
+    uint64_t sequence;
+    uint64_t check;
+} fe_ring_stress_msg_t;
+
+/**
+ * @brief Tüm thread'lerin paylaştığı test durumu.
+ */
+typedef struct fe_ring_stress_state {
+    fe_spsc_queue_t spsc;
+    fe_mpmc_queue_t mpmc;
+    uint64_t        message_count;
+    uint32_t        thread_count;
+    uint64_t        per_producer;
+    uint64_t        consumed;  // Atomik: MPMC'den alınan toplam mesaj
+    uint64_t        sum;       // Atomik: alınan sıra numaralarının toplamı
+    uint32_t        failures;  // Atomik
+} fe_ring_stress_state_t;
+
+/**
+ * @brief Bir thread'in görevi ve kimliği.
+ */
+typedef struct fe_ring_stress_worker {
+    fe_ring_stress_state_t* state;
+    uint32_t                index;
+} fe_ring_stress_worker_t;
+
+static uint64_t fe_ring_stress_check(uint64_t producer, uint64_t sequence) {
+    return (producer * 0x9E3779B97F4A7C15ull) ^ (sequence * 0xC2B2AE3D27D4EB4Full) ^ 0x5A5A5A5A5A5A5A5Aull;
+}
+
+static void fe_ring_stress_fail(fe_ring_stress_state_t* state, const char* what, uint64_t producer, uint64_t sequence) {
+    if (fe_atomic_fetch_add_u32(&state->failures, 1, FE_ATOMIC_RELAXED) < 10) {
+        fprintf(stderr, "FAIL: %s (producer %llu, sequence %llu)\n", what,
+                (unsigned long long)producer, (unsigned long long)sequence);
+    }
+}
+
+static void fe_ring_stress_spsc_producer(void* user_data) {
+    fe_ring_stress_state_t* state = (fe_ring_stress_state_t*)user_data;
+    for (uint64_t i = 0; i < state->message_count;) {
+        fe_ring_stress_msg_t msg = { 0, i, fe_ring_stress_check(0, i) };
+        if (fe_spsc_queue_push(&state->spsc, &msg)) {
+            i++;
+        } else {
+            fe_atomic_cpu_relax();
+        }
+    }
+}
+
+static void fe_ring_stress_mpmc_producer(void* user_data) {
+    fe_ring_stress_worker_t* worker = (fe_ring_stress_worker_t*)user_data;
+    fe_ring_stress_state_t* state = worker->state;
+    for (uint64_t i = 0; i < state->per_producer;) {
+        fe_ring_stress_msg_t msg = { worker->index, i, fe_ring_stress_check(worker->index, i) };
+        if (fe_mpmc_queue_push(&state->mpmc, &msg)) {
+            i++;
+        } else {
+            fe_atomic_cpu_relax();
+        }
+    }
+}
+
+static void fe_ring_stress_mpmc_consumer(void* user_data) {
+    fe_ring_stress_worker_t* worker = (fe_ring_stress_worker_t*)user_data;
+    fe_ring_stress_state_t* state = worker->state;
+    uint64_t total = state->per_producer * state->thread_count;
+    uint64_t next_expected[FE_RING_STRESS_MAX_THREADS];
+    memset(next_expected, 0, sizeof(next_expected));
+    uint64_t local_sum = 0;
+
+    while (fe_atomic_load_u64(&state->consumed, FE_ATOMIC_RELAXED) < total) {
+        fe_ring_stress_msg_t msg;
+        if (!fe_mpmc_queue_pop(&state->mpmc, &msg)) {
+            fe_atomic_cpu_relax();
+            continue;
+        }
+        if (msg.producer >= state->thread_count || msg.check != fe_ring_stress_check(msg.producer, msg.sequence)) {
+            fe_ring_stress_fail(state, "corrupt MPMC message", msg.producer, msg.sequence);
+        } else {
+            // Tek bir üreticinin mesajları bu tüketiciye artan sırayla gelmelidir (FIFO)
+            if (msg.sequence < next_expected[msg.producer]) {
+                fe_ring_stress_fail(state, "MPMC message out of order", msg.producer, msg.sequence);
+            }
+            next_expected[msg.producer] = msg.sequence + 1;
+            local_sum += msg.sequence;
+        }
+        fe_atomic_fetch_add_u64(&state->consumed, 1, FE_ATOMIC_RELAXED);
+    }
+    fe_atomic_fetch_add_u64(&state->sum, local_sum, FE_ATOMIC_RELAXED);
+}
+
+static bool fe_ring_stress_run_spsc(fe_ring_stress_state_t* state) {
+    if (!fe_spsc_queue_init(&state->spsc, FE_RING_STRESS_SPSC_CAPACITY, sizeof(fe_ring_stress_msg_t))) return false;
+    fe_thread_t producer;
+    if (!fe_thread_create(&producer, fe_ring_stress_spsc_producer, state, "spsc_producer")) {
+        fe_spsc_queue_shutdown(&state->spsc);
+        return false;
+    }
+    for (uint64_t i = 0; i < state->message_count;) {
+        fe_ring_stress_msg_t msg;
+        if (!fe_spsc_queue_pop(&state->spsc, &msg)) {
+            fe_atomic_cpu_relax();
+            continue;
+        }
+        if (msg.sequence != i || msg.check != fe_ring_stress_check(0, i)) {
+            fe_ring_stress_fail(state, "SPSC message out of order or corrupt", 0, msg.sequence);
+        }
+        i++;
+    }
+    fe_thread_join(&producer);
+    fe_spsc_queue_shutdown(&state->spsc);
+    return true;
+}
+
+static bool fe_ring_stress_run_mpmc(fe_ring_stress_state_t* state) {
+    if (!fe_mpmc_queue_init(&state->mpmc, FE_RING_STRESS_MPMC_CAPACITY, sizeof(fe_ring_stress_msg_t))) return false;
+    fe_thread_t producers[FE_RING_STRESS_MAX_THREADS];
+    fe_thread_t consumers[FE_RING_STRESS_MAX_THREADS];
+    fe_ring_stress_worker_t workers[FE_RING_STRESS_MAX_THREADS];
+    uint32_t started = 0;
+    bool ok = true;
+    for (uint32_t i = 0; i < state->thread_count; ++i) {
+        workers[i].state = state;
+        workers[i].index = i;
+        if (!fe_thread_create(&producers[i], fe_ring_stress_mpmc_producer, &workers[i], "mpmc_producer")) {
+            ok = false;
+            break;
+        }
+        if (!fe_thread_create(&consumers[i], fe_ring_stress_mpmc_consumer, &workers[i], "mpmc_consumer")) {
+            fe_thread_join(&producers[i]);
+            ok = false;
+            break;
+        }
+        started++;
+    }
+    if (!ok) {
+        // Başlatılamayan çiftlerin mesajları hiç üretilmez; kalan tüketicileri serbest bırak
+        fprintf(stderr, "Failed to start all MPMC threads.\n");
+        fe_atomic_store_u64(&state->consumed, UINT64_MAX / 2, FE_ATOMIC_RELAXED);
+    }
+    for (uint32_t i = 0; i < started; ++i) {
+        fe_thread_join(&producers[i]);
+        fe_thread_join(&consumers[i]);
+    }
+    fe_mpmc_queue_shutdown(&state->mpmc);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    fe_ring_stress_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.message_count = argc > 1 ? (uint64_t)strtoull(argv[1], NULL, 10) : 2000000;
+    state.thread_count = argc > 2 ? (uint32_t)atoi(argv[2]) : 4;
+    if (state.message_count == 0 || state.thread_count == 0 || state.thread_count > FE_RING_STRESS_MAX_THREADS) {
+        fprintf(stderr, "Usage: %s [message_count] [producer_consumer_pairs (1-%d)]\n", argv[0], FE_RING_STRESS_MAX_THREADS);
+        return 1;
+    }
+    state.per_producer = state.message_count / state.thread_count;
+
+    if (!fe_ring_stress_run_spsc(&state)) {
+        fprintf(stderr, "SPSC setup failed.\n");
+        return 1;
+    }
+    printf("SPSC: %llu message(s) checked.\n", (unsigned long long)state.message_count);
+
+    if (!fe_ring_stress_run_mpmc(&state)) {
+        return 1;
+    }
+    uint64_t expected_sum = state.thread_count * (state.per_producer * (state.per_producer - 1) / 2);
+    uint64_t sum = fe_atomic_load_u64(&state.sum, FE_ATOMIC_ACQUIRE);
+    if (sum != expected_sum) {
+        fe_ring_stress_fail(&state, "MPMC messages lost or duplicated", 0, 0);
+    }
+    printf("MPMC: %u producer(s) x %llu message(s) checked.\n", state.thread_count,
+           (unsigned long long)state.per_producer);
+
+    uint32_t failures = fe_atomic_load_u32(&state.failures, FE_ATOMIC_ACQUIRE);
+    printf("%s (%u failure(s))\n", failures == 0 ? "OK" : "FAILED", failures);
+    return failures == 0 ? 0 : 1;
+}
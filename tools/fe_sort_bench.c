@@ -0,0 +1,192 @@
+// fe_sort_bench: core/containers/fe_sort.h sıralamalarını qsort ile karşılaştırır ve sonuçlarını doğrular.
+//
+// Kullanım:
+//   fe_sort_bench [eleman_sayısı] [tekrar] [işçi_sayısı]
+//
+// - Varsayılanlar: 1000000 eleman, 5 tekrar, işçi sayısı (mantıksal işlemci - 1).
+// - Her tekrar aynı tohumdan üretilmiş rastgele int dizisini sıralar; en iyi ve ortanca süre yazılır.
+// - Paralel birleştirme iş sistemi (core/jobs/fe_job_system.h) başlatılarak ölçülür. İşçi
+//   sayısı 0 verilirse iş sistemi başlatılmaz ve paralel yol tek thread'de çalışır.
+// - Sonuçlar qsort çıktısıyla karşılaştırılır; eşit anahtarların sırası (kararlılık) ayrıca denetlenir.
+//
+// Derleme: src/data_structures/fe_sort.c, src/data_structures/fe_ds_types.c, src/jobs/fe_job_system.c,
+// src/utils/fe_timer.c ve bunların bağımlılıklarıyla birlikte -O2 ile derlenir.
+
+#include "core/containers/fe_sort.h"    // Ölçülen sıralamalar
+#include "core/ds/fe_ds_types.h"        // fe_ds_compare_int için
+#include "core/jobs/fe_job_system.h"    // Paralel birleştirme için
+#include "core/utils/fe_timer.h"        // fe_timer_now_ns için
+
+#include <stdio.h>  // printf için
+#include <stdlib.h> // malloc, free, qsort, atoi için
+#include <string.h> // memcpy, memcmp için
+
+#define FE_SORT_BENCH_MAX_REPEATS 64
+
+/**
+ * @brief Kararlılık denetimi için anahtarı ve özgün sırası birlikte saklanan eleman.
+ */
+typedef struct fe_sort_bench_item {
+    int32_t  key;
+    uint32_t order;
+} fe_sort_bench_item_t;
+
+typedef enum fe_sort_bench_kind {
+    FE_SORT_BENCH_QSORT = 0,
+    FE_SORT_BENCH_MERGE,
+    FE_SORT_BENCH_PARALLEL_MERGE,
+    FE_SORT_BENCH_RADIX_U32,
+    FE_SORT_BENCH_RADIX_U64,
+    FE_SORT_BENCH_COUNT
+} fe_sort_bench_kind_t;
+
+static const char* s_bench_names[FE_SORT_BENCH_COUNT] = {
+    "qsort + fe_ds_compare_int",
+    "fe_sort_merge",
+    "fe_sort_parallel_merge",
+    "fe_sort_radix_u32 + payload",
+    "fe_sort_radix_u64 + payload"
+};
+
+static int fe_sort_bench_compare_item(const void* a, const void* b) {
+    const fe_sort_bench_item_t* x = (const fe_sort_bench_item_t*)a;
+    const fe_sort_bench_item_t* y = (const fe_sort_bench_item_t*)b;
+    return (x->key > y->key) - (x->key < y->key);
+}
+
+// xorshift32: platformdan bağımsız, tekrarlanabilir girdi için
+static uint32_t fe_sort_bench_next(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static int fe_sort_bench_compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Tek bir sıralamayı bir kez çalıştırır ve süresini döndürür. Sonuç doğrulanamazsa UINT64_MAX döner.
+ */
+static uint64_t fe_sort_bench_run(fe_sort_bench_kind_t kind, const int32_t* input, const int32_t* expected, size_t count) {
+    uint64_t elapsed = UINT64_MAX;
+    bool ok = false;
+
+    if (kind == FE_SORT_BENCH_QSORT || kind == FE_SORT_BENCH_MERGE) {
+        int32_t* values = (int32_t*)malloc(count * sizeof(int32_t));
+        if (!values) return UINT64_MAX;
+        memcpy(values, input, count * sizeof(int32_t));
+        uint64_t start = fe_timer_now_ns();
+        if (kind == FE_SORT_BENCH_QSORT) {
+            qsort(values, count, sizeof(int32_t), fe_ds_compare_int);
+            ok = true;
+        } else {
+            ok = fe_sort_merge(values, count, sizeof(int32_t), fe_ds_compare_int);
+        }
+        elapsed = fe_timer_now_ns() - start;
+        ok = ok && memcmp(values, expected, count * sizeof(int32_t)) == 0;
+        free(values);
+    } else if (kind == FE_SORT_BENCH_PARALLEL_MERGE) {
+        // Kararlılığı da denetlemek için özgün sıra elemanla birlikte taşınır
+        fe_sort_bench_item_t* items = (fe_sort_bench_item_t*)malloc(count * sizeof(fe_sort_bench_item_t));
+        if (!items) return UINT64_MAX;
+        for (size_t i = 0; i < count; ++i) {
+            items[i].key = input[i];
+            items[i].order = (uint32_t)i;
+        }
+        uint64_t start = fe_timer_now_ns();
+        ok = fe_sort_parallel_merge(items, count, sizeof(fe_sort_bench_item_t), fe_sort_bench_compare_item, 0);
+        elapsed = fe_timer_now_ns() - start;
+        for (size_t i = 0; ok && i < count; ++i) {
+            if (items[i].key != expected[i]) ok = false;
+            if (i > 0 && items[i].key == items[i - 1].key && items[i].order < items[i - 1].order) ok = false;
+        }
+        free(items);
+    } else {
+        bool wide = kind == FE_SORT_BENCH_RADIX_U64;
+        void* keys = malloc(count * (wide ? sizeof(uint64_t) : sizeof(uint32_t)));
+        uint32_t* payloads = (uint32_t*)malloc(count * sizeof(uint32_t));
+        if (!keys || !payloads) {
+            free(keys);
+            free(payloads);
+            return UINT64_MAX;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (wide) {
+                ((uint64_t*)keys)[i] = fe_sort_key_from_i64(input[i]);
+            } else {
+                ((uint32_t*)keys)[i] = fe_sort_key_from_i32(input[i]);
+            }
+            payloads[i] = (uint32_t)i;
+        }
+        uint64_t start = fe_timer_now_ns();
+        ok = wide ? fe_sort_radix_u64((uint64_t*)keys, payloads, count, NULL)
+                  : fe_sort_radix_u32((uint32_t*)keys, payloads, count, NULL);
+        elapsed = fe_timer_now_ns() - start;
+        for (size_t i = 0; ok && i < count; ++i) {
+            if (input[payloads[i]] != expected[i]) ok = false;
+            if (i > 0 && input[payloads[i]] == input[payloads[i - 1]] && payloads[i] < payloads[i - 1]) ok = false;
+        }
+        free(keys);
+        free(payloads);
+    }
+    return ok ? elapsed : UINT64_MAX;
+}
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    int repeats = argc > 2 ? atoi(argv[2]) : 5;
+    int workers = argc > 3 ? atoi(argv[3]) : -1;
+    if (count == 0 || repeats <= 0 || repeats > FE_SORT_BENCH_MAX_REPEATS) {
+        fprintf(stderr, "Usage: %s [element_count] [repeats (1-%d)] [worker_count]\n", argv[0], FE_SORT_BENCH_MAX_REPEATS);
+        return 1;
+    }
+
+    int32_t* input = (int32_t*)malloc(count * sizeof(int32_t));
+    int32_t* expected = (int32_t*)malloc(count * sizeof(int32_t));
+    if (!input || !expected) {
+        fprintf(stderr, "Out of memory for %zu elements.\n", count);
+        return 1;
+    }
+    // Eşit anahtarların sık görülmesi için değer aralığı eleman sayısından küçük tutulur
+    uint32_t state = 0x9E3779B9u;
+    for (size_t i = 0; i < count; ++i) {
+        input[i] = (int32_t)(fe_sort_bench_next(&state) % (uint32_t)(count / 2 + 1)) - (int32_t)(count / 4);
+    }
+    memcpy(expected, input, count * sizeof(int32_t));
+    qsort(expected, count, sizeof(int32_t), fe_ds_compare_int);
+
+    if (workers != 0 && !fe_job_system_init(workers > 0 ? (uint32_t)workers : 0)) {
+        fprintf(stderr, "Failed to start the job system; parallel merge runs on one thread.\n");
+    }
+    printf("%zu random ints, %d repeat(s), %u job thread(s)\n", count, repeats,
+           fe_job_system_is_initialized() ? fe_job_system_worker_count() + 1 : 1);
+    printf("%-30s %10s %10s\n", "", "best ms", "median ms");
+
+    int exit_code = 0;
+    for (int kind = 0; kind < FE_SORT_BENCH_COUNT; ++kind) {
+        uint64_t times[FE_SORT_BENCH_MAX_REPEATS];
+        bool failed = false;
+        for (int r = 0; r < repeats; ++r) {
+            times[r] = fe_sort_bench_run((fe_sort_bench_kind_t)kind, input, expected, count);
+            if (times[r] == UINT64_MAX) failed = true;
+        }
+        if (failed) {
+            printf("%-30s %10s\n", s_bench_names[kind], "FAILED");
+            exit_code = 1;
+            continue;
+        }
+        qsort(times, (size_t)repeats, sizeof(uint64_t), fe_sort_bench_compare_u64);
+        printf("%-30s %10.2f %10.2f\n", s_bench_names[kind], times[0] / 1e6, times[repeats / 2] / 1e6);
+    }
+
+    if (fe_job_system_is_initialized()) fe_job_system_shutdown();
+    free(input);
+    free(expected);
+    return exit_code;
+}